@@ -35,6 +35,38 @@
     #define HANDMADE_MATH_NO_SSE
     #include "HandmadeMath.h"
 
+  When the compiler targets AVX, AVX2 or FMA (e.g. -mavx2 -mfma, -march=native,
+  or /arch:AVX2 on MSVC), some 4x4 matrix and batch operations switch to 256-bit
+  registers, and multiply-adds are fused. With AVX-512 (-mavx512f, /arch:AVX512)
+  a whole HMM_Mat4, or four quaternions, fit in one 512-bit register. Fused
+  multiply-adds round once instead of twice, so results may differ in the last
+  bit from non-FMA builds.
+
+  -----------------------------------------------------------------------------
+
+  On x86, three batch functions, HMM_MulM4V4Array, HMM_MulQArray and
+  HMM_NormQArray, can instead pick an SSE, AVX2 or AVX-512 implementation at
+  runtime, so that one binary built for baseline x86 still uses the wider
+  registers where available. Only these three are dispatched. All other array
+  and SoA functions (HMM_SLerpArray, HMM_SkinV3Array, HMM_RayTriangleSoA,
+  HMM_UnpackQ32Array, and so on) are compiled for whatever the compiler targets,
+  like the single-value functions.
+
+  To enable dispatch, define HANDMADE_MATH_RUNTIME_DISPATCH everywhere
+  HandmadeMath.h is included, and HANDMADE_MATH_IMPLEMENTATION in exactly one C
+  or C++ file:
+
+    #define HANDMADE_MATH_RUNTIME_DISPATCH
+    #define HANDMADE_MATH_IMPLEMENTATION
+    #include "HandmadeMath.h"
+
+  The best tier the CPU supports is selected with cpuid on the first dispatched
+  call. HMM_GetSIMDTier reports the selected tier, and HMM_SetSIMDTier overrides
+  it (e.g. for testing or benchmarking). The AVX2 and AVX-512 tiers use fused
+  multiply-adds, so their results may differ in the last bit from the
+  single-value functions. Without these defines, or on other platforms,
+  HMM_GetSIMDTier reports the tier chosen at compile time.
+
   -----------------------------------------------------------------------------
 
   To use Handmade Math without the C runtime library, you must provide your own
@@ -53,6 +85,45 @@
     #define HMM_SQRTF MySqrtF
     #include "HandmadeMath.h"
 
+  The double-precision functions also use HMM_SIN, HMM_COS, HMM_TAN, HMM_ACOS
+  and HMM_SQRT, which take and return radians. If you don't define them, the
+  float functions above are used instead, at float precision.
+
+  Alternatively, define HANDMADE_MATH_FAST_TRIG to use Handmade Math's own
+  polynomial approximations of sine, cosine, tangent and arccosine instead of
+  the runtime library's. They are typically several times faster, can be inlined
+  and vectorized, and work with any of the angle units above. Their error,
+  measured against double-precision results, is:
+
+    HMM_SinF, HMM_CosF   < 1 ulp for |Angle| <= pi/4,
+                         < 2 ulp for |Angle| <= 2*pi,
+                         < 1e-7 absolute for |Angle| <= 8192 radians
+    HMM_TanF             < 3 ulp for |Angle| <= 2*pi
+    HMM_ACosF            < 1.5 ulp
+
+  Larger angles are not supported. HMM_SinCosF returns both the sine and the
+  cosine of an angle from a single range reduction. The lane-wise HMM_SinV4,
+  HMM_CosV4, HMM_SinCosV4 and HMM_ACosV4, their 8-wide HMM_FloatSoA
+  counterparts, and HMM_SLerpArray, always use these approximations.
+  HANDMADE_MATH_FAST_TRIG can be combined with
+  HANDMADE_MATH_PROVIDE_MATH_FUNCTIONS, in which case only HMM_SQRTF needs to be
+  provided.
+
+  Define HANDMADE_MATH_FAST_RSQRT to compute HMM_InvSqrtF, and so HMM_NormV2,
+  HMM_NormV3, HMM_NormV4, HMM_NormQ and the other normalize functions, from the
+  hardware reciprocal square root estimate (_mm_rsqrt_ps, vrsqrteq_f32) refined
+  with Newton-Raphson, instead of a full square root and divide. Its relative
+  error is below 3e-7 (4 ulp), and the reciprocal square root of zero is NaN
+  rather than infinity. HMM_InvSqrtFastF, HMM_NormFastV3, HMM_NormFastV4 and
+  HMM_NormFastQ always use the estimate, so it can also be used only where it
+  matters. Without SSE or NEON, the exact functions are used either way.
+
+  A few functions, such as HMM_QToM4Unit, skip work by trusting their input.
+  In builds without NDEBUG they check it with HMM_ASSERT, which defaults to
+  assert(). With HANDMADE_MATH_PROVIDE_MATH_FUNCTIONS it defaults to nothing,
+  so that <assert.h> isn't needed. Define HMM_ASSERT before including this
+  file to use your own.
+
   By default, it is assumed that your math functions take radians. To use
   different units, you must define HMM_ANGLE_USER_TO_INTERNAL and
   HMM_ANGLE_INTERNAL_TO_USER. For example, if you want to use degrees in your
@@ -105,6 +176,18 @@
 # define ASSERT_COVERED(a)
 #endif
 
+/* HMM_ASSERT checks the preconditions of functions that trust their input instead of fixing it up,
+   such as HMM_QToM4Unit. It uses assert() unless NDEBUG or HANDMADE_MATH_PROVIDE_MATH_FUNCTIONS
+   (which means there may be no C runtime) is defined; define it yourself to use your own assert. */
+#ifndef HMM_ASSERT
+# if defined(NDEBUG) || defined(HANDMADE_MATH_PROVIDE_MATH_FUNCTIONS)
+#  define HMM_ASSERT(Expression)
+# else
+#  include <assert.h>
+#  define HMM_ASSERT(Expression) assert(Expression)
+# endif
+#endif
+
 #ifdef HANDMADE_MATH_NO_SSE
 # warning "HANDMADE_MATH_NO_SSE is deprecated, use HANDMADE_MATH_NO_SIMD instead"
 # define HANDMADE_MATH_NO_SIMD
@@ -126,6 +209,24 @@
 # ifdef __ARM_NEON
 #  define HANDMADE_MATH__USE_NEON 1
 # endif /* NEON Supported */
+/* SSE2, AVX, AVX2 and FMA are only used on top of SSE. MSVC has no __FMA__, but /arch:AVX2 implies FMA3 */
+# ifdef HANDMADE_MATH__USE_SSE
+#  if defined(__SSE2__) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define HANDMADE_MATH__USE_SSE2 1
+#  endif
+#  ifdef __AVX__
+#   define HANDMADE_MATH__USE_AVX 1
+#  endif
+#  ifdef __AVX2__
+#   define HANDMADE_MATH__USE_AVX2 1
+#  endif
+#  ifdef __AVX512F__
+#   define HANDMADE_MATH__USE_AVX512 1
+#  endif
+#  if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+#   define HANDMADE_MATH__USE_FMA 1
+#  endif
+# endif /* HANDMADE_MATH__USE_SSE */
 #endif /* #ifndef HANDMADE_MATH_NO_SIMD */
 
 #if (!defined(__cplusplus) && defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L)
@@ -136,6 +237,19 @@
 # include <xmmintrin.h>
 #endif
 
+#ifdef HANDMADE_MATH__USE_SSE2
+# include <emmintrin.h>
+#endif
+
+/* Runtime dispatch of the batch kernels is only supported on x86, where SSE is the baseline. */
+#if defined(HANDMADE_MATH_RUNTIME_DISPATCH) && defined(HANDMADE_MATH__USE_SSE)
+# define HANDMADE_MATH__USE_DISPATCH 1
+#endif
+
+#if defined(HANDMADE_MATH__USE_AVX) || defined(HANDMADE_MATH__USE_AVX512) || defined(HANDMADE_MATH__USE_FMA) || defined(HANDMADE_MATH__USE_DISPATCH)
+# include <immintrin.h>
+#endif
+
 #ifdef HANDMADE_MATH__USE_NEON
 # include <arm_neon.h>
 #endif
@@ -186,6 +300,7 @@ extern "C"
 #define HMM_DegToTurn ((float)(HMM_TURNHALF/HMM_DEG180))
 #define HMM_TurnToRad ((float)(HMM_PI/HMM_TURNHALF))
 #define HMM_TurnToDeg ((float)(HMM_DEG180/HMM_TURNHALF))
+#define HMM_F32_MAX 3.402823466e+38f
 
 #if defined(HANDMADE_MATH_USE_RADIANS)
 # define HMM_AngleRad(a) (a)
@@ -201,13 +316,45 @@ extern "C"
 # define HMM_AngleTurn(a) (a)
 #endif
 
+#if defined(HANDMADE_MATH_FAST_TRIG)
+# define HMM_SINF _HMM_FastSinF
+# define HMM_COSF _HMM_FastCosF
+# define HMM_TANF _HMM_FastTanF
+# define HMM_ACOSF _HMM_FastACosF
+#endif
+
 #if !defined(HANDMADE_MATH_PROVIDE_MATH_FUNCTIONS)
 # include <math.h>
-# define HMM_SINF sinf
-# define HMM_COSF cosf
-# define HMM_TANF tanf
+# if !defined(HANDMADE_MATH_FAST_TRIG)
+#  define HMM_SINF sinf
+#  define HMM_COSF cosf
+#  define HMM_TANF tanf
+#  define HMM_ACOSF acosf
+# endif
 # define HMM_SQRTF sqrtf
-# define HMM_ACOSF acosf
+# define HMM_SIN sin
+# define HMM_COS cos
+# define HMM_TAN tan
+# define HMM_ACOS acos
+# define HMM_SQRT sqrt
+#endif
+
+/* The double-precision functions take radians. If you provide your own math functions but not these,
+   the float ones are used, and angles and lengths are only accurate to float precision. */
+#if !defined(HMM_SIN)
+# define HMM_SIN(a) ((double)HMM_SINF(HMM_ANGLE_USER_TO_INTERNAL(HMM_AngleRad((float)(a)))))
+#endif
+#if !defined(HMM_COS)
+# define HMM_COS(a) ((double)HMM_COSF(HMM_ANGLE_USER_TO_INTERNAL(HMM_AngleRad((float)(a)))))
+#endif
+#if !defined(HMM_TAN)
+# define HMM_TAN(a) ((double)HMM_TANF(HMM_ANGLE_USER_TO_INTERNAL(HMM_AngleRad((float)(a)))))
+#endif
+#if !defined(HMM_ACOS)
+# define HMM_ACOS(a) ((double)HMM_ToRad(HMM_ANGLE_INTERNAL_TO_USER(HMM_ACOSF((float)(a)))))
+#endif
+#if !defined(HMM_SQRT)
+# define HMM_SQRT(a) ((double)HMM_SQRTF((float)(a)))
 #endif
 
 #if !defined(HMM_ANGLE_USER_TO_INTERNAL)
@@ -230,6 +377,21 @@ extern "C"
 #define HMM_MOD(a, m) (((a) % (m)) >= 0 ? ((a) % (m)) : (((a) % (m)) + (m)))
 #define HMM_SQUARE(x) ((x) * (x))
 
+/* Multiply-add, A * B + C. Fused (single rounding) when FMA is available. */
+#ifdef HANDMADE_MATH__USE_FMA
+# define _HMM_MADD_PS(A, B, C) _mm_fmadd_ps((A), (B), (C))
+# define _HMM_MADD256_PS(A, B, C) _mm256_fmadd_ps((A), (B), (C))
+# define _HMM_MADD512_PS(A, B, C) _mm512_fmadd_ps((A), (B), (C))
+# define _HMM_MADD_PD(A, B, C) _mm_fmadd_pd((A), (B), (C))
+# define _HMM_MADD256_PD(A, B, C) _mm256_fmadd_pd((A), (B), (C))
+#elif defined(HANDMADE_MATH__USE_SSE)
+# define _HMM_MADD_PS(A, B, C) _mm_add_ps(_mm_mul_ps((A), (B)), (C))
+# define _HMM_MADD256_PS(A, B, C) _mm256_add_ps(_mm256_mul_ps((A), (B)), (C))
+# define _HMM_MADD512_PS(A, B, C) _mm512_add_ps(_mm512_mul_ps((A), (B)), (C))
+# define _HMM_MADD_PD(A, B, C) _mm_add_pd(_mm_mul_pd((A), (B)), (C))
+# define _HMM_MADD256_PD(A, B, C) _mm256_add_pd(_mm256_mul_pd((A), (B)), (C))
+#endif
+
 typedef union HMM_Vec2
 {
     struct
@@ -375,6 +537,40 @@ typedef union HMM_Vec4
 #endif
 } HMM_Vec4;
 
+/* An HMM_Vec3 padded to 16 bytes so that it fills a SIMD register, like HMM_Vec4. The fourth lane is
+   padding: the HMM_*V3A functions ignore it and make no promises about its value. */
+typedef union HMM_Vec3A
+{
+    struct
+    {
+        union
+        {
+            HMM_Vec3 XYZ;
+            struct
+            {
+                float X, Y, Z;
+            };
+        };
+
+        float _Padding;
+    };
+
+    float Elements[3];
+
+#ifdef HANDMADE_MATH__USE_SSE
+    __m128 SSE;
+#endif
+
+#ifdef HANDMADE_MATH__USE_NEON
+    float32x4_t NEON;
+#endif
+
+#ifdef __cplusplus
+    inline float &operator[](int Index) { return Elements[Index]; }
+    inline const float &operator[](int Index) const { return Elements[Index]; }
+#endif
+} HMM_Vec3A;
+
 typedef union HMM_Mat2
 {
     float Elements[2][2];
@@ -408,6 +604,20 @@ typedef union HMM_Mat4
 #endif
 } HMM_Mat4;
 
+/* An affine transform stored as the top three rows of an HMM_Mat4; the bottom row is implicitly
+   (0, 0, 0, 1). Unlike HMM_Mat4, the elements are stored row by row, so each row fills a register and
+   the translation is the W component of each row. */
+typedef union HMM_Affine3x4
+{
+    float Elements[3][4];
+    HMM_Vec4 Rows[3];
+
+#ifdef __cplusplus
+    inline HMM_Vec4 &operator[](int Index) { return Rows[Index]; }
+    inline const HMM_Vec4 &operator[](int Index) const { return Rows[Index]; }
+#endif
+} HMM_Affine3x4;
+
 typedef union HMM_Quat
 {
     struct
@@ -434,8 +644,353 @@ typedef union HMM_Quat
 #endif
 } HMM_Quat;
 
+/* A rigid transform (rotation, then translation) as Real + Dual * epsilon, where epsilon squared is zero. */
+typedef union HMM_DualQuat
+{
+    struct
+    {
+        HMM_Quat Real;
+        HMM_Quat Dual;
+    };
+
+    float Elements[8];
+} HMM_DualQuat;
+
+/* A translation, rotation and scale, applied in the order scale, rotation, translation. The vectors are
+   padded so that each member fills a register. */
+typedef struct HMM_TRS
+{
+    HMM_Vec3A Translation;
+    HMM_Quat Rotation;
+    HMM_Vec3A Scale;
+} HMM_TRS;
+
+/*
+ * Compressed formats, for storing many rotations and vectors (see "Compressed formats" below).
+ */
+
+/* A unit quaternion in 32 bits: the index of its largest component, and the other three in 10 bits each. */
+typedef struct HMM_PackedQuat32
+{
+    unsigned int Bits;
+} HMM_PackedQuat32;
+
+/* A unit quaternion in 48 bits: the index of its largest component, and the other three in 15 bits each. */
+typedef struct HMM_PackedQuat48
+{
+    unsigned short Bits[3];
+} HMM_PackedQuat48;
+
+/* A vector of three IEEE half-precision floats. */
+typedef struct HMM_HalfVec3
+{
+    unsigned short Elements[3];
+} HMM_HalfVec3;
+
+/* A vector inside a box, with each component stored as a 16-bit fraction of the box's size. */
+typedef struct HMM_FixedVec3
+{
+    unsigned short Elements[3];
+} HMM_FixedVec3;
+
+/* A unit vector in 32 bits, as a point on an octahedron unfolded onto a square. */
+typedef struct HMM_OctVec3
+{
+    short X, Y;
+} HMM_OctVec3;
+
+/*
+ * Structure-of-arrays types. Each one holds HMM_SOA_WIDTH values of its AoS
+ * counterpart, one per lane, so that SIMD operations fill every lane.
+ */
+#define HMM_SOA_WIDTH 8
+
+typedef union HMM_FloatSoA
+{
+    float Elements[HMM_SOA_WIDTH];
+
+#ifdef HANDMADE_MATH__USE_SSE
+    __m128 SSE[HMM_SOA_WIDTH / 4];
+#endif
+
+#ifdef HANDMADE_MATH__USE_NEON
+    float32x4_t NEON[HMM_SOA_WIDTH / 4];
+#endif
+
+#ifdef __cplusplus
+    inline float &operator[](int Index) { return Elements[Index]; }
+    inline const float &operator[](int Index) const { return Elements[Index]; }
+#endif
+} HMM_FloatSoA;
+
+typedef union HMM_Vec3SoA
+{
+    struct
+    {
+        HMM_FloatSoA X, Y, Z;
+    };
+
+    HMM_FloatSoA Components[3];
+
+#ifdef __cplusplus
+    inline HMM_FloatSoA &operator[](int Index) { return Components[Index]; }
+    inline const HMM_FloatSoA &operator[](int Index) const { return Components[Index]; }
+#endif
+} HMM_Vec3SoA;
+
+typedef union HMM_Vec4SoA
+{
+    struct
+    {
+        HMM_FloatSoA X, Y, Z, W;
+    };
+
+    HMM_FloatSoA Components[4];
+
+#ifdef __cplusplus
+    inline HMM_FloatSoA &operator[](int Index) { return Components[Index]; }
+    inline const HMM_FloatSoA &operator[](int Index) const { return Components[Index]; }
+#endif
+} HMM_Vec4SoA;
+
+/* The six planes of a view frustum. Each plane is (Normal, Distance) with a unit normal pointing into the
+   frustum, so a point P is inside when Dot(Normal, P) + Distance >= 0 for every plane. */
+typedef union HMM_Frustum
+{
+    struct
+    {
+        HMM_Vec4 Left, Right, Bottom, Top, Near, Far;
+    };
+
+    HMM_Vec4 Planes[6];
+} HMM_Frustum;
+
+/* An axis-aligned bounding box. It is empty if any component of Min is greater than the same component of Max. */
+typedef union HMM_AABB
+{
+    struct
+    {
+        HMM_Vec3 Min, Max;
+    };
+
+    HMM_Vec3 Bounds[2];
+} HMM_AABB;
+
+typedef union HMM_Sphere
+{
+    struct
+    {
+        HMM_Vec3 Center;
+        float Radius;
+    };
+
+    /* (Center, Radius), for loading the whole sphere into one register */
+    HMM_Vec4 CenterRadius;
+} HMM_Sphere;
+
+/* An oriented bounding box: the points Center + Axes * P with |P.X|, |P.Y| and |P.Z| no greater than the
+   components of HalfExtents. The columns of Axes are unit length and perpendicular to each other. */
+typedef struct HMM_OBB
+{
+    HMM_Vec3 Center;
+    HMM_Vec3 HalfExtents;
+    HMM_Mat3 Axes;
+} HMM_OBB;
+
+typedef struct HMM_Ray
+{
+    HMM_Vec3 Origin;
+    HMM_Vec3 Direction;
+} HMM_Ray;
+
+/* HMM_SOA_WIDTH rays for packet tests against one box. The inverse direction is precomputed for the
+   slab test, and MaxT is the furthest distance along each ray that counts as a hit. */
+typedef struct HMM_RaySoA
+{
+    HMM_Vec3SoA Origin;
+    HMM_Vec3SoA InvDirection;
+    HMM_FloatSoA MaxT;
+} HMM_RaySoA;
+
+/* HMM_SOA_WIDTH triangles for packet tests against one ray, stored as the first vertex and the two
+   edges leaving it. */
+typedef struct HMM_TriangleSoA
+{
+    HMM_Vec3SoA Vertex0;
+    HMM_Vec3SoA Edge1;
+    HMM_Vec3SoA Edge2;
+} HMM_TriangleSoA;
+
+/*
+ * Double-precision types, for positions that need more than a float's 24 bits
+ * of mantissa, such as in large worlds. They have the same layout as their float
+ * counterparts. There is no AVX member, so that the layout and alignment don't
+ * depend on the compiler flags; the AVX paths combine the two SSE halves.
+ */
+typedef union HMM_DVec3
+{
+    struct
+    {
+        double X, Y, Z;
+    };
+
+    double Elements[3];
+
+#ifdef __cplusplus
+    inline double &operator[](int Index) { return Elements[Index]; }
+    inline const double &operator[](int Index) const { return Elements[Index]; }
+#endif
+} HMM_DVec3;
+
+typedef union HMM_DVec4
+{
+    struct
+    {
+        union
+        {
+            HMM_DVec3 XYZ;
+            struct
+            {
+                double X, Y, Z;
+            };
+        };
+
+        double W;
+    };
+
+    double Elements[4];
+
+#ifdef HANDMADE_MATH__USE_SSE2
+    __m128d SSE[2];
+#endif
+#ifdef HANDMADE_MATH__USE_NEON
+    float64x2_t NEON[2];
+#endif
+
+#ifdef __cplusplus
+    inline double &operator[](int Index) { return Elements[Index]; }
+    inline const double &operator[](int Index) const { return Elements[Index]; }
+#endif
+} HMM_DVec4;
+
+typedef union HMM_DMat4
+{
+    double Elements[4][4];
+    HMM_DVec4 Columns[4];
+
+#ifdef __cplusplus
+    inline HMM_DVec4 &operator[](int Index) { return Columns[Index]; }
+    inline const HMM_DVec4 &operator[](int Index) const { return Columns[Index]; }
+#endif
+} HMM_DMat4;
+
+typedef union HMM_DQuat
+{
+    struct
+    {
+        union
+        {
+            HMM_DVec3 XYZ;
+            struct
+            {
+                double X, Y, Z;
+            };
+        };
+
+        double W;
+    };
+
+    double Elements[4];
+
+#ifdef HANDMADE_MATH__USE_SSE2
+    __m128d SSE[2];
+#endif
+#ifdef HANDMADE_MATH__USE_NEON
+    float64x2_t NEON[2];
+#endif
+} HMM_DQuat;
+
 typedef signed int HMM_Bool;
 
+typedef enum HMM_SIMDTier
+{
+    HMM_SIMD_TIER_NONE,
+    HMM_SIMD_TIER_NEON,
+    HMM_SIMD_TIER_SSE,
+    HMM_SIMD_TIER_AVX,
+    HMM_SIMD_TIER_AVX2, /* AVX2 and FMA */
+    HMM_SIMD_TIER_AVX512
+} HMM_SIMDTier;
+
+/*
+ * SIMD tier selection
+ */
+
+#ifdef HANDMADE_MATH__USE_DISPATCH
+
+typedef struct _HMM_DispatchTable
+{
+    HMM_SIMDTier Tier;
+    void (*MulM4V4Array)(HMM_Mat4 Matrix, const HMM_Vec4 *In, int InStride, HMM_Vec4 *Out, int OutStride, int Count);
+    void (*MulQArray)(const HMM_Quat *Left, const HMM_Quat *Right, HMM_Quat *Out, int Count);
+    void (*NormQArray)(const HMM_Quat *In, HMM_Quat *Out, int Count);
+} _HMM_DispatchTable;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* NOTE: Defined by the file that includes HandmadeMath.h with HANDMADE_MATH_IMPLEMENTATION. Returns
+   the kernels of the selected tier, selecting the best one on the first call. */
+const _HMM_DispatchTable *_HMM_GetDispatch(void);
+
+// Returns the tier used by HMM_MulM4V4Array, HMM_MulQArray and HMM_NormQArray, detecting it first if none
+// of them has been called yet.
+HMM_SIMDTier HMM_GetSIMDTier(void);
+
+// Makes the dispatched batch functions use the best tier that is no higher than Tier and is supported
+// by the CPU, and returns that tier.
+HMM_SIMDTier HMM_SetSIMDTier(HMM_SIMDTier Tier);
+
+#ifdef __cplusplus
+}
+#endif
+
+#else
+
+COVERAGE(HMM_GetSIMDTier, 1)
+// Returns the instruction set the SIMD code paths were compiled for.
+static inline HMM_SIMDTier HMM_GetSIMDTier(void)
+{
+    ASSERT_COVERED(HMM_GetSIMDTier);
+
+#if defined(HANDMADE_MATH__USE_AVX512)
+    return HMM_SIMD_TIER_AVX512;
+#elif defined(HANDMADE_MATH__USE_AVX2) && defined(HANDMADE_MATH__USE_FMA)
+    return HMM_SIMD_TIER_AVX2;
+#elif defined(HANDMADE_MATH__USE_AVX)
+    return HMM_SIMD_TIER_AVX;
+#elif defined(HANDMADE_MATH__USE_SSE)
+    return HMM_SIMD_TIER_SSE;
+#elif defined(HANDMADE_MATH__USE_NEON)
+    return HMM_SIMD_TIER_NEON;
+#else
+    return HMM_SIMD_TIER_NONE;
+#endif
+}
+
+COVERAGE(HMM_SetSIMDTier, 1)
+// Without runtime dispatch the tier is fixed at compile time, so this only returns it.
+static inline HMM_SIMDTier HMM_SetSIMDTier(HMM_SIMDTier Tier)
+{
+    ASSERT_COVERED(HMM_SetSIMDTier);
+
+    (void)Tier;
+    return HMM_GetSIMDTier();
+}
+
+#endif /* HANDMADE_MATH__USE_DISPATCH */
+
 /*
  * Angle unit conversion functions
  */
@@ -482,32 +1037,397 @@ static inline float HMM_ToTurn(float Angle)
  * Floating-point math functions
  */
 
-COVERAGE(HMM_SinF, 1)
-static inline float HMM_SinF(float Angle)
+/*
+ * Polynomial approximations used by HANDMADE_MATH_FAST_TRIG and by the vector
+ * trig functions. These take and return radians. Coefficients are the
+ * single-precision minimax polynomials from Cephes.
+ *
+ * The quadrant of an angle is effectively random, so results are picked and
+ * negated with bit operations instead of branches. This also lets compilers
+ * vectorize loops that call these functions.
+ */
+
+typedef union _HMM_FloatBits
 {
-    ASSERT_COVERED(HMM_SinF);
-    return HMM_SINF(HMM_ANGLE_USER_TO_INTERNAL(Angle));
-}
+    float F;
+    unsigned int U;
+} _HMM_FloatBits;
 
-COVERAGE(HMM_CosF, 1)
-static inline float HMM_CosF(float Angle)
+// Returns IfSet where Mask is all ones and IfClear where it is all zeros.
+static inline float _HMM_SelectF(unsigned int Mask, float IfSet, float IfClear)
 {
-    ASSERT_COVERED(HMM_CosF);
-    return HMM_COSF(HMM_ANGLE_USER_TO_INTERNAL(Angle));
+    _HMM_FloatBits Set, Clear, Result;
+    Set.F = IfSet;
+    Clear.F = IfClear;
+    Result.U = (Set.U & Mask) | (Clear.U & ~Mask);
+    return Result.F;
 }
 
-COVERAGE(HMM_TanF, 1)
-static inline float HMM_TanF(float Angle)
+// Flips the sign of Float if Bit (0 or 1) is set.
+static inline float _HMM_FlipSignF(float Float, unsigned int Bit)
 {
-    ASSERT_COVERED(HMM_TanF);
-    return HMM_TANF(HMM_ANGLE_USER_TO_INTERNAL(Angle));
+    _HMM_FloatBits Result;
+    Result.F = Float;
+    Result.U ^= Bit << 31;
+    return Result.F;
 }
 
-COVERAGE(HMM_ACosF, 1)
-static inline float HMM_ACosF(float Arg)
+/* Reduces Angle to [-pi/4, pi/4], with Angle = Result + Quadrant * pi/2. pi/2
+   is split in three parts (Cody-Waite) so the products are exact for |Angle|
+   up to 8192. */
+static inline float _HMM_ReduceAngleF(float Angle, int *Quadrant)
 {
-    ASSERT_COVERED(HMM_ACosF);
-    return HMM_ANGLE_INTERNAL_TO_USER(HMM_ACOSF(Arg));
+    _HMM_FloatBits Bits;
+    Bits.F = Angle;
+
+    /* Round to nearest, away from zero */
+    *Quadrant = (int)(Angle * (float)(2.0 / HMM_PI) + (0.5f - (float)(Bits.U >> 31)));
+
+    float QuadrantF = (float)*Quadrant;
+    return ((Angle - QuadrantF * 1.5703125f)
+                   - QuadrantF * 4.837512969970703125e-4f)
+                   - QuadrantF * 7.54978995489188216e-8f;
+}
+
+// Sine and cosine of Angle in X and Y, from one range reduction.
+static inline HMM_Vec2 _HMM_FastSinCosF(float Angle)
+{
+    HMM_Vec2 Result;
+
+    int Quadrant;
+    float X = _HMM_ReduceAngleF(Angle, &Quadrant);
+    float X2 = X * X;
+
+    float Sin = X + X * X2 * (-1.6666654611e-1f + X2 * (8.3321608736e-3f + X2 * -1.9515295891e-4f));
+
+    /* 1 - X2/2 loses the low bits of X2/2, so add them back in with the rest of the polynomial */
+    float HalfX2 = 0.5f * X2;
+    float CosHead = 1.0f - HalfX2;
+    float Cos = CosHead + (((1.0f - CosHead) - HalfX2) + X2 * X2 * (4.166664568298827e-2f + X2 * (-1.388731625493765e-3f + X2 * 2.443315711809948e-5f)));
+
+    /* sin(X + pi/2) = cos(X), cos(X + pi/2) = -sin(X) */
+    unsigned int Swap = 0u - (unsigned int)(Quadrant & 1);
+    Result.X = _HMM_FlipSignF(_HMM_SelectF(Swap, Cos, Sin), ((unsigned int)Quadrant >> 1) & 1);
+    Result.Y = _HMM_FlipSignF(_HMM_SelectF(Swap, Sin, Cos), ((unsigned int)(Quadrant + 1) >> 1) & 1);
+
+    return Result;
+}
+
+static inline float _HMM_FastSinF(float Angle)
+{
+    return _HMM_FastSinCosF(Angle).X;
+}
+
+static inline float _HMM_FastCosF(float Angle)
+{
+    return _HMM_FastSinCosF(Angle).Y;
+}
+
+static inline float _HMM_FastTanF(float Angle)
+{
+    int Quadrant;
+    float X = _HMM_ReduceAngleF(Angle, &Quadrant);
+    float X2 = X * X;
+
+    float Tan = X + X * X2 * (((((9.38540185543e-3f * X2 + 3.11992232697e-3f) * X2 + 2.44301354525e-2f) * X2 + 5.34112807005e-2f) * X2 + 1.33387994085e-1f) * X2 + 3.33331568548e-1f);
+
+    /* tan(X + pi/2) = -1 / tan(X) */
+    return _HMM_SelectF(0u - (unsigned int)(Quadrant & 1), -1.0f / Tan, Tan);
+}
+
+static inline float _HMM_FastACosF(float Arg)
+{
+    /* acos(x) = pi/2 - asin(x), and for |x| > 0.5, asin(|x|) = pi/2 - 2 * asin(sqrt((1 - |x|) / 2)) */
+    float Abs = HMM_ABS(Arg);
+    int Large = Abs > 0.5f;
+    float Z = Large ? 0.5f * (1.0f - Abs) : Abs * Abs;
+
+    /* The square root is cheaper to always take than to branch around. Use the
+       instruction directly where possible, since sqrtf has to check for
+       negative inputs to set errno. */
+#ifdef HANDMADE_MATH__USE_SSE
+    float Sqrt = _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(Z)));
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float Sqrt = vgetq_lane_f32(vsqrtq_f32(vdupq_n_f32(Z)), 0);
+#else
+    float Sqrt = HMM_SQRTF(Z);
+#endif
+    float X = Large ? Sqrt : Abs;
+
+    float ASin = X + X * Z * ((((4.2163199048e-2f * Z + 2.4181311049e-2f) * Z + 4.5470025998e-2f) * Z + 7.4953002686e-2f) * Z + 1.6666752422e-1f);
+
+    float Result;
+    if (Large)
+    {
+        Result = (Arg < 0.0f) ? HMM_PI32 - 2.0f * ASin : 2.0f * ASin;
+    }
+    else
+    {
+        Result = (Arg < 0.0f) ? (HMM_PI32 / 2.0f) + ASin : (HMM_PI32 / 2.0f) - ASin;
+    }
+
+    return Result;
+}
+
+/*
+ * Four- and eight-wide versions of the approximations above. With the same
+ * operation order, each lane rounds exactly like the scalar code unless FMA
+ * is available.
+ */
+
+#ifdef HANDMADE_MATH__USE_SSE2
+static inline void _HMM_SinCosPS(__m128 Angle, __m128 *Sin, __m128 *Cos)
+{
+    /* See _HMM_ReduceAngleF */
+    __m128 Half = _mm_or_ps(_mm_and_ps(Angle, _mm_set1_ps(-0.0f)), _mm_set1_ps(0.5f));
+    __m128i Quadrant = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(Angle, _mm_set1_ps((float)(2.0 / HMM_PI))), Half));
+    __m128 QuadrantF = _mm_cvtepi32_ps(Quadrant);
+    __m128 X = _mm_sub_ps(Angle, _mm_mul_ps(QuadrantF, _mm_set1_ps(1.5703125f)));
+    X = _mm_sub_ps(X, _mm_mul_ps(QuadrantF, _mm_set1_ps(4.837512969970703125e-4f)));
+    X = _mm_sub_ps(X, _mm_mul_ps(QuadrantF, _mm_set1_ps(7.54978995489188216e-8f)));
+    __m128 X2 = _mm_mul_ps(X, X);
+
+    __m128 SinPoly = _HMM_MADD_PS(X2, _mm_set1_ps(-1.9515295891e-4f), _mm_set1_ps(8.3321608736e-3f));
+    SinPoly = _HMM_MADD_PS(X2, SinPoly, _mm_set1_ps(-1.6666654611e-1f));
+    __m128 SinX = _HMM_MADD_PS(_mm_mul_ps(X, X2), SinPoly, X);
+
+    __m128 One = _mm_set1_ps(1.0f);
+    __m128 CosPoly = _HMM_MADD_PS(X2, _mm_set1_ps(2.443315711809948e-5f), _mm_set1_ps(-1.388731625493765e-3f));
+    CosPoly = _HMM_MADD_PS(X2, CosPoly, _mm_set1_ps(4.166664568298827e-2f));
+    __m128 HalfX2 = _mm_mul_ps(_mm_set1_ps(0.5f), X2);
+    __m128 CosHead = _mm_sub_ps(One, HalfX2);
+    __m128 CosX = _mm_add_ps(CosHead, _HMM_MADD_PS(_mm_mul_ps(X2, X2), CosPoly, _mm_sub_ps(_mm_sub_ps(One, CosHead), HalfX2)));
+
+    __m128i OneI = _mm_set1_epi32(1);
+    __m128i TwoI = _mm_set1_epi32(2);
+    __m128 Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(Quadrant, OneI), OneI));
+    __m128 SinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(Quadrant, TwoI), 30));
+    __m128 CosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(Quadrant, OneI), TwoI), 30));
+    *Sin = _mm_xor_ps(_mm_or_ps(_mm_and_ps(Swap, CosX), _mm_andnot_ps(Swap, SinX)), SinSign);
+    *Cos = _mm_xor_ps(_mm_or_ps(_mm_and_ps(Swap, SinX), _mm_andnot_ps(Swap, CosX)), CosSign);
+}
+
+static inline __m128 _HMM_ACosPS(__m128 Arg)
+{
+    __m128 Abs = _mm_andnot_ps(_mm_set1_ps(-0.0f), Arg);
+    __m128 Negative = _mm_cmplt_ps(Arg, _mm_setzero_ps());
+    __m128 Large = _mm_cmpgt_ps(Abs, _mm_set1_ps(0.5f));
+    __m128 LargeZ = _mm_mul_ps(_mm_set1_ps(0.5f), _mm_sub_ps(_mm_set1_ps(1.0f), Abs));
+    __m128 Z = _mm_or_ps(_mm_and_ps(Large, LargeZ), _mm_andnot_ps(Large, _mm_mul_ps(Abs, Abs)));
+    __m128 X = _mm_or_ps(_mm_and_ps(Large, _mm_sqrt_ps(Z)), _mm_andnot_ps(Large, Abs));
+
+    __m128 Poly = _HMM_MADD_PS(_mm_set1_ps(4.2163199048e-2f), Z, _mm_set1_ps(2.4181311049e-2f));
+    Poly = _HMM_MADD_PS(Poly, Z, _mm_set1_ps(4.5470025998e-2f));
+    Poly = _HMM_MADD_PS(Poly, Z, _mm_set1_ps(7.4953002686e-2f));
+    Poly = _HMM_MADD_PS(Poly, Z, _mm_set1_ps(1.6666752422e-1f));
+    __m128 ASin = _HMM_MADD_PS(_mm_mul_ps(X, Z), Poly, X);
+
+    /* Negating ASin folds both signs of Arg into one expression per branch of _HMM_FastACosF */
+    ASin = _mm_xor_ps(ASin, _mm_and_ps(Negative, _mm_set1_ps(-0.0f)));
+    __m128 LargeResult = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.0f), ASin), _mm_and_ps(Negative, _mm_set1_ps(HMM_PI32)));
+    __m128 SmallResult = _mm_sub_ps(_mm_set1_ps(HMM_PI32 / 2.0f), ASin);
+    return _mm_or_ps(_mm_and_ps(Large, LargeResult), _mm_andnot_ps(Large, SmallResult));
+}
+#endif
+
+#ifdef HANDMADE_MATH__USE_AVX2
+static inline void _HMM_SinCos256PS(__m256 Angle, __m256 *Sin, __m256 *Cos)
+{
+    __m256 Half = _mm256_or_ps(_mm256_and_ps(Angle, _mm256_set1_ps(-0.0f)), _mm256_set1_ps(0.5f));
+    __m256i Quadrant = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(Angle, _mm256_set1_ps((float)(2.0 / HMM_PI))), Half));
+    __m256 QuadrantF = _mm256_cvtepi32_ps(Quadrant);
+    __m256 X = _mm256_sub_ps(Angle, _mm256_mul_ps(QuadrantF, _mm256_set1_ps(1.5703125f)));
+    X = _mm256_sub_ps(X, _mm256_mul_ps(QuadrantF, _mm256_set1_ps(4.837512969970703125e-4f)));
+    X = _mm256_sub_ps(X, _mm256_mul_ps(QuadrantF, _mm256_set1_ps(7.54978995489188216e-8f)));
+    __m256 X2 = _mm256_mul_ps(X, X);
+
+    __m256 SinPoly = _HMM_MADD256_PS(X2, _mm256_set1_ps(-1.9515295891e-4f), _mm256_set1_ps(8.3321608736e-3f));
+    SinPoly = _HMM_MADD256_PS(X2, SinPoly, _mm256_set1_ps(-1.6666654611e-1f));
+    __m256 SinX = _HMM_MADD256_PS(_mm256_mul_ps(X, X2), SinPoly, X);
+
+    __m256 One = _mm256_set1_ps(1.0f);
+    __m256 CosPoly = _HMM_MADD256_PS(X2, _mm256_set1_ps(2.443315711809948e-5f), _mm256_set1_ps(-1.388731625493765e-3f));
+    CosPoly = _HMM_MADD256_PS(X2, CosPoly, _mm256_set1_ps(4.166664568298827e-2f));
+    __m256 HalfX2 = _mm256_mul_ps(_mm256_set1_ps(0.5f), X2);
+    __m256 CosHead = _mm256_sub_ps(One, HalfX2);
+    __m256 CosX = _mm256_add_ps(CosHead, _HMM_MADD256_PS(_mm256_mul_ps(X2, X2), CosPoly, _mm256_sub_ps(_mm256_sub_ps(One, CosHead), HalfX2)));
+
+    __m256i OneI = _mm256_set1_epi32(1);
+    __m256i TwoI = _mm256_set1_epi32(2);
+    __m256 Swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(Quadrant, OneI), OneI));
+    __m256 SinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(Quadrant, TwoI), 30));
+    __m256 CosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(Quadrant, OneI), TwoI), 30));
+    *Sin = _mm256_xor_ps(_mm256_blendv_ps(SinX, CosX, Swap), SinSign);
+    *Cos = _mm256_xor_ps(_mm256_blendv_ps(CosX, SinX, Swap), CosSign);
+}
+
+static inline __m256 _HMM_ACos256PS(__m256 Arg)
+{
+    __m256 Abs = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), Arg);
+    __m256 Negative = _mm256_cmp_ps(Arg, _mm256_setzero_ps(), _CMP_LT_OQ);
+    __m256 Large = _mm256_cmp_ps(Abs, _mm256_set1_ps(0.5f), _CMP_GT_OQ);
+    __m256 LargeZ = _mm256_mul_ps(_mm256_set1_ps(0.5f), _mm256_sub_ps(_mm256_set1_ps(1.0f), Abs));
+    __m256 Z = _mm256_blendv_ps(_mm256_mul_ps(Abs, Abs), LargeZ, Large);
+    __m256 X = _mm256_blendv_ps(Abs, _mm256_sqrt_ps(Z), Large);
+
+    __m256 Poly = _HMM_MADD256_PS(_mm256_set1_ps(4.2163199048e-2f), Z, _mm256_set1_ps(2.4181311049e-2f));
+    Poly = _HMM_MADD256_PS(Poly, Z, _mm256_set1_ps(4.5470025998e-2f));
+    Poly = _HMM_MADD256_PS(Poly, Z, _mm256_set1_ps(7.4953002686e-2f));
+    Poly = _HMM_MADD256_PS(Poly, Z, _mm256_set1_ps(1.6666752422e-1f));
+    __m256 ASin = _HMM_MADD256_PS(_mm256_mul_ps(X, Z), Poly, X);
+
+    ASin = _mm256_xor_ps(ASin, _mm256_and_ps(Negative, _mm256_set1_ps(-0.0f)));
+    __m256 LargeResult = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), ASin), _mm256_and_ps(Negative, _mm256_set1_ps(HMM_PI32)));
+    __m256 SmallResult = _mm256_sub_ps(_mm256_set1_ps(HMM_PI32 / 2.0f), ASin);
+    return _mm256_blendv_ps(SmallResult, LargeResult, Large);
+}
+#endif
+
+#ifdef HANDMADE_MATH__USE_NEON
+static inline void _HMM_SinCosNEON(float32x4_t Angle, float32x4_t *Sin, float32x4_t *Cos)
+{
+    uint32x4_t SignBit = vdupq_n_u32(0x80000000u);
+    float32x4_t Half = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(vreinterpretq_u32_f32(Angle), SignBit), vreinterpretq_u32_f32(vdupq_n_f32(0.5f))));
+    int32x4_t Quadrant = vcvtq_s32_f32(vaddq_f32(vmulq_n_f32(Angle, (float)(2.0 / HMM_PI)), Half));
+    float32x4_t QuadrantF = vcvtq_f32_s32(Quadrant);
+    float32x4_t X = vsubq_f32(Angle, vmulq_n_f32(QuadrantF, 1.5703125f));
+    X = vsubq_f32(X, vmulq_n_f32(QuadrantF, 4.837512969970703125e-4f));
+    X = vsubq_f32(X, vmulq_n_f32(QuadrantF, 7.54978995489188216e-8f));
+    float32x4_t X2 = vmulq_f32(X, X);
+
+    float32x4_t SinPoly = vaddq_f32(vmulq_n_f32(X2, -1.9515295891e-4f), vdupq_n_f32(8.3321608736e-3f));
+    SinPoly = vaddq_f32(vmulq_f32(X2, SinPoly), vdupq_n_f32(-1.6666654611e-1f));
+    float32x4_t SinX = vaddq_f32(vmulq_f32(vmulq_f32(X, X2), SinPoly), X);
+
+    float32x4_t One = vdupq_n_f32(1.0f);
+    float32x4_t CosPoly = vaddq_f32(vmulq_n_f32(X2, 2.443315711809948e-5f), vdupq_n_f32(-1.388731625493765e-3f));
+    CosPoly = vaddq_f32(vmulq_f32(X2, CosPoly), vdupq_n_f32(4.166664568298827e-2f));
+    float32x4_t HalfX2 = vmulq_n_f32(X2, 0.5f);
+    float32x4_t CosHead = vsubq_f32(One, HalfX2);
+    float32x4_t CosX = vaddq_f32(CosHead, vaddq_f32(vmulq_f32(vmulq_f32(X2, X2), CosPoly), vsubq_f32(vsubq_f32(One, CosHead), HalfX2)));
+
+    uint32x4_t Swap = vtstq_s32(Quadrant, vdupq_n_s32(1));
+    uint32x4_t SinSign = vshlq_n_u32(vandq_u32(vreinterpretq_u32_s32(Quadrant), vdupq_n_u32(2)), 30);
+    uint32x4_t CosSign = vshlq_n_u32(vandq_u32(vreinterpretq_u32_s32(vaddq_s32(Quadrant, vdupq_n_s32(1))), vdupq_n_u32(2)), 30);
+    *Sin = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(Swap, CosX, SinX)), SinSign));
+    *Cos = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(Swap, SinX, CosX)), CosSign));
+}
+
+static inline float32x4_t _HMM_ACosNEON(float32x4_t Arg)
+{
+    float32x4_t Abs = vabsq_f32(Arg);
+    uint32x4_t Negative = vcltq_f32(Arg, vdupq_n_f32(0.0f));
+    uint32x4_t Large = vcgtq_f32(Abs, vdupq_n_f32(0.5f));
+    float32x4_t LargeZ = vmulq_n_f32(vsubq_f32(vdupq_n_f32(1.0f), Abs), 0.5f);
+    float32x4_t Z = vbslq_f32(Large, LargeZ, vmulq_f32(Abs, Abs));
+    float32x4_t X = vbslq_f32(Large, vsqrtq_f32(Z), Abs);
+
+    float32x4_t Poly = vaddq_f32(vmulq_n_f32(Z, 4.2163199048e-2f), vdupq_n_f32(2.4181311049e-2f));
+    Poly = vaddq_f32(vmulq_f32(Poly, Z), vdupq_n_f32(4.5470025998e-2f));
+    Poly = vaddq_f32(vmulq_f32(Poly, Z), vdupq_n_f32(7.4953002686e-2f));
+    Poly = vaddq_f32(vmulq_f32(Poly, Z), vdupq_n_f32(1.6666752422e-1f));
+    float32x4_t ASin = vaddq_f32(vmulq_f32(vmulq_f32(X, Z), Poly), X);
+
+    ASin = vbslq_f32(Negative, vnegq_f32(ASin), ASin);
+    float32x4_t LargeResult = vaddq_f32(vmulq_n_f32(ASin, 2.0f), vreinterpretq_f32_u32(vandq_u32(Negative, vreinterpretq_u32_f32(vdupq_n_f32(HMM_PI32)))));
+    float32x4_t SmallResult = vsubq_f32(vdupq_n_f32(HMM_PI32 / 2.0f), ASin);
+    return vbslq_f32(Large, LargeResult, SmallResult);
+}
+#endif
+
+/*
+ * Reciprocal square root approximations used by HANDMADE_MATH_FAST_RSQRT and
+ * the HMM_NormFast functions. The hardware estimate is refined with Newton-Raphson
+ * steps, y' = y*(1.5 - 0.5*x*y*y), each of which roughly doubles its number of
+ * correct bits. An input of zero gives NaN instead of infinity.
+ */
+
+#ifdef HANDMADE_MATH__USE_SSE
+static inline __m128 _HMM_RSqrtPS(__m128 Float)
+{
+    __m128 Estimate = _mm_rsqrt_ps(Float);
+    __m128 HalfFloat = _mm_mul_ps(Float, _mm_set1_ps(0.5f));
+    __m128 Step = _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(HalfFloat, Estimate), Estimate));
+    return _mm_mul_ps(Estimate, Step);
+}
+#endif
+
+#ifdef HANDMADE_MATH__USE_AVX
+static inline __m256 _HMM_RSqrt256PS(__m256 Float)
+{
+    __m256 Estimate = _mm256_rsqrt_ps(Float);
+    __m256 HalfFloat = _mm256_mul_ps(Float, _mm256_set1_ps(0.5f));
+    __m256 Step = _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(_mm256_mul_ps(HalfFloat, Estimate), Estimate));
+    return _mm256_mul_ps(Estimate, Step);
+}
+#endif
+
+#ifdef HANDMADE_MATH__USE_AVX512
+/* NOTE: _mm512_rsqrt14_ps is more accurate than _mm_rsqrt_ps, so these results may differ from it in the last bit. */
+static inline __m512 _HMM_RSqrt512PS(__m512 Float)
+{
+    __m512 Estimate = _mm512_rsqrt14_ps(Float);
+    __m512 HalfFloat = _mm512_mul_ps(Float, _mm512_set1_ps(0.5f));
+    __m512 Step = _mm512_sub_ps(_mm512_set1_ps(1.5f), _mm512_mul_ps(_mm512_mul_ps(HalfFloat, Estimate), Estimate));
+    return _mm512_mul_ps(Estimate, Step);
+}
+#endif
+
+#ifdef HANDMADE_MATH__USE_NEON
+/* NOTE: vrsqrteq_f32 is only good to about 8 bits, so it takes two steps to get as close as one does on SSE. */
+static inline float32x4_t _HMM_RSqrtNEON(float32x4_t Float)
+{
+    float32x4_t Estimate = vrsqrteq_f32(Float);
+    Estimate = vmulq_f32(Estimate, vrsqrtsq_f32(vmulq_f32(Float, Estimate), Estimate));
+    Estimate = vmulq_f32(Estimate, vrsqrtsq_f32(vmulq_f32(Float, Estimate), Estimate));
+    return Estimate;
+}
+#endif
+
+COVERAGE(HMM_SinF, 1)
+static inline float HMM_SinF(float Angle)
+{
+    ASSERT_COVERED(HMM_SinF);
+    return HMM_SINF(HMM_ANGLE_USER_TO_INTERNAL(Angle));
+}
+
+COVERAGE(HMM_CosF, 1)
+static inline float HMM_CosF(float Angle)
+{
+    ASSERT_COVERED(HMM_CosF);
+    return HMM_COSF(HMM_ANGLE_USER_TO_INTERNAL(Angle));
+}
+
+COVERAGE(HMM_TanF, 1)
+static inline float HMM_TanF(float Angle)
+{
+    ASSERT_COVERED(HMM_TanF);
+    return HMM_TANF(HMM_ANGLE_USER_TO_INTERNAL(Angle));
+}
+
+// Sine and cosine of Angle in X and Y. With HANDMADE_MATH_FAST_TRIG, both come from one range reduction.
+COVERAGE(HMM_SinCosF, 1)
+static inline HMM_Vec2 HMM_SinCosF(float Angle)
+{
+    ASSERT_COVERED(HMM_SinCosF);
+
+    HMM_Vec2 Result;
+
+#ifdef HANDMADE_MATH_FAST_TRIG
+    Result = _HMM_FastSinCosF(HMM_ANGLE_USER_TO_INTERNAL(Angle));
+#else
+    Result.X = HMM_SINF(HMM_ANGLE_USER_TO_INTERNAL(Angle));
+    Result.Y = HMM_COSF(HMM_ANGLE_USER_TO_INTERNAL(Angle));
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_ACosF, 1)
+static inline float HMM_ACosF(float Arg)
+{
+    ASSERT_COVERED(HMM_ACosF);
+    return HMM_ANGLE_INTERNAL_TO_USER(HMM_ACOSF(Arg));
 }
 
 COVERAGE(HMM_SqrtF, 1)
@@ -532,6 +1452,26 @@ static inline float HMM_SqrtF(float Float)
     return Result;
 }
 
+// Approximate 1/sqrt(Float) from the hardware estimate. See HANDMADE_MATH_FAST_RSQRT at the top of this file.
+COVERAGE(HMM_InvSqrtFastF, 1)
+static inline float HMM_InvSqrtFastF(float Float)
+{
+    ASSERT_COVERED(HMM_InvSqrtFastF);
+
+    float Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    float Estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(Float)));
+    Result = Estimate * (1.5f - 0.5f*Float*Estimate*Estimate);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result = vgetq_lane_f32(_HMM_RSqrtNEON(vdupq_n_f32(Float)), 0);
+#else
+    Result = 1.0f/HMM_SqrtF(Float);
+#endif
+
+    return Result;
+}
+
 COVERAGE(HMM_InvSqrtF, 1)
 static inline float HMM_InvSqrtF(float Float)
 {
@@ -539,7 +1479,125 @@ static inline float HMM_InvSqrtF(float Float)
 
     float Result;
 
+#ifdef HANDMADE_MATH_FAST_RSQRT
+    Result = HMM_InvSqrtFastF(Float);
+#else
     Result = 1.0f/HMM_SqrtF(Float);
+#endif
+
+    return Result;
+}
+
+/*
+ * Vector math functions
+ *
+ * Lane-wise versions of the functions above. The trig functions always use the
+ * HANDMADE_MATH_FAST_TRIG approximations (see the top of this file for their
+ * accuracy), whether or not it is defined, so that they can be vectorized.
+ */
+
+COVERAGE(HMM_SinCosV4, 1)
+static inline void HMM_SinCosV4(HMM_Vec4 Angle, HMM_Vec4 *Sin, HMM_Vec4 *Cos)
+{
+    ASSERT_COVERED(HMM_SinCosV4);
+
+#ifdef HANDMADE_MATH__USE_SSE2
+    _HMM_SinCosPS(_mm_mul_ps(Angle.SSE, _mm_set1_ps(HMM_ToRad(1.0f))), &Sin->SSE, &Cos->SSE);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    _HMM_SinCosNEON(vmulq_n_f32(Angle.NEON, HMM_ToRad(1.0f)), &Sin->NEON, &Cos->NEON);
+#else
+    for (int Lane = 0; Lane < 4; ++Lane)
+    {
+        HMM_Vec2 SinCos = _HMM_FastSinCosF(Angle.Elements[Lane] * HMM_ToRad(1.0f));
+        Sin->Elements[Lane] = SinCos.X;
+        Cos->Elements[Lane] = SinCos.Y;
+    }
+#endif
+}
+
+COVERAGE(HMM_SinV4, 1)
+static inline HMM_Vec4 HMM_SinV4(HMM_Vec4 Angle)
+{
+    ASSERT_COVERED(HMM_SinV4);
+
+    HMM_Vec4 Sin, Cos;
+    HMM_SinCosV4(Angle, &Sin, &Cos);
+    return Sin;
+}
+
+COVERAGE(HMM_CosV4, 1)
+static inline HMM_Vec4 HMM_CosV4(HMM_Vec4 Angle)
+{
+    ASSERT_COVERED(HMM_CosV4);
+
+    HMM_Vec4 Sin, Cos;
+    HMM_SinCosV4(Angle, &Sin, &Cos);
+    return Cos;
+}
+
+COVERAGE(HMM_ACosV4, 1)
+static inline HMM_Vec4 HMM_ACosV4(HMM_Vec4 Arg)
+{
+    ASSERT_COVERED(HMM_ACosV4);
+
+    HMM_Vec4 Result;
+
+#ifdef HANDMADE_MATH__USE_SSE2
+    Result.SSE = _mm_mul_ps(_HMM_ACosPS(Arg.SSE), _mm_set1_ps(HMM_AngleRad(1.0f)));
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vmulq_n_f32(_HMM_ACosNEON(Arg.NEON), HMM_AngleRad(1.0f));
+#else
+    for (int Lane = 0; Lane < 4; ++Lane)
+    {
+        Result.Elements[Lane] = _HMM_FastACosF(Arg.Elements[Lane]) * HMM_AngleRad(1.0f);
+    }
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_SqrtV4, 1)
+static inline HMM_Vec4 HMM_SqrtV4(HMM_Vec4 A)
+{
+    ASSERT_COVERED(HMM_SqrtV4);
+
+    HMM_Vec4 Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _mm_sqrt_ps(A.SSE);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vsqrtq_f32(A.NEON);
+#else
+    for (int Lane = 0; Lane < 4; ++Lane)
+    {
+        Result.Elements[Lane] = HMM_SqrtF(A.Elements[Lane]);
+    }
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_RSqrtV4, 1)
+static inline HMM_Vec4 HMM_RSqrtV4(HMM_Vec4 A)
+{
+    ASSERT_COVERED(HMM_RSqrtV4);
+
+    HMM_Vec4 Result;
+
+#if defined(HANDMADE_MATH__USE_SSE) && defined(HANDMADE_MATH_FAST_RSQRT)
+    Result.SSE = _HMM_RSqrtPS(A.SSE);
+#elif defined(HANDMADE_MATH__USE_SSE)
+    Result.SSE = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(A.SSE));
+#elif defined(HANDMADE_MATH__USE_NEON) && defined(HANDMADE_MATH_FAST_RSQRT)
+    Result.NEON = _HMM_RSqrtNEON(A.NEON);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(A.NEON));
+#else
+    for (int Lane = 0; Lane < 4; ++Lane)
+    {
+        Result.Elements[Lane] = HMM_InvSqrtF(A.Elements[Lane]);
+    }
+#endif
 
     return Result;
 }
@@ -979,9 +2037,13 @@ static inline float HMM_DotV4(HMM_Vec4 Left, HMM_Vec4 Right)
     // Or a r = _mm_mul_ps(v1, v2), r = _mm_hadd_ps(r, r), r = _mm_hadd_ps(r, r) for SSE3
 #ifdef HANDMADE_MATH__USE_SSE
     __m128 SSEResultOne = _mm_mul_ps(Left.SSE, Right.SSE);
-    __m128 SSEResultTwo = _mm_shuffle_ps(SSEResultOne, SSEResultOne, _MM_SHUFFLE(2, 3, 0, 1));
-    SSEResultOne = _mm_add_ps(SSEResultOne, SSEResultTwo);
-    SSEResultTwo = _mm_shuffle_ps(SSEResultOne, SSEResultOne, _MM_SHUFFLE(0, 1, 2, 3));
+#ifdef HANDMADE_MATH__USE_FMA
+    /* NOTE: Fuse the neighbouring products in directly instead of shuffling the products. */
+    SSEResultOne = _mm_fmadd_ps(_mm_shuffle_ps(Left.SSE, Left.SSE, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(Right.SSE, Right.SSE, _MM_SHUFFLE(2, 3, 0, 1)), SSEResultOne);
+#else
+    SSEResultOne = _mm_add_ps(SSEResultOne, _mm_shuffle_ps(SSEResultOne, SSEResultOne, _MM_SHUFFLE(2, 3, 0, 1)));
+#endif
+    __m128 SSEResultTwo = _mm_shuffle_ps(SSEResultOne, SSEResultOne, _MM_SHUFFLE(0, 1, 2, 3));
     SSEResultOne = _mm_add_ps(SSEResultOne, SSEResultTwo);
     _mm_store_ss(&Result, SSEResultOne);
 #elif defined(HANDMADE_MATH__USE_NEON)
@@ -1077,6 +2139,45 @@ static inline HMM_Vec4 HMM_NormV4(HMM_Vec4 A)
     return HMM_MulV4F(A, HMM_InvSqrtF(HMM_DotV4(A, A)));
 }
 
+// Like HMM_NormV3, but always uses the approximate HMM_InvSqrtFastF.
+COVERAGE(HMM_NormFastV3, 1)
+static inline HMM_Vec3 HMM_NormFastV3(HMM_Vec3 A)
+{
+    ASSERT_COVERED(HMM_NormFastV3);
+    return HMM_MulV3F(A, HMM_InvSqrtFastF(HMM_DotV3(A, A)));
+}
+
+// Like HMM_NormV4, but always uses the approximate HMM_InvSqrtFastF. The length never leaves the SIMD register.
+COVERAGE(HMM_NormFastV4, 1)
+static inline HMM_Vec4 HMM_NormFastV4(HMM_Vec4 A)
+{
+    ASSERT_COVERED(HMM_NormFastV4);
+
+    HMM_Vec4 Result;
+
+    /* NOTE: Same sums as HMM_DotV4, which leave the dot product in every lane. */
+#ifdef HANDMADE_MATH__USE_SSE
+    __m128 Dot = _mm_mul_ps(A.SSE, A.SSE);
+#ifdef HANDMADE_MATH__USE_FMA
+    __m128 Swapped = _mm_shuffle_ps(A.SSE, A.SSE, _MM_SHUFFLE(2, 3, 0, 1));
+    Dot = _mm_fmadd_ps(Swapped, Swapped, Dot);
+#else
+    Dot = _mm_add_ps(Dot, _mm_shuffle_ps(Dot, Dot, _MM_SHUFFLE(2, 3, 0, 1)));
+#endif
+    Dot = _mm_add_ps(Dot, _mm_shuffle_ps(Dot, Dot, _MM_SHUFFLE(0, 1, 2, 3)));
+    Result.SSE = _mm_mul_ps(A.SSE, _HMM_RSqrtPS(Dot));
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t Dot = vmulq_f32(A.NEON, A.NEON);
+    Dot = vpaddq_f32(Dot, Dot);
+    Dot = vpaddq_f32(Dot, Dot);
+    Result.NEON = vmulq_f32(A.NEON, _HMM_RSqrtNEON(Dot));
+#else
+    Result = HMM_MulV4F(A, HMM_InvSqrtFastF(HMM_DotV4(A, A)));
+#endif
+
+    return Result;
+}
+
 /*
  * Utility vector functions
  */
@@ -1103,563 +2204,2016 @@ static inline HMM_Vec4 HMM_LerpV4(HMM_Vec4 A, float Time, HMM_Vec4 B)
 }
 
 /*
- * SSE stuff
+ * Padded Vec3 operations
+ *
+ * HMM_Vec3A versions of the Vec3 functions, which use SIMD where HMM_Vec3
+ * can't. Each one gives the same result in the X, Y and Z lanes as its
+ * HMM_Vec3 counterpart.
  */
 
-COVERAGE(HMM_LinearCombineV4M4, 1)
-static inline HMM_Vec4 HMM_LinearCombineV4M4(HMM_Vec4 Left, HMM_Mat4 Right)
+#ifdef HANDMADE_MATH__USE_SSE
+// Cross product of the XYZ parts. The W lane comes out as zero for finite inputs.
+static inline __m128 _HMM_CrossSSE(__m128 Left, __m128 Right)
 {
-    ASSERT_COVERED(HMM_LinearCombineV4M4);
+    __m128 LeftYZX = _mm_shuffle_ps(Left, Left, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 LeftZXY = _mm_shuffle_ps(Left, Left, _MM_SHUFFLE(3, 1, 0, 2));
+    __m128 RightYZX = _mm_shuffle_ps(Right, Right, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 RightZXY = _mm_shuffle_ps(Right, Right, _MM_SHUFFLE(3, 1, 0, 2));
+    return _mm_sub_ps(_mm_mul_ps(LeftYZX, RightZXY), _mm_mul_ps(LeftZXY, RightYZX));
+}
+#endif
 
-    HMM_Vec4 Result;
-#ifdef HANDMADE_MATH__USE_SSE
-    Result.SSE = _mm_mul_ps(_mm_shuffle_ps(Left.SSE, Left.SSE, 0x00), Right.Columns[0].SSE);
-    Result.SSE = _mm_add_ps(Result.SSE, _mm_mul_ps(_mm_shuffle_ps(Left.SSE, Left.SSE, 0x55), Right.Columns[1].SSE));
-    Result.SSE = _mm_add_ps(Result.SSE, _mm_mul_ps(_mm_shuffle_ps(Left.SSE, Left.SSE, 0xaa), Right.Columns[2].SSE));
-    Result.SSE = _mm_add_ps(Result.SSE, _mm_mul_ps(_mm_shuffle_ps(Left.SSE, Left.SSE, 0xff), Right.Columns[3].SSE));
-#elif defined(HANDMADE_MATH__USE_NEON)
-    Result.NEON = vmulq_laneq_f32(Right.Columns[0].NEON, Left.NEON, 0);
-    Result.NEON = vfmaq_laneq_f32(Result.NEON, Right.Columns[1].NEON, Left.NEON, 1);
-    Result.NEON = vfmaq_laneq_f32(Result.NEON, Right.Columns[2].NEON, Left.NEON, 2);
-    Result.NEON = vfmaq_laneq_f32(Result.NEON, Right.Columns[3].NEON, Left.NEON, 3);
-#else
-    Result.X = Left.Elements[0] * Right.Columns[0].X;
-    Result.Y = Left.Elements[0] * Right.Columns[0].Y;
-    Result.Z = Left.Elements[0] * Right.Columns[0].Z;
-    Result.W = Left.Elements[0] * Right.Columns[0].W;
+#ifdef HANDMADE_MATH__USE_NEON
+// (Y, Z, X) in the first three lanes.
+static inline float32x4_t _HMM_YZXNEON(float32x4_t V)
+{
+    return vcopyq_laneq_f32(vextq_f32(V, V, 1), 2, V, 0);
+}
+#endif
 
-    Result.X += Left.Elements[1] * Right.Columns[1].X;
-    Result.Y += Left.Elements[1] * Right.Columns[1].Y;
-    Result.Z += Left.Elements[1] * Right.Columns[1].Z;
-    Result.W += Left.Elements[1] * Right.Columns[1].W;
+COVERAGE(HMM_V3A, 1)
+static inline HMM_Vec3A HMM_V3A(float X, float Y, float Z)
+{
+    ASSERT_COVERED(HMM_V3A);
 
-    Result.X += Left.Elements[2] * Right.Columns[2].X;
-    Result.Y += Left.Elements[2] * Right.Columns[2].Y;
-    Result.Z += Left.Elements[2] * Right.Columns[2].Z;
-    Result.W += Left.Elements[2] * Right.Columns[2].W;
+    HMM_Vec3A Result;
 
-    Result.X += Left.Elements[3] * Right.Columns[3].X;
-    Result.Y += Left.Elements[3] * Right.Columns[3].Y;
-    Result.Z += Left.Elements[3] * Right.Columns[3].Z;
-    Result.W += Left.Elements[3] * Right.Columns[3].W;
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _mm_setr_ps(X, Y, Z, 0.0f);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t v = {X, Y, Z, 0.0f};
+    Result.NEON = v;
+#else
+    Result.X = X;
+    Result.Y = Y;
+    Result.Z = Z;
+    Result._Padding = 0.0f;
 #endif
 
     return Result;
 }
 
-/*
- * 2x2 Matrices
- */
-
-COVERAGE(HMM_M2, 1)
-static inline HMM_Mat2 HMM_M2(void)
+COVERAGE(HMM_V3ToV3A, 1)
+static inline HMM_Vec3A HMM_V3ToV3A(HMM_Vec3 Vector)
 {
-    ASSERT_COVERED(HMM_M2);
-    HMM_Mat2 Result = {0};
-    return Result;
+    ASSERT_COVERED(HMM_V3ToV3A);
+
+    return HMM_V3A(Vector.X, Vector.Y, Vector.Z);
 }
 
-COVERAGE(HMM_M2D, 1)
-static inline HMM_Mat2 HMM_M2D(float Diagonal)
+COVERAGE(HMM_V3AToV3, 1)
+static inline HMM_Vec3 HMM_V3AToV3(HMM_Vec3A Vector)
 {
-    ASSERT_COVERED(HMM_M2D);
+    ASSERT_COVERED(HMM_V3AToV3);
 
-    HMM_Mat2 Result = {0};
-    Result.Elements[0][0] = Diagonal;
-    Result.Elements[1][1] = Diagonal;
+    return Vector.XYZ;
+}
+
+COVERAGE(HMM_V4ToV3A, 1)
+// Reinterprets the XYZ part of an HMM_Vec4; W becomes the padding.
+static inline HMM_Vec3A HMM_V4ToV3A(HMM_Vec4 Vector)
+{
+    ASSERT_COVERED(HMM_V4ToV3A);
+
+    HMM_Vec3A Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = Vector.SSE;
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = Vector.NEON;
+#else
+    Result.XYZ = Vector.XYZ;
+    Result._Padding = Vector.W;
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_TransposeM2, 1)
-static inline HMM_Mat2 HMM_TransposeM2(HMM_Mat2 Matrix)
+COVERAGE(HMM_V3AToV4, 1)
+static inline HMM_Vec4 HMM_V3AToV4(HMM_Vec3A Vector, float W)
 {
-    ASSERT_COVERED(HMM_TransposeM2);
+    ASSERT_COVERED(HMM_V3AToV4);
 
-    HMM_Mat2 Result = Matrix;
+    HMM_Vec4 Result;
 
-    Result.Elements[0][1] = Matrix.Elements[1][0];
-    Result.Elements[1][0] = Matrix.Elements[0][1];
+#ifdef HANDMADE_MATH__USE_SSE
+    /* NOTE: (Z, Z, W, W), then (X, Y) from Vector and (Z, W) from that. */
+    __m128 ZW = _mm_shuffle_ps(Vector.SSE, _mm_set_ss(W), _MM_SHUFFLE(0, 0, 2, 2));
+    Result.SSE = _mm_shuffle_ps(Vector.SSE, ZW, _MM_SHUFFLE(2, 0, 1, 0));
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vsetq_lane_f32(W, Vector.NEON, 3);
+#else
+    Result.XYZ = Vector.XYZ;
+    Result.W = W;
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_AddM2, 1)
-static inline HMM_Mat2 HMM_AddM2(HMM_Mat2 Left, HMM_Mat2 Right)
+COVERAGE(HMM_AddV3A, 1)
+static inline HMM_Vec3A HMM_AddV3A(HMM_Vec3A Left, HMM_Vec3A Right)
 {
-    ASSERT_COVERED(HMM_AddM2);
+    ASSERT_COVERED(HMM_AddV3A);
 
-    HMM_Mat2 Result;
+    HMM_Vec3A Result;
 
-    Result.Elements[0][0] = Left.Elements[0][0] + Right.Elements[0][0];
-    Result.Elements[0][1] = Left.Elements[0][1] + Right.Elements[0][1];
-    Result.Elements[1][0] = Left.Elements[1][0] + Right.Elements[1][0];
-    Result.Elements[1][1] = Left.Elements[1][1] + Right.Elements[1][1];
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _mm_add_ps(Left.SSE, Right.SSE);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vaddq_f32(Left.NEON, Right.NEON);
+#else
+    Result.XYZ = HMM_AddV3(Left.XYZ, Right.XYZ);
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_SubM2, 1)
-static inline HMM_Mat2 HMM_SubM2(HMM_Mat2 Left, HMM_Mat2 Right)
+COVERAGE(HMM_SubV3A, 1)
+static inline HMM_Vec3A HMM_SubV3A(HMM_Vec3A Left, HMM_Vec3A Right)
 {
-    ASSERT_COVERED(HMM_SubM2);
+    ASSERT_COVERED(HMM_SubV3A);
 
-    HMM_Mat2 Result;
+    HMM_Vec3A Result;
 
-    Result.Elements[0][0] = Left.Elements[0][0] - Right.Elements[0][0];
-    Result.Elements[0][1] = Left.Elements[0][1] - Right.Elements[0][1];
-    Result.Elements[1][0] = Left.Elements[1][0] - Right.Elements[1][0];
-    Result.Elements[1][1] = Left.Elements[1][1] - Right.Elements[1][1];
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _mm_sub_ps(Left.SSE, Right.SSE);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vsubq_f32(Left.NEON, Right.NEON);
+#else
+    Result.XYZ = HMM_SubV3(Left.XYZ, Right.XYZ);
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_MulM2V2, 1)
-static inline HMM_Vec2 HMM_MulM2V2(HMM_Mat2 Matrix, HMM_Vec2 Vector)
+COVERAGE(HMM_MulV3A, 1)
+static inline HMM_Vec3A HMM_MulV3A(HMM_Vec3A Left, HMM_Vec3A Right)
 {
-    ASSERT_COVERED(HMM_MulM2V2);
-
-    HMM_Vec2 Result;
+    ASSERT_COVERED(HMM_MulV3A);
 
-    Result.X = Vector.Elements[0] * Matrix.Columns[0].X;
-    Result.Y = Vector.Elements[0] * Matrix.Columns[0].Y;
+    HMM_Vec3A Result;
 
-    Result.X += Vector.Elements[1] * Matrix.Columns[1].X;
-    Result.Y += Vector.Elements[1] * Matrix.Columns[1].Y;
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _mm_mul_ps(Left.SSE, Right.SSE);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vmulq_f32(Left.NEON, Right.NEON);
+#else
+    Result.XYZ = HMM_MulV3(Left.XYZ, Right.XYZ);
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_MulM2, 1)
-static inline HMM_Mat2 HMM_MulM2(HMM_Mat2 Left, HMM_Mat2 Right)
+COVERAGE(HMM_MulV3AF, 1)
+static inline HMM_Vec3A HMM_MulV3AF(HMM_Vec3A Left, float Right)
 {
-    ASSERT_COVERED(HMM_MulM2);
+    ASSERT_COVERED(HMM_MulV3AF);
 
-    HMM_Mat2 Result;
-    Result.Columns[0] = HMM_MulM2V2(Left, Right.Columns[0]);
-    Result.Columns[1] = HMM_MulM2V2(Left, Right.Columns[1]);
+    HMM_Vec3A Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _mm_mul_ps(Left.SSE, _mm_set1_ps(Right));
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vmulq_n_f32(Left.NEON, Right);
+#else
+    Result.XYZ = HMM_MulV3F(Left.XYZ, Right);
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_MulM2F, 1)
-static inline HMM_Mat2 HMM_MulM2F(HMM_Mat2 Matrix, float Scalar)
+COVERAGE(HMM_DivV3A, 1)
+static inline HMM_Vec3A HMM_DivV3A(HMM_Vec3A Left, HMM_Vec3A Right)
 {
-    ASSERT_COVERED(HMM_MulM2F);
+    ASSERT_COVERED(HMM_DivV3A);
 
-    HMM_Mat2 Result;
+    HMM_Vec3A Result;
 
-    Result.Elements[0][0] = Matrix.Elements[0][0] * Scalar;
-    Result.Elements[0][1] = Matrix.Elements[0][1] * Scalar;
-    Result.Elements[1][0] = Matrix.Elements[1][0] * Scalar;
-    Result.Elements[1][1] = Matrix.Elements[1][1] * Scalar;
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _mm_div_ps(Left.SSE, Right.SSE);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vdivq_f32(Left.NEON, Right.NEON);
+#else
+    Result.XYZ = HMM_DivV3(Left.XYZ, Right.XYZ);
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_DivM2F, 1)
-static inline HMM_Mat2 HMM_DivM2F(HMM_Mat2 Matrix, float Scalar)
+COVERAGE(HMM_DivV3AF, 1)
+static inline HMM_Vec3A HMM_DivV3AF(HMM_Vec3A Left, float Right)
 {
-    ASSERT_COVERED(HMM_DivM2F);
+    ASSERT_COVERED(HMM_DivV3AF);
 
-    HMM_Mat2 Result;
+    HMM_Vec3A Result;
 
-    Result.Elements[0][0] = Matrix.Elements[0][0] / Scalar;
-    Result.Elements[0][1] = Matrix.Elements[0][1] / Scalar;
-    Result.Elements[1][0] = Matrix.Elements[1][0] / Scalar;
-    Result.Elements[1][1] = Matrix.Elements[1][1] / Scalar;
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _mm_div_ps(Left.SSE, _mm_set1_ps(Right));
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vdivq_f32(Left.NEON, vdupq_n_f32(Right));
+#else
+    Result.XYZ = HMM_DivV3F(Left.XYZ, Right);
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_DeterminantM2, 1)
-static inline float HMM_DeterminantM2(HMM_Mat2 Matrix)
+COVERAGE(HMM_DotV3A, 1)
+static inline float HMM_DotV3A(HMM_Vec3A Left, HMM_Vec3A Right)
 {
-    ASSERT_COVERED(HMM_DeterminantM2);
-    return Matrix.Elements[0][0]*Matrix.Elements[1][1] - Matrix.Elements[0][1]*Matrix.Elements[1][0];
-}
+    ASSERT_COVERED(HMM_DotV3A);
 
+#ifdef HANDMADE_MATH__USE_SSE
+    /* NOTE: Summed in the same order as HMM_DotV3, leaving out the padding lane. */
+    __m128 Products = _mm_mul_ps(Left.SSE, Right.SSE);
+    __m128 Sum = _mm_add_ss(Products, _mm_shuffle_ps(Products, Products, _MM_SHUFFLE(1, 1, 1, 1)));
+    Sum = _mm_add_ss(Sum, _mm_shuffle_ps(Products, Products, _MM_SHUFFLE(2, 2, 2, 2)));
+    return _mm_cvtss_f32(Sum);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t Products = vmulq_f32(Left.NEON, Right.NEON);
+    return (vgetq_lane_f32(Products, 0) + vgetq_lane_f32(Products, 1)) + vgetq_lane_f32(Products, 2);
+#else
+    return HMM_DotV3(Left.XYZ, Right.XYZ);
+#endif
+}
 
-COVERAGE(HMM_InvGeneralM2, 1)
-static inline HMM_Mat2 HMM_InvGeneralM2(HMM_Mat2 Matrix)
+COVERAGE(HMM_CrossV3A, 1)
+static inline HMM_Vec3A HMM_CrossV3A(HMM_Vec3A Left, HMM_Vec3A Right)
 {
-    ASSERT_COVERED(HMM_InvGeneralM2);
+    ASSERT_COVERED(HMM_CrossV3A);
 
-    HMM_Mat2 Result;
-    float InvDeterminant = 1.0f / HMM_DeterminantM2(Matrix);
-    Result.Elements[0][0] = InvDeterminant * +Matrix.Elements[1][1];
-    Result.Elements[1][1] = InvDeterminant * +Matrix.Elements[0][0];
-    Result.Elements[0][1] = InvDeterminant * -Matrix.Elements[0][1];
-    Result.Elements[1][0] = InvDeterminant * -Matrix.Elements[1][0];
+    HMM_Vec3A Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _HMM_CrossSSE(Left.SSE, Right.SSE);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t LeftYZX = _HMM_YZXNEON(Left.NEON);
+    float32x4_t RightYZX = _HMM_YZXNEON(Right.NEON);
+    float32x4_t LeftZXY = _HMM_YZXNEON(LeftYZX);
+    float32x4_t RightZXY = _HMM_YZXNEON(RightYZX);
+    Result.NEON = vsubq_f32(vmulq_f32(LeftYZX, RightZXY), vmulq_f32(LeftZXY, RightYZX));
+#else
+    Result.XYZ = HMM_Cross(Left.XYZ, Right.XYZ);
+#endif
 
     return Result;
 }
 
+COVERAGE(HMM_LenSqrV3A, 1)
+static inline float HMM_LenSqrV3A(HMM_Vec3A A)
+{
+    ASSERT_COVERED(HMM_LenSqrV3A);
+    return HMM_DotV3A(A, A);
+}
+
+COVERAGE(HMM_LenV3A, 1)
+static inline float HMM_LenV3A(HMM_Vec3A A)
+{
+    ASSERT_COVERED(HMM_LenV3A);
+    return HMM_SqrtF(HMM_LenSqrV3A(A));
+}
+
+COVERAGE(HMM_NormV3A, 1)
+static inline HMM_Vec3A HMM_NormV3A(HMM_Vec3A A)
+{
+    ASSERT_COVERED(HMM_NormV3A);
+    return HMM_MulV3AF(A, HMM_InvSqrtF(HMM_DotV3A(A, A)));
+}
+
 /*
- * 3x3 Matrices
+ * Structure-of-arrays vector operations
+ *
+ * These mirror the AoS functions above lane by lane. The SSE and NEON paths
+ * round exactly like the scalar code, so a lane of HMM_NormV3SoA matches
+ * HMM_NormV3 on the same input.
  */
 
-COVERAGE(HMM_M3, 1)
-static inline HMM_Mat3 HMM_M3(void)
+static inline HMM_FloatSoA _HMM_AddSoA(HMM_FloatSoA Left, HMM_FloatSoA Right)
 {
-    ASSERT_COVERED(HMM_M3);
-    HMM_Mat3 Result = {0};
+    HMM_FloatSoA Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+        Result.SSE[Block] = _mm_add_ps(Left.SSE[Block], Right.SSE[Block]);
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+        Result.NEON[Block] = vaddq_f32(Left.NEON[Block], Right.NEON[Block]);
+    }
+#else
+    for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+    {
+        Result.Elements[Lane] = Left.Elements[Lane] + Right.Elements[Lane];
+    }
+#endif
+
     return Result;
 }
 
-COVERAGE(HMM_M3D, 1)
-static inline HMM_Mat3 HMM_M3D(float Diagonal)
+static inline HMM_FloatSoA _HMM_SubSoA(HMM_FloatSoA Left, HMM_FloatSoA Right)
 {
-    ASSERT_COVERED(HMM_M3D);
+    HMM_FloatSoA Result;
 
-    HMM_Mat3 Result = {0};
-    Result.Elements[0][0] = Diagonal;
-    Result.Elements[1][1] = Diagonal;
-    Result.Elements[2][2] = Diagonal;
+#ifdef HANDMADE_MATH__USE_SSE
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+        Result.SSE[Block] = _mm_sub_ps(Left.SSE[Block], Right.SSE[Block]);
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+        Result.NEON[Block] = vsubq_f32(Left.NEON[Block], Right.NEON[Block]);
+    }
+#else
+    for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+    {
+        Result.Elements[Lane] = Left.Elements[Lane] - Right.Elements[Lane];
+    }
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_TransposeM3, 1)
-static inline HMM_Mat3 HMM_TransposeM3(HMM_Mat3 Matrix)
+static inline HMM_FloatSoA _HMM_MulSoA(HMM_FloatSoA Left, HMM_FloatSoA Right)
 {
-    ASSERT_COVERED(HMM_TransposeM3);
-
-    HMM_Mat3 Result = Matrix;
+    HMM_FloatSoA Result;
 
-    Result.Elements[0][1] = Matrix.Elements[1][0];
-    Result.Elements[0][2] = Matrix.Elements[2][0];
-    Result.Elements[1][0] = Matrix.Elements[0][1];
-    Result.Elements[1][2] = Matrix.Elements[2][1];
-    Result.Elements[2][1] = Matrix.Elements[1][2];
-    Result.Elements[2][0] = Matrix.Elements[0][2];
+#ifdef HANDMADE_MATH__USE_SSE
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+        Result.SSE[Block] = _mm_mul_ps(Left.SSE[Block], Right.SSE[Block]);
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+        Result.NEON[Block] = vmulq_f32(Left.NEON[Block], Right.NEON[Block]);
+    }
+#else
+    for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+    {
+        Result.Elements[Lane] = Left.Elements[Lane] * Right.Elements[Lane];
+    }
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_AddM3, 1)
-static inline HMM_Mat3 HMM_AddM3(HMM_Mat3 Left, HMM_Mat3 Right)
+COVERAGE(HMM_SqrtSoA, 1)
+static inline HMM_FloatSoA HMM_SqrtSoA(HMM_FloatSoA Float)
 {
-    ASSERT_COVERED(HMM_AddM3);
+    ASSERT_COVERED(HMM_SqrtSoA);
 
-    HMM_Mat3 Result;
+    HMM_FloatSoA Result;
 
-    Result.Elements[0][0] = Left.Elements[0][0] + Right.Elements[0][0];
-    Result.Elements[0][1] = Left.Elements[0][1] + Right.Elements[0][1];
-    Result.Elements[0][2] = Left.Elements[0][2] + Right.Elements[0][2];
-    Result.Elements[1][0] = Left.Elements[1][0] + Right.Elements[1][0];
-    Result.Elements[1][1] = Left.Elements[1][1] + Right.Elements[1][1];
-    Result.Elements[1][2] = Left.Elements[1][2] + Right.Elements[1][2];
-    Result.Elements[2][0] = Left.Elements[2][0] + Right.Elements[2][0];
-    Result.Elements[2][1] = Left.Elements[2][1] + Right.Elements[2][1];
-    Result.Elements[2][2] = Left.Elements[2][2] + Right.Elements[2][2];
+#ifdef HANDMADE_MATH__USE_AVX
+    _mm256_storeu_ps(Result.Elements, _mm256_sqrt_ps(_mm256_loadu_ps(Float.Elements)));
+#elif defined(HANDMADE_MATH__USE_SSE)
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+        Result.SSE[Block] = _mm_sqrt_ps(Float.SSE[Block]);
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+        Result.NEON[Block] = vsqrtq_f32(Float.NEON[Block]);
+    }
+#else
+    for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+    {
+        Result.Elements[Lane] = HMM_SqrtF(Float.Elements[Lane]);
+    }
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_SubM3, 1)
-static inline HMM_Mat3 HMM_SubM3(HMM_Mat3 Left, HMM_Mat3 Right)
+COVERAGE(HMM_RSqrtSoA, 1)
+static inline HMM_FloatSoA HMM_RSqrtSoA(HMM_FloatSoA Float)
 {
-    ASSERT_COVERED(HMM_SubM3);
+    ASSERT_COVERED(HMM_RSqrtSoA);
 
-    HMM_Mat3 Result;
+    HMM_FloatSoA Result;
 
-    Result.Elements[0][0] = Left.Elements[0][0] - Right.Elements[0][0];
-    Result.Elements[0][1] = Left.Elements[0][1] - Right.Elements[0][1];
-    Result.Elements[0][2] = Left.Elements[0][2] - Right.Elements[0][2];
-    Result.Elements[1][0] = Left.Elements[1][0] - Right.Elements[1][0];
-    Result.Elements[1][1] = Left.Elements[1][1] - Right.Elements[1][1];
-    Result.Elements[1][2] = Left.Elements[1][2] - Right.Elements[1][2];
-    Result.Elements[2][0] = Left.Elements[2][0] - Right.Elements[2][0];
-    Result.Elements[2][1] = Left.Elements[2][1] - Right.Elements[2][1];
-    Result.Elements[2][2] = Left.Elements[2][2] - Right.Elements[2][2];
+#if defined(HANDMADE_MATH__USE_AVX) && defined(HANDMADE_MATH_FAST_RSQRT)
+    _mm256_storeu_ps(Result.Elements, _HMM_RSqrt256PS(_mm256_loadu_ps(Float.Elements)));
+#elif defined(HANDMADE_MATH__USE_AVX)
+    _mm256_storeu_ps(Result.Elements, _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(_mm256_loadu_ps(Float.Elements))));
+#elif defined(HANDMADE_MATH__USE_SSE)
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+#ifdef HANDMADE_MATH_FAST_RSQRT
+        Result.SSE[Block] = _HMM_RSqrtPS(Float.SSE[Block]);
+#else
+        Result.SSE[Block] = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(Float.SSE[Block]));
+#endif
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+#ifdef HANDMADE_MATH_FAST_RSQRT
+        Result.NEON[Block] = _HMM_RSqrtNEON(Float.NEON[Block]);
+#else
+        Result.NEON[Block] = vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(Float.NEON[Block]));
+#endif
+    }
+#else
+    for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+    {
+        Result.Elements[Lane] = HMM_InvSqrtF(Float.Elements[Lane]);
+    }
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_MulM3V3, 1)
-static inline HMM_Vec3 HMM_MulM3V3(HMM_Mat3 Matrix, HMM_Vec3 Vector)
+// Like HMM_SinCosV4, with 8-wide registers when AVX2 is available.
+COVERAGE(HMM_SinCosSoA, 1)
+static inline void HMM_SinCosSoA(HMM_FloatSoA Angle, HMM_FloatSoA *Sin, HMM_FloatSoA *Cos)
 {
-    ASSERT_COVERED(HMM_MulM3V3);
+    ASSERT_COVERED(HMM_SinCosSoA);
 
-    HMM_Vec3 Result;
-
-    Result.X = Vector.Elements[0] * Matrix.Columns[0].X;
-    Result.Y = Vector.Elements[0] * Matrix.Columns[0].Y;
-    Result.Z = Vector.Elements[0] * Matrix.Columns[0].Z;
+#ifdef HANDMADE_MATH__USE_AVX2
+    __m256 Sin8, Cos8;
+    _HMM_SinCos256PS(_mm256_mul_ps(_mm256_loadu_ps(Angle.Elements), _mm256_set1_ps(HMM_ToRad(1.0f))), &Sin8, &Cos8);
+    _mm256_storeu_ps(Sin->Elements, Sin8);
+    _mm256_storeu_ps(Cos->Elements, Cos8);
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    __m128 ToRad = _mm_set1_ps(HMM_ToRad(1.0f));
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+        _HMM_SinCosPS(_mm_mul_ps(Angle.SSE[Block], ToRad), &Sin->SSE[Block], &Cos->SSE[Block]);
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+        _HMM_SinCosNEON(vmulq_n_f32(Angle.NEON[Block], HMM_ToRad(1.0f)), &Sin->NEON[Block], &Cos->NEON[Block]);
+    }
+#else
+    for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+    {
+        HMM_Vec2 SinCos = _HMM_FastSinCosF(Angle.Elements[Lane] * HMM_ToRad(1.0f));
+        Sin->Elements[Lane] = SinCos.X;
+        Cos->Elements[Lane] = SinCos.Y;
+    }
+#endif
+}
 
-    Result.X += Vector.Elements[1] * Matrix.Columns[1].X;
-    Result.Y += Vector.Elements[1] * Matrix.Columns[1].Y;
-    Result.Z += Vector.Elements[1] * Matrix.Columns[1].Z;
+COVERAGE(HMM_SinSoA, 1)
+static inline HMM_FloatSoA HMM_SinSoA(HMM_FloatSoA Angle)
+{
+    ASSERT_COVERED(HMM_SinSoA);
 
-    Result.X += Vector.Elements[2] * Matrix.Columns[2].X;
-    Result.Y += Vector.Elements[2] * Matrix.Columns[2].Y;
-    Result.Z += Vector.Elements[2] * Matrix.Columns[2].Z;
+    HMM_FloatSoA Sin, Cos;
+    HMM_SinCosSoA(Angle, &Sin, &Cos);
+    return Sin;
+}
 
-    return Result;
+COVERAGE(HMM_CosSoA, 1)
+static inline HMM_FloatSoA HMM_CosSoA(HMM_FloatSoA Angle)
+{
+    ASSERT_COVERED(HMM_CosSoA);
+
+    HMM_FloatSoA Sin, Cos;
+    HMM_SinCosSoA(Angle, &Sin, &Cos);
+    return Cos;
 }
 
-COVERAGE(HMM_MulM3, 1)
-static inline HMM_Mat3 HMM_MulM3(HMM_Mat3 Left, HMM_Mat3 Right)
+COVERAGE(HMM_ACosSoA, 1)
+static inline HMM_FloatSoA HMM_ACosSoA(HMM_FloatSoA Arg)
 {
-    ASSERT_COVERED(HMM_MulM3);
+    ASSERT_COVERED(HMM_ACosSoA);
 
-    HMM_Mat3 Result;
-    Result.Columns[0] = HMM_MulM3V3(Left, Right.Columns[0]);
-    Result.Columns[1] = HMM_MulM3V3(Left, Right.Columns[1]);
-    Result.Columns[2] = HMM_MulM3V3(Left, Right.Columns[2]);
+    HMM_FloatSoA Result;
+
+#ifdef HANDMADE_MATH__USE_AVX2
+    _mm256_storeu_ps(Result.Elements, _mm256_mul_ps(_HMM_ACos256PS(_mm256_loadu_ps(Arg.Elements)), _mm256_set1_ps(HMM_AngleRad(1.0f))));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    __m128 ToUser = _mm_set1_ps(HMM_AngleRad(1.0f));
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+        Result.SSE[Block] = _mm_mul_ps(_HMM_ACosPS(Arg.SSE[Block]), ToUser);
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+        Result.NEON[Block] = vmulq_n_f32(_HMM_ACosNEON(Arg.NEON[Block]), HMM_AngleRad(1.0f));
+    }
+#else
+    for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+    {
+        Result.Elements[Lane] = _HMM_FastACosF(Arg.Elements[Lane]) * HMM_AngleRad(1.0f);
+    }
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_MulM3F, 1)
-static inline HMM_Mat3 HMM_MulM3F(HMM_Mat3 Matrix, float Scalar)
+COVERAGE(HMM_SoAF, 1)
+static inline HMM_FloatSoA HMM_SoAF(float Value)
 {
-    ASSERT_COVERED(HMM_MulM3F);
+    ASSERT_COVERED(HMM_SoAF);
 
-    HMM_Mat3 Result;
+    HMM_FloatSoA Result;
 
-    Result.Elements[0][0] = Matrix.Elements[0][0] * Scalar;
-    Result.Elements[0][1] = Matrix.Elements[0][1] * Scalar;
-    Result.Elements[0][2] = Matrix.Elements[0][2] * Scalar;
-    Result.Elements[1][0] = Matrix.Elements[1][0] * Scalar;
-    Result.Elements[1][1] = Matrix.Elements[1][1] * Scalar;
-    Result.Elements[1][2] = Matrix.Elements[1][2] * Scalar;
-    Result.Elements[2][0] = Matrix.Elements[2][0] * Scalar;
-    Result.Elements[2][1] = Matrix.Elements[2][1] * Scalar;
-    Result.Elements[2][2] = Matrix.Elements[2][2] * Scalar;
+#ifdef HANDMADE_MATH__USE_SSE
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+        Result.SSE[Block] = _mm_set1_ps(Value);
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block)
+    {
+        Result.NEON[Block] = vdupq_n_f32(Value);
+    }
+#else
+    for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+    {
+        Result.Elements[Lane] = Value;
+    }
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_DivM3F, 1)
-static inline HMM_Mat3 HMM_DivM3F(HMM_Mat3 Matrix, float Scalar)
+COVERAGE(HMM_V3SoA, 1)
+// Copies Vector into every lane.
+static inline HMM_Vec3SoA HMM_V3SoA(HMM_Vec3 Vector)
 {
-    ASSERT_COVERED(HMM_DivM3F);
+    ASSERT_COVERED(HMM_V3SoA);
 
-    HMM_Mat3 Result;
+    HMM_Vec3SoA Result;
+    Result.X = HMM_SoAF(Vector.X);
+    Result.Y = HMM_SoAF(Vector.Y);
+    Result.Z = HMM_SoAF(Vector.Z);
 
-    Result.Elements[0][0] = Matrix.Elements[0][0] / Scalar;
-    Result.Elements[0][1] = Matrix.Elements[0][1] / Scalar;
-    Result.Elements[0][2] = Matrix.Elements[0][2] / Scalar;
-    Result.Elements[1][0] = Matrix.Elements[1][0] / Scalar;
-    Result.Elements[1][1] = Matrix.Elements[1][1] / Scalar;
-    Result.Elements[1][2] = Matrix.Elements[1][2] / Scalar;
-    Result.Elements[2][0] = Matrix.Elements[2][0] / Scalar;
-    Result.Elements[2][1] = Matrix.Elements[2][1] / Scalar;
-    Result.Elements[2][2] = Matrix.Elements[2][2] / Scalar;
+    return Result;
+}
+
+COVERAGE(HMM_V4SoA, 1)
+// Copies Vector into every lane.
+static inline HMM_Vec4SoA HMM_V4SoA(HMM_Vec4 Vector)
+{
+    ASSERT_COVERED(HMM_V4SoA);
+
+    HMM_Vec4SoA Result;
+    Result.X = HMM_SoAF(Vector.X);
+    Result.Y = HMM_SoAF(Vector.Y);
+    Result.Z = HMM_SoAF(Vector.Z);
+    Result.W = HMM_SoAF(Vector.W);
 
     return Result;
 }
 
-COVERAGE(HMM_DeterminantM3, 1)
-static inline float HMM_DeterminantM3(HMM_Mat3 Matrix)
+COVERAGE(HMM_AddV3SoA, 1)
+static inline HMM_Vec3SoA HMM_AddV3SoA(HMM_Vec3SoA Left, HMM_Vec3SoA Right)
 {
-    ASSERT_COVERED(HMM_DeterminantM3);
+    ASSERT_COVERED(HMM_AddV3SoA);
 
-    HMM_Mat3 Cross;
-    Cross.Columns[0] = HMM_Cross(Matrix.Columns[1], Matrix.Columns[2]);
-    Cross.Columns[1] = HMM_Cross(Matrix.Columns[2], Matrix.Columns[0]);
-    Cross.Columns[2] = HMM_Cross(Matrix.Columns[0], Matrix.Columns[1]);
+    HMM_Vec3SoA Result;
+    Result.X = _HMM_AddSoA(Left.X, Right.X);
+    Result.Y = _HMM_AddSoA(Left.Y, Right.Y);
+    Result.Z = _HMM_AddSoA(Left.Z, Right.Z);
 
-    return HMM_DotV3(Cross.Columns[2], Matrix.Columns[2]);
+    return Result;
 }
 
-COVERAGE(HMM_InvGeneralM3, 1)
-static inline HMM_Mat3 HMM_InvGeneralM3(HMM_Mat3 Matrix)
+COVERAGE(HMM_AddV4SoA, 1)
+static inline HMM_Vec4SoA HMM_AddV4SoA(HMM_Vec4SoA Left, HMM_Vec4SoA Right)
 {
-    ASSERT_COVERED(HMM_InvGeneralM3);
+    ASSERT_COVERED(HMM_AddV4SoA);
 
-    HMM_Mat3 Cross;
-    Cross.Columns[0] = HMM_Cross(Matrix.Columns[1], Matrix.Columns[2]);
-    Cross.Columns[1] = HMM_Cross(Matrix.Columns[2], Matrix.Columns[0]);
-    Cross.Columns[2] = HMM_Cross(Matrix.Columns[0], Matrix.Columns[1]);
+    HMM_Vec4SoA Result;
+    Result.X = _HMM_AddSoA(Left.X, Right.X);
+    Result.Y = _HMM_AddSoA(Left.Y, Right.Y);
+    Result.Z = _HMM_AddSoA(Left.Z, Right.Z);
+    Result.W = _HMM_AddSoA(Left.W, Right.W);
 
-    float InvDeterminant = 1.0f / HMM_DotV3(Cross.Columns[2], Matrix.Columns[2]);
+    return Result;
+}
 
-    HMM_Mat3 Result;
-    Result.Columns[0] = HMM_MulV3F(Cross.Columns[0], InvDeterminant);
-    Result.Columns[1] = HMM_MulV3F(Cross.Columns[1], InvDeterminant);
-    Result.Columns[2] = HMM_MulV3F(Cross.Columns[2], InvDeterminant);
+COVERAGE(HMM_SubV3SoA, 1)
+static inline HMM_Vec3SoA HMM_SubV3SoA(HMM_Vec3SoA Left, HMM_Vec3SoA Right)
+{
+    ASSERT_COVERED(HMM_SubV3SoA);
 
-    return HMM_TransposeM3(Result);
+    HMM_Vec3SoA Result;
+    Result.X = _HMM_SubSoA(Left.X, Right.X);
+    Result.Y = _HMM_SubSoA(Left.Y, Right.Y);
+    Result.Z = _HMM_SubSoA(Left.Z, Right.Z);
+
+    return Result;
 }
 
-/*
- * 4x4 Matrices
- */
+COVERAGE(HMM_SubV4SoA, 1)
+static inline HMM_Vec4SoA HMM_SubV4SoA(HMM_Vec4SoA Left, HMM_Vec4SoA Right)
+{
+    ASSERT_COVERED(HMM_SubV4SoA);
 
-COVERAGE(HMM_M4, 1)
-static inline HMM_Mat4 HMM_M4(void)
+    HMM_Vec4SoA Result;
+    Result.X = _HMM_SubSoA(Left.X, Right.X);
+    Result.Y = _HMM_SubSoA(Left.Y, Right.Y);
+    Result.Z = _HMM_SubSoA(Left.Z, Right.Z);
+    Result.W = _HMM_SubSoA(Left.W, Right.W);
+
+    return Result;
+}
+
+COVERAGE(HMM_MulV3SoA, 1)
+static inline HMM_Vec3SoA HMM_MulV3SoA(HMM_Vec3SoA Left, HMM_Vec3SoA Right)
 {
-    ASSERT_COVERED(HMM_M4);
-    HMM_Mat4 Result = {0};
+    ASSERT_COVERED(HMM_MulV3SoA);
+
+    HMM_Vec3SoA Result;
+    Result.X = _HMM_MulSoA(Left.X, Right.X);
+    Result.Y = _HMM_MulSoA(Left.Y, Right.Y);
+    Result.Z = _HMM_MulSoA(Left.Z, Right.Z);
+
     return Result;
 }
 
-COVERAGE(HMM_M4D, 1)
-static inline HMM_Mat4 HMM_M4D(float Diagonal)
+COVERAGE(HMM_MulV3SoAF, 1)
+static inline HMM_Vec3SoA HMM_MulV3SoAF(HMM_Vec3SoA Left, float Right)
 {
-    ASSERT_COVERED(HMM_M4D);
+    ASSERT_COVERED(HMM_MulV3SoAF);
 
-    HMM_Mat4 Result = {0};
-    Result.Elements[0][0] = Diagonal;
-    Result.Elements[1][1] = Diagonal;
-    Result.Elements[2][2] = Diagonal;
-    Result.Elements[3][3] = Diagonal;
+    HMM_FloatSoA Scalar = HMM_SoAF(Right);
+
+    HMM_Vec3SoA Result;
+    Result.X = _HMM_MulSoA(Left.X, Scalar);
+    Result.Y = _HMM_MulSoA(Left.Y, Scalar);
+    Result.Z = _HMM_MulSoA(Left.Z, Scalar);
 
     return Result;
 }
 
-COVERAGE(HMM_TransposeM4, 1)
-static inline HMM_Mat4 HMM_TransposeM4(HMM_Mat4 Matrix)
+COVERAGE(HMM_MulV4SoA, 1)
+static inline HMM_Vec4SoA HMM_MulV4SoA(HMM_Vec4SoA Left, HMM_Vec4SoA Right)
 {
-    ASSERT_COVERED(HMM_TransposeM4);
+    ASSERT_COVERED(HMM_MulV4SoA);
 
-    HMM_Mat4 Result;
-#ifdef HANDMADE_MATH__USE_SSE
-    Result = Matrix;
-    _MM_TRANSPOSE4_PS(Result.Columns[0].SSE, Result.Columns[1].SSE, Result.Columns[2].SSE, Result.Columns[3].SSE);
-#elif defined(HANDMADE_MATH__USE_NEON)
-    float32x4x4_t Transposed = vld4q_f32((float*)Matrix.Columns);
-    Result.Columns[0].NEON = Transposed.val[0];
-    Result.Columns[1].NEON = Transposed.val[1];
-    Result.Columns[2].NEON = Transposed.val[2];
-    Result.Columns[3].NEON = Transposed.val[3];
-#else
-    Result.Elements[0][0] = Matrix.Elements[0][0];
-    Result.Elements[0][1] = Matrix.Elements[1][0];
-    Result.Elements[0][2] = Matrix.Elements[2][0];
-    Result.Elements[0][3] = Matrix.Elements[3][0];
-    Result.Elements[1][0] = Matrix.Elements[0][1];
-    Result.Elements[1][1] = Matrix.Elements[1][1];
-    Result.Elements[1][2] = Matrix.Elements[2][1];
-    Result.Elements[1][3] = Matrix.Elements[3][1];
-    Result.Elements[2][0] = Matrix.Elements[0][2];
-    Result.Elements[2][1] = Matrix.Elements[1][2];
-    Result.Elements[2][2] = Matrix.Elements[2][2];
-    Result.Elements[2][3] = Matrix.Elements[3][2];
-    Result.Elements[3][0] = Matrix.Elements[0][3];
-    Result.Elements[3][1] = Matrix.Elements[1][3];
-    Result.Elements[3][2] = Matrix.Elements[2][3];
-    Result.Elements[3][3] = Matrix.Elements[3][3];
-#endif
+    HMM_Vec4SoA Result;
+    Result.X = _HMM_MulSoA(Left.X, Right.X);
+    Result.Y = _HMM_MulSoA(Left.Y, Right.Y);
+    Result.Z = _HMM_MulSoA(Left.Z, Right.Z);
+    Result.W = _HMM_MulSoA(Left.W, Right.W);
 
     return Result;
 }
 
-COVERAGE(HMM_AddM4, 1)
-static inline HMM_Mat4 HMM_AddM4(HMM_Mat4 Left, HMM_Mat4 Right)
+COVERAGE(HMM_MulV4SoAF, 1)
+static inline HMM_Vec4SoA HMM_MulV4SoAF(HMM_Vec4SoA Left, float Right)
 {
-    ASSERT_COVERED(HMM_AddM4);
+    ASSERT_COVERED(HMM_MulV4SoAF);
 
-    HMM_Mat4 Result;
+    HMM_FloatSoA Scalar = HMM_SoAF(Right);
 
-    Result.Columns[0] = HMM_AddV4(Left.Columns[0], Right.Columns[0]);
-    Result.Columns[1] = HMM_AddV4(Left.Columns[1], Right.Columns[1]);
-    Result.Columns[2] = HMM_AddV4(Left.Columns[2], Right.Columns[2]);
-    Result.Columns[3] = HMM_AddV4(Left.Columns[3], Right.Columns[3]);
+    HMM_Vec4SoA Result;
+    Result.X = _HMM_MulSoA(Left.X, Scalar);
+    Result.Y = _HMM_MulSoA(Left.Y, Scalar);
+    Result.Z = _HMM_MulSoA(Left.Z, Scalar);
+    Result.W = _HMM_MulSoA(Left.W, Scalar);
 
     return Result;
 }
 
-COVERAGE(HMM_SubM4, 1)
-static inline HMM_Mat4 HMM_SubM4(HMM_Mat4 Left, HMM_Mat4 Right)
+COVERAGE(HMM_DotV3SoA, 1)
+static inline HMM_FloatSoA HMM_DotV3SoA(HMM_Vec3SoA Left, HMM_Vec3SoA Right)
 {
-    ASSERT_COVERED(HMM_SubM4);
+    ASSERT_COVERED(HMM_DotV3SoA);
 
-    HMM_Mat4 Result;
-
-    Result.Columns[0] = HMM_SubV4(Left.Columns[0], Right.Columns[0]);
-    Result.Columns[1] = HMM_SubV4(Left.Columns[1], Right.Columns[1]);
-    Result.Columns[2] = HMM_SubV4(Left.Columns[2], Right.Columns[2]);
-    Result.Columns[3] = HMM_SubV4(Left.Columns[3], Right.Columns[3]);
+    HMM_FloatSoA Result = _HMM_MulSoA(Left.X, Right.X);
+    Result = _HMM_AddSoA(Result, _HMM_MulSoA(Left.Y, Right.Y));
+    Result = _HMM_AddSoA(Result, _HMM_MulSoA(Left.Z, Right.Z));
 
     return Result;
 }
 
-COVERAGE(HMM_MulM4, 1)
-static inline HMM_Mat4 HMM_MulM4(HMM_Mat4 Left, HMM_Mat4 Right)
+COVERAGE(HMM_DotV4SoA, 1)
+static inline HMM_FloatSoA HMM_DotV4SoA(HMM_Vec4SoA Left, HMM_Vec4SoA Right)
 {
-    ASSERT_COVERED(HMM_MulM4);
+    ASSERT_COVERED(HMM_DotV4SoA);
 
-    HMM_Mat4 Result;
-    Result.Columns[0] = HMM_LinearCombineV4M4(Right.Columns[0], Left);
-    Result.Columns[1] = HMM_LinearCombineV4M4(Right.Columns[1], Left);
-    Result.Columns[2] = HMM_LinearCombineV4M4(Right.Columns[2], Left);
-    Result.Columns[3] = HMM_LinearCombineV4M4(Right.Columns[3], Left);
+    HMM_FloatSoA XZ = _HMM_AddSoA(_HMM_MulSoA(Left.X, Right.X), _HMM_MulSoA(Left.Z, Right.Z));
+    HMM_FloatSoA YW = _HMM_AddSoA(_HMM_MulSoA(Left.Y, Right.Y), _HMM_MulSoA(Left.W, Right.W));
+
+    return _HMM_AddSoA(XZ, YW);
+}
+
+COVERAGE(HMM_CrossSoA, 1)
+static inline HMM_Vec3SoA HMM_CrossSoA(HMM_Vec3SoA Left, HMM_Vec3SoA Right)
+{
+    ASSERT_COVERED(HMM_CrossSoA);
+
+    HMM_Vec3SoA Result;
+    Result.X = _HMM_SubSoA(_HMM_MulSoA(Left.Y, Right.Z), _HMM_MulSoA(Left.Z, Right.Y));
+    Result.Y = _HMM_SubSoA(_HMM_MulSoA(Left.Z, Right.X), _HMM_MulSoA(Left.X, Right.Z));
+    Result.Z = _HMM_SubSoA(_HMM_MulSoA(Left.X, Right.Y), _HMM_MulSoA(Left.Y, Right.X));
 
     return Result;
 }
 
-COVERAGE(HMM_MulM4F, 1)
-static inline HMM_Mat4 HMM_MulM4F(HMM_Mat4 Matrix, float Scalar)
+COVERAGE(HMM_LenV3SoA, 1)
+static inline HMM_FloatSoA HMM_LenV3SoA(HMM_Vec3SoA A)
 {
-    ASSERT_COVERED(HMM_MulM4F);
+    ASSERT_COVERED(HMM_LenV3SoA);
+    return HMM_SqrtSoA(HMM_DotV3SoA(A, A));
+}
 
-    HMM_Mat4 Result;
+COVERAGE(HMM_LenV4SoA, 1)
+static inline HMM_FloatSoA HMM_LenV4SoA(HMM_Vec4SoA A)
+{
+    ASSERT_COVERED(HMM_LenV4SoA);
+    return HMM_SqrtSoA(HMM_DotV4SoA(A, A));
+}
 
+COVERAGE(HMM_NormV3SoA, 1)
+static inline HMM_Vec3SoA HMM_NormV3SoA(HMM_Vec3SoA A)
+{
+    ASSERT_COVERED(HMM_NormV3SoA);
 
-#ifdef HANDMADE_MATH__USE_SSE
-    __m128 SSEScalar = _mm_set1_ps(Scalar);
-    Result.Columns[0].SSE = _mm_mul_ps(Matrix.Columns[0].SSE, SSEScalar);
-    Result.Columns[1].SSE = _mm_mul_ps(Matrix.Columns[1].SSE, SSEScalar);
-    Result.Columns[2].SSE = _mm_mul_ps(Matrix.Columns[2].SSE, SSEScalar);
-    Result.Columns[3].SSE = _mm_mul_ps(Matrix.Columns[3].SSE, SSEScalar);
-#elif defined(HANDMADE_MATH__USE_NEON)
-    Result.Columns[0].NEON = vmulq_n_f32(Matrix.Columns[0].NEON, Scalar);
-    Result.Columns[1].NEON = vmulq_n_f32(Matrix.Columns[1].NEON, Scalar);
-    Result.Columns[2].NEON = vmulq_n_f32(Matrix.Columns[2].NEON, Scalar);
-    Result.Columns[3].NEON = vmulq_n_f32(Matrix.Columns[3].NEON, Scalar);
-#else
-    Result.Elements[0][0] = Matrix.Elements[0][0] * Scalar;
-    Result.Elements[0][1] = Matrix.Elements[0][1] * Scalar;
-    Result.Elements[0][2] = Matrix.Elements[0][2] * Scalar;
-    Result.Elements[0][3] = Matrix.Elements[0][3] * Scalar;
-    Result.Elements[1][0] = Matrix.Elements[1][0] * Scalar;
-    Result.Elements[1][1] = Matrix.Elements[1][1] * Scalar;
-    Result.Elements[1][2] = Matrix.Elements[1][2] * Scalar;
-    Result.Elements[1][3] = Matrix.Elements[1][3] * Scalar;
-    Result.Elements[2][0] = Matrix.Elements[2][0] * Scalar;
-    Result.Elements[2][1] = Matrix.Elements[2][1] * Scalar;
-    Result.Elements[2][2] = Matrix.Elements[2][2] * Scalar;
-    Result.Elements[2][3] = Matrix.Elements[2][3] * Scalar;
-    Result.Elements[3][0] = Matrix.Elements[3][0] * Scalar;
-    Result.Elements[3][1] = Matrix.Elements[3][1] * Scalar;
-    Result.Elements[3][2] = Matrix.Elements[3][2] * Scalar;
-    Result.Elements[3][3] = Matrix.Elements[3][3] * Scalar;
-#endif
+    HMM_FloatSoA InvLength = HMM_RSqrtSoA(HMM_DotV3SoA(A, A));
+
+    HMM_Vec3SoA Result;
+    Result.X = _HMM_MulSoA(A.X, InvLength);
+    Result.Y = _HMM_MulSoA(A.Y, InvLength);
+    Result.Z = _HMM_MulSoA(A.Z, InvLength);
 
     return Result;
 }
 
-COVERAGE(HMM_MulM4V4, 1)
-static inline HMM_Vec4 HMM_MulM4V4(HMM_Mat4 Matrix, HMM_Vec4 Vector)
+COVERAGE(HMM_NormV4SoA, 1)
+static inline HMM_Vec4SoA HMM_NormV4SoA(HMM_Vec4SoA A)
 {
-    ASSERT_COVERED(HMM_MulM4V4);
-    return HMM_LinearCombineV4M4(Vector, Matrix);
+    ASSERT_COVERED(HMM_NormV4SoA);
+
+    HMM_FloatSoA InvLength = HMM_RSqrtSoA(HMM_DotV4SoA(A, A));
+
+    HMM_Vec4SoA Result;
+    Result.X = _HMM_MulSoA(A.X, InvLength);
+    Result.Y = _HMM_MulSoA(A.Y, InvLength);
+    Result.Z = _HMM_MulSoA(A.Z, InvLength);
+    Result.W = _HMM_MulSoA(A.W, InvLength);
+
+    return Result;
 }
 
-COVERAGE(HMM_DivM4F, 1)
-static inline HMM_Mat4 HMM_DivM4F(HMM_Mat4 Matrix, float Scalar)
+COVERAGE(HMM_LerpV3SoA, 1)
+static inline HMM_Vec3SoA HMM_LerpV3SoA(HMM_Vec3SoA A, float Time, HMM_Vec3SoA B)
 {
-    ASSERT_COVERED(HMM_DivM4F);
+    ASSERT_COVERED(HMM_LerpV3SoA);
+    return HMM_AddV3SoA(HMM_MulV3SoAF(A, 1.0f - Time), HMM_MulV3SoAF(B, Time));
+}
 
-    HMM_Mat4 Result;
+COVERAGE(HMM_LerpV4SoA, 1)
+static inline HMM_Vec4SoA HMM_LerpV4SoA(HMM_Vec4SoA A, float Time, HMM_Vec4SoA B)
+{
+    ASSERT_COVERED(HMM_LerpV4SoA);
+    return HMM_AddV4SoA(HMM_MulV4SoAF(A, 1.0f - Time), HMM_MulV4SoAF(B, Time));
+}
 
 #ifdef HANDMADE_MATH__USE_SSE
-    __m128 SSEScalar = _mm_set1_ps(Scalar);
-    Result.Columns[0].SSE = _mm_div_ps(Matrix.Columns[0].SSE, SSEScalar);
-    Result.Columns[1].SSE = _mm_div_ps(Matrix.Columns[1].SSE, SSEScalar);
-    Result.Columns[2].SSE = _mm_div_ps(Matrix.Columns[2].SSE, SSEScalar);
-    Result.Columns[3].SSE = _mm_div_ps(Matrix.Columns[3].SSE, SSEScalar);
-#elif defined(HANDMADE_MATH__USE_NEON)
-    float32x4_t NEONScalar = vdupq_n_f32(Scalar);
-    Result.Columns[0].NEON = vdivq_f32(Matrix.Columns[0].NEON, NEONScalar);
-    Result.Columns[1].NEON = vdivq_f32(Matrix.Columns[1].NEON, NEONScalar);
-    Result.Columns[2].NEON = vdivq_f32(Matrix.Columns[2].NEON, NEONScalar);
-    Result.Columns[3].NEON = vdivq_f32(Matrix.Columns[3].NEON, NEONScalar);
-#else
+// Splits four packed 3-element values, (X0 Y0 Z0 X1) (Y1 Z1 X2 Y2) (Z2 X3 Y3 Z3), into one register per element.
+static inline void _HMM_DeinterleaveV3SSE(__m128 A, __m128 B, __m128 C, __m128 *X, __m128 *Y, __m128 *Z)
+{
+    __m128 XY23 = _mm_shuffle_ps(B, C, _MM_SHUFFLE(2, 1, 3, 2));
+    __m128 YZ01 = _mm_shuffle_ps(A, B, _MM_SHUFFLE(1, 0, 2, 1));
+
+    *X = _mm_shuffle_ps(A, XY23, _MM_SHUFFLE(2, 0, 3, 0));
+    *Y = _mm_shuffle_ps(YZ01, XY23, _MM_SHUFFLE(3, 1, 2, 0));
+    *Z = _mm_shuffle_ps(YZ01, C, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+// Stores four HMM_Vec3s (12 floats) from one register per element.
+static inline void _HMM_StoreV3x4SSE(float *Dest, __m128 X, __m128 Y, __m128 Z)
+{
+    __m128 XY01 = _mm_unpacklo_ps(X, Y);
+    __m128 XY23 = _mm_unpackhi_ps(X, Y);
+    __m128 ZX01 = _mm_shuffle_ps(Z, X, _MM_SHUFFLE(1, 1, 0, 0));
+    __m128 YZ11 = _mm_shuffle_ps(Y, Z, _MM_SHUFFLE(1, 1, 1, 1));
+    __m128 ZX23 = _mm_shuffle_ps(Z, X, _MM_SHUFFLE(3, 3, 2, 2));
+    __m128 YZ33 = _mm_shuffle_ps(Y, Z, _MM_SHUFFLE(3, 3, 3, 3));
+
+    _mm_storeu_ps(Dest + 0, _mm_shuffle_ps(XY01, ZX01, _MM_SHUFFLE(2, 0, 1, 0)));
+    _mm_storeu_ps(Dest + 4, _mm_shuffle_ps(YZ11, XY23, _MM_SHUFFLE(1, 0, 2, 0)));
+    _mm_storeu_ps(Dest + 8, _mm_shuffle_ps(ZX23, YZ33, _MM_SHUFFLE(2, 0, 2, 0)));
+}
+#endif
+
+COVERAGE(HMM_V3ArrayToSoA, 1)
+// Transposes Count vectors into (Count + HMM_SOA_WIDTH - 1) / HMM_SOA_WIDTH blocks. Unused lanes
+// in the last block are set to zero.
+static inline void HMM_V3ArrayToSoA(const HMM_Vec3 *In, HMM_Vec3SoA *Out, int Count)
+{
+    ASSERT_COVERED(HMM_V3ArrayToSoA);
+
+    const float *Source = (const float *)In;
+
+    for (int Index = 0; Index < Count; Index += HMM_SOA_WIDTH, ++Out)
+    {
+        int Lane = 0;
+
+        if (Count - Index >= HMM_SOA_WIDTH)
+        {
+#ifdef HANDMADE_MATH__USE_SSE
+            for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block, Source += 12)
+            {
+                _HMM_DeinterleaveV3SSE(_mm_loadu_ps(Source + 0), _mm_loadu_ps(Source + 4), _mm_loadu_ps(Source + 8),
+                                       &Out->X.SSE[Block], &Out->Y.SSE[Block], &Out->Z.SSE[Block]);
+            }
+            Lane = HMM_SOA_WIDTH;
+#elif defined(HANDMADE_MATH__USE_NEON)
+            for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block, Source += 12)
+            {
+                float32x4x3_t Deinterleaved = vld3q_f32(Source);
+                Out->X.NEON[Block] = Deinterleaved.val[0];
+                Out->Y.NEON[Block] = Deinterleaved.val[1];
+                Out->Z.NEON[Block] = Deinterleaved.val[2];
+            }
+            Lane = HMM_SOA_WIDTH;
+#endif
+        }
+
+        for (; Lane < HMM_SOA_WIDTH; ++Lane)
+        {
+            if (Index + Lane < Count)
+            {
+                Out->X.Elements[Lane] = Source[0];
+                Out->Y.Elements[Lane] = Source[1];
+                Out->Z.Elements[Lane] = Source[2];
+                Source += 3;
+            }
+            else
+            {
+                Out->X.Elements[Lane] = 0.0f;
+                Out->Y.Elements[Lane] = 0.0f;
+                Out->Z.Elements[Lane] = 0.0f;
+            }
+        }
+    }
+}
+
+COVERAGE(HMM_SoAToV3Array, 1)
+// Transposes blocks back into Count vectors. Lanes past Count in the last block are ignored.
+static inline void HMM_SoAToV3Array(const HMM_Vec3SoA *In, HMM_Vec3 *Out, int Count)
+{
+    ASSERT_COVERED(HMM_SoAToV3Array);
+
+    float *Dest = (float *)Out;
+
+    for (int Index = 0; Index < Count; Index += HMM_SOA_WIDTH, ++In)
+    {
+        int Lane = 0;
+
+        if (Count - Index >= HMM_SOA_WIDTH)
+        {
+#ifdef HANDMADE_MATH__USE_SSE
+            for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block, Dest += 12)
+            {
+                _HMM_StoreV3x4SSE(Dest, In->X.SSE[Block], In->Y.SSE[Block], In->Z.SSE[Block]);
+            }
+            Lane = HMM_SOA_WIDTH;
+#elif defined(HANDMADE_MATH__USE_NEON)
+            for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block, Dest += 12)
+            {
+                float32x4x3_t Interleaved;
+                Interleaved.val[0] = In->X.NEON[Block];
+                Interleaved.val[1] = In->Y.NEON[Block];
+                Interleaved.val[2] = In->Z.NEON[Block];
+                vst3q_f32(Dest, Interleaved);
+            }
+            Lane = HMM_SOA_WIDTH;
+#endif
+        }
+
+        for (; Lane < HMM_SOA_WIDTH && Index + Lane < Count; ++Lane)
+        {
+            Dest[0] = In->X.Elements[Lane];
+            Dest[1] = In->Y.Elements[Lane];
+            Dest[2] = In->Z.Elements[Lane];
+            Dest += 3;
+        }
+    }
+}
+
+COVERAGE(HMM_V4ArrayToSoA, 1)
+// Transposes Count vectors into (Count + HMM_SOA_WIDTH - 1) / HMM_SOA_WIDTH blocks. Unused lanes
+// in the last block are set to zero.
+static inline void HMM_V4ArrayToSoA(const HMM_Vec4 *In, HMM_Vec4SoA *Out, int Count)
+{
+    ASSERT_COVERED(HMM_V4ArrayToSoA);
+
+    const float *Source = (const float *)In;
+
+    for (int Index = 0; Index < Count; Index += HMM_SOA_WIDTH, ++Out)
+    {
+        int Lane = 0;
+
+        if (Count - Index >= HMM_SOA_WIDTH)
+        {
+#ifdef HANDMADE_MATH__USE_SSE
+            for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block, Source += 16)
+            {
+                __m128 X = _mm_loadu_ps(Source + 0);
+                __m128 Y = _mm_loadu_ps(Source + 4);
+                __m128 Z = _mm_loadu_ps(Source + 8);
+                __m128 W = _mm_loadu_ps(Source + 12);
+                _MM_TRANSPOSE4_PS(X, Y, Z, W);
+
+                Out->X.SSE[Block] = X;
+                Out->Y.SSE[Block] = Y;
+                Out->Z.SSE[Block] = Z;
+                Out->W.SSE[Block] = W;
+            }
+            Lane = HMM_SOA_WIDTH;
+#elif defined(HANDMADE_MATH__USE_NEON)
+            for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block, Source += 16)
+            {
+                float32x4x4_t Deinterleaved = vld4q_f32(Source);
+                Out->X.NEON[Block] = Deinterleaved.val[0];
+                Out->Y.NEON[Block] = Deinterleaved.val[1];
+                Out->Z.NEON[Block] = Deinterleaved.val[2];
+                Out->W.NEON[Block] = Deinterleaved.val[3];
+            }
+            Lane = HMM_SOA_WIDTH;
+#endif
+        }
+
+        for (; Lane < HMM_SOA_WIDTH; ++Lane)
+        {
+            if (Index + Lane < Count)
+            {
+                Out->X.Elements[Lane] = Source[0];
+                Out->Y.Elements[Lane] = Source[1];
+                Out->Z.Elements[Lane] = Source[2];
+                Out->W.Elements[Lane] = Source[3];
+                Source += 4;
+            }
+            else
+            {
+                Out->X.Elements[Lane] = 0.0f;
+                Out->Y.Elements[Lane] = 0.0f;
+                Out->Z.Elements[Lane] = 0.0f;
+                Out->W.Elements[Lane] = 0.0f;
+            }
+        }
+    }
+}
+
+COVERAGE(HMM_SoAToV4Array, 1)
+// Transposes blocks back into Count vectors. Lanes past Count in the last block are ignored.
+static inline void HMM_SoAToV4Array(const HMM_Vec4SoA *In, HMM_Vec4 *Out, int Count)
+{
+    ASSERT_COVERED(HMM_SoAToV4Array);
+
+    float *Dest = (float *)Out;
+
+    for (int Index = 0; Index < Count; Index += HMM_SOA_WIDTH, ++In)
+    {
+        int Lane = 0;
+
+        if (Count - Index >= HMM_SOA_WIDTH)
+        {
+#ifdef HANDMADE_MATH__USE_SSE
+            for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block, Dest += 16)
+            {
+                __m128 X = In->X.SSE[Block];
+                __m128 Y = In->Y.SSE[Block];
+                __m128 Z = In->Z.SSE[Block];
+                __m128 W = In->W.SSE[Block];
+                _MM_TRANSPOSE4_PS(X, Y, Z, W);
+
+                _mm_storeu_ps(Dest + 0, X);
+                _mm_storeu_ps(Dest + 4, Y);
+                _mm_storeu_ps(Dest + 8, Z);
+                _mm_storeu_ps(Dest + 12, W);
+            }
+            Lane = HMM_SOA_WIDTH;
+#elif defined(HANDMADE_MATH__USE_NEON)
+            for (int Block = 0; Block < HMM_SOA_WIDTH / 4; ++Block, Dest += 16)
+            {
+                float32x4x4_t Interleaved;
+                Interleaved.val[0] = In->X.NEON[Block];
+                Interleaved.val[1] = In->Y.NEON[Block];
+                Interleaved.val[2] = In->Z.NEON[Block];
+                Interleaved.val[3] = In->W.NEON[Block];
+                vst4q_f32(Dest, Interleaved);
+            }
+            Lane = HMM_SOA_WIDTH;
+#endif
+        }
+
+        for (; Lane < HMM_SOA_WIDTH && Index + Lane < Count; ++Lane)
+        {
+            Dest[0] = In->X.Elements[Lane];
+            Dest[1] = In->Y.Elements[Lane];
+            Dest[2] = In->Z.Elements[Lane];
+            Dest[3] = In->W.Elements[Lane];
+            Dest += 4;
+        }
+    }
+}
+
+/*
+ * SSE stuff
+ */
+
+#ifdef HANDMADE_MATH__USE_AVX
+/* NOTE: Internal 256-bit helpers. Each register holds two Vec4s, one per 128-bit half. */
+
+// Cross product of the XYZ parts of each half. The W lanes come out as zero.
+static inline __m256 _HMM_CrossAVX(__m256 Left, __m256 Right)
+{
+    __m256 LeftYZX = _mm256_shuffle_ps(Left, Left, _MM_SHUFFLE(3, 0, 2, 1));
+    __m256 LeftZXY = _mm256_shuffle_ps(Left, Left, _MM_SHUFFLE(3, 1, 0, 2));
+    __m256 RightYZX = _mm256_shuffle_ps(Right, Right, _MM_SHUFFLE(3, 0, 2, 1));
+    __m256 RightZXY = _mm256_shuffle_ps(Right, Right, _MM_SHUFFLE(3, 1, 0, 2));
+    return _mm256_sub_ps(_mm256_mul_ps(LeftYZX, RightZXY), _mm256_mul_ps(LeftZXY, RightYZX));
+}
+
+// Sum of the four lanes of each half, broadcast across that half.
+static inline __m256 _HMM_HorizontalSumAVX(__m256 Value)
+{
+    Value = _mm256_add_ps(Value, _mm256_shuffle_ps(Value, Value, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm256_add_ps(Value, _mm256_shuffle_ps(Value, Value, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+
+// Transposes the 4x4 matrix whose columns are packed as [0|2] and [1|3], producing its rows packed as [0|1] and [2|3].
+static inline void _HMM_TransposeAVX(__m256 Columns02, __m256 Columns13, __m256 *Rows01, __m256 *Rows23)
+{
+    __m256 Low = _mm256_unpacklo_ps(Columns02, Columns13);
+    __m256 High = _mm256_unpackhi_ps(Columns02, Columns13);
+#ifdef HANDMADE_MATH__USE_AVX2
+    /* NOTE: Low is [0x 1x 0y 1y | 2x 3x 2y 3y], so rows 0 and 1 are just its 64-bit pairs in the order 0, 2, 1, 3. */
+    *Rows01 = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(Low), _MM_SHUFFLE(3, 1, 2, 0)));
+    *Rows23 = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(High), _MM_SHUFFLE(3, 1, 2, 0)));
+#else
+    __m256 LowHalves = _mm256_permute2f128_ps(Low, High, 0x20);
+    __m256 HighHalves = _mm256_permute2f128_ps(Low, High, 0x31);
+    __m256 Rows02 = _mm256_shuffle_ps(LowHalves, HighHalves, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 Rows13 = _mm256_shuffle_ps(LowHalves, HighHalves, _MM_SHUFFLE(3, 2, 3, 2));
+    *Rows01 = _mm256_permute2f128_ps(Rows02, Rows13, 0x20);
+    *Rows23 = _mm256_permute2f128_ps(Rows02, Rows13, 0x31);
+#endif
+}
+
+// Transposes the 4x4 matrices in the low and high halves of the four registers, like _MM_TRANSPOSE4_PS on each half.
+static inline void _HMM_Transpose4x4AVX(__m256 *Row0, __m256 *Row1, __m256 *Row2, __m256 *Row3)
+{
+    __m256 Low01 = _mm256_unpacklo_ps(*Row0, *Row1);
+    __m256 Low23 = _mm256_unpacklo_ps(*Row2, *Row3);
+    __m256 High01 = _mm256_unpackhi_ps(*Row0, *Row1);
+    __m256 High23 = _mm256_unpackhi_ps(*Row2, *Row3);
+    *Row0 = _mm256_shuffle_ps(Low01, Low23, _MM_SHUFFLE(1, 0, 1, 0));
+    *Row1 = _mm256_shuffle_ps(Low01, Low23, _MM_SHUFFLE(3, 2, 3, 2));
+    *Row2 = _mm256_shuffle_ps(High01, High23, _MM_SHUFFLE(1, 0, 1, 0));
+    *Row3 = _mm256_shuffle_ps(High01, High23, _MM_SHUFFLE(3, 2, 3, 2));
+}
+#endif /* HANDMADE_MATH__USE_AVX */
+
+COVERAGE(HMM_LinearCombineV4M4, 1)
+static inline HMM_Vec4 HMM_LinearCombineV4M4(HMM_Vec4 Left, HMM_Mat4 Right)
+{
+    ASSERT_COVERED(HMM_LinearCombineV4M4);
+
+    HMM_Vec4 Result;
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _mm_mul_ps(_mm_shuffle_ps(Left.SSE, Left.SSE, 0x00), Right.Columns[0].SSE);
+    Result.SSE = _HMM_MADD_PS(_mm_shuffle_ps(Left.SSE, Left.SSE, 0x55), Right.Columns[1].SSE, Result.SSE);
+    Result.SSE = _HMM_MADD_PS(_mm_shuffle_ps(Left.SSE, Left.SSE, 0xaa), Right.Columns[2].SSE, Result.SSE);
+    Result.SSE = _HMM_MADD_PS(_mm_shuffle_ps(Left.SSE, Left.SSE, 0xff), Right.Columns[3].SSE, Result.SSE);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vmulq_laneq_f32(Right.Columns[0].NEON, Left.NEON, 0);
+    Result.NEON = vfmaq_laneq_f32(Result.NEON, Right.Columns[1].NEON, Left.NEON, 1);
+    Result.NEON = vfmaq_laneq_f32(Result.NEON, Right.Columns[2].NEON, Left.NEON, 2);
+    Result.NEON = vfmaq_laneq_f32(Result.NEON, Right.Columns[3].NEON, Left.NEON, 3);
+#else
+    Result.X = Left.Elements[0] * Right.Columns[0].X;
+    Result.Y = Left.Elements[0] * Right.Columns[0].Y;
+    Result.Z = Left.Elements[0] * Right.Columns[0].Z;
+    Result.W = Left.Elements[0] * Right.Columns[0].W;
+
+    Result.X += Left.Elements[1] * Right.Columns[1].X;
+    Result.Y += Left.Elements[1] * Right.Columns[1].Y;
+    Result.Z += Left.Elements[1] * Right.Columns[1].Z;
+    Result.W += Left.Elements[1] * Right.Columns[1].W;
+
+    Result.X += Left.Elements[2] * Right.Columns[2].X;
+    Result.Y += Left.Elements[2] * Right.Columns[2].Y;
+    Result.Z += Left.Elements[2] * Right.Columns[2].Z;
+    Result.W += Left.Elements[2] * Right.Columns[2].W;
+
+    Result.X += Left.Elements[3] * Right.Columns[3].X;
+    Result.Y += Left.Elements[3] * Right.Columns[3].Y;
+    Result.Z += Left.Elements[3] * Right.Columns[3].Z;
+    Result.W += Left.Elements[3] * Right.Columns[3].W;
+#endif
+
+    return Result;
+}
+
+/*
+ * 2x2 Matrices
+ */
+
+COVERAGE(HMM_M2, 1)
+static inline HMM_Mat2 HMM_M2(void)
+{
+    ASSERT_COVERED(HMM_M2);
+    HMM_Mat2 Result = {0};
+    return Result;
+}
+
+COVERAGE(HMM_M2D, 1)
+static inline HMM_Mat2 HMM_M2D(float Diagonal)
+{
+    ASSERT_COVERED(HMM_M2D);
+
+    HMM_Mat2 Result = {0};
+    Result.Elements[0][0] = Diagonal;
+    Result.Elements[1][1] = Diagonal;
+
+    return Result;
+}
+
+COVERAGE(HMM_TransposeM2, 1)
+static inline HMM_Mat2 HMM_TransposeM2(HMM_Mat2 Matrix)
+{
+    ASSERT_COVERED(HMM_TransposeM2);
+
+    HMM_Mat2 Result = Matrix;
+
+    Result.Elements[0][1] = Matrix.Elements[1][0];
+    Result.Elements[1][0] = Matrix.Elements[0][1];
+
+    return Result;
+}
+
+COVERAGE(HMM_AddM2, 1)
+static inline HMM_Mat2 HMM_AddM2(HMM_Mat2 Left, HMM_Mat2 Right)
+{
+    ASSERT_COVERED(HMM_AddM2);
+
+    HMM_Mat2 Result;
+
+    Result.Elements[0][0] = Left.Elements[0][0] + Right.Elements[0][0];
+    Result.Elements[0][1] = Left.Elements[0][1] + Right.Elements[0][1];
+    Result.Elements[1][0] = Left.Elements[1][0] + Right.Elements[1][0];
+    Result.Elements[1][1] = Left.Elements[1][1] + Right.Elements[1][1];
+
+    return Result;
+}
+
+COVERAGE(HMM_SubM2, 1)
+static inline HMM_Mat2 HMM_SubM2(HMM_Mat2 Left, HMM_Mat2 Right)
+{
+    ASSERT_COVERED(HMM_SubM2);
+
+    HMM_Mat2 Result;
+
+    Result.Elements[0][0] = Left.Elements[0][0] - Right.Elements[0][0];
+    Result.Elements[0][1] = Left.Elements[0][1] - Right.Elements[0][1];
+    Result.Elements[1][0] = Left.Elements[1][0] - Right.Elements[1][0];
+    Result.Elements[1][1] = Left.Elements[1][1] - Right.Elements[1][1];
+
+    return Result;
+}
+
+COVERAGE(HMM_MulM2V2, 1)
+static inline HMM_Vec2 HMM_MulM2V2(HMM_Mat2 Matrix, HMM_Vec2 Vector)
+{
+    ASSERT_COVERED(HMM_MulM2V2);
+
+    HMM_Vec2 Result;
+
+    Result.X = Vector.Elements[0] * Matrix.Columns[0].X;
+    Result.Y = Vector.Elements[0] * Matrix.Columns[0].Y;
+
+    Result.X += Vector.Elements[1] * Matrix.Columns[1].X;
+    Result.Y += Vector.Elements[1] * Matrix.Columns[1].Y;
+
+    return Result;
+}
+
+COVERAGE(HMM_MulM2, 1)
+static inline HMM_Mat2 HMM_MulM2(HMM_Mat2 Left, HMM_Mat2 Right)
+{
+    ASSERT_COVERED(HMM_MulM2);
+
+    HMM_Mat2 Result;
+    Result.Columns[0] = HMM_MulM2V2(Left, Right.Columns[0]);
+    Result.Columns[1] = HMM_MulM2V2(Left, Right.Columns[1]);
+
+    return Result;
+}
+
+COVERAGE(HMM_MulM2F, 1)
+static inline HMM_Mat2 HMM_MulM2F(HMM_Mat2 Matrix, float Scalar)
+{
+    ASSERT_COVERED(HMM_MulM2F);
+
+    HMM_Mat2 Result;
+
+    Result.Elements[0][0] = Matrix.Elements[0][0] * Scalar;
+    Result.Elements[0][1] = Matrix.Elements[0][1] * Scalar;
+    Result.Elements[1][0] = Matrix.Elements[1][0] * Scalar;
+    Result.Elements[1][1] = Matrix.Elements[1][1] * Scalar;
+
+    return Result;
+}
+
+COVERAGE(HMM_DivM2F, 1)
+static inline HMM_Mat2 HMM_DivM2F(HMM_Mat2 Matrix, float Scalar)
+{
+    ASSERT_COVERED(HMM_DivM2F);
+
+    HMM_Mat2 Result;
+
+    Result.Elements[0][0] = Matrix.Elements[0][0] / Scalar;
+    Result.Elements[0][1] = Matrix.Elements[0][1] / Scalar;
+    Result.Elements[1][0] = Matrix.Elements[1][0] / Scalar;
+    Result.Elements[1][1] = Matrix.Elements[1][1] / Scalar;
+
+    return Result;
+}
+
+COVERAGE(HMM_DeterminantM2, 1)
+static inline float HMM_DeterminantM2(HMM_Mat2 Matrix)
+{
+    ASSERT_COVERED(HMM_DeterminantM2);
+    return Matrix.Elements[0][0]*Matrix.Elements[1][1] - Matrix.Elements[0][1]*Matrix.Elements[1][0];
+}
+
+
+COVERAGE(HMM_InvGeneralM2, 1)
+static inline HMM_Mat2 HMM_InvGeneralM2(HMM_Mat2 Matrix)
+{
+    ASSERT_COVERED(HMM_InvGeneralM2);
+
+    HMM_Mat2 Result;
+    float InvDeterminant = 1.0f / HMM_DeterminantM2(Matrix);
+    Result.Elements[0][0] = InvDeterminant * +Matrix.Elements[1][1];
+    Result.Elements[1][1] = InvDeterminant * +Matrix.Elements[0][0];
+    Result.Elements[0][1] = InvDeterminant * -Matrix.Elements[0][1];
+    Result.Elements[1][0] = InvDeterminant * -Matrix.Elements[1][0];
+
+    return Result;
+}
+
+/*
+ * 3x3 Matrices
+ */
+
+#if defined(HANDMADE_MATH__USE_SSE) || defined(HANDMADE_MATH__USE_NEON)
+/* NOTE: The 36-byte HMM_Mat3 is accessed as elements 0-3, 4-7 and 8, the same pieces a struct copy
+   writes, so a matrix the caller just stored can be loaded straight from the store buffer. */
+static inline void _HMM_LoadM3A(const HMM_Mat3 *Matrix, HMM_Vec3A *Column0, HMM_Vec3A *Column1, HMM_Vec3A *Column2)
+{
+    const float *Elements = &Matrix->Elements[0][0];
+#ifdef HANDMADE_MATH__USE_SSE
+    __m128 Low = _mm_loadu_ps(Elements);
+    __m128 High = _mm_loadu_ps(Elements + 4);
+    __m128 Last = _mm_load_ss(Elements + 8);
+    __m128 Middle = _mm_shuffle_ps(Low, High, _MM_SHUFFLE(1, 0, 3, 3));
+    Column0->SSE = Low;
+    Column1->SSE = _mm_shuffle_ps(Middle, Middle, _MM_SHUFFLE(3, 3, 2, 0));
+    Column2->SSE = _mm_shuffle_ps(High, Last, _MM_SHUFFLE(1, 0, 3, 2));
+#else
+    float32x4_t Low = vld1q_f32(Elements);
+    float32x4_t High = vld1q_f32(Elements + 4);
+    float32x4_t Last = vld1q_dup_f32(Elements + 8);
+    Column0->NEON = Low;
+    Column1->NEON = vextq_f32(Low, High, 3);
+    Column2->NEON = vextq_f32(High, Last, 2);
+#endif
+}
+
+static inline HMM_Mat3 _HMM_StoreM3A(HMM_Vec3A Column0, HMM_Vec3A Column1, HMM_Vec3A Column2)
+{
+    HMM_Mat3 Result;
+    float *Elements = &Result.Elements[0][0];
+
+#ifdef HANDMADE_MATH__USE_SSE
+    __m128 Joint = _mm_shuffle_ps(Column0.SSE, Column1.SSE, _MM_SHUFFLE(0, 0, 2, 2));
+    _mm_storeu_ps(Elements, _mm_shuffle_ps(Column0.SSE, Joint, _MM_SHUFFLE(2, 0, 1, 0)));
+    _mm_storeu_ps(Elements + 4, _mm_shuffle_ps(Column1.SSE, Column2.SSE, _MM_SHUFFLE(1, 0, 2, 1)));
+    _mm_store_ss(Elements + 8, _mm_movehl_ps(Column2.SSE, Column2.SSE));
+#else
+    vst1q_f32(Elements, vcopyq_laneq_f32(Column0.NEON, 3, Column1.NEON, 0));
+    vst1q_f32(Elements + 4, vcombine_f32(vget_low_f32(vextq_f32(Column1.NEON, Column1.NEON, 1)), vget_low_f32(Column2.NEON)));
+    vst1q_lane_f32(Elements + 8, Column2.NEON, 2);
+#endif
+
+    return Result;
+}
+
+// Vector.X * Column0 + Vector.Y * Column1 + Vector.Z * Column2
+static inline HMM_Vec3A _HMM_LinearCombineV3A(HMM_Vec3 Vector, HMM_Vec3A Column0, HMM_Vec3A Column1, HMM_Vec3A Column2)
+{
+    HMM_Vec3A Result;
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _mm_mul_ps(_mm_set1_ps(Vector.X), Column0.SSE);
+    Result.SSE = _HMM_MADD_PS(_mm_set1_ps(Vector.Y), Column1.SSE, Result.SSE);
+    Result.SSE = _HMM_MADD_PS(_mm_set1_ps(Vector.Z), Column2.SSE, Result.SSE);
+#else
+    Result.NEON = vmulq_n_f32(Column0.NEON, Vector.X);
+    Result.NEON = vfmaq_n_f32(Result.NEON, Column1.NEON, Vector.Y);
+    Result.NEON = vfmaq_n_f32(Result.NEON, Column2.NEON, Vector.Z);
+#endif
+    return Result;
+}
+
+// Transposes the XYZ parts of three columns.
+static inline void _HMM_TransposeV3A(HMM_Vec3A *Column0, HMM_Vec3A *Column1, HMM_Vec3A *Column2)
+{
+#ifdef HANDMADE_MATH__USE_SSE
+    __m128 Column3 = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(Column0->SSE, Column1->SSE, Column2->SSE, Column3);
+#else
+    float32x4_t Zero = vdupq_n_f32(0.0f);
+    float32x4x2_t Pair01 = vtrnq_f32(Column0->NEON, Column1->NEON);
+    float32x4x2_t Pair23 = vtrnq_f32(Column2->NEON, Zero);
+    Column0->NEON = vcombine_f32(vget_low_f32(Pair01.val[0]), vget_low_f32(Pair23.val[0]));
+    Column1->NEON = vcombine_f32(vget_low_f32(Pair01.val[1]), vget_low_f32(Pair23.val[1]));
+    Column2->NEON = vcombine_f32(vget_high_f32(Pair01.val[0]), vget_high_f32(Pair23.val[0]));
+#endif
+}
+#endif
+
+COVERAGE(HMM_M3, 1)
+static inline HMM_Mat3 HMM_M3(void)
+{
+    ASSERT_COVERED(HMM_M3);
+    HMM_Mat3 Result = {0};
+    return Result;
+}
+
+COVERAGE(HMM_M3D, 1)
+static inline HMM_Mat3 HMM_M3D(float Diagonal)
+{
+    ASSERT_COVERED(HMM_M3D);
+
+    HMM_Mat3 Result = {0};
+    Result.Elements[0][0] = Diagonal;
+    Result.Elements[1][1] = Diagonal;
+    Result.Elements[2][2] = Diagonal;
+
+    return Result;
+}
+
+COVERAGE(HMM_TransposeM3, 1)
+static inline HMM_Mat3 HMM_TransposeM3(HMM_Mat3 Matrix)
+{
+    ASSERT_COVERED(HMM_TransposeM3);
+
+#if defined(HANDMADE_MATH__USE_SSE) || defined(HANDMADE_MATH__USE_NEON)
+    HMM_Vec3A Column0, Column1, Column2;
+    _HMM_LoadM3A(&Matrix, &Column0, &Column1, &Column2);
+    _HMM_TransposeV3A(&Column0, &Column1, &Column2);
+    return _HMM_StoreM3A(Column0, Column1, Column2);
+#else
+    HMM_Mat3 Result = Matrix;
+
+    Result.Elements[0][1] = Matrix.Elements[1][0];
+    Result.Elements[0][2] = Matrix.Elements[2][0];
+    Result.Elements[1][0] = Matrix.Elements[0][1];
+    Result.Elements[1][2] = Matrix.Elements[2][1];
+    Result.Elements[2][1] = Matrix.Elements[1][2];
+    Result.Elements[2][0] = Matrix.Elements[0][2];
+
+    return Result;
+#endif
+}
+
+COVERAGE(HMM_AddM3, 1)
+static inline HMM_Mat3 HMM_AddM3(HMM_Mat3 Left, HMM_Mat3 Right)
+{
+    ASSERT_COVERED(HMM_AddM3);
+
+    HMM_Mat3 Result;
+
+    Result.Elements[0][0] = Left.Elements[0][0] + Right.Elements[0][0];
+    Result.Elements[0][1] = Left.Elements[0][1] + Right.Elements[0][1];
+    Result.Elements[0][2] = Left.Elements[0][2] + Right.Elements[0][2];
+    Result.Elements[1][0] = Left.Elements[1][0] + Right.Elements[1][0];
+    Result.Elements[1][1] = Left.Elements[1][1] + Right.Elements[1][1];
+    Result.Elements[1][2] = Left.Elements[1][2] + Right.Elements[1][2];
+    Result.Elements[2][0] = Left.Elements[2][0] + Right.Elements[2][0];
+    Result.Elements[2][1] = Left.Elements[2][1] + Right.Elements[2][1];
+    Result.Elements[2][2] = Left.Elements[2][2] + Right.Elements[2][2];
+
+    return Result;
+}
+
+COVERAGE(HMM_SubM3, 1)
+static inline HMM_Mat3 HMM_SubM3(HMM_Mat3 Left, HMM_Mat3 Right)
+{
+    ASSERT_COVERED(HMM_SubM3);
+
+    HMM_Mat3 Result;
+
+    Result.Elements[0][0] = Left.Elements[0][0] - Right.Elements[0][0];
+    Result.Elements[0][1] = Left.Elements[0][1] - Right.Elements[0][1];
+    Result.Elements[0][2] = Left.Elements[0][2] - Right.Elements[0][2];
+    Result.Elements[1][0] = Left.Elements[1][0] - Right.Elements[1][0];
+    Result.Elements[1][1] = Left.Elements[1][1] - Right.Elements[1][1];
+    Result.Elements[1][2] = Left.Elements[1][2] - Right.Elements[1][2];
+    Result.Elements[2][0] = Left.Elements[2][0] - Right.Elements[2][0];
+    Result.Elements[2][1] = Left.Elements[2][1] - Right.Elements[2][1];
+    Result.Elements[2][2] = Left.Elements[2][2] - Right.Elements[2][2];
+
+    return Result;
+}
+
+COVERAGE(HMM_MulM3V3, 1)
+static inline HMM_Vec3 HMM_MulM3V3(HMM_Mat3 Matrix, HMM_Vec3 Vector)
+{
+    ASSERT_COVERED(HMM_MulM3V3);
+
+    /* NOTE: This stays scalar. Moving one HMM_Vec3 in and out of a register costs as much as the
+       arithmetic; use HMM_MulM3V3Array for streams of vectors. */
+    HMM_Vec3 Result;
+
+    Result.X = Vector.Elements[0] * Matrix.Columns[0].X;
+    Result.Y = Vector.Elements[0] * Matrix.Columns[0].Y;
+    Result.Z = Vector.Elements[0] * Matrix.Columns[0].Z;
+
+    Result.X += Vector.Elements[1] * Matrix.Columns[1].X;
+    Result.Y += Vector.Elements[1] * Matrix.Columns[1].Y;
+    Result.Z += Vector.Elements[1] * Matrix.Columns[1].Z;
+
+    Result.X += Vector.Elements[2] * Matrix.Columns[2].X;
+    Result.Y += Vector.Elements[2] * Matrix.Columns[2].Y;
+    Result.Z += Vector.Elements[2] * Matrix.Columns[2].Z;
+
+    return Result;
+}
+
+COVERAGE(HMM_MulM3, 1)
+static inline HMM_Mat3 HMM_MulM3(HMM_Mat3 Left, HMM_Mat3 Right)
+{
+    ASSERT_COVERED(HMM_MulM3);
+
+#if defined(HANDMADE_MATH__USE_SSE) || defined(HANDMADE_MATH__USE_NEON)
+    HMM_Vec3A Left0, Left1, Left2;
+    _HMM_LoadM3A(&Left, &Left0, &Left1, &Left2);
+    return _HMM_StoreM3A(_HMM_LinearCombineV3A(Right.Columns[0], Left0, Left1, Left2),
+                         _HMM_LinearCombineV3A(Right.Columns[1], Left0, Left1, Left2),
+                         _HMM_LinearCombineV3A(Right.Columns[2], Left0, Left1, Left2));
+#else
+    HMM_Mat3 Result;
+    Result.Columns[0] = HMM_MulM3V3(Left, Right.Columns[0]);
+    Result.Columns[1] = HMM_MulM3V3(Left, Right.Columns[1]);
+    Result.Columns[2] = HMM_MulM3V3(Left, Right.Columns[2]);
+
+    return Result;
+#endif
+}
+
+COVERAGE(HMM_MulM3F, 1)
+static inline HMM_Mat3 HMM_MulM3F(HMM_Mat3 Matrix, float Scalar)
+{
+    ASSERT_COVERED(HMM_MulM3F);
+
+    HMM_Mat3 Result;
+
+    Result.Elements[0][0] = Matrix.Elements[0][0] * Scalar;
+    Result.Elements[0][1] = Matrix.Elements[0][1] * Scalar;
+    Result.Elements[0][2] = Matrix.Elements[0][2] * Scalar;
+    Result.Elements[1][0] = Matrix.Elements[1][0] * Scalar;
+    Result.Elements[1][1] = Matrix.Elements[1][1] * Scalar;
+    Result.Elements[1][2] = Matrix.Elements[1][2] * Scalar;
+    Result.Elements[2][0] = Matrix.Elements[2][0] * Scalar;
+    Result.Elements[2][1] = Matrix.Elements[2][1] * Scalar;
+    Result.Elements[2][2] = Matrix.Elements[2][2] * Scalar;
+
+    return Result;
+}
+
+COVERAGE(HMM_DivM3F, 1)
+static inline HMM_Mat3 HMM_DivM3F(HMM_Mat3 Matrix, float Scalar)
+{
+    ASSERT_COVERED(HMM_DivM3F);
+
+    HMM_Mat3 Result;
+
+    Result.Elements[0][0] = Matrix.Elements[0][0] / Scalar;
+    Result.Elements[0][1] = Matrix.Elements[0][1] / Scalar;
+    Result.Elements[0][2] = Matrix.Elements[0][2] / Scalar;
+    Result.Elements[1][0] = Matrix.Elements[1][0] / Scalar;
+    Result.Elements[1][1] = Matrix.Elements[1][1] / Scalar;
+    Result.Elements[1][2] = Matrix.Elements[1][2] / Scalar;
+    Result.Elements[2][0] = Matrix.Elements[2][0] / Scalar;
+    Result.Elements[2][1] = Matrix.Elements[2][1] / Scalar;
+    Result.Elements[2][2] = Matrix.Elements[2][2] / Scalar;
+
+    return Result;
+}
+
+COVERAGE(HMM_DeterminantM3, 1)
+static inline float HMM_DeterminantM3(HMM_Mat3 Matrix)
+{
+    ASSERT_COVERED(HMM_DeterminantM3);
+
+#if defined(HANDMADE_MATH__USE_SSE) || defined(HANDMADE_MATH__USE_NEON)
+    HMM_Vec3A Column0, Column1, Column2;
+    _HMM_LoadM3A(&Matrix, &Column0, &Column1, &Column2);
+    return HMM_DotV3A(HMM_CrossV3A(Column0, Column1), Column2);
+#else
+    HMM_Mat3 Cross;
+    Cross.Columns[0] = HMM_Cross(Matrix.Columns[1], Matrix.Columns[2]);
+    Cross.Columns[1] = HMM_Cross(Matrix.Columns[2], Matrix.Columns[0]);
+    Cross.Columns[2] = HMM_Cross(Matrix.Columns[0], Matrix.Columns[1]);
+
+    return HMM_DotV3(Cross.Columns[2], Matrix.Columns[2]);
+#endif
+}
+
+COVERAGE(HMM_InvGeneralM3, 1)
+static inline HMM_Mat3 HMM_InvGeneralM3(HMM_Mat3 Matrix)
+{
+    ASSERT_COVERED(HMM_InvGeneralM3);
+
+#if defined(HANDMADE_MATH__USE_SSE) || defined(HANDMADE_MATH__USE_NEON)
+    HMM_Vec3A Column0, Column1, Column2;
+    _HMM_LoadM3A(&Matrix, &Column0, &Column1, &Column2);
+
+    HMM_Vec3A Cross0 = HMM_CrossV3A(Column1, Column2);
+    HMM_Vec3A Cross1 = HMM_CrossV3A(Column2, Column0);
+    HMM_Vec3A Cross2 = HMM_CrossV3A(Column0, Column1);
+
+    float InvDeterminant = 1.0f / HMM_DotV3A(Cross2, Column2);
+
+    Cross0 = HMM_MulV3AF(Cross0, InvDeterminant);
+    Cross1 = HMM_MulV3AF(Cross1, InvDeterminant);
+    Cross2 = HMM_MulV3AF(Cross2, InvDeterminant);
+    _HMM_TransposeV3A(&Cross0, &Cross1, &Cross2);
+
+    return _HMM_StoreM3A(Cross0, Cross1, Cross2);
+#else
+    HMM_Mat3 Cross;
+    Cross.Columns[0] = HMM_Cross(Matrix.Columns[1], Matrix.Columns[2]);
+    Cross.Columns[1] = HMM_Cross(Matrix.Columns[2], Matrix.Columns[0]);
+    Cross.Columns[2] = HMM_Cross(Matrix.Columns[0], Matrix.Columns[1]);
+
+    float InvDeterminant = 1.0f / HMM_DotV3(Cross.Columns[2], Matrix.Columns[2]);
+
+    HMM_Mat3 Result;
+    Result.Columns[0] = HMM_MulV3F(Cross.Columns[0], InvDeterminant);
+    Result.Columns[1] = HMM_MulV3F(Cross.Columns[1], InvDeterminant);
+    Result.Columns[2] = HMM_MulV3F(Cross.Columns[2], InvDeterminant);
+
+    return HMM_TransposeM3(Result);
+#endif
+}
+
+COVERAGE(HMM_MulM3V3Array, 1)
+// Multiplies Count vectors by Matrix, e.g. to transform a stream of normals by a normal matrix.
+// Out may be the same array as In.
+static inline void HMM_MulM3V3Array(HMM_Mat3 Matrix, const HMM_Vec3 *In, HMM_Vec3 *Out, int Count)
+{
+    ASSERT_COVERED(HMM_MulM3V3Array);
+
+#if defined(HANDMADE_MATH__USE_SSE) || defined(HANDMADE_MATH__USE_NEON)
+    int Index = 0;
+
+    /* NOTE: Four vectors at a time, deinterleaved into X, Y and Z like HMM_V3ArrayToSoA, so that each
+       matrix element is broadcast once and no lanes are wasted on padding. Each lane is computed in
+       the same order as HMM_MulM3V3. */
+#ifdef HANDMADE_MATH__USE_SSE
+    __m128 M00 = _mm_set1_ps(Matrix.Elements[0][0]), M01 = _mm_set1_ps(Matrix.Elements[0][1]), M02 = _mm_set1_ps(Matrix.Elements[0][2]);
+    __m128 M10 = _mm_set1_ps(Matrix.Elements[1][0]), M11 = _mm_set1_ps(Matrix.Elements[1][1]), M12 = _mm_set1_ps(Matrix.Elements[1][2]);
+    __m128 M20 = _mm_set1_ps(Matrix.Elements[2][0]), M21 = _mm_set1_ps(Matrix.Elements[2][1]), M22 = _mm_set1_ps(Matrix.Elements[2][2]);
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        const float *Source = &In[Index].Elements[0];
+        __m128 X, Y, Z;
+        _HMM_DeinterleaveV3SSE(_mm_loadu_ps(Source + 0), _mm_loadu_ps(Source + 4), _mm_loadu_ps(Source + 8), &X, &Y, &Z);
+
+        __m128 ResultX = _HMM_MADD_PS(Z, M20, _HMM_MADD_PS(Y, M10, _mm_mul_ps(X, M00)));
+        __m128 ResultY = _HMM_MADD_PS(Z, M21, _HMM_MADD_PS(Y, M11, _mm_mul_ps(X, M01)));
+        __m128 ResultZ = _HMM_MADD_PS(Z, M22, _HMM_MADD_PS(Y, M12, _mm_mul_ps(X, M02)));
+        _HMM_StoreV3x4SSE(&Out[Index].Elements[0], ResultX, ResultY, ResultZ);
+    }
+#else
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        float32x4x3_t Vectors = vld3q_f32(&In[Index].Elements[0]);
+        float32x4x3_t Result;
+        for (int Row = 0; Row < 3; ++Row)
+        {
+            Result.val[Row] = vmulq_n_f32(Vectors.val[0], Matrix.Elements[0][Row]);
+            Result.val[Row] = vfmaq_n_f32(Result.val[Row], Vectors.val[1], Matrix.Elements[1][Row]);
+            Result.val[Row] = vfmaq_n_f32(Result.val[Row], Vectors.val[2], Matrix.Elements[2][Row]);
+        }
+        vst3q_f32(&Out[Index].Elements[0], Result);
+    }
+#endif
+
+    HMM_Vec3A Column0, Column1, Column2;
+    _HMM_LoadM3A(&Matrix, &Column0, &Column1, &Column2);
+    for (; Index < Count; ++Index)
+    {
+        Out[Index] = _HMM_LinearCombineV3A(In[Index], Column0, Column1, Column2).XYZ;
+    }
+#else
+    for (int Index = 0; Index < Count; ++Index)
+    {
+        Out[Index] = HMM_MulM3V3(Matrix, In[Index]);
+    }
+#endif
+}
+
+/*
+ * 4x4 Matrices
+ */
+
+COVERAGE(HMM_M4, 1)
+static inline HMM_Mat4 HMM_M4(void)
+{
+    ASSERT_COVERED(HMM_M4);
+    HMM_Mat4 Result = {0};
+    return Result;
+}
+
+COVERAGE(HMM_M4D, 1)
+static inline HMM_Mat4 HMM_M4D(float Diagonal)
+{
+    ASSERT_COVERED(HMM_M4D);
+
+    HMM_Mat4 Result = {0};
+    Result.Elements[0][0] = Diagonal;
+    Result.Elements[1][1] = Diagonal;
+    Result.Elements[2][2] = Diagonal;
+    Result.Elements[3][3] = Diagonal;
+
+    return Result;
+}
+
+COVERAGE(HMM_TransposeM4, 1)
+static inline HMM_Mat4 HMM_TransposeM4(HMM_Mat4 Matrix)
+{
+    ASSERT_COVERED(HMM_TransposeM4);
+
+    HMM_Mat4 Result;
+#ifdef HANDMADE_MATH__USE_AVX512
+    __m512i Indices = _mm512_set_epi32(15, 11, 7, 3, 14, 10, 6, 2, 13, 9, 5, 1, 12, 8, 4, 0);
+    _mm512_storeu_ps(Result.Elements, _mm512_permutexvar_ps(Indices, _mm512_loadu_ps(Matrix.Elements)));
+#elif defined(HANDMADE_MATH__USE_AVX)
+    __m256 Columns02 = _mm256_insertf128_ps(_mm256_castps128_ps256(Matrix.Columns[0].SSE), Matrix.Columns[2].SSE, 1);
+    __m256 Columns13 = _mm256_insertf128_ps(_mm256_castps128_ps256(Matrix.Columns[1].SSE), Matrix.Columns[3].SSE, 1);
+    __m256 Rows01, Rows23;
+    _HMM_TransposeAVX(Columns02, Columns13, &Rows01, &Rows23);
+    _mm256_storeu_ps(Result.Columns[0].Elements, Rows01);
+    _mm256_storeu_ps(Result.Columns[2].Elements, Rows23);
+#elif defined(HANDMADE_MATH__USE_SSE)
+    Result = Matrix;
+    _MM_TRANSPOSE4_PS(Result.Columns[0].SSE, Result.Columns[1].SSE, Result.Columns[2].SSE, Result.Columns[3].SSE);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4x4_t Transposed = vld4q_f32((float*)Matrix.Columns);
+    Result.Columns[0].NEON = Transposed.val[0];
+    Result.Columns[1].NEON = Transposed.val[1];
+    Result.Columns[2].NEON = Transposed.val[2];
+    Result.Columns[3].NEON = Transposed.val[3];
+#else
+    Result.Elements[0][0] = Matrix.Elements[0][0];
+    Result.Elements[0][1] = Matrix.Elements[1][0];
+    Result.Elements[0][2] = Matrix.Elements[2][0];
+    Result.Elements[0][3] = Matrix.Elements[3][0];
+    Result.Elements[1][0] = Matrix.Elements[0][1];
+    Result.Elements[1][1] = Matrix.Elements[1][1];
+    Result.Elements[1][2] = Matrix.Elements[2][1];
+    Result.Elements[1][3] = Matrix.Elements[3][1];
+    Result.Elements[2][0] = Matrix.Elements[0][2];
+    Result.Elements[2][1] = Matrix.Elements[1][2];
+    Result.Elements[2][2] = Matrix.Elements[2][2];
+    Result.Elements[2][3] = Matrix.Elements[3][2];
+    Result.Elements[3][0] = Matrix.Elements[0][3];
+    Result.Elements[3][1] = Matrix.Elements[1][3];
+    Result.Elements[3][2] = Matrix.Elements[2][3];
+    Result.Elements[3][3] = Matrix.Elements[3][3];
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_AddM4, 1)
+static inline HMM_Mat4 HMM_AddM4(HMM_Mat4 Left, HMM_Mat4 Right)
+{
+    ASSERT_COVERED(HMM_AddM4);
+
+    HMM_Mat4 Result;
+
+#ifdef HANDMADE_MATH__USE_AVX512
+    _mm512_storeu_ps(Result.Elements, _mm512_add_ps(_mm512_loadu_ps(Left.Elements), _mm512_loadu_ps(Right.Elements)));
+#else
+    Result.Columns[0] = HMM_AddV4(Left.Columns[0], Right.Columns[0]);
+    Result.Columns[1] = HMM_AddV4(Left.Columns[1], Right.Columns[1]);
+    Result.Columns[2] = HMM_AddV4(Left.Columns[2], Right.Columns[2]);
+    Result.Columns[3] = HMM_AddV4(Left.Columns[3], Right.Columns[3]);
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_SubM4, 1)
+static inline HMM_Mat4 HMM_SubM4(HMM_Mat4 Left, HMM_Mat4 Right)
+{
+    ASSERT_COVERED(HMM_SubM4);
+
+    HMM_Mat4 Result;
+
+#ifdef HANDMADE_MATH__USE_AVX512
+    _mm512_storeu_ps(Result.Elements, _mm512_sub_ps(_mm512_loadu_ps(Left.Elements), _mm512_loadu_ps(Right.Elements)));
+#else
+    Result.Columns[0] = HMM_SubV4(Left.Columns[0], Right.Columns[0]);
+    Result.Columns[1] = HMM_SubV4(Left.Columns[1], Right.Columns[1]);
+    Result.Columns[2] = HMM_SubV4(Left.Columns[2], Right.Columns[2]);
+    Result.Columns[3] = HMM_SubV4(Left.Columns[3], Right.Columns[3]);
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_MulM4, 1)
+static inline HMM_Mat4 HMM_MulM4(HMM_Mat4 Left, HMM_Mat4 Right)
+{
+    ASSERT_COVERED(HMM_MulM4);
+
+    HMM_Mat4 Result;
+#ifdef HANDMADE_MATH__USE_AVX512
+    /* NOTE: Same as the LinearCombine path below, but all four columns of Right at once. */
+    __m512 Right512 = _mm512_loadu_ps(Right.Elements);
+    __m512 Result512 = _mm512_mul_ps(_mm512_permute_ps(Right512, 0x00), _mm512_broadcast_f32x4(Left.Columns[0].SSE));
+    Result512 = _HMM_MADD512_PS(_mm512_permute_ps(Right512, 0x55), _mm512_broadcast_f32x4(Left.Columns[1].SSE), Result512);
+    Result512 = _HMM_MADD512_PS(_mm512_permute_ps(Right512, 0xaa), _mm512_broadcast_f32x4(Left.Columns[2].SSE), Result512);
+    Result512 = _HMM_MADD512_PS(_mm512_permute_ps(Right512, 0xff), _mm512_broadcast_f32x4(Left.Columns[3].SSE), Result512);
+    _mm512_storeu_ps(Result.Elements, Result512);
+#elif defined(HANDMADE_MATH__USE_AVX)
+    /* NOTE: Same as the LinearCombine path below, but two columns of Right at a time. */
+    __m256 Left0 = _mm256_insertf128_ps(_mm256_castps128_ps256(Left.Columns[0].SSE), Left.Columns[0].SSE, 1);
+    __m256 Left1 = _mm256_insertf128_ps(_mm256_castps128_ps256(Left.Columns[1].SSE), Left.Columns[1].SSE, 1);
+    __m256 Left2 = _mm256_insertf128_ps(_mm256_castps128_ps256(Left.Columns[2].SSE), Left.Columns[2].SSE, 1);
+    __m256 Left3 = _mm256_insertf128_ps(_mm256_castps128_ps256(Left.Columns[3].SSE), Left.Columns[3].SSE, 1);
+    __m256 Right01 = _mm256_loadu_ps(Right.Columns[0].Elements);
+    __m256 Right23 = _mm256_loadu_ps(Right.Columns[2].Elements);
+
+    __m256 Result01 = _mm256_mul_ps(_mm256_shuffle_ps(Right01, Right01, 0x00), Left0);
+    __m256 Result23 = _mm256_mul_ps(_mm256_shuffle_ps(Right23, Right23, 0x00), Left0);
+    Result01 = _HMM_MADD256_PS(_mm256_shuffle_ps(Right01, Right01, 0x55), Left1, Result01);
+    Result23 = _HMM_MADD256_PS(_mm256_shuffle_ps(Right23, Right23, 0x55), Left1, Result23);
+    Result01 = _HMM_MADD256_PS(_mm256_shuffle_ps(Right01, Right01, 0xaa), Left2, Result01);
+    Result23 = _HMM_MADD256_PS(_mm256_shuffle_ps(Right23, Right23, 0xaa), Left2, Result23);
+    Result01 = _HMM_MADD256_PS(_mm256_shuffle_ps(Right01, Right01, 0xff), Left3, Result01);
+    Result23 = _HMM_MADD256_PS(_mm256_shuffle_ps(Right23, Right23, 0xff), Left3, Result23);
+
+    _mm256_storeu_ps(Result.Columns[0].Elements, Result01);
+    _mm256_storeu_ps(Result.Columns[2].Elements, Result23);
+#else
+    Result.Columns[0] = HMM_LinearCombineV4M4(Right.Columns[0], Left);
+    Result.Columns[1] = HMM_LinearCombineV4M4(Right.Columns[1], Left);
+    Result.Columns[2] = HMM_LinearCombineV4M4(Right.Columns[2], Left);
+    Result.Columns[3] = HMM_LinearCombineV4M4(Right.Columns[3], Left);
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_MulM4F, 1)
+static inline HMM_Mat4 HMM_MulM4F(HMM_Mat4 Matrix, float Scalar)
+{
+    ASSERT_COVERED(HMM_MulM4F);
+
+    HMM_Mat4 Result;
+
+
+#ifdef HANDMADE_MATH__USE_AVX512
+    _mm512_storeu_ps(Result.Elements, _mm512_mul_ps(_mm512_loadu_ps(Matrix.Elements), _mm512_set1_ps(Scalar)));
+#elif defined(HANDMADE_MATH__USE_SSE)
+    __m128 SSEScalar = _mm_set1_ps(Scalar);
+    Result.Columns[0].SSE = _mm_mul_ps(Matrix.Columns[0].SSE, SSEScalar);
+    Result.Columns[1].SSE = _mm_mul_ps(Matrix.Columns[1].SSE, SSEScalar);
+    Result.Columns[2].SSE = _mm_mul_ps(Matrix.Columns[2].SSE, SSEScalar);
+    Result.Columns[3].SSE = _mm_mul_ps(Matrix.Columns[3].SSE, SSEScalar);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.Columns[0].NEON = vmulq_n_f32(Matrix.Columns[0].NEON, Scalar);
+    Result.Columns[1].NEON = vmulq_n_f32(Matrix.Columns[1].NEON, Scalar);
+    Result.Columns[2].NEON = vmulq_n_f32(Matrix.Columns[2].NEON, Scalar);
+    Result.Columns[3].NEON = vmulq_n_f32(Matrix.Columns[3].NEON, Scalar);
+#else
+    Result.Elements[0][0] = Matrix.Elements[0][0] * Scalar;
+    Result.Elements[0][1] = Matrix.Elements[0][1] * Scalar;
+    Result.Elements[0][2] = Matrix.Elements[0][2] * Scalar;
+    Result.Elements[0][3] = Matrix.Elements[0][3] * Scalar;
+    Result.Elements[1][0] = Matrix.Elements[1][0] * Scalar;
+    Result.Elements[1][1] = Matrix.Elements[1][1] * Scalar;
+    Result.Elements[1][2] = Matrix.Elements[1][2] * Scalar;
+    Result.Elements[1][3] = Matrix.Elements[1][3] * Scalar;
+    Result.Elements[2][0] = Matrix.Elements[2][0] * Scalar;
+    Result.Elements[2][1] = Matrix.Elements[2][1] * Scalar;
+    Result.Elements[2][2] = Matrix.Elements[2][2] * Scalar;
+    Result.Elements[2][3] = Matrix.Elements[2][3] * Scalar;
+    Result.Elements[3][0] = Matrix.Elements[3][0] * Scalar;
+    Result.Elements[3][1] = Matrix.Elements[3][1] * Scalar;
+    Result.Elements[3][2] = Matrix.Elements[3][2] * Scalar;
+    Result.Elements[3][3] = Matrix.Elements[3][3] * Scalar;
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_MulM4V4, 1)
+static inline HMM_Vec4 HMM_MulM4V4(HMM_Mat4 Matrix, HMM_Vec4 Vector)
+{
+    ASSERT_COVERED(HMM_MulM4V4);
+    return HMM_LinearCombineV4M4(Vector, Matrix);
+}
+
+static inline void _HMM_MulM4V4ArrayBase(HMM_Mat4 Matrix, const HMM_Vec4 *In, int InStride, HMM_Vec4 *Out, int OutStride, int Count)
+{
+    const char *InBytes = (const char *)In;
+    char *OutBytes = (char *)Out;
+    int Index = 0;
+
+    if (InStride == 0)
+    {
+        InStride = sizeof(HMM_Vec4);
+    }
+    if (OutStride == 0)
+    {
+        OutStride = sizeof(HMM_Vec4);
+    }
+
+#ifdef HANDMADE_MATH__USE_AVX
+    /* NOTE: Each 256-bit register holds two vectors, and each column is duplicated into both halves. */
+    __m256 Column0 = _mm256_insertf128_ps(_mm256_castps128_ps256(Matrix.Columns[0].SSE), Matrix.Columns[0].SSE, 1);
+    __m256 Column1 = _mm256_insertf128_ps(_mm256_castps128_ps256(Matrix.Columns[1].SSE), Matrix.Columns[1].SSE, 1);
+    __m256 Column2 = _mm256_insertf128_ps(_mm256_castps128_ps256(Matrix.Columns[2].SSE), Matrix.Columns[2].SSE, 1);
+    __m256 Column3 = _mm256_insertf128_ps(_mm256_castps128_ps256(Matrix.Columns[3].SSE), Matrix.Columns[3].SSE, 1);
+
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        __m256 V01 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps((const float *)(InBytes + 0*InStride))), _mm_loadu_ps((const float *)(InBytes + 1*InStride)), 1);
+        __m256 V23 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps((const float *)(InBytes + 2*InStride))), _mm_loadu_ps((const float *)(InBytes + 3*InStride)), 1);
+
+        __m256 R01 = _mm256_mul_ps(_mm256_shuffle_ps(V01, V01, 0x00), Column0);
+        __m256 R23 = _mm256_mul_ps(_mm256_shuffle_ps(V23, V23, 0x00), Column0);
+
+        R01 = _HMM_MADD256_PS(_mm256_shuffle_ps(V01, V01, 0x55), Column1, R01);
+        R23 = _HMM_MADD256_PS(_mm256_shuffle_ps(V23, V23, 0x55), Column1, R23);
+
+        R01 = _HMM_MADD256_PS(_mm256_shuffle_ps(V01, V01, 0xaa), Column2, R01);
+        R23 = _HMM_MADD256_PS(_mm256_shuffle_ps(V23, V23, 0xaa), Column2, R23);
+
+        R01 = _HMM_MADD256_PS(_mm256_shuffle_ps(V01, V01, 0xff), Column3, R01);
+        R23 = _HMM_MADD256_PS(_mm256_shuffle_ps(V23, V23, 0xff), Column3, R23);
+
+        _mm_storeu_ps((float *)(OutBytes + 0*OutStride), _mm256_castps256_ps128(R01));
+        _mm_storeu_ps((float *)(OutBytes + 1*OutStride), _mm256_extractf128_ps(R01, 1));
+        _mm_storeu_ps((float *)(OutBytes + 2*OutStride), _mm256_castps256_ps128(R23));
+        _mm_storeu_ps((float *)(OutBytes + 3*OutStride), _mm256_extractf128_ps(R23, 1));
+
+        InBytes += 4*InStride;
+        OutBytes += 4*OutStride;
+    }
+#elif defined(HANDMADE_MATH__USE_SSE)
+    __m128 Column0 = Matrix.Columns[0].SSE;
+    __m128 Column1 = Matrix.Columns[1].SSE;
+    __m128 Column2 = Matrix.Columns[2].SSE;
+    __m128 Column3 = Matrix.Columns[3].SSE;
+
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        __m128 V0 = _mm_loadu_ps((const float *)(InBytes + 0*InStride));
+        __m128 V1 = _mm_loadu_ps((const float *)(InBytes + 1*InStride));
+        __m128 V2 = _mm_loadu_ps((const float *)(InBytes + 2*InStride));
+        __m128 V3 = _mm_loadu_ps((const float *)(InBytes + 3*InStride));
+
+        __m128 R0 = _mm_mul_ps(_mm_shuffle_ps(V0, V0, 0x00), Column0);
+        __m128 R1 = _mm_mul_ps(_mm_shuffle_ps(V1, V1, 0x00), Column0);
+        __m128 R2 = _mm_mul_ps(_mm_shuffle_ps(V2, V2, 0x00), Column0);
+        __m128 R3 = _mm_mul_ps(_mm_shuffle_ps(V3, V3, 0x00), Column0);
+
+        R0 = _HMM_MADD_PS(_mm_shuffle_ps(V0, V0, 0x55), Column1, R0);
+        R1 = _HMM_MADD_PS(_mm_shuffle_ps(V1, V1, 0x55), Column1, R1);
+        R2 = _HMM_MADD_PS(_mm_shuffle_ps(V2, V2, 0x55), Column1, R2);
+        R3 = _HMM_MADD_PS(_mm_shuffle_ps(V3, V3, 0x55), Column1, R3);
+
+        R0 = _HMM_MADD_PS(_mm_shuffle_ps(V0, V0, 0xaa), Column2, R0);
+        R1 = _HMM_MADD_PS(_mm_shuffle_ps(V1, V1, 0xaa), Column2, R1);
+        R2 = _HMM_MADD_PS(_mm_shuffle_ps(V2, V2, 0xaa), Column2, R2);
+        R3 = _HMM_MADD_PS(_mm_shuffle_ps(V3, V3, 0xaa), Column2, R3);
+
+        R0 = _HMM_MADD_PS(_mm_shuffle_ps(V0, V0, 0xff), Column3, R0);
+        R1 = _HMM_MADD_PS(_mm_shuffle_ps(V1, V1, 0xff), Column3, R1);
+        R2 = _HMM_MADD_PS(_mm_shuffle_ps(V2, V2, 0xff), Column3, R2);
+        R3 = _HMM_MADD_PS(_mm_shuffle_ps(V3, V3, 0xff), Column3, R3);
+
+        _mm_storeu_ps((float *)(OutBytes + 0*OutStride), R0);
+        _mm_storeu_ps((float *)(OutBytes + 1*OutStride), R1);
+        _mm_storeu_ps((float *)(OutBytes + 2*OutStride), R2);
+        _mm_storeu_ps((float *)(OutBytes + 3*OutStride), R3);
+
+        InBytes += 4*InStride;
+        OutBytes += 4*OutStride;
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t Column0 = Matrix.Columns[0].NEON;
+    float32x4_t Column1 = Matrix.Columns[1].NEON;
+    float32x4_t Column2 = Matrix.Columns[2].NEON;
+    float32x4_t Column3 = Matrix.Columns[3].NEON;
+
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        float32x4_t V0 = vld1q_f32((const float *)(InBytes + 0*InStride));
+        float32x4_t V1 = vld1q_f32((const float *)(InBytes + 1*InStride));
+        float32x4_t V2 = vld1q_f32((const float *)(InBytes + 2*InStride));
+        float32x4_t V3 = vld1q_f32((const float *)(InBytes + 3*InStride));
+
+        float32x4_t R0 = vmulq_laneq_f32(Column0, V0, 0);
+        float32x4_t R1 = vmulq_laneq_f32(Column0, V1, 0);
+        float32x4_t R2 = vmulq_laneq_f32(Column0, V2, 0);
+        float32x4_t R3 = vmulq_laneq_f32(Column0, V3, 0);
+
+        R0 = vfmaq_laneq_f32(R0, Column1, V0, 1);
+        R1 = vfmaq_laneq_f32(R1, Column1, V1, 1);
+        R2 = vfmaq_laneq_f32(R2, Column1, V2, 1);
+        R3 = vfmaq_laneq_f32(R3, Column1, V3, 1);
+
+        R0 = vfmaq_laneq_f32(R0, Column2, V0, 2);
+        R1 = vfmaq_laneq_f32(R1, Column2, V1, 2);
+        R2 = vfmaq_laneq_f32(R2, Column2, V2, 2);
+        R3 = vfmaq_laneq_f32(R3, Column2, V3, 2);
+
+        R0 = vfmaq_laneq_f32(R0, Column3, V0, 3);
+        R1 = vfmaq_laneq_f32(R1, Column3, V1, 3);
+        R2 = vfmaq_laneq_f32(R2, Column3, V2, 3);
+        R3 = vfmaq_laneq_f32(R3, Column3, V3, 3);
+
+        vst1q_f32((float *)(OutBytes + 0*OutStride), R0);
+        vst1q_f32((float *)(OutBytes + 1*OutStride), R1);
+        vst1q_f32((float *)(OutBytes + 2*OutStride), R2);
+        vst1q_f32((float *)(OutBytes + 3*OutStride), R3);
+
+        InBytes += 4*InStride;
+        OutBytes += 4*OutStride;
+    }
+#endif
+
+    /* NOTE: Remaining vectors (or all of them, without SIMD) go through the single-vector path. */
+    for (; Index < Count; ++Index)
+    {
+        const float *Source = (const float *)InBytes;
+        float *Dest = (float *)OutBytes;
+
+        HMM_Vec4 Result = HMM_LinearCombineV4M4(HMM_V4(Source[0], Source[1], Source[2], Source[3]), Matrix);
+        Dest[0] = Result.X;
+        Dest[1] = Result.Y;
+        Dest[2] = Result.Z;
+        Dest[3] = Result.W;
+
+        InBytes += InStride;
+        OutBytes += OutStride;
+    }
+}
+
+COVERAGE(HMM_MulM4V4Array, 1)
+// Transforms Count vectors by Matrix, giving exactly the same results as calling HMM_MulM4V4 on
+// each one. InStride and OutStride are the distances in bytes between consecutive vectors, or 0 for
+// tightly packed arrays. The vectors only need float alignment, and In and Out may be the same array.
+// (With HANDMADE_MATH_RUNTIME_DISPATCH, the AVX2 and AVX-512 tiers may differ in the last bit.)
+static inline void HMM_MulM4V4Array(HMM_Mat4 Matrix, const HMM_Vec4 *In, int InStride, HMM_Vec4 *Out, int OutStride, int Count)
+{
+    ASSERT_COVERED(HMM_MulM4V4Array);
+
+#ifdef HANDMADE_MATH__USE_DISPATCH
+    _HMM_GetDispatch()->MulM4V4Array(Matrix, In, InStride, Out, OutStride, Count);
+#else
+    _HMM_MulM4V4ArrayBase(Matrix, In, InStride, Out, OutStride, Count);
+#endif
+}
+
+COVERAGE(HMM_DivM4F, 1)
+static inline HMM_Mat4 HMM_DivM4F(HMM_Mat4 Matrix, float Scalar)
+{
+    ASSERT_COVERED(HMM_DivM4F);
+
+    HMM_Mat4 Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    __m128 SSEScalar = _mm_set1_ps(Scalar);
+    Result.Columns[0].SSE = _mm_div_ps(Matrix.Columns[0].SSE, SSEScalar);
+    Result.Columns[1].SSE = _mm_div_ps(Matrix.Columns[1].SSE, SSEScalar);
+    Result.Columns[2].SSE = _mm_div_ps(Matrix.Columns[2].SSE, SSEScalar);
+    Result.Columns[3].SSE = _mm_div_ps(Matrix.Columns[3].SSE, SSEScalar);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t NEONScalar = vdupq_n_f32(Scalar);
+    Result.Columns[0].NEON = vdivq_f32(Matrix.Columns[0].NEON, NEONScalar);
+    Result.Columns[1].NEON = vdivq_f32(Matrix.Columns[1].NEON, NEONScalar);
+    Result.Columns[2].NEON = vdivq_f32(Matrix.Columns[2].NEON, NEONScalar);
+    Result.Columns[3].NEON = vdivq_f32(Matrix.Columns[3].NEON, NEONScalar);
+#else
     Result.Elements[0][0] = Matrix.Elements[0][0] / Scalar;
     Result.Elements[0][1] = Matrix.Elements[0][1] / Scalar;
     Result.Elements[0][2] = Matrix.Elements[0][2] / Scalar;
@@ -1681,429 +4235,5266 @@ static inline HMM_Mat4 HMM_DivM4F(HMM_Mat4 Matrix, float Scalar)
     return Result;
 }
 
-COVERAGE(HMM_DeterminantM4, 1)
-static inline float HMM_DeterminantM4(HMM_Mat4 Matrix)
+COVERAGE(HMM_DeterminantM4, 1)
+static inline float HMM_DeterminantM4(HMM_Mat4 Matrix)
+{
+    ASSERT_COVERED(HMM_DeterminantM4);
+
+    HMM_Vec3 C01 = HMM_Cross(Matrix.Columns[0].XYZ, Matrix.Columns[1].XYZ);
+    HMM_Vec3 C23 = HMM_Cross(Matrix.Columns[2].XYZ, Matrix.Columns[3].XYZ);
+    HMM_Vec3 B10 = HMM_SubV3(HMM_MulV3F(Matrix.Columns[0].XYZ, Matrix.Columns[1].W), HMM_MulV3F(Matrix.Columns[1].XYZ, Matrix.Columns[0].W));
+    HMM_Vec3 B32 = HMM_SubV3(HMM_MulV3F(Matrix.Columns[2].XYZ, Matrix.Columns[3].W), HMM_MulV3F(Matrix.Columns[3].XYZ, Matrix.Columns[2].W));
+
+    return HMM_DotV3(C01, B32) + HMM_DotV3(C23, B10);
+}
+
+COVERAGE(HMM_InvGeneralM4, 1)
+// Returns a general-purpose inverse of an HMM_Mat4. Note that special-purpose inverses of many transformations
+// are available and will be more efficient.
+static inline HMM_Mat4 HMM_InvGeneralM4(HMM_Mat4 Matrix)
+{
+    ASSERT_COVERED(HMM_InvGeneralM4);
+
+#ifdef HANDMADE_MATH__USE_AVX
+    /* NOTE: The same computation as below, with columns packed as [0|2] and [1|3] so that
+       C01 and C23, B10 and B32, and pairs of result columns are each computed together. */
+    __m256 Columns02 = _mm256_insertf128_ps(_mm256_castps128_ps256(Matrix.Columns[0].SSE), Matrix.Columns[2].SSE, 1);
+    __m256 Columns13 = _mm256_insertf128_ps(_mm256_castps128_ps256(Matrix.Columns[1].SSE), Matrix.Columns[3].SSE, 1);
+    __m256 W02 = _mm256_shuffle_ps(Columns02, Columns02, 0xff);
+    __m256 W13 = _mm256_shuffle_ps(Columns13, Columns13, 0xff);
+
+    __m256 C0123 = _HMM_CrossAVX(Columns02, Columns13);
+    __m256 B1032 = _mm256_sub_ps(_mm256_mul_ps(Columns02, W13), _mm256_mul_ps(Columns13, W02));
+
+    __m256 Products = _mm256_mul_ps(C0123, _mm256_permute2f128_ps(B1032, B1032, 0x01));
+    __m128 Determinant = _mm_add_ps(_mm256_castps256_ps128(Products), _mm256_extractf128_ps(Products, 1));
+    Determinant = _mm_add_ps(Determinant, _mm_shuffle_ps(Determinant, Determinant, _MM_SHUFFLE(2, 3, 0, 1)));
+    Determinant = _mm_add_ps(Determinant, _mm_shuffle_ps(Determinant, Determinant, _MM_SHUFFLE(1, 0, 3, 2)));
+    __m128 InvDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), Determinant);
+    __m256 InvDeterminant256 = _mm256_insertf128_ps(_mm256_castps128_ps256(InvDeterminant), InvDeterminant, 1);
+
+    C0123 = _mm256_mul_ps(C0123, InvDeterminant256);
+    B1032 = _mm256_mul_ps(B1032, InvDeterminant256);
+    __m256 C2301 = _mm256_permute2f128_ps(C0123, C0123, 0x01);
+    __m256 B3210 = _mm256_permute2f128_ps(B1032, B1032, 0x01);
+
+    __m256 XYZ02 = _mm256_add_ps(_HMM_CrossAVX(Columns13, B3210), _mm256_mul_ps(C2301, W13));
+    __m256 XYZ13 = _mm256_sub_ps(_HMM_CrossAVX(B3210, Columns02), _mm256_mul_ps(C2301, W02));
+    __m256 Dot02 = _HMM_HorizontalSumAVX(_mm256_mul_ps(Columns13, C2301));
+    __m256 Dot13 = _HMM_HorizontalSumAVX(_mm256_mul_ps(Columns02, C2301));
+    __m256 Result02 = _mm256_blend_ps(XYZ02, _mm256_sub_ps(_mm256_setzero_ps(), Dot02), 0x88);
+    __m256 Result13 = _mm256_blend_ps(XYZ13, Dot13, 0x88);
+
+    HMM_Mat4 Result;
+    __m256 Rows01, Rows23;
+    _HMM_TransposeAVX(Result02, Result13, &Rows01, &Rows23);
+    _mm256_storeu_ps(Result.Columns[0].Elements, Rows01);
+    _mm256_storeu_ps(Result.Columns[2].Elements, Rows23);
+    return Result;
+#else
+    HMM_Vec3A Column0 = HMM_V4ToV3A(Matrix.Columns[0]);
+    HMM_Vec3A Column1 = HMM_V4ToV3A(Matrix.Columns[1]);
+    HMM_Vec3A Column2 = HMM_V4ToV3A(Matrix.Columns[2]);
+    HMM_Vec3A Column3 = HMM_V4ToV3A(Matrix.Columns[3]);
+
+    HMM_Vec3A C01 = HMM_CrossV3A(Column0, Column1);
+    HMM_Vec3A C23 = HMM_CrossV3A(Column2, Column3);
+    HMM_Vec3A B10 = HMM_SubV3A(HMM_MulV3AF(Column0, Matrix.Columns[1].W), HMM_MulV3AF(Column1, Matrix.Columns[0].W));
+    HMM_Vec3A B32 = HMM_SubV3A(HMM_MulV3AF(Column2, Matrix.Columns[3].W), HMM_MulV3AF(Column3, Matrix.Columns[2].W));
+
+    float InvDeterminant = 1.0f / (HMM_DotV3A(C01, B32) + HMM_DotV3A(C23, B10));
+    C01 = HMM_MulV3AF(C01, InvDeterminant);
+    C23 = HMM_MulV3AF(C23, InvDeterminant);
+    B10 = HMM_MulV3AF(B10, InvDeterminant);
+    B32 = HMM_MulV3AF(B32, InvDeterminant);
+
+    HMM_Mat4 Result;
+    Result.Columns[0] = HMM_V3AToV4(HMM_AddV3A(HMM_CrossV3A(Column1, B32), HMM_MulV3AF(C23, Matrix.Columns[1].W)), -HMM_DotV3A(Column1, C23));
+    Result.Columns[1] = HMM_V3AToV4(HMM_SubV3A(HMM_CrossV3A(B32, Column0), HMM_MulV3AF(C23, Matrix.Columns[0].W)), +HMM_DotV3A(Column0, C23));
+    Result.Columns[2] = HMM_V3AToV4(HMM_AddV3A(HMM_CrossV3A(Column3, B10), HMM_MulV3AF(C01, Matrix.Columns[3].W)), -HMM_DotV3A(Column3, C01));
+    Result.Columns[3] = HMM_V3AToV4(HMM_SubV3A(HMM_CrossV3A(B10, Column2), HMM_MulV3AF(C01, Matrix.Columns[2].W)), +HMM_DotV3A(Column2, C01));
+
+    return HMM_TransposeM4(Result);
+#endif
+}
+
+/*
+ * 3x4 affine matrices
+ *
+ * For transforms whose bottom row is (0, 0, 0, 1), which is everything built
+ * from HMM_Translate, HMM_Rotate_RH/LH, HMM_Scale and HMM_LookAt_RH/LH. They take
+ * 48 bytes instead of 64, composing two takes 36 multiplies instead of 64, and
+ * they can be inverted without a general 4x4 inverse.
+ */
+
+COVERAGE(HMM_A34D, 1)
+static inline HMM_Affine3x4 HMM_A34D(float Diagonal)
+{
+    ASSERT_COVERED(HMM_A34D);
+
+    HMM_Affine3x4 Result = {0};
+    Result.Elements[0][0] = Diagonal;
+    Result.Elements[1][1] = Diagonal;
+    Result.Elements[2][2] = Diagonal;
+
+    return Result;
+}
+
+COVERAGE(HMM_M4ToA34, 1)
+// Drops the bottom row of an affine HMM_Mat4. This is lossless if the bottom row is (0, 0, 0, 1).
+static inline HMM_Affine3x4 HMM_M4ToA34(HMM_Mat4 Matrix)
+{
+    ASSERT_COVERED(HMM_M4ToA34);
+
+    HMM_Mat4 Transposed = HMM_TransposeM4(Matrix);
+
+    HMM_Affine3x4 Result;
+    Result.Rows[0] = Transposed.Columns[0];
+    Result.Rows[1] = Transposed.Columns[1];
+    Result.Rows[2] = Transposed.Columns[2];
+
+    return Result;
+}
+
+COVERAGE(HMM_A34ToM4, 1)
+static inline HMM_Mat4 HMM_A34ToM4(HMM_Affine3x4 Matrix)
+{
+    ASSERT_COVERED(HMM_A34ToM4);
+
+    HMM_Mat4 Transposed;
+    Transposed.Columns[0] = Matrix.Rows[0];
+    Transposed.Columns[1] = Matrix.Rows[1];
+    Transposed.Columns[2] = Matrix.Rows[2];
+    Transposed.Columns[3] = HMM_V4(0.0f, 0.0f, 0.0f, 1.0f);
+
+    return HMM_TransposeM4(Transposed);
+}
+
+#ifdef HANDMADE_MATH__USE_SSE
+// One row of HMM_MulA34: the rows of Right weighted by LeftRow, plus its translation.
+static inline __m128 _HMM_MulA34RowSSE(__m128 LeftRow, __m128 Right0, __m128 Right1, __m128 Right2)
+{
+    __m128 Result = _mm_mul_ps(_mm_shuffle_ps(LeftRow, LeftRow, 0x00), Right0);
+    Result = _HMM_MADD_PS(_mm_shuffle_ps(LeftRow, LeftRow, 0x55), Right1, Result);
+    Result = _HMM_MADD_PS(_mm_shuffle_ps(LeftRow, LeftRow, 0xaa), Right2, Result);
+    return _mm_add_ps(Result, _mm_and_ps(LeftRow, _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1))));
+}
+#endif
+
+#ifdef HANDMADE_MATH__USE_NEON
+static inline float32x4_t _HMM_MulA34RowNEON(float32x4_t LeftRow, float32x4_t Right0, float32x4_t Right1, float32x4_t Right2)
+{
+    float32x4_t Result = vmulq_laneq_f32(Right0, LeftRow, 0);
+    Result = vfmaq_laneq_f32(Result, Right1, LeftRow, 1);
+    Result = vfmaq_laneq_f32(Result, Right2, LeftRow, 2);
+    return vsetq_lane_f32(vgetq_lane_f32(Result, 3) + vgetq_lane_f32(LeftRow, 3), Result, 3);
+}
+#endif
+
+COVERAGE(HMM_MulA34, 1)
+// Composes two affine transforms: the result applies Right first and then Left, like HMM_MulM4.
+static inline HMM_Affine3x4 HMM_MulA34(HMM_Affine3x4 Left, HMM_Affine3x4 Right)
+{
+    ASSERT_COVERED(HMM_MulA34);
+
+    HMM_Affine3x4 Result;
+
+    /* NOTE: Each row of the result is a combination of the rows of Right, weighted by the row of Left,
+       plus the translation of Left. */
+#ifdef HANDMADE_MATH__USE_AVX
+    __m256 Left01 = _mm256_loadu_ps(Left.Rows[0].Elements);
+    __m256 Result01 = _mm256_mul_ps(_mm256_permute_ps(Left01, 0x00), _mm256_broadcast_ps(&Right.Rows[0].SSE));
+    Result01 = _HMM_MADD256_PS(_mm256_permute_ps(Left01, 0x55), _mm256_broadcast_ps(&Right.Rows[1].SSE), Result01);
+    Result01 = _HMM_MADD256_PS(_mm256_permute_ps(Left01, 0xaa), _mm256_broadcast_ps(&Right.Rows[2].SSE), Result01);
+    Result01 = _mm256_add_ps(Result01, _mm256_and_ps(Left01, _mm256_castsi256_ps(_mm256_setr_epi32(0, 0, 0, -1, 0, 0, 0, -1))));
+    _mm256_storeu_ps(Result.Rows[0].Elements, Result01);
+    Result.Rows[2].SSE = _HMM_MulA34RowSSE(Left.Rows[2].SSE, Right.Rows[0].SSE, Right.Rows[1].SSE, Right.Rows[2].SSE);
+#elif defined(HANDMADE_MATH__USE_SSE)
+    Result.Rows[0].SSE = _HMM_MulA34RowSSE(Left.Rows[0].SSE, Right.Rows[0].SSE, Right.Rows[1].SSE, Right.Rows[2].SSE);
+    Result.Rows[1].SSE = _HMM_MulA34RowSSE(Left.Rows[1].SSE, Right.Rows[0].SSE, Right.Rows[1].SSE, Right.Rows[2].SSE);
+    Result.Rows[2].SSE = _HMM_MulA34RowSSE(Left.Rows[2].SSE, Right.Rows[0].SSE, Right.Rows[1].SSE, Right.Rows[2].SSE);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.Rows[0].NEON = _HMM_MulA34RowNEON(Left.Rows[0].NEON, Right.Rows[0].NEON, Right.Rows[1].NEON, Right.Rows[2].NEON);
+    Result.Rows[1].NEON = _HMM_MulA34RowNEON(Left.Rows[1].NEON, Right.Rows[0].NEON, Right.Rows[1].NEON, Right.Rows[2].NEON);
+    Result.Rows[2].NEON = _HMM_MulA34RowNEON(Left.Rows[2].NEON, Right.Rows[0].NEON, Right.Rows[1].NEON, Right.Rows[2].NEON);
+#else
+    for (int Row = 0; Row < 3; ++Row)
+    {
+        for (int Column = 0; Column < 4; ++Column)
+        {
+            float Sum = Left.Elements[Row][0] * Right.Elements[0][Column];
+            Sum += Left.Elements[Row][1] * Right.Elements[1][Column];
+            Sum += Left.Elements[Row][2] * Right.Elements[2][Column];
+            Result.Elements[Row][Column] = Sum;
+        }
+        Result.Elements[Row][3] += Left.Elements[Row][3];
+    }
+#endif
+
+    return Result;
+}
+
+// Multiplies Vector (with the given W) by each row and returns the three dot products.
+static inline HMM_Vec3 _HMM_TransformA34(HMM_Affine3x4 Matrix, HMM_Vec4 Vector)
+{
+#ifdef HANDMADE_MATH__USE_SSE
+    __m128 X = _mm_mul_ps(Matrix.Rows[0].SSE, Vector.SSE);
+    __m128 Y = _mm_mul_ps(Matrix.Rows[1].SSE, Vector.SSE);
+    __m128 Z = _mm_mul_ps(Matrix.Rows[2].SSE, Vector.SSE);
+    __m128 W = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(X, Y, Z, W);
+
+    HMM_Vec4 Result;
+    Result.SSE = _mm_add_ps(_mm_add_ps(X, Y), _mm_add_ps(Z, W));
+    return Result.XYZ;
+#else
+    return HMM_V3(HMM_DotV4(Matrix.Rows[0], Vector), HMM_DotV4(Matrix.Rows[1], Vector), HMM_DotV4(Matrix.Rows[2], Vector));
+#endif
+}
+
+COVERAGE(HMM_TransformPointA34, 1)
+static inline HMM_Vec3 HMM_TransformPointA34(HMM_Affine3x4 Matrix, HMM_Vec3 Point)
+{
+    ASSERT_COVERED(HMM_TransformPointA34);
+
+    return _HMM_TransformA34(Matrix, HMM_V4V(Point, 1.0f));
+}
+
+COVERAGE(HMM_TransformDirA34, 1)
+// Transforms a direction, ignoring the translation. Normals need the inverse transpose instead if the
+// transform has non-uniform scale.
+static inline HMM_Vec3 HMM_TransformDirA34(HMM_Affine3x4 Matrix, HMM_Vec3 Direction)
+{
+    ASSERT_COVERED(HMM_TransformDirA34);
+
+    return _HMM_TransformA34(Matrix, HMM_V4V(Direction, 0.0f));
+}
+
+// The inverse of Matrix, given the columns of the inverse of its 3x3 part. The W components of the
+// columns are ignored.
+static inline HMM_Affine3x4 _HMM_InvA34(HMM_Affine3x4 Matrix, HMM_Vec4 Column0, HMM_Vec4 Column1, HMM_Vec4 Column2)
+{
+    HMM_Affine3x4 Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    /* NOTE: Shuffles, because reading the translation as scalars makes some compilers spill the rows. */
+    __m128 Translation = _mm_mul_ps(Column0.SSE, _mm_shuffle_ps(Matrix.Rows[0].SSE, Matrix.Rows[0].SSE, 0xff));
+    Translation = _HMM_MADD_PS(Column1.SSE, _mm_shuffle_ps(Matrix.Rows[1].SSE, Matrix.Rows[1].SSE, 0xff), Translation);
+    Translation = _HMM_MADD_PS(Column2.SSE, _mm_shuffle_ps(Matrix.Rows[2].SSE, Matrix.Rows[2].SSE, 0xff), Translation);
+    __m128 NegTranslation = _mm_xor_ps(Translation, _mm_set1_ps(-0.0f));
+    _MM_TRANSPOSE4_PS(Column0.SSE, Column1.SSE, Column2.SSE, NegTranslation);
+
+    Result.Rows[0] = Column0;
+    Result.Rows[1] = Column1;
+    Result.Rows[2] = Column2;
+#else
+    HMM_Vec3 Translation = HMM_MulV3F(Column0.XYZ, Matrix.Elements[0][3]);
+    Translation = HMM_AddV3(Translation, HMM_MulV3F(Column1.XYZ, Matrix.Elements[1][3]));
+    Translation = HMM_AddV3(Translation, HMM_MulV3F(Column2.XYZ, Matrix.Elements[2][3]));
+
+    for (int Row = 0; Row < 3; ++Row)
+    {
+        Result.Elements[Row][0] = Column0.Elements[Row];
+        Result.Elements[Row][1] = Column1.Elements[Row];
+        Result.Elements[Row][2] = Column2.Elements[Row];
+        Result.Elements[Row][3] = -Translation.Elements[Row];
+    }
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_InvRigidA34, 1)
+// Inverts a rotation followed by a translation by transposing the rotation and rotating the negated
+// translation. Use HMM_InvA34 if the transform has scale.
+static inline HMM_Affine3x4 HMM_InvRigidA34(HMM_Affine3x4 Matrix)
+{
+    ASSERT_COVERED(HMM_InvRigidA34);
+
+    return _HMM_InvA34(Matrix, Matrix.Rows[0], Matrix.Rows[1], Matrix.Rows[2]);
+}
+
+COVERAGE(HMM_InvA34, 1)
+// Inverts any invertible affine transform with a 3x3 inverse of its linear part.
+static inline HMM_Affine3x4 HMM_InvA34(HMM_Affine3x4 Matrix)
+{
+    ASSERT_COVERED(HMM_InvA34);
+
+#ifdef HANDMADE_MATH__USE_SSE
+    HMM_Vec4 Cross0, Cross1, Cross2;
+    Cross0.SSE = _HMM_CrossSSE(Matrix.Rows[1].SSE, Matrix.Rows[2].SSE);
+    Cross1.SSE = _HMM_CrossSSE(Matrix.Rows[2].SSE, Matrix.Rows[0].SSE);
+    Cross2.SSE = _HMM_CrossSSE(Matrix.Rows[0].SSE, Matrix.Rows[1].SSE);
+
+    /* NOTE: The W lane of the cross products is zero, so a four-lane dot product gives the determinant. */
+    __m128 Determinant = _mm_mul_ps(Matrix.Rows[0].SSE, Cross0.SSE);
+    Determinant = _mm_add_ps(Determinant, _mm_shuffle_ps(Determinant, Determinant, _MM_SHUFFLE(2, 3, 0, 1)));
+    Determinant = _mm_add_ps(Determinant, _mm_shuffle_ps(Determinant, Determinant, _MM_SHUFFLE(1, 0, 3, 2)));
+    __m128 InvDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), Determinant);
+    Cross0.SSE = _mm_mul_ps(Cross0.SSE, InvDeterminant);
+    Cross1.SSE = _mm_mul_ps(Cross1.SSE, InvDeterminant);
+    Cross2.SSE = _mm_mul_ps(Cross2.SSE, InvDeterminant);
+
+    return _HMM_InvA34(Matrix, Cross0, Cross1, Cross2);
+#else
+    HMM_Vec3 Cross0 = HMM_Cross(Matrix.Rows[1].XYZ, Matrix.Rows[2].XYZ);
+    HMM_Vec3 Cross1 = HMM_Cross(Matrix.Rows[2].XYZ, Matrix.Rows[0].XYZ);
+    HMM_Vec3 Cross2 = HMM_Cross(Matrix.Rows[0].XYZ, Matrix.Rows[1].XYZ);
+    float InvDeterminant = 1.0f / HMM_DotV3(Matrix.Rows[0].XYZ, Cross0);
+
+    return _HMM_InvA34(Matrix,
+                       HMM_V4V(HMM_MulV3F(Cross0, InvDeterminant), 0.0f),
+                       HMM_V4V(HMM_MulV3F(Cross1, InvDeterminant), 0.0f),
+                       HMM_V4V(HMM_MulV3F(Cross2, InvDeterminant), 0.0f));
+#endif
+}
+
+COVERAGE(HMM_MulA34Array, 1)
+// Composes Count pairs of transforms: Out[i] = Left[i] * Right[i]. Out may be the same array as Left
+// or Right.
+static inline void HMM_MulA34Array(const HMM_Affine3x4 *Left, const HMM_Affine3x4 *Right, HMM_Affine3x4 *Out, int Count)
+{
+    ASSERT_COVERED(HMM_MulA34Array);
+
+    for (int Index = 0; Index < Count; ++Index)
+    {
+        Out[Index] = HMM_MulA34(Left[Index], Right[Index]);
+    }
+}
+
+COVERAGE(HMM_TransformPointA34Array, 1)
+// Transforms Count points by Matrix. Out may be the same array as In.
+static inline void HMM_TransformPointA34Array(HMM_Affine3x4 Matrix, const HMM_Vec3 *In, HMM_Vec3 *Out, int Count)
+{
+    ASSERT_COVERED(HMM_TransformPointA34Array);
+
+    /* NOTE: In column form, each point takes one multiply-add per column instead of three dot products. */
+    HMM_Mat4 Columns = HMM_A34ToM4(Matrix);
+    for (int Index = 0; Index < Count; ++Index)
+    {
+        Out[Index] = HMM_LinearCombineV4M4(HMM_V4V(In[Index], 1.0f), Columns).XYZ;
+    }
+}
+
+/*
+ * Transform hierarchies
+ *
+ * A hierarchy is stored flat, one entry per node in each array. Parents[i] is
+ * the index of node i's parent, or -1 for a root, and every parent comes
+ * before its children, so one pass in index order updates the whole tree.
+ * In depth-first order each subtree is also a contiguous range (see
+ * HMM_HierarchySubtreeEnd). Once the nodes above a set of subtrees are up to
+ * date, the subtrees can be updated on different threads.
+ */
+
+COVERAGE(HMM_HierarchySubtreeEnd, 1)
+// Returns one past the last node in Node's subtree, for a hierarchy in depth-first order.
+static inline int HMM_HierarchySubtreeEnd(const int *Parents, int Node, int Count)
+{
+    ASSERT_COVERED(HMM_HierarchySubtreeEnd);
+
+    int End = Node + 1;
+    while (End < Count && Parents[End] >= Node)
+    {
+        ++End;
+    }
+
+    return End;
+}
+
+/* Returns the first node in [Index, End) that a hierarchy update has to recompute, or End, and marks it in Dirty.
+   A node is recomputed if it is dirty or its parent was recomputed. */
+static inline int _HMM_NextDirtyNode(const int *Parents, unsigned char *Dirty, int Index, int End)
+{
+    if (!Dirty)
+    {
+        return Index;
+    }
+
+    while (Index < End)
+    {
+        int Parent = Parents[Index];
+        if (Dirty[Index] || (Parent >= 0 && Dirty[Parent]))
+        {
+            Dirty[Index] = 1;
+            return Index;
+        }
+
+        /* NOTE: Skips the clean node's subtree, as HMM_HierarchySubtreeEnd does, but stops at a dirty descendant. */
+        int Node = Index++;
+        while (Index < End && Parents[Index] >= Node && !Dirty[Index])
+        {
+            ++Index;
+        }
+    }
+
+    return End;
+}
+
+COVERAGE(HMM_UpdateHierarchyA34, 1)
+// Computes World[i] = World[Parents[i]] * Local[i], or Local[i] for a root, for the Count nodes starting
+// at First. The arrays cover the whole hierarchy, and parents before First must already be up to date.
+// If Dirty is not NULL, the hierarchy must be in depth-first order, and only nodes with Dirty[i] set or
+// an updated parent are recomputed; the subtrees of clean nodes are skipped. On return, Dirty[i] is set
+// for every node that was recomputed, and the caller clears it for the next update.
+static inline void HMM_UpdateHierarchyA34(const int *Parents, const HMM_Affine3x4 *Local, unsigned char *Dirty,
+                                          HMM_Affine3x4 *World, int First, int Count)
+{
+    ASSERT_COVERED(HMM_UpdateHierarchyA34);
+
+    int End = First + Count;
+    for (int Index = _HMM_NextDirtyNode(Parents, Dirty, First, End); Index < End;
+         Index = _HMM_NextDirtyNode(Parents, Dirty, Index + 1, End))
+    {
+        int Parent = Parents[Index];
+        World[Index] = (Parent >= 0) ? HMM_MulA34(World[Parent], Local[Index]) : Local[Index];
+    }
+}
+
+COVERAGE(HMM_UpdateHierarchyM4, 1)
+// HMM_UpdateHierarchyA34 for HMM_Mat4 transforms.
+static inline void HMM_UpdateHierarchyM4(const int *Parents, const HMM_Mat4 *Local, unsigned char *Dirty,
+                                         HMM_Mat4 *World, int First, int Count)
+{
+    ASSERT_COVERED(HMM_UpdateHierarchyM4);
+
+    int End = First + Count;
+    for (int Index = _HMM_NextDirtyNode(Parents, Dirty, First, End); Index < End;
+         Index = _HMM_NextDirtyNode(Parents, Dirty, Index + 1, End))
+    {
+        int Parent = Parents[Index];
+        World[Index] = (Parent >= 0) ? HMM_MulM4(World[Parent], Local[Index]) : Local[Index];
+    }
+}
+
+/*
+ * Common graphics transformations
+ */
+
+COVERAGE(HMM_Orthographic_RH_NO, 1)
+// Produces a right-handed orthographic projection matrix with Z ranging from -1 to 1 (the GL convention).
+// Left, Right, Bottom, and Top specify the coordinates of their respective clipping planes.
+// Near and Far specify the distances to the near and far clipping planes.
+static inline HMM_Mat4 HMM_Orthographic_RH_NO(float Left, float Right, float Bottom, float Top, float Near, float Far)
+{
+    ASSERT_COVERED(HMM_Orthographic_RH_NO);
+
+    HMM_Mat4 Result = {0};
+
+    Result.Elements[0][0] = 2.0f / (Right - Left);
+    Result.Elements[1][1] = 2.0f / (Top - Bottom);
+    Result.Elements[2][2] = 2.0f / (Near - Far);
+    Result.Elements[3][3] = 1.0f;
+
+    Result.Elements[3][0] = (Left + Right) / (Left - Right);
+    Result.Elements[3][1] = (Bottom + Top) / (Bottom - Top);
+    Result.Elements[3][2] = (Near + Far) / (Near - Far);
+
+    return Result;
+}
+
+COVERAGE(HMM_Orthographic_RH_ZO, 1)
+// Produces a right-handed orthographic projection matrix with Z ranging from 0 to 1 (the DirectX convention).
+// Left, Right, Bottom, and Top specify the coordinates of their respective clipping planes.
+// Near and Far specify the distances to the near and far clipping planes.
+static inline HMM_Mat4 HMM_Orthographic_RH_ZO(float Left, float Right, float Bottom, float Top, float Near, float Far)
+{
+    ASSERT_COVERED(HMM_Orthographic_RH_ZO);
+
+    HMM_Mat4 Result = {0};
+
+    Result.Elements[0][0] = 2.0f / (Right - Left);
+    Result.Elements[1][1] = 2.0f / (Top - Bottom);
+    Result.Elements[2][2] = 1.0f / (Near - Far);
+    Result.Elements[3][3] = 1.0f;
+
+    Result.Elements[3][0] = (Left + Right) / (Left - Right);
+    Result.Elements[3][1] = (Bottom + Top) / (Bottom - Top);
+    Result.Elements[3][2] = (Near) / (Near - Far);
+
+    return Result;
+}
+
+COVERAGE(HMM_Orthographic_LH_NO, 1)
+// Produces a left-handed orthographic projection matrix with Z ranging from -1 to 1 (the GL convention).
+// Left, Right, Bottom, and Top specify the coordinates of their respective clipping planes.
+// Near and Far specify the distances to the near and far clipping planes.
+static inline HMM_Mat4 HMM_Orthographic_LH_NO(float Left, float Right, float Bottom, float Top, float Near, float Far)
+{
+    ASSERT_COVERED(HMM_Orthographic_LH_NO);
+
+    HMM_Mat4 Result = HMM_Orthographic_RH_NO(Left, Right, Bottom, Top, Near, Far);
+    Result.Elements[2][2] = -Result.Elements[2][2];
+
+    return Result;
+}
+
+COVERAGE(HMM_Orthographic_LH_ZO, 1)
+// Produces a left-handed orthographic projection matrix with Z ranging from 0 to 1 (the DirectX convention).
+// Left, Right, Bottom, and Top specify the coordinates of their respective clipping planes.
+// Near and Far specify the distances to the near and far clipping planes.
+static inline HMM_Mat4 HMM_Orthographic_LH_ZO(float Left, float Right, float Bottom, float Top, float Near, float Far)
+{
+    ASSERT_COVERED(HMM_Orthographic_LH_ZO);
+
+    HMM_Mat4 Result = HMM_Orthographic_RH_ZO(Left, Right, Bottom, Top, Near, Far);
+    Result.Elements[2][2] = -Result.Elements[2][2];
+
+    return Result;
+}
+
+COVERAGE(HMM_InvOrthographic, 1)
+// Returns an inverse for the given orthographic projection matrix. Works for all orthographic
+// projection matrices, regardless of handedness or NDC convention.
+static inline HMM_Mat4 HMM_InvOrthographic(HMM_Mat4 OrthoMatrix)
+{
+    ASSERT_COVERED(HMM_InvOrthographic);
+
+    HMM_Mat4 Result = {0};
+    Result.Elements[0][0] = 1.0f / OrthoMatrix.Elements[0][0];
+    Result.Elements[1][1] = 1.0f / OrthoMatrix.Elements[1][1];
+    Result.Elements[2][2] = 1.0f / OrthoMatrix.Elements[2][2];
+    Result.Elements[3][3] = 1.0f;
+
+    Result.Elements[3][0] = -OrthoMatrix.Elements[3][0] * Result.Elements[0][0];
+    Result.Elements[3][1] = -OrthoMatrix.Elements[3][1] * Result.Elements[1][1];
+    Result.Elements[3][2] = -OrthoMatrix.Elements[3][2] * Result.Elements[2][2];
+
+    return Result;
+}
+
+COVERAGE(HMM_Perspective_RH_NO, 1)
+static inline HMM_Mat4 HMM_Perspective_RH_NO(float FOV, float AspectRatio, float Near, float Far)
+{
+    ASSERT_COVERED(HMM_Perspective_RH_NO);
+
+    HMM_Mat4 Result = {0};
+
+    // See https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/gluPerspective.xml
+
+#ifdef HANDMADE_MATH_FAST_TRIG
+    HMM_Vec2 SinCos = HMM_SinCosF(FOV / 2.0f);
+    float Cotangent = SinCos.Y / SinCos.X;
+#else
+    float Cotangent = 1.0f / HMM_TanF(FOV / 2.0f);
+#endif
+    Result.Elements[0][0] = Cotangent / AspectRatio;
+    Result.Elements[1][1] = Cotangent;
+    Result.Elements[2][3] = -1.0f;
+
+    Result.Elements[2][2] = (Near + Far) / (Near - Far);
+    Result.Elements[3][2] = (2.0f * Near * Far) / (Near - Far);
+
+    return Result;
+}
+
+COVERAGE(HMM_Perspective_RH_ZO, 1)
+static inline HMM_Mat4 HMM_Perspective_RH_ZO(float FOV, float AspectRatio, float Near, float Far)
+{
+    ASSERT_COVERED(HMM_Perspective_RH_ZO);
+
+    HMM_Mat4 Result = {0};
+
+    // See https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/gluPerspective.xml
+
+#ifdef HANDMADE_MATH_FAST_TRIG
+    HMM_Vec2 SinCos = HMM_SinCosF(FOV / 2.0f);
+    float Cotangent = SinCos.Y / SinCos.X;
+#else
+    float Cotangent = 1.0f / HMM_TanF(FOV / 2.0f);
+#endif
+    Result.Elements[0][0] = Cotangent / AspectRatio;
+    Result.Elements[1][1] = Cotangent;
+    Result.Elements[2][3] = -1.0f;
+
+    Result.Elements[2][2] = (Far) / (Near - Far);
+    Result.Elements[3][2] = (Near * Far) / (Near - Far);
+
+    return Result;
+}
+
+COVERAGE(HMM_Perspective_LH_NO, 1)
+static inline HMM_Mat4 HMM_Perspective_LH_NO(float FOV, float AspectRatio, float Near, float Far)
+{
+    ASSERT_COVERED(HMM_Perspective_LH_NO);
+
+    HMM_Mat4 Result = HMM_Perspective_RH_NO(FOV, AspectRatio, Near, Far);
+    Result.Elements[2][2] = -Result.Elements[2][2];
+    Result.Elements[2][3] = -Result.Elements[2][3];
+
+    return Result;
+}
+
+COVERAGE(HMM_Perspective_LH_ZO, 1)
+static inline HMM_Mat4 HMM_Perspective_LH_ZO(float FOV, float AspectRatio, float Near, float Far)
+{
+    ASSERT_COVERED(HMM_Perspective_LH_ZO);
+
+    HMM_Mat4 Result = HMM_Perspective_RH_ZO(FOV, AspectRatio, Near, Far);
+    Result.Elements[2][2] = -Result.Elements[2][2];
+    Result.Elements[2][3] = -Result.Elements[2][3];
+
+    return Result;
+}
+
+COVERAGE(HMM_InvPerspective_RH, 1)
+static inline HMM_Mat4 HMM_InvPerspective_RH(HMM_Mat4 PerspectiveMatrix)
+{
+    ASSERT_COVERED(HMM_InvPerspective_RH);
+
+    HMM_Mat4 Result = {0};
+    Result.Elements[0][0] = 1.0f / PerspectiveMatrix.Elements[0][0];
+    Result.Elements[1][1] = 1.0f / PerspectiveMatrix.Elements[1][1];
+    Result.Elements[2][2] = 0.0f;
+
+    Result.Elements[2][3] = 1.0f / PerspectiveMatrix.Elements[3][2];
+    Result.Elements[3][3] = PerspectiveMatrix.Elements[2][2] * Result.Elements[2][3];
+    Result.Elements[3][2] = PerspectiveMatrix.Elements[2][3];
+
+    return Result;
+}
+
+COVERAGE(HMM_InvPerspective_LH, 1)
+static inline HMM_Mat4 HMM_InvPerspective_LH(HMM_Mat4 PerspectiveMatrix)
+{
+    ASSERT_COVERED(HMM_InvPerspective_LH);
+
+    HMM_Mat4 Result = {0};
+    Result.Elements[0][0] = 1.0f / PerspectiveMatrix.Elements[0][0];
+    Result.Elements[1][1] = 1.0f / PerspectiveMatrix.Elements[1][1];
+    Result.Elements[2][2] = 0.0f;
+
+    Result.Elements[2][3] = 1.0f / PerspectiveMatrix.Elements[3][2];
+    Result.Elements[3][3] = PerspectiveMatrix.Elements[2][2] * -Result.Elements[2][3];
+    Result.Elements[3][2] = PerspectiveMatrix.Elements[2][3];
+
+    return Result;
+}
+
+COVERAGE(HMM_Translate, 1)
+static inline HMM_Mat4 HMM_Translate(HMM_Vec3 Translation)
+{
+    ASSERT_COVERED(HMM_Translate);
+
+    HMM_Mat4 Result = HMM_M4D(1.0f);
+    Result.Elements[3][0] = Translation.X;
+    Result.Elements[3][1] = Translation.Y;
+    Result.Elements[3][2] = Translation.Z;
+
+    return Result;
+}
+
+COVERAGE(HMM_InvTranslate, 1)
+static inline HMM_Mat4 HMM_InvTranslate(HMM_Mat4 TranslationMatrix)
+{
+    ASSERT_COVERED(HMM_InvTranslate);
+
+    HMM_Mat4 Result = TranslationMatrix;
+    Result.Elements[3][0] = -Result.Elements[3][0];
+    Result.Elements[3][1] = -Result.Elements[3][1];
+    Result.Elements[3][2] = -Result.Elements[3][2];
+
+    return Result;
+}
+
+COVERAGE(HMM_Rotate_RH, 1)
+static inline HMM_Mat4 HMM_Rotate_RH(float Angle, HMM_Vec3 Axis)
+{
+    ASSERT_COVERED(HMM_Rotate_RH);
+
+    HMM_Mat4 Result = HMM_M4D(1.0f);
+
+    Axis = HMM_NormV3(Axis);
+
+    HMM_Vec2 SinCos = HMM_SinCosF(Angle);
+    float SinTheta = SinCos.X;
+    float CosTheta = SinCos.Y;
+    float CosValue = 1.0f - CosTheta;
+
+    Result.Elements[0][0] = (Axis.X * Axis.X * CosValue) + CosTheta;
+    Result.Elements[0][1] = (Axis.X * Axis.Y * CosValue) + (Axis.Z * SinTheta);
+    Result.Elements[0][2] = (Axis.X * Axis.Z * CosValue) - (Axis.Y * SinTheta);
+
+    Result.Elements[1][0] = (Axis.Y * Axis.X * CosValue) - (Axis.Z * SinTheta);
+    Result.Elements[1][1] = (Axis.Y * Axis.Y * CosValue) + CosTheta;
+    Result.Elements[1][2] = (Axis.Y * Axis.Z * CosValue) + (Axis.X * SinTheta);
+
+    Result.Elements[2][0] = (Axis.Z * Axis.X * CosValue) + (Axis.Y * SinTheta);
+    Result.Elements[2][1] = (Axis.Z * Axis.Y * CosValue) - (Axis.X * SinTheta);
+    Result.Elements[2][2] = (Axis.Z * Axis.Z * CosValue) + CosTheta;
+
+    return Result;
+}
+
+COVERAGE(HMM_Rotate_LH, 1)
+static inline HMM_Mat4 HMM_Rotate_LH(float Angle, HMM_Vec3 Axis)
+{
+    ASSERT_COVERED(HMM_Rotate_LH);
+    /* NOTE(lcf): Matrix will be inverse/transpose of RH. */
+    return HMM_Rotate_RH(-Angle, Axis);
+}
+
+COVERAGE(HMM_InvRotate, 1)
+static inline HMM_Mat4 HMM_InvRotate(HMM_Mat4 RotationMatrix)
+{
+    ASSERT_COVERED(HMM_InvRotate);
+    return HMM_TransposeM4(RotationMatrix);
+}
+
+COVERAGE(HMM_Scale, 1)
+static inline HMM_Mat4 HMM_Scale(HMM_Vec3 Scale)
+{
+    ASSERT_COVERED(HMM_Scale);
+
+    HMM_Mat4 Result = HMM_M4D(1.0f);
+    Result.Elements[0][0] = Scale.X;
+    Result.Elements[1][1] = Scale.Y;
+    Result.Elements[2][2] = Scale.Z;
+
+    return Result;
+}
+
+COVERAGE(HMM_InvScale, 1)
+static inline HMM_Mat4 HMM_InvScale(HMM_Mat4 ScaleMatrix)
+{
+    ASSERT_COVERED(HMM_InvScale);
+
+    HMM_Mat4 Result = ScaleMatrix;
+    Result.Elements[0][0] = 1.0f / Result.Elements[0][0];
+    Result.Elements[1][1] = 1.0f / Result.Elements[1][1];
+    Result.Elements[2][2] = 1.0f / Result.Elements[2][2];
+
+    return Result;
+}
+
+static inline HMM_Mat4 _HMM_LookAt(HMM_Vec3A F,  HMM_Vec3A S, HMM_Vec3A U,  HMM_Vec3A Eye)
+{
+    HMM_Mat4 Result;
+
+    /* NOTE: The rows are S, U and -F, with the translation in the fourth column. */
+    Result.Columns[0] = HMM_V3AToV4(S, 0.0f);
+    Result.Columns[1] = HMM_V3AToV4(U, 0.0f);
+    Result.Columns[2] = HMM_V3AToV4(HMM_MulV3AF(F, -1.0f), 0.0f);
+    Result.Columns[3] = HMM_V4(0.0f, 0.0f, 0.0f, 1.0f);
+    Result = HMM_TransposeM4(Result);
+
+    Result.Columns[3] = HMM_V4(-HMM_DotV3A(S, Eye), -HMM_DotV3A(U, Eye), HMM_DotV3A(F, Eye), 1.0f);
+
+    return Result;
+}
+
+COVERAGE(HMM_LookAt_RH, 1)
+static inline HMM_Mat4 HMM_LookAt_RH(HMM_Vec3 Eye, HMM_Vec3 Center, HMM_Vec3 Up)
+{
+    ASSERT_COVERED(HMM_LookAt_RH);
+
+    HMM_Vec3A EyeA = HMM_V3ToV3A(Eye);
+    HMM_Vec3A F = HMM_NormV3A(HMM_SubV3A(HMM_V3ToV3A(Center), EyeA));
+    HMM_Vec3A S = HMM_NormV3A(HMM_CrossV3A(F, HMM_V3ToV3A(Up)));
+    HMM_Vec3A U = HMM_CrossV3A(S, F);
+
+    return _HMM_LookAt(F, S, U, EyeA);
+}
+
+COVERAGE(HMM_LookAt_LH, 1)
+static inline HMM_Mat4 HMM_LookAt_LH(HMM_Vec3 Eye, HMM_Vec3 Center, HMM_Vec3 Up)
+{
+    ASSERT_COVERED(HMM_LookAt_LH);
+
+    HMM_Vec3A EyeA = HMM_V3ToV3A(Eye);
+    HMM_Vec3A F = HMM_NormV3A(HMM_SubV3A(EyeA, HMM_V3ToV3A(Center)));
+    HMM_Vec3A S = HMM_NormV3A(HMM_CrossV3A(F, HMM_V3ToV3A(Up)));
+    HMM_Vec3A U = HMM_CrossV3A(S, F);
+
+    return _HMM_LookAt(F, S, U, EyeA);
+}
+
+COVERAGE(HMM_InvLookAt, 1)
+static inline HMM_Mat4 HMM_InvLookAt(HMM_Mat4 Matrix)
+{
+    ASSERT_COVERED(HMM_InvLookAt);
+    HMM_Mat4 Result;
+
+    HMM_Mat3 Rotation = {0};
+    Rotation.Columns[0] = Matrix.Columns[0].XYZ;
+    Rotation.Columns[1] = Matrix.Columns[1].XYZ;
+    Rotation.Columns[2] = Matrix.Columns[2].XYZ;
+    Rotation = HMM_TransposeM3(Rotation);
+
+    Result.Columns[0] = HMM_V4V(Rotation.Columns[0], 0.0f);
+    Result.Columns[1] = HMM_V4V(Rotation.Columns[1], 0.0f);
+    Result.Columns[2] = HMM_V4V(Rotation.Columns[2], 0.0f);
+    Result.Columns[3] = HMM_MulV4F(Matrix.Columns[3], -1.0f);
+    Result.Elements[3][0] = -1.0f * Matrix.Elements[3][0] /
+        (Rotation.Elements[0][0] + Rotation.Elements[0][1] + Rotation.Elements[0][2]);
+    Result.Elements[3][1] = -1.0f * Matrix.Elements[3][1] /
+        (Rotation.Elements[1][0] + Rotation.Elements[1][1] + Rotation.Elements[1][2]);
+    Result.Elements[3][2] = -1.0f * Matrix.Elements[3][2] /
+        (Rotation.Elements[2][0] + Rotation.Elements[2][1] + Rotation.Elements[2][2]);
+    Result.Elements[3][3] = 1.0f;
+
+    return Result;
+}
+
+/*
+ * Frustum culling
+ *
+ * Planes are extracted from a view-projection matrix with the Gribb-Hartmann
+ * method, so the frustum is in whatever space the matrix transforms from
+ * (world space for projection * view). Use the _NO or _ZO function that
+ * matches the projection the matrix was built with. Handedness needs no
+ * special handling, since it is already part of the matrix.
+ */
+
+static inline HMM_Vec4 _HMM_NormPlane(HMM_Vec4 Plane)
+{
+    return HMM_MulV4F(Plane, HMM_InvSqrtF(HMM_LenSqrV3(Plane.XYZ)));
+}
+
+static inline HMM_Frustum _HMM_FrustumFromM4(HMM_Mat4 ViewProjection, HMM_Bool ZeroToOne)
+{
+    /* NOTE: The rows of the matrix, as clip = (Row0 . P, Row1 . P, Row2 . P, Row3 . P). */
+    HMM_Mat4 Rows = HMM_TransposeM4(ViewProjection);
+
+    HMM_Frustum Result;
+    Result.Left = _HMM_NormPlane(HMM_AddV4(Rows.Columns[3], Rows.Columns[0]));
+    Result.Right = _HMM_NormPlane(HMM_SubV4(Rows.Columns[3], Rows.Columns[0]));
+    Result.Bottom = _HMM_NormPlane(HMM_AddV4(Rows.Columns[3], Rows.Columns[1]));
+    Result.Top = _HMM_NormPlane(HMM_SubV4(Rows.Columns[3], Rows.Columns[1]));
+    Result.Near = _HMM_NormPlane(ZeroToOne ? Rows.Columns[2] : HMM_AddV4(Rows.Columns[3], Rows.Columns[2]));
+    Result.Far = _HMM_NormPlane(HMM_SubV4(Rows.Columns[3], Rows.Columns[2]));
+
+    return Result;
+}
+
+COVERAGE(HMM_FrustumFromM4_NO, 1)
+// Extracts the frustum of a view-projection matrix whose clip space Z ranges from -1 to 1 (the GL convention),
+// as produced by HMM_Perspective_RH_NO, HMM_Perspective_LH_NO, HMM_Orthographic_RH_NO and HMM_Orthographic_LH_NO.
+static inline HMM_Frustum HMM_FrustumFromM4_NO(HMM_Mat4 ViewProjection)
+{
+    ASSERT_COVERED(HMM_FrustumFromM4_NO);
+    return _HMM_FrustumFromM4(ViewProjection, 0);
+}
+
+COVERAGE(HMM_FrustumFromM4_ZO, 1)
+// Extracts the frustum of a view-projection matrix whose clip space Z ranges from 0 to 1 (the DirectX convention),
+// as produced by HMM_Perspective_RH_ZO, HMM_Perspective_LH_ZO, HMM_Orthographic_RH_ZO and HMM_Orthographic_LH_ZO.
+static inline HMM_Frustum HMM_FrustumFromM4_ZO(HMM_Mat4 ViewProjection)
+{
+    ASSERT_COVERED(HMM_FrustumFromM4_ZO);
+    return _HMM_FrustumFromM4(ViewProjection, 1);
+}
+
+COVERAGE(HMM_FrustumTestSphere, 1)
+// Returns whether a sphere is at least partly inside the frustum.
+static inline HMM_Bool HMM_FrustumTestSphere(HMM_Frustum Frustum, HMM_Vec3 Center, float Radius)
+{
+    ASSERT_COVERED(HMM_FrustumTestSphere);
+
+    for (int Plane = 0; Plane < 6; ++Plane)
+    {
+        if (HMM_DotV3(Frustum.Planes[Plane].XYZ, Center) + Frustum.Planes[Plane].W < -Radius)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+COVERAGE(HMM_FrustumTestAABB, 1)
+// Returns whether a box might be inside the frustum. Each plane is tested against the corner
+// furthest along its normal, so a box outside the frustum but near one of its edges can be
+// reported as inside; a box that is inside is never reported as outside.
+static inline HMM_Bool HMM_FrustumTestAABB(HMM_Frustum Frustum, HMM_Vec3 Min, HMM_Vec3 Max)
+{
+    ASSERT_COVERED(HMM_FrustumTestAABB);
+
+    for (int Plane = 0; Plane < 6; ++Plane)
+    {
+        HMM_Vec4 P = Frustum.Planes[Plane];
+        HMM_Vec3 Corner = HMM_V3(P.X >= 0.0f ? Max.X : Min.X, P.Y >= 0.0f ? Max.Y : Min.Y, P.Z >= 0.0f ? Max.Z : Min.Z);
+        if (HMM_DotV3(P.XYZ, Corner) + P.W < 0.0f)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* NOTE: The batch tests take blocks of HMM_SOA_WIDTH (8) objects, as made by HMM_V3ArrayToSoA, and
+   write one bit per object to Visible: bit (i % 8) of Visible[i / 8] is set if object i may be
+   visible. Visible needs (Count + 7) / 8 bytes, and bits past Count are cleared. Each lane gives
+   the same answer as the single-object test. The plane components are broadcast once up front,
+   and all six planes are tested without branching. */
+
+#ifdef HANDMADE_MATH__USE_AVX
+static inline __m256 _HMM_PlaneDistanceAVX(const __m256 *Plane, __m256 X, __m256 Y, __m256 Z)
+{
+    /* NOTE: Separate multiplies and adds, in the order of the scalar test, so that lanes match it exactly. */
+    __m256 Distance = _mm256_add_ps(_mm256_mul_ps(X, Plane[0]), _mm256_mul_ps(Y, Plane[1]));
+    Distance = _mm256_add_ps(Distance, _mm256_mul_ps(Z, Plane[2]));
+    return _mm256_add_ps(Distance, Plane[3]);
+}
+#elif defined(HANDMADE_MATH__USE_SSE)
+static inline __m128 _HMM_PlaneDistanceSSE(const __m128 *Plane, __m128 X, __m128 Y, __m128 Z)
+{
+    __m128 Distance = _mm_add_ps(_mm_mul_ps(X, Plane[0]), _mm_mul_ps(Y, Plane[1]));
+    Distance = _mm_add_ps(Distance, _mm_mul_ps(Z, Plane[2]));
+    return _mm_add_ps(Distance, Plane[3]);
+}
+#elif defined(HANDMADE_MATH__USE_NEON)
+static inline float32x4_t _HMM_PlaneDistanceNEON(const float32x4_t *Plane, float32x4_t X, float32x4_t Y, float32x4_t Z)
+{
+    float32x4_t Distance = vaddq_f32(vmulq_f32(X, Plane[0]), vmulq_f32(Y, Plane[1]));
+    Distance = vaddq_f32(Distance, vmulq_f32(Z, Plane[2]));
+    return vaddq_f32(Distance, Plane[3]);
+}
+
+static inline int _HMM_MoveMaskNEON(uint32x4_t Mask)
+{
+    static const uint32_t Bits[4] = {1, 2, 4, 8};
+    return (int)vaddvq_u32(vandq_u32(Mask, vld1q_u32(Bits)));
+}
+#endif
+
+static inline unsigned char _HMM_VisibleBits(int Mask, int Block, int Count)
+{
+    int Remaining = Count - Block * HMM_SOA_WIDTH;
+    if (Remaining < HMM_SOA_WIDTH)
+    {
+        Mask &= (1 << Remaining) - 1;
+    }
+    return (unsigned char)Mask;
+}
+
+COVERAGE(HMM_FrustumTestSphereSoA, 1)
+// Batch version of HMM_FrustumTestSphere.
+static inline void HMM_FrustumTestSphereSoA(HMM_Frustum Frustum, const HMM_Vec3SoA *Centers, const HMM_FloatSoA *Radii,
+                                            unsigned char *Visible, int Count)
+{
+    ASSERT_COVERED(HMM_FrustumTestSphereSoA);
+
+#ifdef HANDMADE_MATH__USE_AVX
+    __m256 Planes[6][4];
+    for (int Plane = 0; Plane < 6; ++Plane)
+    {
+        for (int Component = 0; Component < 4; ++Component)
+        {
+            Planes[Plane][Component] = _mm256_set1_ps(Frustum.Planes[Plane].Elements[Component]);
+        }
+    }
+
+    for (int Block = 0; Block * HMM_SOA_WIDTH < Count; ++Block)
+    {
+        __m256 X = _mm256_loadu_ps(Centers[Block].X.Elements);
+        __m256 Y = _mm256_loadu_ps(Centers[Block].Y.Elements);
+        __m256 Z = _mm256_loadu_ps(Centers[Block].Z.Elements);
+        __m256 NegRadius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(Radii[Block].Elements));
+
+        __m256 Inside = _mm256_cmp_ps(_HMM_PlaneDistanceAVX(Planes[0], X, Y, Z), NegRadius, _CMP_GE_OQ);
+        for (int Plane = 1; Plane < 6; ++Plane)
+        {
+            Inside = _mm256_and_ps(Inside, _mm256_cmp_ps(_HMM_PlaneDistanceAVX(Planes[Plane], X, Y, Z), NegRadius, _CMP_GE_OQ));
+        }
+        Visible[Block] = _HMM_VisibleBits(_mm256_movemask_ps(Inside), Block, Count);
+    }
+#elif defined(HANDMADE_MATH__USE_SSE)
+    __m128 Planes[6][4];
+    for (int Plane = 0; Plane < 6; ++Plane)
+    {
+        for (int Component = 0; Component < 4; ++Component)
+        {
+            Planes[Plane][Component] = _mm_set1_ps(Frustum.Planes[Plane].Elements[Component]);
+        }
+    }
+
+    for (int Block = 0; Block * HMM_SOA_WIDTH < Count; ++Block)
+    {
+        int Mask = 0;
+        for (int Half = 0; Half < HMM_SOA_WIDTH / 4; ++Half)
+        {
+            __m128 X = Centers[Block].X.SSE[Half];
+            __m128 Y = Centers[Block].Y.SSE[Half];
+            __m128 Z = Centers[Block].Z.SSE[Half];
+            __m128 NegRadius = _mm_sub_ps(_mm_setzero_ps(), Radii[Block].SSE[Half]);
+
+            __m128 Inside = _mm_cmpge_ps(_HMM_PlaneDistanceSSE(Planes[0], X, Y, Z), NegRadius);
+            for (int Plane = 1; Plane < 6; ++Plane)
+            {
+                Inside = _mm_and_ps(Inside, _mm_cmpge_ps(_HMM_PlaneDistanceSSE(Planes[Plane], X, Y, Z), NegRadius));
+            }
+            Mask |= _mm_movemask_ps(Inside) << (4 * Half);
+        }
+        Visible[Block] = _HMM_VisibleBits(Mask, Block, Count);
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t Planes[6][4];
+    for (int Plane = 0; Plane < 6; ++Plane)
+    {
+        for (int Component = 0; Component < 4; ++Component)
+        {
+            Planes[Plane][Component] = vdupq_n_f32(Frustum.Planes[Plane].Elements[Component]);
+        }
+    }
+
+    for (int Block = 0; Block * HMM_SOA_WIDTH < Count; ++Block)
+    {
+        int Mask = 0;
+        for (int Half = 0; Half < HMM_SOA_WIDTH / 4; ++Half)
+        {
+            float32x4_t X = Centers[Block].X.NEON[Half];
+            float32x4_t Y = Centers[Block].Y.NEON[Half];
+            float32x4_t Z = Centers[Block].Z.NEON[Half];
+            float32x4_t NegRadius = vnegq_f32(Radii[Block].NEON[Half]);
+
+            uint32x4_t Inside = vcgeq_f32(_HMM_PlaneDistanceNEON(Planes[0], X, Y, Z), NegRadius);
+            for (int Plane = 1; Plane < 6; ++Plane)
+            {
+                Inside = vandq_u32(Inside, vcgeq_f32(_HMM_PlaneDistanceNEON(Planes[Plane], X, Y, Z), NegRadius));
+            }
+            Mask |= _HMM_MoveMaskNEON(Inside) << (4 * Half);
+        }
+        Visible[Block] = _HMM_VisibleBits(Mask, Block, Count);
+    }
+#else
+    for (int Block = 0; Block * HMM_SOA_WIDTH < Count; ++Block)
+    {
+        int Mask = 0;
+        for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+        {
+            HMM_Vec3 Center = HMM_V3(Centers[Block].X.Elements[Lane], Centers[Block].Y.Elements[Lane], Centers[Block].Z.Elements[Lane]);
+            Mask |= HMM_FrustumTestSphere(Frustum, Center, Radii[Block].Elements[Lane]) << Lane;
+        }
+        Visible[Block] = _HMM_VisibleBits(Mask, Block, Count);
+    }
+#endif
+}
+
+COVERAGE(HMM_FrustumTestAABBSoA, 1)
+// Batch version of HMM_FrustumTestAABB.
+static inline void HMM_FrustumTestAABBSoA(HMM_Frustum Frustum, const HMM_Vec3SoA *Mins, const HMM_Vec3SoA *Maxs,
+                                          unsigned char *Visible, int Count)
+{
+    ASSERT_COVERED(HMM_FrustumTestAABBSoA);
+
+    /* NOTE: The normal is the same for every lane, so the corner is picked per plane rather than per lane.
+       Corners[P][C] is Mins or Maxs, whichever holds component C of the corner tested against plane P. */
+    const HMM_Vec3SoA *Corners[6][3];
+    for (int Plane = 0; Plane < 6; ++Plane)
+    {
+        for (int Component = 0; Component < 3; ++Component)
+        {
+            Corners[Plane][Component] = Frustum.Planes[Plane].Elements[Component] >= 0.0f ? Maxs : Mins;
+        }
+    }
+
+#ifdef HANDMADE_MATH__USE_AVX
+    __m256 Planes[6][4];
+    for (int Plane = 0; Plane < 6; ++Plane)
+    {
+        for (int Component = 0; Component < 4; ++Component)
+        {
+            Planes[Plane][Component] = _mm256_set1_ps(Frustum.Planes[Plane].Elements[Component]);
+        }
+    }
+
+    for (int Block = 0; Block * HMM_SOA_WIDTH < Count; ++Block)
+    {
+        __m256 Inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int Plane = 0; Plane < 6; ++Plane)
+        {
+            __m256 X = _mm256_loadu_ps(Corners[Plane][0][Block].X.Elements);
+            __m256 Y = _mm256_loadu_ps(Corners[Plane][1][Block].Y.Elements);
+            __m256 Z = _mm256_loadu_ps(Corners[Plane][2][Block].Z.Elements);
+            Inside = _mm256_and_ps(Inside, _mm256_cmp_ps(_HMM_PlaneDistanceAVX(Planes[Plane], X, Y, Z), _mm256_setzero_ps(), _CMP_GE_OQ));
+        }
+        Visible[Block] = _HMM_VisibleBits(_mm256_movemask_ps(Inside), Block, Count);
+    }
+#elif defined(HANDMADE_MATH__USE_SSE)
+    __m128 Planes[6][4];
+    for (int Plane = 0; Plane < 6; ++Plane)
+    {
+        for (int Component = 0; Component < 4; ++Component)
+        {
+            Planes[Plane][Component] = _mm_set1_ps(Frustum.Planes[Plane].Elements[Component]);
+        }
+    }
+
+    for (int Block = 0; Block * HMM_SOA_WIDTH < Count; ++Block)
+    {
+        int Mask = 0;
+        for (int Half = 0; Half < HMM_SOA_WIDTH / 4; ++Half)
+        {
+            __m128 Inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (int Plane = 0; Plane < 6; ++Plane)
+            {
+                __m128 X = Corners[Plane][0][Block].X.SSE[Half];
+                __m128 Y = Corners[Plane][1][Block].Y.SSE[Half];
+                __m128 Z = Corners[Plane][2][Block].Z.SSE[Half];
+                Inside = _mm_and_ps(Inside, _mm_cmpge_ps(_HMM_PlaneDistanceSSE(Planes[Plane], X, Y, Z), _mm_setzero_ps()));
+            }
+            Mask |= _mm_movemask_ps(Inside) << (4 * Half);
+        }
+        Visible[Block] = _HMM_VisibleBits(Mask, Block, Count);
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t Planes[6][4];
+    for (int Plane = 0; Plane < 6; ++Plane)
+    {
+        for (int Component = 0; Component < 4; ++Component)
+        {
+            Planes[Plane][Component] = vdupq_n_f32(Frustum.Planes[Plane].Elements[Component]);
+        }
+    }
+
+    for (int Block = 0; Block * HMM_SOA_WIDTH < Count; ++Block)
+    {
+        int Mask = 0;
+        for (int Half = 0; Half < HMM_SOA_WIDTH / 4; ++Half)
+        {
+            uint32x4_t Inside = vdupq_n_u32(0xFFFFFFFFu);
+            for (int Plane = 0; Plane < 6; ++Plane)
+            {
+                float32x4_t X = Corners[Plane][0][Block].X.NEON[Half];
+                float32x4_t Y = Corners[Plane][1][Block].Y.NEON[Half];
+                float32x4_t Z = Corners[Plane][2][Block].Z.NEON[Half];
+                Inside = vandq_u32(Inside, vcgeq_f32(_HMM_PlaneDistanceNEON(Planes[Plane], X, Y, Z), vdupq_n_f32(0.0f)));
+            }
+            Mask |= _HMM_MoveMaskNEON(Inside) << (4 * Half);
+        }
+        Visible[Block] = _HMM_VisibleBits(Mask, Block, Count);
+    }
+#else
+    for (int Block = 0; Block * HMM_SOA_WIDTH < Count; ++Block)
+    {
+        int Mask = 0;
+        for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+        {
+            HMM_Vec3 Min = HMM_V3(Mins[Block].X.Elements[Lane], Mins[Block].Y.Elements[Lane], Mins[Block].Z.Elements[Lane]);
+            HMM_Vec3 Max = HMM_V3(Maxs[Block].X.Elements[Lane], Maxs[Block].Y.Elements[Lane], Maxs[Block].Z.Elements[Lane]);
+            Mask |= HMM_FrustumTestAABB(Frustum, Min, Max) << Lane;
+        }
+        Visible[Block] = _HMM_VisibleBits(Mask, Block, Count);
+    }
+    (void)Corners;
+#endif
+}
+
+/*
+ * Bounding volumes
+ *
+ * Transforms take an affine HMM_Mat4, such as a model matrix. They give a
+ * volume that contains the transformed volume, which for boxes and spheres
+ * under rotation is larger than the original.
+ */
+
+static inline HMM_Vec3A _HMM_MinV3A(HMM_Vec3A Left, HMM_Vec3A Right)
+{
+    HMM_Vec3A Result;
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _mm_min_ps(Left.SSE, Right.SSE);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vminq_f32(Left.NEON, Right.NEON);
+#else
+    Result.X = HMM_MIN(Left.X, Right.X);
+    Result.Y = HMM_MIN(Left.Y, Right.Y);
+    Result.Z = HMM_MIN(Left.Z, Right.Z);
+#endif
+    return Result;
+}
+
+static inline HMM_Vec3A _HMM_MaxV3A(HMM_Vec3A Left, HMM_Vec3A Right)
+{
+    HMM_Vec3A Result;
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _mm_max_ps(Left.SSE, Right.SSE);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vmaxq_f32(Left.NEON, Right.NEON);
+#else
+    Result.X = HMM_MAX(Left.X, Right.X);
+    Result.Y = HMM_MAX(Left.Y, Right.Y);
+    Result.Z = HMM_MAX(Left.Z, Right.Z);
+#endif
+    return Result;
+}
+
+COVERAGE(HMM_AABBFromPoints, 1)
+// Returns the smallest box containing Count points. With no points, the box is empty.
+static inline HMM_AABB HMM_AABBFromPoints(const HMM_Vec3 *Points, int Count)
+{
+    ASSERT_COVERED(HMM_AABBFromPoints);
+
+    HMM_Vec3A Min = HMM_V3A(HMM_F32_MAX, HMM_F32_MAX, HMM_F32_MAX);
+    HMM_Vec3A Max = HMM_V3A(-HMM_F32_MAX, -HMM_F32_MAX, -HMM_F32_MAX);
+    for (int Index = 0; Index < Count; ++Index)
+    {
+        HMM_Vec3A Point = HMM_V3ToV3A(Points[Index]);
+        Min = _HMM_MinV3A(Min, Point);
+        Max = _HMM_MaxV3A(Max, Point);
+    }
+
+    HMM_AABB Result;
+    Result.Min = Min.XYZ;
+    Result.Max = Max.XYZ;
+    return Result;
+}
+
+COVERAGE(HMM_AABBCenter, 1)
+static inline HMM_Vec3 HMM_AABBCenter(HMM_AABB Box)
+{
+    ASSERT_COVERED(HMM_AABBCenter);
+    return HMM_MulV3F(HMM_AddV3(Box.Min, Box.Max), 0.5f);
+}
+
+COVERAGE(HMM_AABBHalfExtents, 1)
+static inline HMM_Vec3 HMM_AABBHalfExtents(HMM_AABB Box)
+{
+    ASSERT_COVERED(HMM_AABBHalfExtents);
+    return HMM_MulV3F(HMM_SubV3(Box.Max, Box.Min), 0.5f);
+}
+
+COVERAGE(HMM_MergeAABB, 1)
+// Returns the smallest box containing both boxes.
+static inline HMM_AABB HMM_MergeAABB(HMM_AABB Left, HMM_AABB Right)
+{
+    ASSERT_COVERED(HMM_MergeAABB);
+
+    HMM_AABB Result;
+    Result.Min.X = HMM_MIN(Left.Min.X, Right.Min.X);
+    Result.Min.Y = HMM_MIN(Left.Min.Y, Right.Min.Y);
+    Result.Min.Z = HMM_MIN(Left.Min.Z, Right.Min.Z);
+    Result.Max.X = HMM_MAX(Left.Max.X, Right.Max.X);
+    Result.Max.Y = HMM_MAX(Left.Max.Y, Right.Max.Y);
+    Result.Max.Z = HMM_MAX(Left.Max.Z, Right.Max.Z);
+
+    return Result;
+}
+
+COVERAGE(HMM_MergeAABBArray, 1)
+// Returns the smallest box containing Count boxes, e.g. to refit a BVH node. With no boxes, the box is empty.
+static inline HMM_AABB HMM_MergeAABBArray(const HMM_AABB *Boxes, int Count)
+{
+    ASSERT_COVERED(HMM_MergeAABBArray);
+
+    HMM_Vec3A Min = HMM_V3A(HMM_F32_MAX, HMM_F32_MAX, HMM_F32_MAX);
+    HMM_Vec3A Max = HMM_V3A(-HMM_F32_MAX, -HMM_F32_MAX, -HMM_F32_MAX);
+    for (int Index = 0; Index < Count; ++Index)
+    {
+        Min = _HMM_MinV3A(Min, HMM_V3ToV3A(Boxes[Index].Min));
+        Max = _HMM_MaxV3A(Max, HMM_V3ToV3A(Boxes[Index].Max));
+    }
+
+    HMM_AABB Result;
+    Result.Min = Min.XYZ;
+    Result.Max = Max.XYZ;
+    return Result;
+}
+
+COVERAGE(HMM_AABBContainsV3, 1)
+static inline HMM_Bool HMM_AABBContainsV3(HMM_AABB Box, HMM_Vec3 Point)
+{
+    ASSERT_COVERED(HMM_AABBContainsV3);
+
+    return Point.X >= Box.Min.X && Point.X <= Box.Max.X
+        && Point.Y >= Box.Min.Y && Point.Y <= Box.Max.Y
+        && Point.Z >= Box.Min.Z && Point.Z <= Box.Max.Z;
+}
+
+COVERAGE(HMM_AABBContainsAABB, 1)
+// Returns whether Inner is entirely inside Outer.
+static inline HMM_Bool HMM_AABBContainsAABB(HMM_AABB Outer, HMM_AABB Inner)
+{
+    ASSERT_COVERED(HMM_AABBContainsAABB);
+
+    return Inner.Min.X >= Outer.Min.X && Inner.Max.X <= Outer.Max.X
+        && Inner.Min.Y >= Outer.Min.Y && Inner.Max.Y <= Outer.Max.Y
+        && Inner.Min.Z >= Outer.Min.Z && Inner.Max.Z <= Outer.Max.Z;
+}
+
+COVERAGE(HMM_AABBOverlap, 1)
+// Returns whether two boxes overlap. Boxes that only touch count as overlapping.
+static inline HMM_Bool HMM_AABBOverlap(HMM_AABB Left, HMM_AABB Right)
+{
+    ASSERT_COVERED(HMM_AABBOverlap);
+
+    return Left.Min.X <= Right.Max.X && Right.Min.X <= Left.Max.X
+        && Left.Min.Y <= Right.Max.Y && Right.Min.Y <= Left.Max.Y
+        && Left.Min.Z <= Right.Max.Z && Right.Min.Z <= Left.Max.Z;
+}
+
+COVERAGE(HMM_AABBOverlapArray, 1)
+// Tests Box against Count boxes, e.g. for a broadphase query. Bit (i % 8) of Overlaps[i / 8] is set if
+// Box overlaps Boxes[i]; Overlaps needs (Count + 7) / 8 bytes, and bits past Count are cleared.
+static inline void HMM_AABBOverlapArray(HMM_AABB Box, const HMM_AABB *Boxes, unsigned char *Overlaps, int Count)
+{
+    ASSERT_COVERED(HMM_AABBOverlapArray);
+
+#ifdef HANDMADE_MATH__USE_SSE
+    /* NOTE: Each box is read with two overlapping loads, and the lane holding Min.Z is moved to the
+       top of the second and ignored. */
+    __m128 BoxMin = _mm_setr_ps(Box.Min.X, Box.Min.Y, Box.Min.Z, 0.0f);
+    __m128 BoxMax = _mm_setr_ps(Box.Max.X, Box.Max.Y, Box.Max.Z, 0.0f);
+    for (int Byte = 0; Byte * 8 < Count; ++Byte)
+    {
+        int Bits = 0;
+        int End = HMM_MIN(8, Count - Byte * 8);
+        for (int Bit = 0; Bit < End; ++Bit)
+        {
+            const float *Other = &Boxes[Byte * 8 + Bit].Min.X;
+            __m128 OtherMin = _mm_loadu_ps(Other);             /* Min.X Min.Y Min.Z Max.X */
+            __m128 OtherMax = _mm_loadu_ps(Other + 2);         /* Min.Z Max.X Max.Y Max.Z */
+            OtherMax = _mm_shuffle_ps(OtherMax, OtherMax, _MM_SHUFFLE(0, 3, 2, 1));
+            __m128 Separated = _mm_or_ps(_mm_cmpgt_ps(BoxMin, OtherMax), _mm_cmpgt_ps(OtherMin, BoxMax));
+            Bits |= ((_mm_movemask_ps(Separated) & 7) == 0) << Bit;
+        }
+        Overlaps[Byte] = (unsigned char)Bits;
+    }
+#else
+    for (int Byte = 0; Byte * 8 < Count; ++Byte)
+    {
+        int Bits = 0;
+        int End = HMM_MIN(8, Count - Byte * 8);
+        for (int Bit = 0; Bit < End; ++Bit)
+        {
+            Bits |= HMM_AABBOverlap(Box, Boxes[Byte * 8 + Bit]) << Bit;
+        }
+        Overlaps[Byte] = (unsigned char)Bits;
+    }
+#endif
+}
+
+// Writes both corners with two vector stores, so that vector loads of the box right after don't stall.
+static inline void _HMM_StoreAABB(HMM_AABB *Out, HMM_Vec3A Min, HMM_Vec3A Max)
+{
+#ifdef HANDMADE_MATH__USE_SSE
+    /* NOTE: The second store starts at Min.Z and covers the padding lane of the first. */
+    __m128 Upper = _mm_shuffle_ps(Min.SSE, Max.SSE, _MM_SHUFFLE(0, 0, 2, 2));
+    Upper = _mm_shuffle_ps(Upper, Max.SSE, _MM_SHUFFLE(2, 1, 2, 0));
+    _mm_storeu_ps(&Out->Min.X, Min.SSE);
+    _mm_storeu_ps(&Out->Min.Z, Upper);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    vst1q_f32(&Out->Min.X, Min.NEON);
+    vst1_f32(&Out->Max.X, vget_low_f32(Max.NEON));
+    vst1q_lane_f32(&Out->Max.Z, Max.NEON, 2);
+#else
+    Out->Min = Min.XYZ;
+    Out->Max = Max.XYZ;
+#endif
+}
+
+// Arvo's method: each column of the matrix, scaled by the box's minimum and maximum along that axis,
+// adds its smaller product to the new minimum and its larger one to the new maximum.
+static inline void _HMM_TransformAABB(HMM_Vec3A Column0, HMM_Vec3A Column1, HMM_Vec3A Column2, HMM_Vec3A Translation,
+                                      HMM_AABB Box, HMM_AABB *Out)
+{
+    HMM_Vec3A Min = Translation;
+    HMM_Vec3A Max = Translation;
+
+    HMM_Vec3A A = HMM_MulV3AF(Column0, Box.Min.X);
+    HMM_Vec3A B = HMM_MulV3AF(Column0, Box.Max.X);
+    Min = HMM_AddV3A(Min, _HMM_MinV3A(A, B));
+    Max = HMM_AddV3A(Max, _HMM_MaxV3A(A, B));
+
+    A = HMM_MulV3AF(Column1, Box.Min.Y);
+    B = HMM_MulV3AF(Column1, Box.Max.Y);
+    Min = HMM_AddV3A(Min, _HMM_MinV3A(A, B));
+    Max = HMM_AddV3A(Max, _HMM_MaxV3A(A, B));
+
+    A = HMM_MulV3AF(Column2, Box.Min.Z);
+    B = HMM_MulV3AF(Column2, Box.Max.Z);
+    Min = HMM_AddV3A(Min, _HMM_MinV3A(A, B));
+    Max = HMM_AddV3A(Max, _HMM_MaxV3A(A, B));
+
+    _HMM_StoreAABB(Out, Min, Max);
+}
+
+COVERAGE(HMM_TransformAABB, 1)
+// Returns the smallest axis-aligned box containing the transformed box.
+static inline HMM_AABB HMM_TransformAABB(HMM_Mat4 Matrix, HMM_AABB Box)
+{
+    ASSERT_COVERED(HMM_TransformAABB);
+
+    HMM_AABB Result;
+    _HMM_TransformAABB(HMM_V4ToV3A(Matrix.Columns[0]), HMM_V4ToV3A(Matrix.Columns[1]),
+                       HMM_V4ToV3A(Matrix.Columns[2]), HMM_V4ToV3A(Matrix.Columns[3]), Box, &Result);
+    return Result;
+}
+
+COVERAGE(HMM_TransformAABBArray, 1)
+// Transforms Count boxes by Matrix. Out may be the same array as In.
+static inline void HMM_TransformAABBArray(HMM_Mat4 Matrix, const HMM_AABB *In, HMM_AABB *Out, int Count)
+{
+    ASSERT_COVERED(HMM_TransformAABBArray);
+
+    HMM_Vec3A Column0 = HMM_V4ToV3A(Matrix.Columns[0]);
+    HMM_Vec3A Column1 = HMM_V4ToV3A(Matrix.Columns[1]);
+    HMM_Vec3A Column2 = HMM_V4ToV3A(Matrix.Columns[2]);
+    HMM_Vec3A Translation = HMM_V4ToV3A(Matrix.Columns[3]);
+    for (int Index = 0; Index < Count; ++Index)
+    {
+        _HMM_TransformAABB(Column0, Column1, Column2, Translation, In[Index], &Out[Index]);
+    }
+}
+
+COVERAGE(HMM_SphereFromAABB, 1)
+// Returns the smallest sphere containing a box.
+static inline HMM_Sphere HMM_SphereFromAABB(HMM_AABB Box)
+{
+    ASSERT_COVERED(HMM_SphereFromAABB);
+
+    HMM_Sphere Result;
+    Result.Center = HMM_AABBCenter(Box);
+    Result.Radius = HMM_LenV3(HMM_AABBHalfExtents(Box));
+    return Result;
+}
+
+COVERAGE(HMM_AABBFromSphere, 1)
+static inline HMM_AABB HMM_AABBFromSphere(HMM_Sphere Sphere)
+{
+    ASSERT_COVERED(HMM_AABBFromSphere);
+
+    HMM_Vec3 Extents = HMM_V3(Sphere.Radius, Sphere.Radius, Sphere.Radius);
+    HMM_AABB Result;
+    Result.Min = HMM_SubV3(Sphere.Center, Extents);
+    Result.Max = HMM_AddV3(Sphere.Center, Extents);
+    return Result;
+}
+
+COVERAGE(HMM_MergeSphere, 1)
+// Returns the smallest sphere containing both spheres.
+static inline HMM_Sphere HMM_MergeSphere(HMM_Sphere Left, HMM_Sphere Right)
+{
+    ASSERT_COVERED(HMM_MergeSphere);
+
+    HMM_Vec3 Offset = HMM_SubV3(Right.Center, Left.Center);
+    float Distance = HMM_LenV3(Offset);
+
+    if (Distance + Right.Radius <= Left.Radius)
+    {
+        return Left;
+    }
+    if (Distance + Left.Radius <= Right.Radius)
+    {
+        return Right;
+    }
+
+    HMM_Sphere Result;
+    Result.Radius = 0.5f * (Distance + Left.Radius + Right.Radius);
+    Result.Center = HMM_AddV3(Left.Center, HMM_MulV3F(Offset, (Result.Radius - Left.Radius) / Distance));
+    return Result;
+}
+
+COVERAGE(HMM_SphereContainsV3, 1)
+static inline HMM_Bool HMM_SphereContainsV3(HMM_Sphere Sphere, HMM_Vec3 Point)
+{
+    ASSERT_COVERED(HMM_SphereContainsV3);
+    return HMM_LenSqrV3(HMM_SubV3(Point, Sphere.Center)) <= Sphere.Radius * Sphere.Radius;
+}
+
+COVERAGE(HMM_SphereOverlap, 1)
+static inline HMM_Bool HMM_SphereOverlap(HMM_Sphere Left, HMM_Sphere Right)
+{
+    ASSERT_COVERED(HMM_SphereOverlap);
+
+    float Radii = Left.Radius + Right.Radius;
+    return HMM_LenSqrV3(HMM_SubV3(Right.Center, Left.Center)) <= Radii * Radii;
+}
+
+COVERAGE(HMM_SphereOverlapAABB, 1)
+static inline HMM_Bool HMM_SphereOverlapAABB(HMM_Sphere Sphere, HMM_AABB Box)
+{
+    ASSERT_COVERED(HMM_SphereOverlapAABB);
+
+    HMM_Vec3 Closest;
+    Closest.X = HMM_MIN(HMM_MAX(Sphere.Center.X, Box.Min.X), Box.Max.X);
+    Closest.Y = HMM_MIN(HMM_MAX(Sphere.Center.Y, Box.Min.Y), Box.Max.Y);
+    Closest.Z = HMM_MIN(HMM_MAX(Sphere.Center.Z, Box.Min.Z), Box.Max.Z);
+    return HMM_LenSqrV3(HMM_SubV3(Closest, Sphere.Center)) <= Sphere.Radius * Sphere.Radius;
+}
+
+// The largest factor by which the matrix scales a length.
+static inline float _HMM_MaxScaleM4(HMM_Mat4 Matrix)
+{
+    float Scale = HMM_MAX(HMM_LenSqrV3(Matrix.Columns[0].XYZ), HMM_LenSqrV3(Matrix.Columns[1].XYZ));
+    return HMM_SqrtF(HMM_MAX(Scale, HMM_LenSqrV3(Matrix.Columns[2].XYZ)));
+}
+
+COVERAGE(HMM_TransformSphere, 1)
+// Transforms the center and scales the radius by the largest scale of the matrix.
+static inline HMM_Sphere HMM_TransformSphere(HMM_Mat4 Matrix, HMM_Sphere Sphere)
+{
+    ASSERT_COVERED(HMM_TransformSphere);
+
+    HMM_Sphere Result;
+    Result.Center = HMM_LinearCombineV4M4(HMM_V4V(Sphere.Center, 1.0f), Matrix).XYZ;
+    Result.Radius = Sphere.Radius * _HMM_MaxScaleM4(Matrix);
+    return Result;
+}
+
+COVERAGE(HMM_TransformSphereArray, 1)
+// Transforms Count spheres by Matrix. Out may be the same array as In.
+static inline void HMM_TransformSphereArray(HMM_Mat4 Matrix, const HMM_Sphere *In, HMM_Sphere *Out, int Count)
+{
+    ASSERT_COVERED(HMM_TransformSphereArray);
+
+    /* NOTE: Each sphere is transformed as one HMM_Vec4: the radius lane picks up the scale through a fourth
+       column of (0, 0, 0, Scale), and the translation is added afterwards. */
+    HMM_Mat4 Columns;
+    Columns.Columns[0] = HMM_V4V(Matrix.Columns[0].XYZ, 0.0f);
+    Columns.Columns[1] = HMM_V4V(Matrix.Columns[1].XYZ, 0.0f);
+    Columns.Columns[2] = HMM_V4V(Matrix.Columns[2].XYZ, 0.0f);
+    Columns.Columns[3] = HMM_V4(0.0f, 0.0f, 0.0f, _HMM_MaxScaleM4(Matrix));
+    HMM_Vec4 Translation = HMM_V4V(Matrix.Columns[3].XYZ, 0.0f);
+
+    for (int Index = 0; Index < Count; ++Index)
+    {
+        Out[Index].CenterRadius = HMM_AddV4(HMM_LinearCombineV4M4(In[Index].CenterRadius, Columns), Translation);
+    }
+}
+
+COVERAGE(HMM_OBBFromAABB, 1)
+// Returns the oriented box that a box becomes under an affine transform without shear.
+static inline HMM_OBB HMM_OBBFromAABB(HMM_Mat4 Matrix, HMM_AABB Box)
+{
+    ASSERT_COVERED(HMM_OBBFromAABB);
+
+    HMM_Vec3 HalfExtents = HMM_AABBHalfExtents(Box);
+    float Scale0 = HMM_LenV3(Matrix.Columns[0].XYZ);
+    float Scale1 = HMM_LenV3(Matrix.Columns[1].XYZ);
+    float Scale2 = HMM_LenV3(Matrix.Columns[2].XYZ);
+
+    HMM_OBB Result;
+    Result.Center = HMM_LinearCombineV4M4(HMM_V4V(HMM_AABBCenter(Box), 1.0f), Matrix).XYZ;
+    Result.HalfExtents = HMM_V3(HalfExtents.X * Scale0, HalfExtents.Y * Scale1, HalfExtents.Z * Scale2);
+    Result.Axes.Columns[0] = HMM_DivV3F(Matrix.Columns[0].XYZ, Scale0);
+    Result.Axes.Columns[1] = HMM_DivV3F(Matrix.Columns[1].XYZ, Scale1);
+    Result.Axes.Columns[2] = HMM_DivV3F(Matrix.Columns[2].XYZ, Scale2);
+    return Result;
+}
+
+COVERAGE(HMM_AABBFromOBB, 1)
+// Returns the smallest axis-aligned box containing an oriented box.
+static inline HMM_AABB HMM_AABBFromOBB(HMM_OBB Box)
+{
+    ASSERT_COVERED(HMM_AABBFromOBB);
+
+    HMM_Vec3 Extents;
+    for (int Row = 0; Row < 3; ++Row)
+    {
+        Extents.Elements[Row] = HMM_ABS(Box.Axes.Elements[0][Row]) * Box.HalfExtents.X
+                              + HMM_ABS(Box.Axes.Elements[1][Row]) * Box.HalfExtents.Y
+                              + HMM_ABS(Box.Axes.Elements[2][Row]) * Box.HalfExtents.Z;
+    }
+
+    HMM_AABB Result;
+    Result.Min = HMM_SubV3(Box.Center, Extents);
+    Result.Max = HMM_AddV3(Box.Center, Extents);
+    return Result;
+}
+
+COVERAGE(HMM_TransformOBB, 1)
+// Transforms an oriented box by an affine transform without shear.
+static inline HMM_OBB HMM_TransformOBB(HMM_Mat4 Matrix, HMM_OBB Box)
+{
+    ASSERT_COVERED(HMM_TransformOBB);
+
+    HMM_OBB Result;
+    Result.Center = HMM_LinearCombineV4M4(HMM_V4V(Box.Center, 1.0f), Matrix).XYZ;
+    for (int Axis = 0; Axis < 3; ++Axis)
+    {
+        HMM_Vec3 Direction = HMM_LinearCombineV4M4(HMM_V4V(Box.Axes.Columns[Axis], 0.0f), Matrix).XYZ;
+        float Scale = HMM_LenV3(Direction);
+        Result.Axes.Columns[Axis] = HMM_DivV3F(Direction, Scale);
+        Result.HalfExtents.Elements[Axis] = Box.HalfExtents.Elements[Axis] * Scale;
+    }
+    return Result;
+}
+
+COVERAGE(HMM_OBBContainsV3, 1)
+static inline HMM_Bool HMM_OBBContainsV3(HMM_OBB Box, HMM_Vec3 Point)
+{
+    ASSERT_COVERED(HMM_OBBContainsV3);
+
+    HMM_Vec3 Offset = HMM_SubV3(Point, Box.Center);
+    for (int Axis = 0; Axis < 3; ++Axis)
+    {
+        if (HMM_ABS(HMM_DotV3(Offset, Box.Axes.Columns[Axis])) > Box.HalfExtents.Elements[Axis])
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+COVERAGE(HMM_OBBOverlap, 1)
+// Separating axis test over the 15 candidate axes: the face normals of both boxes and their
+// pairwise cross products.
+static inline HMM_Bool HMM_OBBOverlap(HMM_OBB Left, HMM_OBB Right)
+{
+    ASSERT_COVERED(HMM_OBBOverlap);
+
+    /* NOTE: Right's axes and center expressed in Left's frame. The epsilon keeps near-parallel edge
+       pairs, whose cross products are close to zero, from giving false separations. */
+    const float Epsilon = 1e-6f;
+    HMM_Mat3 Rotation, AbsRotation;
+    HMM_Vec3 Offset = HMM_SubV3(Right.Center, Left.Center);
+    HMM_Vec3 T;
+    for (int LeftAxis = 0; LeftAxis < 3; ++LeftAxis)
+    {
+        for (int RightAxis = 0; RightAxis < 3; ++RightAxis)
+        {
+            Rotation.Elements[RightAxis][LeftAxis] = HMM_DotV3(Left.Axes.Columns[LeftAxis], Right.Axes.Columns[RightAxis]);
+            AbsRotation.Elements[RightAxis][LeftAxis] = HMM_ABS(Rotation.Elements[RightAxis][LeftAxis]) + Epsilon;
+        }
+        T.Elements[LeftAxis] = HMM_DotV3(Offset, Left.Axes.Columns[LeftAxis]);
+    }
+
+    const float *A = Left.HalfExtents.Elements;
+    const float *B = Right.HalfExtents.Elements;
+    float RadiusA, RadiusB;
+
+    /* Left's axes */
+    for (int LeftAxis = 0; LeftAxis < 3; ++LeftAxis)
+    {
+        RadiusB = B[0] * AbsRotation.Elements[0][LeftAxis] + B[1] * AbsRotation.Elements[1][LeftAxis] + B[2] * AbsRotation.Elements[2][LeftAxis];
+        if (HMM_ABS(T.Elements[LeftAxis]) > A[LeftAxis] + RadiusB)
+        {
+            return 0;
+        }
+    }
+
+    /* Right's axes */
+    for (int RightAxis = 0; RightAxis < 3; ++RightAxis)
+    {
+        RadiusA = A[0] * AbsRotation.Elements[RightAxis][0] + A[1] * AbsRotation.Elements[RightAxis][1] + A[2] * AbsRotation.Elements[RightAxis][2];
+        float Distance = T.X * Rotation.Elements[RightAxis][0] + T.Y * Rotation.Elements[RightAxis][1] + T.Z * Rotation.Elements[RightAxis][2];
+        if (HMM_ABS(Distance) > RadiusA + B[RightAxis])
+        {
+            return 0;
+        }
+    }
+
+    /* Cross products of each of Left's axes with each of Right's */
+    for (int LeftAxis = 0; LeftAxis < 3; ++LeftAxis)
+    {
+        int LeftAxis1 = (LeftAxis + 1) % 3, LeftAxis2 = (LeftAxis + 2) % 3;
+        for (int RightAxis = 0; RightAxis < 3; ++RightAxis)
+        {
+            int RightAxis1 = (RightAxis + 1) % 3, RightAxis2 = (RightAxis + 2) % 3;
+            RadiusA = A[LeftAxis1] * AbsRotation.Elements[RightAxis][LeftAxis2] + A[LeftAxis2] * AbsRotation.Elements[RightAxis][LeftAxis1];
+            RadiusB = B[RightAxis1] * AbsRotation.Elements[RightAxis2][LeftAxis] + B[RightAxis2] * AbsRotation.Elements[RightAxis1][LeftAxis];
+            float Distance = T.Elements[LeftAxis2] * Rotation.Elements[RightAxis][LeftAxis1] - T.Elements[LeftAxis1] * Rotation.Elements[RightAxis][LeftAxis2];
+            if (HMM_ABS(Distance) > RadiusA + RadiusB)
+            {
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * Ray intersection
+ *
+ * Distances along a ray are in units of its direction's length, so the hit
+ * point is Origin + T * Direction. The packet tests return a mask with bit i
+ * set if lane i hits, and each lane gives the same answer as the
+ * single-ray test.
+ */
+
+// Moller-Trumbore, on a triangle given as its first vertex and the two edges leaving it.
+static inline HMM_Bool _HMM_RayTriangle(HMM_Ray Ray, float MaxT, HMM_Vec3 Vertex0, HMM_Vec3 Edge1, HMM_Vec3 Edge2,
+                                        float *T, float *U, float *V)
+{
+    HMM_Vec3 P = HMM_Cross(Ray.Direction, Edge2);
+    float Det = HMM_DotV3(Edge1, P);
+    if (Det == 0.0f)
+    {
+        return 0;
+    }
+
+    float InvDet = 1.0f / Det;
+    HMM_Vec3 S = HMM_SubV3(Ray.Origin, Vertex0);
+    HMM_Vec3 Q = HMM_Cross(S, Edge1);
+    float HitU = HMM_DotV3(S, P) * InvDet;
+    float HitV = HMM_DotV3(Ray.Direction, Q) * InvDet;
+    float HitT = HMM_DotV3(Edge2, Q) * InvDet;
+
+    if (HitU >= 0.0f && HitU <= 1.0f && HitV >= 0.0f && HitU + HitV <= 1.0f && HitT >= 0.0f && HitT <= MaxT)
+    {
+        *T = HitT;
+        *U = HitU;
+        *V = HitV;
+        return 1;
+    }
+    return 0;
+}
+
+COVERAGE(HMM_RayTriangle, 1)
+// Ray-triangle test, with both sides of the triangle counting. On a hit, writes the distance T and
+// the barycentric coordinates U and V of the hit point, which is (1 - U - V) * Vertex0 + U * Vertex1 + V * Vertex2.
+static inline HMM_Bool HMM_RayTriangle(HMM_Ray Ray, float MaxT, HMM_Vec3 Vertex0, HMM_Vec3 Vertex1, HMM_Vec3 Vertex2,
+                                       float *T, float *U, float *V)
+{
+    ASSERT_COVERED(HMM_RayTriangle);
+    return _HMM_RayTriangle(Ray, MaxT, Vertex0, HMM_SubV3(Vertex1, Vertex0), HMM_SubV3(Vertex2, Vertex0), T, U, V);
+}
+
+COVERAGE(HMM_RayAABB, 1)
+// Slab test. On a hit, writes the distance at which the ray enters the box, or 0 if it starts inside.
+static inline HMM_Bool HMM_RayAABB(HMM_Ray Ray, float MaxT, HMM_AABB Box, float *T)
+{
+    ASSERT_COVERED(HMM_RayAABB);
+
+    float Near = 0.0f;
+    float Far = MaxT;
+    for (int Axis = 0; Axis < 3; ++Axis)
+    {
+        float InvDirection = 1.0f / Ray.Direction.Elements[Axis];
+        float T1 = (Box.Min.Elements[Axis] - Ray.Origin.Elements[Axis]) * InvDirection;
+        float T2 = (Box.Max.Elements[Axis] - Ray.Origin.Elements[Axis]) * InvDirection;
+        Near = HMM_MAX(Near, HMM_MIN(T1, T2));
+        Far = HMM_MIN(Far, HMM_MAX(T1, T2));
+    }
+
+    if (Near <= Far)
+    {
+        *T = Near;
+        return 1;
+    }
+    return 0;
+}
+
+COVERAGE(HMM_RaysToSoA, 1)
+// Packs Count rays into (Count + HMM_SOA_WIDTH - 1) / HMM_SOA_WIDTH blocks, all with the same MaxT.
+// Unused lanes in the last block never hit.
+static inline void HMM_RaysToSoA(const HMM_Ray *In, float MaxT, HMM_RaySoA *Out, int Count)
+{
+    ASSERT_COVERED(HMM_RaysToSoA);
+
+    for (int Index = 0; Index < Count; Index += HMM_SOA_WIDTH, ++Out)
+    {
+        for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+        {
+            for (int Axis = 0; Axis < 3; ++Axis)
+            {
+                if (Index + Lane < Count)
+                {
+                    Out->Origin.Components[Axis].Elements[Lane] = In[Index + Lane].Origin.Elements[Axis];
+                    Out->InvDirection.Components[Axis].Elements[Lane] = 1.0f / In[Index + Lane].Direction.Elements[Axis];
+                }
+                else
+                {
+                    Out->Origin.Components[Axis].Elements[Lane] = 0.0f;
+                    Out->InvDirection.Components[Axis].Elements[Lane] = 1.0f;
+                }
+            }
+            Out->MaxT.Elements[Lane] = Index + Lane < Count ? MaxT : -1.0f;
+        }
+    }
+}
+
+COVERAGE(HMM_TrianglesToSoA, 1)
+// Packs Count triangles, given as three vertices each, into (Count + HMM_SOA_WIDTH - 1) / HMM_SOA_WIDTH
+// blocks. Unused lanes in the last block are degenerate and never hit.
+static inline void HMM_TrianglesToSoA(const HMM_Vec3 *Vertices, HMM_TriangleSoA *Out, int Count)
+{
+    ASSERT_COVERED(HMM_TrianglesToSoA);
+
+    for (int Index = 0; Index < Count; Index += HMM_SOA_WIDTH, ++Out)
+    {
+        for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+        {
+            HMM_Vec3 Vertex0 = HMM_V3(0.0f, 0.0f, 0.0f);
+            HMM_Vec3 Edge1 = Vertex0;
+            HMM_Vec3 Edge2 = Vertex0;
+            if (Index + Lane < Count)
+            {
+                const HMM_Vec3 *Triangle = &Vertices[3 * (Index + Lane)];
+                Vertex0 = Triangle[0];
+                Edge1 = HMM_SubV3(Triangle[1], Triangle[0]);
+                Edge2 = HMM_SubV3(Triangle[2], Triangle[0]);
+            }
+
+            for (int Axis = 0; Axis < 3; ++Axis)
+            {
+                Out->Vertex0.Components[Axis].Elements[Lane] = Vertex0.Elements[Axis];
+                Out->Edge1.Components[Axis].Elements[Lane] = Edge1.Elements[Axis];
+                Out->Edge2.Components[Axis].Elements[Lane] = Edge2.Elements[Axis];
+            }
+        }
+    }
+}
+
+/* NOTE: The packet kernels keep each HMM_Vec3SoA as three registers. Products and sums are done
+   separately, in the order of HMM_DotV3 and HMM_Cross, so that lanes match the single-ray tests. */
+
+#ifdef HANDMADE_MATH__USE_AVX
+static inline __m256 _HMM_DotSoAAVX(const __m256 *Left, const __m256 *Right)
+{
+    __m256 Result = _mm256_add_ps(_mm256_mul_ps(Left[0], Right[0]), _mm256_mul_ps(Left[1], Right[1]));
+    return _mm256_add_ps(Result, _mm256_mul_ps(Left[2], Right[2]));
+}
+
+static inline void _HMM_CrossSoAAVX(const __m256 *Left, const __m256 *Right, __m256 *Result)
+{
+    Result[0] = _mm256_sub_ps(_mm256_mul_ps(Left[1], Right[2]), _mm256_mul_ps(Left[2], Right[1]));
+    Result[1] = _mm256_sub_ps(_mm256_mul_ps(Left[2], Right[0]), _mm256_mul_ps(Left[0], Right[2]));
+    Result[2] = _mm256_sub_ps(_mm256_mul_ps(Left[0], Right[1]), _mm256_mul_ps(Left[1], Right[0]));
+}
+#elif defined(HANDMADE_MATH__USE_SSE)
+static inline __m128 _HMM_DotSoASSE(const __m128 *Left, const __m128 *Right)
+{
+    __m128 Result = _mm_add_ps(_mm_mul_ps(Left[0], Right[0]), _mm_mul_ps(Left[1], Right[1]));
+    return _mm_add_ps(Result, _mm_mul_ps(Left[2], Right[2]));
+}
+
+static inline void _HMM_CrossSoASSE(const __m128 *Left, const __m128 *Right, __m128 *Result)
+{
+    Result[0] = _mm_sub_ps(_mm_mul_ps(Left[1], Right[2]), _mm_mul_ps(Left[2], Right[1]));
+    Result[1] = _mm_sub_ps(_mm_mul_ps(Left[2], Right[0]), _mm_mul_ps(Left[0], Right[2]));
+    Result[2] = _mm_sub_ps(_mm_mul_ps(Left[0], Right[1]), _mm_mul_ps(Left[1], Right[0]));
+}
+#elif defined(HANDMADE_MATH__USE_NEON)
+static inline float32x4_t _HMM_DotSoANEON(const float32x4_t *Left, const float32x4_t *Right)
+{
+    float32x4_t Result = vaddq_f32(vmulq_f32(Left[0], Right[0]), vmulq_f32(Left[1], Right[1]));
+    return vaddq_f32(Result, vmulq_f32(Left[2], Right[2]));
+}
+
+static inline void _HMM_CrossSoANEON(const float32x4_t *Left, const float32x4_t *Right, float32x4_t *Result)
+{
+    Result[0] = vsubq_f32(vmulq_f32(Left[1], Right[2]), vmulq_f32(Left[2], Right[1]));
+    Result[1] = vsubq_f32(vmulq_f32(Left[2], Right[0]), vmulq_f32(Left[0], Right[2]));
+    Result[2] = vsubq_f32(vmulq_f32(Left[0], Right[1]), vmulq_f32(Left[1], Right[0]));
+}
+#endif
+
+COVERAGE(HMM_RayTriangleSoA, 1)
+// Tests one ray against a block of HMM_SOA_WIDTH triangles. T, U and V are written for every lane,
+// but only hold a hit for the lanes set in the returned mask.
+static inline int HMM_RayTriangleSoA(HMM_Ray Ray, float MaxT, const HMM_TriangleSoA *Triangles,
+                                     HMM_FloatSoA *T, HMM_FloatSoA *U, HMM_FloatSoA *V)
+{
+    ASSERT_COVERED(HMM_RayTriangleSoA);
+
+    int Mask = 0;
+
+#ifdef HANDMADE_MATH__USE_AVX
+    /* NOTE: Filled without loops, which some compilers would run through the stack. */
+    __m256 Direction[3] = {
+        _mm256_set1_ps(Ray.Direction.X), _mm256_set1_ps(Ray.Direction.Y), _mm256_set1_ps(Ray.Direction.Z)
+    };
+    __m256 Edge1[3] = {
+        _mm256_loadu_ps(Triangles->Edge1.X.Elements), _mm256_loadu_ps(Triangles->Edge1.Y.Elements), _mm256_loadu_ps(Triangles->Edge1.Z.Elements)
+    };
+    __m256 Edge2[3] = {
+        _mm256_loadu_ps(Triangles->Edge2.X.Elements), _mm256_loadu_ps(Triangles->Edge2.Y.Elements), _mm256_loadu_ps(Triangles->Edge2.Z.Elements)
+    };
+    __m256 S[3] = {
+        _mm256_sub_ps(_mm256_set1_ps(Ray.Origin.X), _mm256_loadu_ps(Triangles->Vertex0.X.Elements)),
+        _mm256_sub_ps(_mm256_set1_ps(Ray.Origin.Y), _mm256_loadu_ps(Triangles->Vertex0.Y.Elements)),
+        _mm256_sub_ps(_mm256_set1_ps(Ray.Origin.Z), _mm256_loadu_ps(Triangles->Vertex0.Z.Elements))
+    };
+    __m256 P[3], Q[3];
+
+    _HMM_CrossSoAAVX(Direction, Edge2, P);
+    _HMM_CrossSoAAVX(S, Edge1, Q);
+    __m256 Det = _HMM_DotSoAAVX(Edge1, P);
+    __m256 InvDet = _mm256_div_ps(_mm256_set1_ps(1.0f), Det);
+    __m256 HitU = _mm256_mul_ps(_HMM_DotSoAAVX(S, P), InvDet);
+    __m256 HitV = _mm256_mul_ps(_HMM_DotSoAAVX(Direction, Q), InvDet);
+    __m256 HitT = _mm256_mul_ps(_HMM_DotSoAAVX(Edge2, Q), InvDet);
+
+    __m256 Zero = _mm256_setzero_ps();
+    __m256 One = _mm256_set1_ps(1.0f);
+    __m256 Hit = _mm256_cmp_ps(Det, Zero, _CMP_NEQ_OQ);
+    Hit = _mm256_and_ps(Hit, _mm256_cmp_ps(HitU, Zero, _CMP_GE_OQ));
+    Hit = _mm256_and_ps(Hit, _mm256_cmp_ps(HitU, One, _CMP_LE_OQ));
+    Hit = _mm256_and_ps(Hit, _mm256_cmp_ps(HitV, Zero, _CMP_GE_OQ));
+    Hit = _mm256_and_ps(Hit, _mm256_cmp_ps(_mm256_add_ps(HitU, HitV), One, _CMP_LE_OQ));
+    Hit = _mm256_and_ps(Hit, _mm256_cmp_ps(HitT, Zero, _CMP_GE_OQ));
+    Hit = _mm256_and_ps(Hit, _mm256_cmp_ps(HitT, _mm256_set1_ps(MaxT), _CMP_LE_OQ));
+
+    _mm256_storeu_ps(T->Elements, HitT);
+    _mm256_storeu_ps(U->Elements, HitU);
+    _mm256_storeu_ps(V->Elements, HitV);
+    Mask = _mm256_movemask_ps(Hit);
+#elif defined(HANDMADE_MATH__USE_SSE)
+    __m128 Origin[3] = { _mm_set1_ps(Ray.Origin.X), _mm_set1_ps(Ray.Origin.Y), _mm_set1_ps(Ray.Origin.Z) };
+    __m128 Direction[3] = { _mm_set1_ps(Ray.Direction.X), _mm_set1_ps(Ray.Direction.Y), _mm_set1_ps(Ray.Direction.Z) };
+    __m128 Zero = _mm_setzero_ps();
+    __m128 One = _mm_set1_ps(1.0f);
+    __m128 MaxTs = _mm_set1_ps(MaxT);
+
+    for (int Half = 0; Half < HMM_SOA_WIDTH / 4; ++Half)
+    {
+        __m128 Edge1[3] = { Triangles->Edge1.X.SSE[Half], Triangles->Edge1.Y.SSE[Half], Triangles->Edge1.Z.SSE[Half] };
+        __m128 Edge2[3] = { Triangles->Edge2.X.SSE[Half], Triangles->Edge2.Y.SSE[Half], Triangles->Edge2.Z.SSE[Half] };
+        __m128 S[3] = {
+            _mm_sub_ps(Origin[0], Triangles->Vertex0.X.SSE[Half]),
+            _mm_sub_ps(Origin[1], Triangles->Vertex0.Y.SSE[Half]),
+            _mm_sub_ps(Origin[2], Triangles->Vertex0.Z.SSE[Half])
+        };
+        __m128 P[3], Q[3];
+
+        _HMM_CrossSoASSE(Direction, Edge2, P);
+        _HMM_CrossSoASSE(S, Edge1, Q);
+        __m128 Det = _HMM_DotSoASSE(Edge1, P);
+        __m128 InvDet = _mm_div_ps(One, Det);
+        __m128 HitU = _mm_mul_ps(_HMM_DotSoASSE(S, P), InvDet);
+        __m128 HitV = _mm_mul_ps(_HMM_DotSoASSE(Direction, Q), InvDet);
+        __m128 HitT = _mm_mul_ps(_HMM_DotSoASSE(Edge2, Q), InvDet);
+
+        __m128 Hit = _mm_cmpneq_ps(Det, Zero);
+        Hit = _mm_and_ps(Hit, _mm_cmpge_ps(HitU, Zero));
+        Hit = _mm_and_ps(Hit, _mm_cmple_ps(HitU, One));
+        Hit = _mm_and_ps(Hit, _mm_cmpge_ps(HitV, Zero));
+        Hit = _mm_and_ps(Hit, _mm_cmple_ps(_mm_add_ps(HitU, HitV), One));
+        Hit = _mm_and_ps(Hit, _mm_cmpge_ps(HitT, Zero));
+        Hit = _mm_and_ps(Hit, _mm_cmple_ps(HitT, MaxTs));
+
+        T->SSE[Half] = HitT;
+        U->SSE[Half] = HitU;
+        V->SSE[Half] = HitV;
+        Mask |= _mm_movemask_ps(Hit) << (4 * Half);
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t Origin[3] = { vdupq_n_f32(Ray.Origin.X), vdupq_n_f32(Ray.Origin.Y), vdupq_n_f32(Ray.Origin.Z) };
+    float32x4_t Direction[3] = { vdupq_n_f32(Ray.Direction.X), vdupq_n_f32(Ray.Direction.Y), vdupq_n_f32(Ray.Direction.Z) };
+    float32x4_t Zero = vdupq_n_f32(0.0f);
+    float32x4_t One = vdupq_n_f32(1.0f);
+    float32x4_t MaxTs = vdupq_n_f32(MaxT);
+
+    for (int Half = 0; Half < HMM_SOA_WIDTH / 4; ++Half)
+    {
+        float32x4_t Edge1[3] = { Triangles->Edge1.X.NEON[Half], Triangles->Edge1.Y.NEON[Half], Triangles->Edge1.Z.NEON[Half] };
+        float32x4_t Edge2[3] = { Triangles->Edge2.X.NEON[Half], Triangles->Edge2.Y.NEON[Half], Triangles->Edge2.Z.NEON[Half] };
+        float32x4_t S[3] = {
+            vsubq_f32(Origin[0], Triangles->Vertex0.X.NEON[Half]),
+            vsubq_f32(Origin[1], Triangles->Vertex0.Y.NEON[Half]),
+            vsubq_f32(Origin[2], Triangles->Vertex0.Z.NEON[Half])
+        };
+        float32x4_t P[3], Q[3];
+
+        _HMM_CrossSoANEON(Direction, Edge2, P);
+        _HMM_CrossSoANEON(S, Edge1, Q);
+        float32x4_t Det = _HMM_DotSoANEON(Edge1, P);
+        float32x4_t InvDet = vdivq_f32(One, Det);
+        float32x4_t HitU = vmulq_f32(_HMM_DotSoANEON(S, P), InvDet);
+        float32x4_t HitV = vmulq_f32(_HMM_DotSoANEON(Direction, Q), InvDet);
+        float32x4_t HitT = vmulq_f32(_HMM_DotSoANEON(Edge2, Q), InvDet);
+
+        uint32x4_t Hit = vmvnq_u32(vceqq_f32(Det, Zero));
+        Hit = vandq_u32(Hit, vcgeq_f32(HitU, Zero));
+        Hit = vandq_u32(Hit, vcleq_f32(HitU, One));
+        Hit = vandq_u32(Hit, vcgeq_f32(HitV, Zero));
+        Hit = vandq_u32(Hit, vcleq_f32(vaddq_f32(HitU, HitV), One));
+        Hit = vandq_u32(Hit, vcgeq_f32(HitT, Zero));
+        Hit = vandq_u32(Hit, vcleq_f32(HitT, MaxTs));
+
+        T->NEON[Half] = HitT;
+        U->NEON[Half] = HitU;
+        V->NEON[Half] = HitV;
+        Mask |= _HMM_MoveMaskNEON(Hit) << (4 * Half);
+    }
+#else
+    for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+    {
+        HMM_Vec3 Vertex0, Edge1, Edge2;
+        for (int Axis = 0; Axis < 3; ++Axis)
+        {
+            Vertex0.Elements[Axis] = Triangles->Vertex0.Components[Axis].Elements[Lane];
+            Edge1.Elements[Axis] = Triangles->Edge1.Components[Axis].Elements[Lane];
+            Edge2.Elements[Axis] = Triangles->Edge2.Components[Axis].Elements[Lane];
+        }
+
+        T->Elements[Lane] = U->Elements[Lane] = V->Elements[Lane] = 0.0f;
+        Mask |= _HMM_RayTriangle(Ray, MaxT, Vertex0, Edge1, Edge2, &T->Elements[Lane], &U->Elements[Lane], &V->Elements[Lane]) << Lane;
+    }
+#endif
+
+    return Mask;
+}
+
+COVERAGE(HMM_RayAABBSoA, 1)
+// Tests a block of HMM_SOA_WIDTH rays against one box. If T is not NULL, it gets the distance at
+// which each ray enters the box, which only means something for the lanes set in the returned mask.
+static inline int HMM_RayAABBSoA(const HMM_RaySoA *Rays, HMM_AABB Box, HMM_FloatSoA *T)
+{
+    ASSERT_COVERED(HMM_RayAABBSoA);
+
+    int Mask = 0;
+
+    /* NOTE: An origin on a face with a zero direction component makes that slab 0 * inf = NaN.
+       HMM_MIN and HMM_MAX return their first operand then, so the min and max below take their
+       operands in the order that does the same and skips the slab, as HMM_RayAABB does. */
+#ifdef HANDMADE_MATH__USE_AVX
+    __m256 Near = _mm256_setzero_ps();
+    __m256 Far = _mm256_loadu_ps(Rays->MaxT.Elements);
+    for (int Axis = 0; Axis < 3; ++Axis)
+    {
+        __m256 Origin = _mm256_loadu_ps(Rays->Origin.Components[Axis].Elements);
+        __m256 InvDirection = _mm256_loadu_ps(Rays->InvDirection.Components[Axis].Elements);
+        __m256 T1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(Box.Min.Elements[Axis]), Origin), InvDirection);
+        __m256 T2 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(Box.Max.Elements[Axis]), Origin), InvDirection);
+        Near = _mm256_max_ps(_mm256_min_ps(T2, T1), Near);
+        Far = _mm256_min_ps(_mm256_max_ps(T2, T1), Far);
+    }
+
+    if (T)
+    {
+        _mm256_storeu_ps(T->Elements, Near);
+    }
+    Mask = _mm256_movemask_ps(_mm256_cmp_ps(Near, Far, _CMP_LE_OQ));
+#elif defined(HANDMADE_MATH__USE_SSE)
+    __m128 Min[3] = { _mm_set1_ps(Box.Min.X), _mm_set1_ps(Box.Min.Y), _mm_set1_ps(Box.Min.Z) };
+    __m128 Max[3] = { _mm_set1_ps(Box.Max.X), _mm_set1_ps(Box.Max.Y), _mm_set1_ps(Box.Max.Z) };
+    for (int Half = 0; Half < HMM_SOA_WIDTH / 4; ++Half)
+    {
+        __m128 Near = _mm_setzero_ps();
+        __m128 Far = Rays->MaxT.SSE[Half];
+        for (int Axis = 0; Axis < 3; ++Axis)
+        {
+            __m128 Origin = Rays->Origin.Components[Axis].SSE[Half];
+            __m128 InvDirection = Rays->InvDirection.Components[Axis].SSE[Half];
+            __m128 T1 = _mm_mul_ps(_mm_sub_ps(Min[Axis], Origin), InvDirection);
+            __m128 T2 = _mm_mul_ps(_mm_sub_ps(Max[Axis], Origin), InvDirection);
+            Near = _mm_max_ps(_mm_min_ps(T2, T1), Near);
+            Far = _mm_min_ps(_mm_max_ps(T2, T1), Far);
+        }
+
+        if (T)
+        {
+            T->SSE[Half] = Near;
+        }
+        Mask |= _mm_movemask_ps(_mm_cmple_ps(Near, Far)) << (4 * Half);
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t Min[3] = { vdupq_n_f32(Box.Min.X), vdupq_n_f32(Box.Min.Y), vdupq_n_f32(Box.Min.Z) };
+    float32x4_t Max[3] = { vdupq_n_f32(Box.Max.X), vdupq_n_f32(Box.Max.Y), vdupq_n_f32(Box.Max.Z) };
+    for (int Half = 0; Half < HMM_SOA_WIDTH / 4; ++Half)
+    {
+        float32x4_t Near = vdupq_n_f32(0.0f);
+        float32x4_t Far = Rays->MaxT.NEON[Half];
+        for (int Axis = 0; Axis < 3; ++Axis)
+        {
+            float32x4_t Origin = Rays->Origin.Components[Axis].NEON[Half];
+            float32x4_t InvDirection = Rays->InvDirection.Components[Axis].NEON[Half];
+            float32x4_t T1 = vmulq_f32(vsubq_f32(Min[Axis], Origin), InvDirection);
+            float32x4_t T2 = vmulq_f32(vsubq_f32(Max[Axis], Origin), InvDirection);
+            /* NOTE: vminq_f32 and vmaxq_f32 return NaN if either operand is, so this selects instead. */
+            float32x4_t Min12 = vbslq_f32(vcgtq_f32(T1, T2), T2, T1);
+            float32x4_t Max12 = vbslq_f32(vcltq_f32(T1, T2), T2, T1);
+            Near = vbslq_f32(vcltq_f32(Near, Min12), Min12, Near);
+            Far = vbslq_f32(vcgtq_f32(Far, Max12), Max12, Far);
+        }
+
+        if (T)
+        {
+            T->NEON[Half] = Near;
+        }
+        Mask |= _HMM_MoveMaskNEON(vcleq_f32(Near, Far)) << (4 * Half);
+    }
+#else
+    for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+    {
+        float Near = 0.0f;
+        float Far = Rays->MaxT.Elements[Lane];
+        for (int Axis = 0; Axis < 3; ++Axis)
+        {
+            float Origin = Rays->Origin.Components[Axis].Elements[Lane];
+            float InvDirection = Rays->InvDirection.Components[Axis].Elements[Lane];
+            float T1 = (Box.Min.Elements[Axis] - Origin) * InvDirection;
+            float T2 = (Box.Max.Elements[Axis] - Origin) * InvDirection;
+            Near = HMM_MAX(Near, HMM_MIN(T1, T2));
+            Far = HMM_MIN(Far, HMM_MAX(T1, T2));
+        }
+
+        if (T)
+        {
+            T->Elements[Lane] = Near;
+        }
+        Mask |= (Near <= Far) << Lane;
+    }
+#endif
+
+    return Mask;
+}
+
+/*
+ * Quaternion operations
+ */
+
+COVERAGE(HMM_Q, 1)
+static inline HMM_Quat HMM_Q(float X, float Y, float Z, float W)
+{
+    ASSERT_COVERED(HMM_Q);
+
+    HMM_Quat Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _mm_setr_ps(X, Y, Z, W);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t v = { X, Y, Z, W };
+    Result.NEON = v;
+#else
+    Result.X = X;
+    Result.Y = Y;
+    Result.Z = Z;
+    Result.W = W;
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_QV4, 1)
+static inline HMM_Quat HMM_QV4(HMM_Vec4 Vector)
+{
+    ASSERT_COVERED(HMM_QV4);
+
+    HMM_Quat Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = Vector.SSE;
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = Vector.NEON;
+#else
+    Result.X = Vector.X;
+    Result.Y = Vector.Y;
+    Result.Z = Vector.Z;
+    Result.W = Vector.W;
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_AddQ, 1)
+static inline HMM_Quat HMM_AddQ(HMM_Quat Left, HMM_Quat Right)
+{
+    ASSERT_COVERED(HMM_AddQ);
+
+    HMM_Quat Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _mm_add_ps(Left.SSE, Right.SSE);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vaddq_f32(Left.NEON, Right.NEON);
+#else
+
+    Result.X = Left.X + Right.X;
+    Result.Y = Left.Y + Right.Y;
+    Result.Z = Left.Z + Right.Z;
+    Result.W = Left.W + Right.W;
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_SubQ, 1)
+static inline HMM_Quat HMM_SubQ(HMM_Quat Left, HMM_Quat Right)
+{
+    ASSERT_COVERED(HMM_SubQ);
+
+    HMM_Quat Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    Result.SSE = _mm_sub_ps(Left.SSE, Right.SSE);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vsubq_f32(Left.NEON, Right.NEON);
+#else
+    Result.X = Left.X - Right.X;
+    Result.Y = Left.Y - Right.Y;
+    Result.Z = Left.Z - Right.Z;
+    Result.W = Left.W - Right.W;
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_MulQ, 1)
+static inline HMM_Quat HMM_MulQ(HMM_Quat Left, HMM_Quat Right)
+{
+    ASSERT_COVERED(HMM_MulQ);
+
+    HMM_Quat Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    __m128 SSEResultOne = _mm_xor_ps(_mm_shuffle_ps(Left.SSE, Left.SSE, _MM_SHUFFLE(0, 0, 0, 0)), _mm_setr_ps(0.f, -0.f, 0.f, -0.f));
+    __m128 SSEResultTwo = _mm_shuffle_ps(Right.SSE, Right.SSE, _MM_SHUFFLE(0, 1, 2, 3));
+    __m128 SSEResultThree = _mm_mul_ps(SSEResultTwo, SSEResultOne);
+
+    SSEResultOne = _mm_xor_ps(_mm_shuffle_ps(Left.SSE, Left.SSE, _MM_SHUFFLE(1, 1, 1, 1)) , _mm_setr_ps(0.f, 0.f, -0.f, -0.f));
+    SSEResultTwo = _mm_shuffle_ps(Right.SSE, Right.SSE, _MM_SHUFFLE(1, 0, 3, 2));
+    SSEResultThree = _HMM_MADD_PS(SSEResultTwo, SSEResultOne, SSEResultThree);
+
+    SSEResultOne = _mm_xor_ps(_mm_shuffle_ps(Left.SSE, Left.SSE, _MM_SHUFFLE(2, 2, 2, 2)), _mm_setr_ps(-0.f, 0.f, 0.f, -0.f));
+    SSEResultTwo = _mm_shuffle_ps(Right.SSE, Right.SSE, _MM_SHUFFLE(2, 3, 0, 1));
+    SSEResultThree = _HMM_MADD_PS(SSEResultTwo, SSEResultOne, SSEResultThree);
+
+    SSEResultOne = _mm_shuffle_ps(Left.SSE, Left.SSE, _MM_SHUFFLE(3, 3, 3, 3));
+    SSEResultTwo = _mm_shuffle_ps(Right.SSE, Right.SSE, _MM_SHUFFLE(3, 2, 1, 0));
+    Result.SSE = _HMM_MADD_PS(SSEResultTwo, SSEResultOne, SSEResultThree);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t Right1032 = vrev64q_f32(Right.NEON);
+    float32x4_t Right3210 = vcombine_f32(vget_high_f32(Right1032), vget_low_f32(Right1032));
+    float32x4_t Right2301 = vrev64q_f32(Right3210);
+
+    float32x4_t FirstSign = {1.0f, -1.0f, 1.0f, -1.0f};
+    Result.NEON = vmulq_f32(Right3210, vmulq_f32(vdupq_laneq_f32(Left.NEON, 0), FirstSign));
+    float32x4_t SecondSign = {1.0f, 1.0f, -1.0f, -1.0f};
+    Result.NEON = vfmaq_f32(Result.NEON, Right2301, vmulq_f32(vdupq_laneq_f32(Left.NEON, 1), SecondSign));
+    float32x4_t ThirdSign = {-1.0f, 1.0f, 1.0f, -1.0f};
+    Result.NEON = vfmaq_f32(Result.NEON, Right1032, vmulq_f32(vdupq_laneq_f32(Left.NEON, 2), ThirdSign));
+    Result.NEON = vfmaq_laneq_f32(Result.NEON, Right.NEON, Left.NEON, 3);
+
+#else
+    Result.X =  Right.Elements[3] * +Left.Elements[0];
+    Result.Y =  Right.Elements[2] * -Left.Elements[0];
+    Result.Z =  Right.Elements[1] * +Left.Elements[0];
+    Result.W =  Right.Elements[0] * -Left.Elements[0];
+
+    Result.X += Right.Elements[2] * +Left.Elements[1];
+    Result.Y += Right.Elements[3] * +Left.Elements[1];
+    Result.Z += Right.Elements[0] * -Left.Elements[1];
+    Result.W += Right.Elements[1] * -Left.Elements[1];
+
+    Result.X += Right.Elements[1] * -Left.Elements[2];
+    Result.Y += Right.Elements[0] * +Left.Elements[2];
+    Result.Z += Right.Elements[3] * +Left.Elements[2];
+    Result.W += Right.Elements[2] * -Left.Elements[2];
+
+    Result.X += Right.Elements[0] * +Left.Elements[3];
+    Result.Y += Right.Elements[1] * +Left.Elements[3];
+    Result.Z += Right.Elements[2] * +Left.Elements[3];
+    Result.W += Right.Elements[3] * +Left.Elements[3];
+#endif
+
+    return Result;
+}
+
+static inline void _HMM_MulQArrayBase(const HMM_Quat *Left, const HMM_Quat *Right, HMM_Quat *Out, int Count)
+{
+    int Index = 0;
+
+#ifdef HANDMADE_MATH__USE_AVX512
+    __m512i SignOne = _mm512_castps_si512(_mm512_broadcast_f32x4(_mm_setr_ps(0.f, -0.f, 0.f, -0.f)));
+    __m512i SignTwo = _mm512_castps_si512(_mm512_broadcast_f32x4(_mm_setr_ps(0.f, 0.f, -0.f, -0.f)));
+    __m512i SignThree = _mm512_castps_si512(_mm512_broadcast_f32x4(_mm_setr_ps(-0.f, 0.f, 0.f, -0.f)));
+
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        __m512 L = _mm512_loadu_ps(&Left[Index]);
+        __m512 R = _mm512_loadu_ps(&Right[Index]);
+
+        /* NOTE: AVX-512F has no floating-point xor, so the sign flips go through the integer one. */
+        __m512 ResultOne = _mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(_mm512_permute_ps(L, _MM_SHUFFLE(0, 0, 0, 0))), SignOne));
+        __m512 ResultTwo = _mm512_permute_ps(R, _MM_SHUFFLE(0, 1, 2, 3));
+        __m512 ResultThree = _mm512_mul_ps(ResultTwo, ResultOne);
+
+        ResultOne = _mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(_mm512_permute_ps(L, _MM_SHUFFLE(1, 1, 1, 1))), SignTwo));
+        ResultTwo = _mm512_permute_ps(R, _MM_SHUFFLE(1, 0, 3, 2));
+        ResultThree = _HMM_MADD512_PS(ResultTwo, ResultOne, ResultThree);
+
+        ResultOne = _mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(_mm512_permute_ps(L, _MM_SHUFFLE(2, 2, 2, 2))), SignThree));
+        ResultTwo = _mm512_permute_ps(R, _MM_SHUFFLE(2, 3, 0, 1));
+        ResultThree = _HMM_MADD512_PS(ResultTwo, ResultOne, ResultThree);
+
+        ResultOne = _mm512_permute_ps(L, _MM_SHUFFLE(3, 3, 3, 3));
+        ResultTwo = _mm512_permute_ps(R, _MM_SHUFFLE(3, 2, 1, 0));
+        _mm512_storeu_ps(&Out[Index], _HMM_MADD512_PS(ResultTwo, ResultOne, ResultThree));
+    }
+#elif defined(HANDMADE_MATH__USE_AVX)
+    __m256 SignOne = _mm256_setr_ps(0.f, -0.f, 0.f, -0.f, 0.f, -0.f, 0.f, -0.f);
+    __m256 SignTwo = _mm256_setr_ps(0.f, 0.f, -0.f, -0.f, 0.f, 0.f, -0.f, -0.f);
+    __m256 SignThree = _mm256_setr_ps(-0.f, 0.f, 0.f, -0.f, -0.f, 0.f, 0.f, -0.f);
+
+    for (; Index + 2 <= Count; Index += 2)
+    {
+        __m256 L = _mm256_loadu_ps(Left[Index].Elements);
+        __m256 R = _mm256_loadu_ps(Right[Index].Elements);
+
+        __m256 ResultOne = _mm256_xor_ps(_mm256_shuffle_ps(L, L, _MM_SHUFFLE(0, 0, 0, 0)), SignOne);
+        __m256 ResultTwo = _mm256_shuffle_ps(R, R, _MM_SHUFFLE(0, 1, 2, 3));
+        __m256 ResultThree = _mm256_mul_ps(ResultTwo, ResultOne);
+
+        ResultOne = _mm256_xor_ps(_mm256_shuffle_ps(L, L, _MM_SHUFFLE(1, 1, 1, 1)), SignTwo);
+        ResultTwo = _mm256_shuffle_ps(R, R, _MM_SHUFFLE(1, 0, 3, 2));
+        ResultThree = _HMM_MADD256_PS(ResultTwo, ResultOne, ResultThree);
+
+        ResultOne = _mm256_xor_ps(_mm256_shuffle_ps(L, L, _MM_SHUFFLE(2, 2, 2, 2)), SignThree);
+        ResultTwo = _mm256_shuffle_ps(R, R, _MM_SHUFFLE(2, 3, 0, 1));
+        ResultThree = _HMM_MADD256_PS(ResultTwo, ResultOne, ResultThree);
+
+        ResultOne = _mm256_shuffle_ps(L, L, _MM_SHUFFLE(3, 3, 3, 3));
+        ResultTwo = _mm256_shuffle_ps(R, R, _MM_SHUFFLE(3, 2, 1, 0));
+        _mm256_storeu_ps(Out[Index].Elements, _HMM_MADD256_PS(ResultTwo, ResultOne, ResultThree));
+    }
+#endif
+
+    for (; Index < Count; ++Index)
+    {
+        Out[Index] = HMM_MulQ(Left[Index], Right[Index]);
+    }
+}
+
+COVERAGE(HMM_MulQArray, 1)
+// Multiplies Count pairs of quaternions, giving the same results as calling HMM_MulQ on each pair.
+// Out may be the same array as Left or Right.
+// (With HANDMADE_MATH_RUNTIME_DISPATCH, the AVX2 and AVX-512 tiers may differ in the last bit.)
+static inline void HMM_MulQArray(const HMM_Quat *Left, const HMM_Quat *Right, HMM_Quat *Out, int Count)
+{
+    ASSERT_COVERED(HMM_MulQArray);
+
+#ifdef HANDMADE_MATH__USE_DISPATCH
+    _HMM_GetDispatch()->MulQArray(Left, Right, Out, Count);
+#else
+    _HMM_MulQArrayBase(Left, Right, Out, Count);
+#endif
+}
+
+COVERAGE(HMM_MulQF, 1)
+static inline HMM_Quat HMM_MulQF(HMM_Quat Left, float Multiplicative)
+{
+    ASSERT_COVERED(HMM_MulQF);
+
+    HMM_Quat Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    __m128 Scalar = _mm_set1_ps(Multiplicative);
+    Result.SSE = _mm_mul_ps(Left.SSE, Scalar);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON = vmulq_n_f32(Left.NEON, Multiplicative);
+#else
+    Result.X = Left.X * Multiplicative;
+    Result.Y = Left.Y * Multiplicative;
+    Result.Z = Left.Z * Multiplicative;
+    Result.W = Left.W * Multiplicative;
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_DivQF, 1)
+static inline HMM_Quat HMM_DivQF(HMM_Quat Left, float Divnd)
+{
+    ASSERT_COVERED(HMM_DivQF);
+
+    HMM_Quat Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    __m128 Scalar = _mm_set1_ps(Divnd);
+    Result.SSE = _mm_div_ps(Left.SSE, Scalar);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t Scalar = vdupq_n_f32(Divnd);
+    Result.NEON = vdivq_f32(Left.NEON, Scalar);
+#else
+    Result.X = Left.X / Divnd;
+    Result.Y = Left.Y / Divnd;
+    Result.Z = Left.Z / Divnd;
+    Result.W = Left.W / Divnd;
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_DotQ, 1)
+static inline float HMM_DotQ(HMM_Quat Left, HMM_Quat Right)
+{
+    ASSERT_COVERED(HMM_DotQ);
+
+    float Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    __m128 SSEResultOne = _mm_mul_ps(Left.SSE, Right.SSE);
+#ifdef HANDMADE_MATH__USE_FMA
+    /* NOTE: Fuse the neighbouring products in directly instead of shuffling the products. */
+    SSEResultOne = _mm_fmadd_ps(_mm_shuffle_ps(Left.SSE, Left.SSE, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(Right.SSE, Right.SSE, _MM_SHUFFLE(2, 3, 0, 1)), SSEResultOne);
+#else
+    SSEResultOne = _mm_add_ps(SSEResultOne, _mm_shuffle_ps(SSEResultOne, SSEResultOne, _MM_SHUFFLE(2, 3, 0, 1)));
+#endif
+    __m128 SSEResultTwo = _mm_shuffle_ps(SSEResultOne, SSEResultOne, _MM_SHUFFLE(0, 1, 2, 3));
+    SSEResultOne = _mm_add_ps(SSEResultOne, SSEResultTwo);
+    _mm_store_ss(&Result, SSEResultOne);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t NEONMultiplyResult = vmulq_f32(Left.NEON, Right.NEON);
+    float32x4_t NEONHalfAdd = vpaddq_f32(NEONMultiplyResult, NEONMultiplyResult);
+    float32x4_t NEONFullAdd = vpaddq_f32(NEONHalfAdd, NEONHalfAdd);
+    Result = vgetq_lane_f32(NEONFullAdd, 0);
+#else
+    Result = ((Left.X * Right.X) + (Left.Z * Right.Z)) + ((Left.Y * Right.Y) + (Left.W * Right.W));
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_InvQ, 1)
+static inline HMM_Quat HMM_InvQ(HMM_Quat Left)
+{
+    ASSERT_COVERED(HMM_InvQ);
+
+    HMM_Quat Result;
+    Result.X = -Left.X;
+    Result.Y = -Left.Y;
+    Result.Z = -Left.Z;
+    Result.W = Left.W;
+
+    return HMM_DivQF(Result, (HMM_DotQ(Left, Left)));
+}
+
+COVERAGE(HMM_NormQ, 1)
+static inline HMM_Quat HMM_NormQ(HMM_Quat Quat)
+{
+    ASSERT_COVERED(HMM_NormQ);
+
+    /* NOTE(lcf): Take advantage of SSE implementation in HMM_NormV4 */
+    HMM_Vec4 Vec = HMM_V4(Quat.X, Quat.Y, Quat.Z, Quat.W);
+    Vec = HMM_NormV4(Vec);
+    HMM_Quat Result = HMM_QV4(Vec);
+
+    return Result;
+}
+
+// Like HMM_NormQ, but always uses the approximate HMM_InvSqrtFastF.
+COVERAGE(HMM_NormFastQ, 1)
+static inline HMM_Quat HMM_NormFastQ(HMM_Quat Quat)
+{
+    ASSERT_COVERED(HMM_NormFastQ);
+
+    HMM_Vec4 Vec = HMM_V4(Quat.X, Quat.Y, Quat.Z, Quat.W);
+    Vec = HMM_NormFastV4(Vec);
+    HMM_Quat Result = HMM_QV4(Vec);
+
+    return Result;
+}
+
+static inline void _HMM_NormQArrayBase(const HMM_Quat *In, HMM_Quat *Out, int Count)
+{
+    int Index = 0;
+
+    /* NOTE: The dot products are summed in the same order as HMM_DotV4, and lane 0 of each one is
+       broadcast because that is the lane HMM_DotV4 returns. */
+#ifdef HANDMADE_MATH__USE_AVX512
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        __m512 Q = _mm512_loadu_ps(&In[Index]);
+        __m512 Dot = _mm512_mul_ps(Q, Q);
+#ifdef HANDMADE_MATH__USE_FMA
+        __m512 Swapped = _mm512_permute_ps(Q, _MM_SHUFFLE(2, 3, 0, 1));
+        Dot = _mm512_fmadd_ps(Swapped, Swapped, Dot);
+#else
+        Dot = _mm512_add_ps(Dot, _mm512_permute_ps(Dot, _MM_SHUFFLE(2, 3, 0, 1)));
+#endif
+        Dot = _mm512_add_ps(Dot, _mm512_permute_ps(Dot, _MM_SHUFFLE(0, 1, 2, 3)));
+        Dot = _mm512_permute_ps(Dot, _MM_SHUFFLE(0, 0, 0, 0));
+
+#ifdef HANDMADE_MATH_FAST_RSQRT
+        __m512 InvLength = _HMM_RSqrt512PS(Dot);
+#else
+        __m512 InvLength = _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_sqrt_ps(Dot));
+#endif
+        _mm512_storeu_ps(&Out[Index], _mm512_mul_ps(Q, InvLength));
+    }
+#elif defined(HANDMADE_MATH__USE_AVX)
+    for (; Index + 2 <= Count; Index += 2)
+    {
+        __m256 Q = _mm256_loadu_ps(In[Index].Elements);
+        __m256 Dot = _mm256_mul_ps(Q, Q);
+#ifdef HANDMADE_MATH__USE_FMA
+        __m256 Swapped = _mm256_shuffle_ps(Q, Q, _MM_SHUFFLE(2, 3, 0, 1));
+        Dot = _mm256_fmadd_ps(Swapped, Swapped, Dot);
+#else
+        Dot = _mm256_add_ps(Dot, _mm256_shuffle_ps(Dot, Dot, _MM_SHUFFLE(2, 3, 0, 1)));
+#endif
+        Dot = _mm256_add_ps(Dot, _mm256_shuffle_ps(Dot, Dot, _MM_SHUFFLE(0, 1, 2, 3)));
+        Dot = _mm256_shuffle_ps(Dot, Dot, _MM_SHUFFLE(0, 0, 0, 0));
+
+#ifdef HANDMADE_MATH_FAST_RSQRT
+        __m256 InvLength = _HMM_RSqrt256PS(Dot);
+#else
+        __m256 InvLength = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(Dot));
+#endif
+        _mm256_storeu_ps(Out[Index].Elements, _mm256_mul_ps(Q, InvLength));
+    }
+#endif
+
+    for (; Index < Count; ++Index)
+    {
+        Out[Index] = HMM_NormQ(In[Index]);
+    }
+}
+
+COVERAGE(HMM_NormQArray, 1)
+// Normalizes Count quaternions, giving the same results as calling HMM_NormQ on each one.
+// Out may be the same array as In.
+// (With HANDMADE_MATH_RUNTIME_DISPATCH, the AVX2 and AVX-512 tiers may differ in the last bit,
+// as may AVX-512 builds with HANDMADE_MATH_FAST_RSQRT.)
+static inline void HMM_NormQArray(const HMM_Quat *In, HMM_Quat *Out, int Count)
+{
+    ASSERT_COVERED(HMM_NormQArray);
+
+#ifdef HANDMADE_MATH__USE_DISPATCH
+    _HMM_GetDispatch()->NormQArray(In, Out, Count);
+#else
+    _HMM_NormQArrayBase(In, Out, Count);
+#endif
+}
+
+static inline HMM_Quat _HMM_MixQ(HMM_Quat Left, float MixLeft, HMM_Quat Right, float MixRight) {
+    HMM_Quat Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    __m128 ScalarLeft = _mm_set1_ps(MixLeft);
+    __m128 ScalarRight = _mm_set1_ps(MixRight);
+    __m128 SSEResultOne = _mm_mul_ps(Left.SSE, ScalarLeft);
+    __m128 SSEResultTwo = _mm_mul_ps(Right.SSE, ScalarRight);
+    Result.SSE = _mm_add_ps(SSEResultOne, SSEResultTwo);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t ScaledLeft = vmulq_n_f32(Left.NEON, MixLeft);
+    float32x4_t ScaledRight = vmulq_n_f32(Right.NEON, MixRight);
+    Result.NEON = vaddq_f32(ScaledLeft, ScaledRight);
+#else
+    Result.X = Left.X*MixLeft + Right.X*MixRight;
+    Result.Y = Left.Y*MixLeft + Right.Y*MixRight;
+    Result.Z = Left.Z*MixLeft + Right.Z*MixRight;
+    Result.W = Left.W*MixLeft + Right.W*MixRight;
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_NLerp, 1)
+static inline HMM_Quat HMM_NLerp(HMM_Quat Left, float Time, HMM_Quat Right)
+{
+    ASSERT_COVERED(HMM_NLerp);
+
+    HMM_Quat Result = _HMM_MixQ(Left, 1.0f-Time, Right, Time);
+    Result = HMM_NormQ(Result);
+
+    return Result;
+}
+
+COVERAGE(HMM_SLerp, 1)
+static inline HMM_Quat HMM_SLerp(HMM_Quat Left, float Time, HMM_Quat Right)
+{
+    ASSERT_COVERED(HMM_SLerp);
+
+    HMM_Quat Result;
+
+    float Cos_Theta = HMM_DotQ(Left, Right);
+
+    if (Cos_Theta < 0.0f) { /* NOTE(lcf): Take shortest path on Hyper-sphere */
+        Cos_Theta = -Cos_Theta;
+        Right = HMM_Q(-Right.X, -Right.Y, -Right.Z, -Right.W);
+    }
+
+    /* NOTE(lcf): Use Normalized Linear interpolation when vectors are roughly not L.I. */
+    if (Cos_Theta > 0.9995f) {
+        Result = HMM_NLerp(Left, Time, Right);
+    } else {
+        float Angle = HMM_ACosF(Cos_Theta);
+        float MixLeft = HMM_SinF((1.0f - Time) * Angle);
+        float MixRight = HMM_SinF(Time * Angle);
+
+        Result = _HMM_MixQ(Left, MixLeft, Right, MixRight);
+        Result = HMM_NormQ(Result);
+    }
+
+    return Result;
+}
+
+/*
+ * Batched quaternion interpolation. The pairs are transposed four (SSE2, NEON)
+ * or eight (AVX2) at a time, so that each register holds one component of every
+ * pair. The shortest-path flip and the choice between spherical and linear
+ * interpolation are made per lane with masks instead of branches.
+ */
+
+// Branch-free HMM_SLerp with the approximate trig functions. The batch kernels below use it for the
+// pairs that don't fill a register, and for every pair without SIMD.
+static inline HMM_Quat _HMM_SLerpFast(HMM_Quat Left, float Time, HMM_Quat Right)
+{
+    float Cos_Theta = HMM_DotQ(Left, Right);
+    unsigned int Negative = Cos_Theta < 0.0f;
+    Cos_Theta = _HMM_FlipSignF(Cos_Theta, Negative);
+
+    float Angle = _HMM_FastACosF(Cos_Theta);
+    unsigned int Linear = 0u - (unsigned int)(Cos_Theta > 0.9995f);
+    float MixLeft = _HMM_SelectF(Linear, 1.0f - Time, _HMM_FastSinF((1.0f - Time) * Angle));
+    float MixRight = _HMM_SelectF(Linear, Time, _HMM_FastSinF(Time * Angle));
+
+    /* NOTE: Negating the weight instead of Right gives exactly the same products. */
+    return HMM_NormQ(_HMM_MixQ(Left, MixLeft, Right, _HMM_FlipSignF(MixRight, Negative)));
+}
+
+/* NOTE: Times holds one time per pair, or is NULL to use Time for all of them. The sums and products
+   are in the same order as HMM_DotQ, _HMM_MixQ and HMM_NormQ, so the linear lanes round exactly like
+   HMM_NLerp. */
+static inline void _HMM_LerpQArray(const HMM_Quat *Left, const float *Times, float Time, const HMM_Quat *Right, HMM_Quat *Out, int Count, HMM_Bool Spherical)
+{
+    int Index = 0;
+
+#ifdef HANDMADE_MATH__USE_AVX2
+    for (; Index + 8 <= Count; Index += 8)
+    {
+        /* NOTE: Pair I goes in the low half and pair I + 4 in the high half, so one in-lane transpose
+           leaves pairs 0-3 in the low halves and 4-7 in the high halves, in order. */
+        __m256 L[4], R[4], Q[4];
+        for (int I = 0; I < 4; ++I)
+        {
+            L[I] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Left[Index + I].Elements)), _mm_loadu_ps(Left[Index + I + 4].Elements), 1);
+            R[I] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Right[Index + I].Elements)), _mm_loadu_ps(Right[Index + I + 4].Elements), 1);
+        }
+        _HMM_Transpose4x4AVX(&L[0], &L[1], &L[2], &L[3]);
+        _HMM_Transpose4x4AVX(&R[0], &R[1], &R[2], &R[3]);
+
+        __m256 T = Times ? _mm256_loadu_ps(&Times[Index]) : _mm256_set1_ps(Time);
+        __m256 MixLeft = _mm256_sub_ps(_mm256_set1_ps(1.0f), T);
+        __m256 MixRight = T;
+
+        if (Spherical)
+        {
+            __m256 Cos = _mm256_add_ps(_HMM_MADD256_PS(L[1], R[1], _mm256_mul_ps(L[0], R[0])), _HMM_MADD256_PS(L[2], R[2], _mm256_mul_ps(L[3], R[3])));
+            __m256 Sign = _mm256_and_ps(_mm256_cmp_ps(Cos, _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_set1_ps(-0.0f));
+            Cos = _mm256_xor_ps(Cos, Sign);
+
+            __m256 Angle = _HMM_ACos256PS(Cos);
+            __m256 SinLeft, SinRight, Unused;
+            _HMM_SinCos256PS(_mm256_mul_ps(MixLeft, Angle), &SinLeft, &Unused);
+            _HMM_SinCos256PS(_mm256_mul_ps(T, Angle), &SinRight, &Unused);
+
+            __m256 Linear = _mm256_cmp_ps(Cos, _mm256_set1_ps(0.9995f), _CMP_GT_OQ);
+            MixLeft = _mm256_blendv_ps(SinLeft, MixLeft, Linear);
+            MixRight = _mm256_xor_ps(_mm256_blendv_ps(SinRight, T, Linear), Sign);
+        }
+
+        for (int I = 0; I < 4; ++I)
+        {
+            Q[I] = _mm256_add_ps(_mm256_mul_ps(L[I], MixLeft), _mm256_mul_ps(R[I], MixRight));
+        }
+
+        __m256 Dot = _mm256_add_ps(_HMM_MADD256_PS(Q[1], Q[1], _mm256_mul_ps(Q[0], Q[0])), _HMM_MADD256_PS(Q[2], Q[2], _mm256_mul_ps(Q[3], Q[3])));
+#ifdef HANDMADE_MATH_FAST_RSQRT
+        __m256 InvLength = _HMM_RSqrt256PS(Dot);
+#else
+        __m256 InvLength = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(Dot));
+#endif
+        for (int I = 0; I < 4; ++I)
+        {
+            Q[I] = _mm256_mul_ps(Q[I], InvLength);
+        }
+
+        _HMM_Transpose4x4AVX(&Q[0], &Q[1], &Q[2], &Q[3]);
+        for (int I = 0; I < 4; ++I)
+        {
+            _mm_storeu_ps(Out[Index + I].Elements, _mm256_castps256_ps128(Q[I]));
+            _mm_storeu_ps(Out[Index + I + 4].Elements, _mm256_extractf128_ps(Q[I], 1));
+        }
+    }
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        __m128 LX = _mm_loadu_ps(Left[Index + 0].Elements);
+        __m128 LY = _mm_loadu_ps(Left[Index + 1].Elements);
+        __m128 LZ = _mm_loadu_ps(Left[Index + 2].Elements);
+        __m128 LW = _mm_loadu_ps(Left[Index + 3].Elements);
+        _MM_TRANSPOSE4_PS(LX, LY, LZ, LW);
+
+        __m128 RX = _mm_loadu_ps(Right[Index + 0].Elements);
+        __m128 RY = _mm_loadu_ps(Right[Index + 1].Elements);
+        __m128 RZ = _mm_loadu_ps(Right[Index + 2].Elements);
+        __m128 RW = _mm_loadu_ps(Right[Index + 3].Elements);
+        _MM_TRANSPOSE4_PS(RX, RY, RZ, RW);
+
+        __m128 T = Times ? _mm_loadu_ps(&Times[Index]) : _mm_set1_ps(Time);
+        __m128 MixLeft = _mm_sub_ps(_mm_set1_ps(1.0f), T);
+        __m128 MixRight = T;
+
+        if (Spherical)
+        {
+            __m128 Cos = _mm_add_ps(_HMM_MADD_PS(LY, RY, _mm_mul_ps(LX, RX)), _HMM_MADD_PS(LZ, RZ, _mm_mul_ps(LW, RW)));
+            __m128 Sign = _mm_and_ps(_mm_cmplt_ps(Cos, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+            Cos = _mm_xor_ps(Cos, Sign);
+
+            __m128 Angle = _HMM_ACosPS(Cos);
+            __m128 SinLeft, SinRight, Unused;
+            _HMM_SinCosPS(_mm_mul_ps(MixLeft, Angle), &SinLeft, &Unused);
+            _HMM_SinCosPS(_mm_mul_ps(T, Angle), &SinRight, &Unused);
+
+            __m128 Linear = _mm_cmpgt_ps(Cos, _mm_set1_ps(0.9995f));
+            MixLeft = _mm_or_ps(_mm_and_ps(Linear, MixLeft), _mm_andnot_ps(Linear, SinLeft));
+            MixRight = _mm_xor_ps(_mm_or_ps(_mm_and_ps(Linear, T), _mm_andnot_ps(Linear, SinRight)), Sign);
+        }
+
+        __m128 X = _mm_add_ps(_mm_mul_ps(LX, MixLeft), _mm_mul_ps(RX, MixRight));
+        __m128 Y = _mm_add_ps(_mm_mul_ps(LY, MixLeft), _mm_mul_ps(RY, MixRight));
+        __m128 Z = _mm_add_ps(_mm_mul_ps(LZ, MixLeft), _mm_mul_ps(RZ, MixRight));
+        __m128 W = _mm_add_ps(_mm_mul_ps(LW, MixLeft), _mm_mul_ps(RW, MixRight));
+
+        __m128 Dot = _mm_add_ps(_HMM_MADD_PS(Y, Y, _mm_mul_ps(X, X)), _HMM_MADD_PS(Z, Z, _mm_mul_ps(W, W)));
+#ifdef HANDMADE_MATH_FAST_RSQRT
+        __m128 InvLength = _HMM_RSqrtPS(Dot);
+#else
+        __m128 InvLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(Dot));
+#endif
+        X = _mm_mul_ps(X, InvLength);
+        Y = _mm_mul_ps(Y, InvLength);
+        Z = _mm_mul_ps(Z, InvLength);
+        W = _mm_mul_ps(W, InvLength);
+
+        _MM_TRANSPOSE4_PS(X, Y, Z, W);
+        _mm_storeu_ps(Out[Index + 0].Elements, X);
+        _mm_storeu_ps(Out[Index + 1].Elements, Y);
+        _mm_storeu_ps(Out[Index + 2].Elements, Z);
+        _mm_storeu_ps(Out[Index + 3].Elements, W);
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        float32x4x4_t L = vld4q_f32(Left[Index].Elements);
+        float32x4x4_t R = vld4q_f32(Right[Index].Elements);
+
+        float32x4_t T = Times ? vld1q_f32(&Times[Index]) : vdupq_n_f32(Time);
+        float32x4_t MixLeft = vsubq_f32(vdupq_n_f32(1.0f), T);
+        float32x4_t MixRight = T;
+
+        if (Spherical)
+        {
+            /* NOTE: Same order as the vpaddq_f32 sums in HMM_DotQ */
+            float32x4_t Cos = vaddq_f32(vaddq_f32(vmulq_f32(L.val[0], R.val[0]), vmulq_f32(L.val[1], R.val[1])),
+                                        vaddq_f32(vmulq_f32(L.val[2], R.val[2]), vmulq_f32(L.val[3], R.val[3])));
+            uint32x4_t Negative = vcltq_f32(Cos, vdupq_n_f32(0.0f));
+            Cos = vabsq_f32(Cos);
+
+            float32x4_t Angle = _HMM_ACosNEON(Cos);
+            float32x4_t SinLeft, SinRight, Unused;
+            _HMM_SinCosNEON(vmulq_f32(MixLeft, Angle), &SinLeft, &Unused);
+            _HMM_SinCosNEON(vmulq_f32(T, Angle), &SinRight, &Unused);
+
+            uint32x4_t Linear = vcgtq_f32(Cos, vdupq_n_f32(0.9995f));
+            MixLeft = vbslq_f32(Linear, MixLeft, SinLeft);
+            MixRight = vbslq_f32(Linear, T, SinRight);
+            MixRight = vbslq_f32(Negative, vnegq_f32(MixRight), MixRight);
+        }
+
+        float32x4x4_t Q;
+        for (int I = 0; I < 4; ++I)
+        {
+            Q.val[I] = vaddq_f32(vmulq_f32(L.val[I], MixLeft), vmulq_f32(R.val[I], MixRight));
+        }
+
+        float32x4_t Dot = vaddq_f32(vaddq_f32(vmulq_f32(Q.val[0], Q.val[0]), vmulq_f32(Q.val[1], Q.val[1])),
+                                    vaddq_f32(vmulq_f32(Q.val[2], Q.val[2]), vmulq_f32(Q.val[3], Q.val[3])));
+#ifdef HANDMADE_MATH_FAST_RSQRT
+        float32x4_t InvLength = _HMM_RSqrtNEON(Dot);
+#else
+        float32x4_t InvLength = vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(Dot));
+#endif
+        for (int I = 0; I < 4; ++I)
+        {
+            Q.val[I] = vmulq_f32(Q.val[I], InvLength);
+        }
+
+        vst4q_f32(Out[Index].Elements, Q);
+    }
+#endif
+
+    for (; Index < Count; ++Index)
+    {
+        float ElementTime = Times ? Times[Index] : Time;
+        Out[Index] = Spherical ? _HMM_SLerpFast(Left[Index], ElementTime, Right[Index]) : HMM_NLerp(Left[Index], ElementTime, Right[Index]);
+    }
+}
+
+COVERAGE(HMM_NLerpArray, 1)
+// Interpolates Count pairs of quaternions, giving the same results as calling HMM_NLerp on each pair
+// with the matching element of Time. Out may be the same array as Left or Right.
+static inline void HMM_NLerpArray(const HMM_Quat *Left, const float *Time, const HMM_Quat *Right, HMM_Quat *Out, int Count)
+{
+    ASSERT_COVERED(HMM_NLerpArray);
+    _HMM_LerpQArray(Left, Time, 0.0f, Right, Out, Count, 0);
+}
+
+COVERAGE(HMM_NLerpArrayF, 1)
+// Like HMM_NLerpArray, with the same Time for every pair.
+static inline void HMM_NLerpArrayF(const HMM_Quat *Left, float Time, const HMM_Quat *Right, HMM_Quat *Out, int Count)
+{
+    ASSERT_COVERED(HMM_NLerpArrayF);
+    _HMM_LerpQArray(Left, 0, Time, Right, Out, Count, 0);
+}
+
+COVERAGE(HMM_SLerpArray, 1)
+// Spherically interpolates Count pairs of quaternions along the shortest path, like calling HMM_SLerp
+// on each pair with the matching element of Time. The trig functions are always the
+// HANDMADE_MATH_FAST_TRIG approximations, so results are within 1e-6 of HMM_SLerp's for unit
+// quaternions. Out may be the same array as Left or Right.
+static inline void HMM_SLerpArray(const HMM_Quat *Left, const float *Time, const HMM_Quat *Right, HMM_Quat *Out, int Count)
+{
+    ASSERT_COVERED(HMM_SLerpArray);
+    _HMM_LerpQArray(Left, Time, 0.0f, Right, Out, Count, 1);
+}
+
+COVERAGE(HMM_SLerpArrayF, 1)
+// Like HMM_SLerpArray, with the same Time for every pair.
+static inline void HMM_SLerpArrayF(const HMM_Quat *Left, float Time, const HMM_Quat *Right, HMM_Quat *Out, int Count)
+{
+    ASSERT_COVERED(HMM_SLerpArrayF);
+    _HMM_LerpQArray(Left, 0, Time, Right, Out, Count, 1);
+}
+
+COVERAGE(HMM_QToM4, 1)
+static inline HMM_Mat4 HMM_QToM4(HMM_Quat Left)
+{
+    ASSERT_COVERED(HMM_QToM4);
+
+    HMM_Mat4 Result;
+
+    HMM_Quat NormalizedQ = HMM_NormQ(Left);
+
+    float XX, YY, ZZ,
+          XY, XZ, YZ,
+          WX, WY, WZ;
+
+    XX = NormalizedQ.X * NormalizedQ.X;
+    YY = NormalizedQ.Y * NormalizedQ.Y;
+    ZZ = NormalizedQ.Z * NormalizedQ.Z;
+    XY = NormalizedQ.X * NormalizedQ.Y;
+    XZ = NormalizedQ.X * NormalizedQ.Z;
+    YZ = NormalizedQ.Y * NormalizedQ.Z;
+    WX = NormalizedQ.W * NormalizedQ.X;
+    WY = NormalizedQ.W * NormalizedQ.Y;
+    WZ = NormalizedQ.W * NormalizedQ.Z;
+
+    Result.Elements[0][0] = 1.0f - 2.0f * (YY + ZZ);
+    Result.Elements[0][1] = 2.0f * (XY + WZ);
+    Result.Elements[0][2] = 2.0f * (XZ - WY);
+    Result.Elements[0][3] = 0.0f;
+
+    Result.Elements[1][0] = 2.0f * (XY - WZ);
+    Result.Elements[1][1] = 1.0f - 2.0f * (XX + ZZ);
+    Result.Elements[1][2] = 2.0f * (YZ + WX);
+    Result.Elements[1][3] = 0.0f;
+
+    Result.Elements[2][0] = 2.0f * (XZ + WY);
+    Result.Elements[2][1] = 2.0f * (YZ - WX);
+    Result.Elements[2][2] = 1.0f - 2.0f * (XX + YY);
+    Result.Elements[2][3] = 0.0f;
+
+    Result.Elements[3][0] = 0.0f;
+    Result.Elements[3][1] = 0.0f;
+    Result.Elements[3][2] = 0.0f;
+    Result.Elements[3][3] = 1.0f;
+
+    return Result;
+}
+
+// The rotation columns of HMM_QToM4Unit, with W = 0.
+static inline void _HMM_UnitQToM4Columns(HMM_Quat Rotation, HMM_Vec4 *Columns)
+{
+#ifdef HANDMADE_MATH__USE_SSE2
+    /* NOTE: Every product is taken once, from the doubled quaternion, then shuffled into place. R0
+       holds the diagonal, and R1 and R2 the sums and differences of the off-diagonal products. */
+    __m128 Q = Rotation.SSE;
+    __m128 Q2 = _mm_add_ps(Q, Q);
+    __m128 Squares = _mm_mul_ps(Q, Q2);
+    __m128 R0 = _mm_sub_ps(_mm_setr_ps(1.0f, 1.0f, 1.0f, 0.0f),
+                           _mm_add_ps(_mm_shuffle_ps(Squares, Squares, _MM_SHUFFLE(3, 0, 0, 1)),
+                                      _mm_shuffle_ps(Squares, Squares, _MM_SHUFFLE(3, 1, 2, 2))));
+    R0 = _mm_and_ps(R0, _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0)));
+
+    __m128 Cross = _mm_mul_ps(_mm_shuffle_ps(Q, Q, _MM_SHUFFLE(3, 1, 0, 0)), _mm_shuffle_ps(Q2, Q2, _MM_SHUFFLE(3, 2, 1, 2)));
+    __m128 Spin = _mm_mul_ps(_mm_shuffle_ps(Q2, Q2, _MM_SHUFFLE(3, 3, 3, 3)), _mm_shuffle_ps(Q, Q, _MM_SHUFFLE(3, 0, 2, 1)));
+    __m128 R1 = _mm_add_ps(Cross, Spin);
+    __m128 R2 = _mm_sub_ps(Cross, Spin);
+
+    __m128 T = _mm_shuffle_ps(R1, R2, _MM_SHUFFLE(1, 0, 2, 1));
+    __m128 Column0 = _mm_shuffle_ps(R0, T, _MM_SHUFFLE(2, 0, 3, 0));
+    __m128 Column1 = _mm_shuffle_ps(R0, T, _MM_SHUFFLE(1, 3, 3, 1));
+    Columns[0].SSE = _mm_shuffle_ps(Column0, Column0, _MM_SHUFFLE(1, 3, 2, 0));
+    Columns[1].SSE = _mm_shuffle_ps(Column1, Column1, _MM_SHUFFLE(1, 3, 0, 2));
+    Columns[2].SSE = _mm_shuffle_ps(_mm_shuffle_ps(R1, R2, _MM_SHUFFLE(2, 2, 0, 0)), R0, _MM_SHUFFLE(3, 2, 2, 0));
+#else
+    float XX = Rotation.X * Rotation.X, YY = Rotation.Y * Rotation.Y, ZZ = Rotation.Z * Rotation.Z;
+    float XY = Rotation.X * Rotation.Y, XZ = Rotation.X * Rotation.Z, YZ = Rotation.Y * Rotation.Z;
+    float WX = Rotation.W * Rotation.X, WY = Rotation.W * Rotation.Y, WZ = Rotation.W * Rotation.Z;
+
+    Columns[0] = HMM_V4(1.0f - 2.0f * (YY + ZZ), 2.0f * (XY + WZ), 2.0f * (XZ - WY), 0.0f);
+    Columns[1] = HMM_V4(2.0f * (XY - WZ), 1.0f - 2.0f * (XX + ZZ), 2.0f * (YZ + WX), 0.0f);
+    Columns[2] = HMM_V4(2.0f * (XZ + WY), 2.0f * (YZ - WX), 1.0f - 2.0f * (XX + YY), 0.0f);
+#endif
+}
+
+COVERAGE(HMM_QToM4Unit, 1)
+// HMM_QToM4 for a quaternion that is already unit length, such as the output of HMM_NormQ or
+// HMM_SLerp. It skips the normalization, which is checked with HMM_ASSERT instead.
+static inline HMM_Mat4 HMM_QToM4Unit(HMM_Quat Left)
+{
+    ASSERT_COVERED(HMM_QToM4Unit);
+    HMM_ASSERT(HMM_ABS(HMM_DotQ(Left, Left) - 1.0f) < 1e-3f);
+
+    HMM_Mat4 Result;
+    _HMM_UnitQToM4Columns(Left, Result.Columns);
+    Result.Columns[3] = HMM_V4(0.0f, 0.0f, 0.0f, 1.0f);
+
+    return Result;
+}
+
+COVERAGE(HMM_QToM4UnitArray, 1)
+// Converts Count unit quaternions with HMM_QToM4Unit.
+static inline void HMM_QToM4UnitArray(const HMM_Quat *In, HMM_Mat4 *Out, int Count)
+{
+    ASSERT_COVERED(HMM_QToM4UnitArray);
+
+    for (int Index = 0; Index < Count; ++Index)
+    {
+        HMM_ASSERT(HMM_ABS(HMM_DotQ(In[Index], In[Index]) - 1.0f) < 1e-3f);
+
+        HMM_Mat4 Result;
+        _HMM_UnitQToM4Columns(In[Index], Result.Columns);
+        Result.Columns[3] = HMM_V4(0.0f, 0.0f, 0.0f, 1.0f);
+        Out[Index] = Result;
+    }
+}
+
+// This method taken from Mike Day at Insomniac Games.
+// https://d3cw3dd2w32x2b.cloudfront.net/wp-content/uploads/2015/01/matrix-to-quat.pdf
+//
+// Note that as mentioned at the top of the paper, the paper assumes the matrix
+// would be *post*-multiplied to a vector to rotate it, meaning the matrix is
+// the transpose of what we're dealing with. But, because our matrices are
+// stored in column-major order, the indices *appear* to match the paper.
+//
+// For example, m12 in the paper is row 1, column 2. We need to transpose it to
+// row 2, column 1. But, because the column comes first when referencing
+// elements, it looks like M.Elements[1][2].
+//
+// Don't be confused! Or if you must be confused, at least trust this
+// comment. :)
+COVERAGE(HMM_M4ToQ_RH, 4)
+static inline HMM_Quat HMM_M4ToQ_RH(HMM_Mat4 M)
+{
+    float T;
+    HMM_Quat Q;
+
+    if (M.Elements[2][2] < 0.0f) {
+        if (M.Elements[0][0] > M.Elements[1][1]) {
+            ASSERT_COVERED(HMM_M4ToQ_RH);
+
+            T = 1 + M.Elements[0][0] - M.Elements[1][1] - M.Elements[2][2];
+            Q = HMM_Q(
+                T,
+                M.Elements[0][1] + M.Elements[1][0],
+                M.Elements[2][0] + M.Elements[0][2],
+                M.Elements[1][2] - M.Elements[2][1]
+            );
+        } else {
+            ASSERT_COVERED(HMM_M4ToQ_RH);
+
+            T = 1 - M.Elements[0][0] + M.Elements[1][1] - M.Elements[2][2];
+            Q = HMM_Q(
+                M.Elements[0][1] + M.Elements[1][0],
+                T,
+                M.Elements[1][2] + M.Elements[2][1],
+                M.Elements[2][0] - M.Elements[0][2]
+            );
+        }
+    } else {
+        if (M.Elements[0][0] < -M.Elements[1][1]) {
+            ASSERT_COVERED(HMM_M4ToQ_RH);
+
+            T = 1 - M.Elements[0][0] - M.Elements[1][1] + M.Elements[2][2];
+            Q = HMM_Q(
+                M.Elements[2][0] + M.Elements[0][2],
+                M.Elements[1][2] + M.Elements[2][1],
+                T,
+                M.Elements[0][1] - M.Elements[1][0]
+            );
+        } else {
+            ASSERT_COVERED(HMM_M4ToQ_RH);
+
+            T = 1 + M.Elements[0][0] + M.Elements[1][1] + M.Elements[2][2];
+            Q = HMM_Q(
+                M.Elements[1][2] - M.Elements[2][1],
+                M.Elements[2][0] - M.Elements[0][2],
+                M.Elements[0][1] - M.Elements[1][0],
+                T
+            );
+        }
+    }
+
+    Q = HMM_MulQF(Q, 0.5f / HMM_SqrtF(T));
+
+    return Q;
+}
+
+COVERAGE(HMM_M4ToQ_LH, 4)
+static inline HMM_Quat HMM_M4ToQ_LH(HMM_Mat4 M)
+{
+    float T;
+    HMM_Quat Q;
+
+    if (M.Elements[2][2] < 0.0f) {
+        if (M.Elements[0][0] > M.Elements[1][1]) {
+            ASSERT_COVERED(HMM_M4ToQ_LH);
+
+            T = 1 + M.Elements[0][0] - M.Elements[1][1] - M.Elements[2][2];
+            Q = HMM_Q(
+                T,
+                M.Elements[0][1] + M.Elements[1][0],
+                M.Elements[2][0] + M.Elements[0][2],
+                M.Elements[2][1] - M.Elements[1][2]
+            );
+        } else {
+            ASSERT_COVERED(HMM_M4ToQ_LH);
+
+            T = 1 - M.Elements[0][0] + M.Elements[1][1] - M.Elements[2][2];
+            Q = HMM_Q(
+                M.Elements[0][1] + M.Elements[1][0],
+                T,
+                M.Elements[1][2] + M.Elements[2][1],
+                M.Elements[0][2] - M.Elements[2][0]
+            );
+        }
+    } else {
+        if (M.Elements[0][0] < -M.Elements[1][1]) {
+            ASSERT_COVERED(HMM_M4ToQ_LH);
+
+            T = 1 - M.Elements[0][0] - M.Elements[1][1] + M.Elements[2][2];
+            Q = HMM_Q(
+                M.Elements[2][0] + M.Elements[0][2],
+                M.Elements[1][2] + M.Elements[2][1],
+                T,
+                M.Elements[1][0] - M.Elements[0][1]
+            );
+        } else {
+            ASSERT_COVERED(HMM_M4ToQ_LH);
+
+            T = 1 + M.Elements[0][0] + M.Elements[1][1] + M.Elements[2][2];
+            Q = HMM_Q(
+                M.Elements[2][1] - M.Elements[1][2],
+                M.Elements[0][2] - M.Elements[2][0],
+                M.Elements[1][0] - M.Elements[0][2],
+                T
+            );
+        }
+    }
+
+    Q = HMM_MulQF(Q, 0.5f / HMM_SqrtF(T));
+
+    return Q;
+}
+
+
+COVERAGE(HMM_QFromAxisAngle_RH, 1)
+static inline HMM_Quat HMM_QFromAxisAngle_RH(HMM_Vec3 Axis, float Angle)
+{
+    ASSERT_COVERED(HMM_QFromAxisAngle_RH);
+
+    HMM_Quat Result;
+
+    HMM_Vec3 AxisNormalized = HMM_NormV3(Axis);
+    HMM_Vec2 SinCos = HMM_SinCosF(Angle / 2.0f);
+
+    Result.XYZ = HMM_MulV3F(AxisNormalized, SinCos.X);
+    Result.W = SinCos.Y;
+
+    return Result;
+}
+
+COVERAGE(HMM_QFromAxisAngle_LH, 1)
+static inline HMM_Quat HMM_QFromAxisAngle_LH(HMM_Vec3 Axis, float Angle)
+{
+    ASSERT_COVERED(HMM_QFromAxisAngle_LH);
+
+    return HMM_QFromAxisAngle_RH(Axis, -Angle);
+}
+
+COVERAGE(HMM_QFromNormPair, 1)
+static inline HMM_Quat HMM_QFromNormPair(HMM_Vec3 Left, HMM_Vec3 Right)
+{
+    ASSERT_COVERED(HMM_QFromNormPair);
+
+    HMM_Quat Result;
+
+    Result.XYZ = HMM_Cross(Left, Right);
+    Result.W = 1.0f + HMM_DotV3(Left, Right);
+
+    return HMM_NormQ(Result);
+}
+
+COVERAGE(HMM_QFromVecPair, 1)
+static inline HMM_Quat HMM_QFromVecPair(HMM_Vec3 Left, HMM_Vec3 Right)
+{
+    ASSERT_COVERED(HMM_QFromVecPair);
+
+    return HMM_QFromNormPair(HMM_NormV3(Left), HMM_NormV3(Right));
+}
+
+COVERAGE(HMM_RotateV2, 1)
+static inline HMM_Vec2 HMM_RotateV2(HMM_Vec2 V, float Angle)
+{
+    ASSERT_COVERED(HMM_RotateV2)
+
+    HMM_Vec2 SinCos = HMM_SinCosF(Angle);
+    float sinA = SinCos.X;
+    float cosA = SinCos.Y;
+
+    return HMM_V2(V.X * cosA - V.Y * sinA, V.X * sinA + V.Y * cosA);
+}
+
+// implementation from
+// https://blog.molecular-matters.com/2013/05/24/a-faster-quaternion-vector-multiplication/
+COVERAGE(HMM_RotateV3Q, 1)
+static inline HMM_Vec3 HMM_RotateV3Q(HMM_Vec3 V, HMM_Quat Q)
+{
+    ASSERT_COVERED(HMM_RotateV3Q);
+
+    HMM_Vec3A QV;
+#ifdef HANDMADE_MATH__USE_SSE
+    QV.SSE = Q.SSE;
+#elif defined(HANDMADE_MATH__USE_NEON)
+    QV.NEON = Q.NEON;
+#else
+    QV.XYZ = Q.XYZ;
+#endif
+    HMM_Vec3A VA = HMM_V3ToV3A(V);
+
+    HMM_Vec3A t = HMM_MulV3AF(HMM_CrossV3A(QV, VA), 2);
+    return HMM_AddV3A(VA, HMM_AddV3A(HMM_MulV3AF(t, Q.W), HMM_CrossV3A(QV, t))).XYZ;
+}
+
+COVERAGE(HMM_RotateV3AxisAngle_LH, 1)
+static inline HMM_Vec3 HMM_RotateV3AxisAngle_LH(HMM_Vec3 V, HMM_Vec3 Axis, float Angle) {
+    ASSERT_COVERED(HMM_RotateV3AxisAngle_LH);
+
+    return HMM_RotateV3Q(V, HMM_QFromAxisAngle_LH(Axis, Angle));
+}
+
+COVERAGE(HMM_RotateV3AxisAngle_RH, 1)
+static inline HMM_Vec3 HMM_RotateV3AxisAngle_RH(HMM_Vec3 V, HMM_Vec3 Axis, float Angle) {
+    ASSERT_COVERED(HMM_RotateV3AxisAngle_RH);
+
+    return HMM_RotateV3Q(V, HMM_QFromAxisAngle_RH(Axis, Angle));
+}
+
+/*
+ * Linear-blend skinning
+ *
+ * Each vertex has four bone indices into a palette of skinning matrices
+ * (typically the bone's world matrix times its inverse bind pose) and four
+ * weights, which should sum to 1. Unused influences need a weight of zero and
+ * a valid index. The four matrices are blended by weight, and the position
+ * (with W = 1) and normal (with W = 0) are transformed by the result. Normals
+ * are not renormalized.
+ */
+
+#ifndef HMM_SKIN_CHUNK_SIZE
+/* Vertices per chunk in HMM_SkinV4ArrayStream. The inputs for 256 vertices take 12 KB, which leaves
+   room for the palette in a 32 KB L1 cache. */
+# define HMM_SKIN_CHUNK_SIZE 256
+#endif
+
+/* Vertices whose inputs are prefetched at a time by HMM_SkinV4ArrayStream. */
+#define _HMM_SKIN_PREFETCH_SPAN 16
+
+#ifdef HANDMADE_MATH__USE_SSE
+# define _HMM_PREFETCH(Address) _mm_prefetch((const char *)(Address), _MM_HINT_T0)
+#elif defined(__GNUC__) || defined(__clang__)
+# define _HMM_PREFETCH(Address) __builtin_prefetch(Address)
+#else
+# define _HMM_PREFETCH(Address)
+#endif
+
+static inline void _HMM_PrefetchRange(const void *Start, int Bytes)
+{
+    const char *Address = (const char *)Start;
+    for (int Offset = 0; Offset < Bytes; Offset += 64)
+    {
+        _HMM_PREFETCH(Address + Offset);
+    }
+}
+
+// Weighted sum of the four palette matrices of one vertex.
+static inline HMM_Mat4 _HMM_BlendPalette(const HMM_Mat4 *Palette, const unsigned short *Bones, const HMM_Vec4 *Weights)
+{
+    HMM_Mat4 Result;
+
+#ifdef HANDMADE_MATH__USE_AVX512
+    __m512 Blend = _mm512_mul_ps(_mm512_loadu_ps(&Palette[Bones[0]]), _mm512_set1_ps(Weights->X));
+    Blend = _HMM_MADD512_PS(_mm512_loadu_ps(&Palette[Bones[1]]), _mm512_set1_ps(Weights->Y), Blend);
+    Blend = _HMM_MADD512_PS(_mm512_loadu_ps(&Palette[Bones[2]]), _mm512_set1_ps(Weights->Z), Blend);
+    Blend = _HMM_MADD512_PS(_mm512_loadu_ps(&Palette[Bones[3]]), _mm512_set1_ps(Weights->W), Blend);
+    _mm512_storeu_ps(&Result, Blend);
+#elif defined(HANDMADE_MATH__USE_AVX)
+    __m256 Weight = _mm256_broadcast_ss(&Weights->X);
+    __m256 Columns01 = _mm256_mul_ps(_mm256_loadu_ps(Palette[Bones[0]].Columns[0].Elements), Weight);
+    __m256 Columns23 = _mm256_mul_ps(_mm256_loadu_ps(Palette[Bones[0]].Columns[2].Elements), Weight);
+    for (int Bone = 1; Bone < 4; ++Bone)
+    {
+        Weight = _mm256_broadcast_ss(&Weights->Elements[Bone]);
+        Columns01 = _HMM_MADD256_PS(_mm256_loadu_ps(Palette[Bones[Bone]].Columns[0].Elements), Weight, Columns01);
+        Columns23 = _HMM_MADD256_PS(_mm256_loadu_ps(Palette[Bones[Bone]].Columns[2].Elements), Weight, Columns23);
+    }
+    _mm256_storeu_ps(Result.Columns[0].Elements, Columns01);
+    _mm256_storeu_ps(Result.Columns[2].Elements, Columns23);
+#elif defined(HANDMADE_MATH__USE_SSE)
+    for (int Column = 0; Column < 4; ++Column)
+    {
+        __m128 Blend = _mm_mul_ps(Palette[Bones[0]].Columns[Column].SSE, _mm_set1_ps(Weights->X));
+        Blend = _HMM_MADD_PS(Palette[Bones[1]].Columns[Column].SSE, _mm_set1_ps(Weights->Y), Blend);
+        Blend = _HMM_MADD_PS(Palette[Bones[2]].Columns[Column].SSE, _mm_set1_ps(Weights->Z), Blend);
+        Result.Columns[Column].SSE = _HMM_MADD_PS(Palette[Bones[3]].Columns[Column].SSE, _mm_set1_ps(Weights->W), Blend);
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    for (int Column = 0; Column < 4; ++Column)
+    {
+        float32x4_t Blend = vmulq_laneq_f32(Palette[Bones[0]].Columns[Column].NEON, Weights->NEON, 0);
+        Blend = vfmaq_laneq_f32(Blend, Palette[Bones[1]].Columns[Column].NEON, Weights->NEON, 1);
+        Blend = vfmaq_laneq_f32(Blend, Palette[Bones[2]].Columns[Column].NEON, Weights->NEON, 2);
+        Result.Columns[Column].NEON = vfmaq_laneq_f32(Blend, Palette[Bones[3]].Columns[Column].NEON, Weights->NEON, 3);
+    }
+#else
+    for (int Column = 0; Column < 4; ++Column)
+    {
+        for (int Row = 0; Row < 4; ++Row)
+        {
+            float Blend = Palette[Bones[0]].Elements[Column][Row] * Weights->X;
+            Blend += Palette[Bones[1]].Elements[Column][Row] * Weights->Y;
+            Blend += Palette[Bones[2]].Elements[Column][Row] * Weights->Z;
+            Result.Elements[Column][Row] = Blend + Palette[Bones[3]].Elements[Column][Row] * Weights->W;
+        }
+    }
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_SkinV3Array, 1)
+// Skins Count vertices. Bones holds four palette indices per vertex, and Weights their weights.
+// Normals and OutNormals may both be NULL to skin only positions. The outputs may be the same
+// arrays as the inputs.
+static inline void HMM_SkinV3Array(const HMM_Mat4 *Palette, const unsigned short *Bones, const HMM_Vec4 *Weights,
+                                   const HMM_Vec3 *Positions, const HMM_Vec3 *Normals,
+                                   HMM_Vec3 *OutPositions, HMM_Vec3 *OutNormals, int Count)
+{
+    ASSERT_COVERED(HMM_SkinV3Array);
+
+    for (int Index = 0; Index < Count; ++Index)
+    {
+        HMM_Mat4 Skin = _HMM_BlendPalette(Palette, &Bones[4 * Index], &Weights[Index]);
+
+        OutPositions[Index] = HMM_LinearCombineV4M4(HMM_V4V(Positions[Index], 1.0f), Skin).XYZ;
+        if (Normals)
+        {
+            OutNormals[Index] = HMM_LinearCombineV4M4(HMM_V4V(Normals[Index], 0.0f), Skin).XYZ;
+        }
+    }
+}
+
+COVERAGE(HMM_SkinV4ArrayStream, 1)
+// Like HMM_SkinV3Array, but for output that is only read by the GPU. The results are written as
+// HMM_Vec4s (W is 1 for positions and 0 for normals, given an affine palette and weights that sum
+// to 1) with non-temporal stores, so they don't evict the palette from the cache. The mesh is skinned
+// HMM_SKIN_CHUNK_SIZE vertices at a time, and the inputs of the next chunk are prefetched a few
+// vertices at a time while the current one is skinned. With SSE, the outputs must be 16-byte aligned.
+static inline void HMM_SkinV4ArrayStream(const HMM_Mat4 *Palette, const unsigned short *Bones, const HMM_Vec4 *Weights,
+                                         const HMM_Vec3 *Positions, const HMM_Vec3 *Normals,
+                                         HMM_Vec4 *OutPositions, HMM_Vec4 *OutNormals, int Count)
+{
+    ASSERT_COVERED(HMM_SkinV4ArrayStream);
+
+    for (int Chunk = 0; Chunk < Count; Chunk += HMM_SKIN_CHUNK_SIZE)
+    {
+        int End = HMM_MIN(Chunk + HMM_SKIN_CHUNK_SIZE, Count);
+
+        for (int Index = Chunk; Index < End; ++Index)
+        {
+            int Ahead = Index + HMM_SKIN_CHUNK_SIZE;
+            if ((Index - Chunk) % _HMM_SKIN_PREFETCH_SPAN == 0 && Ahead < Count)
+            {
+                /* NOTE: Spread over the chunk, so the prefetches don't all queue up at its start. */
+                int Span = HMM_MIN(_HMM_SKIN_PREFETCH_SPAN, Count - Ahead);
+                _HMM_PrefetchRange(&Bones[4 * Ahead], Span * 4 * (int)sizeof(unsigned short));
+                _HMM_PrefetchRange(&Weights[Ahead], Span * (int)sizeof(HMM_Vec4));
+                _HMM_PrefetchRange(&Positions[Ahead], Span * (int)sizeof(HMM_Vec3));
+                if (Normals)
+                {
+                    _HMM_PrefetchRange(&Normals[Ahead], Span * (int)sizeof(HMM_Vec3));
+                }
+            }
+
+            HMM_Mat4 Skin = _HMM_BlendPalette(Palette, &Bones[4 * Index], &Weights[Index]);
+
+            HMM_Vec4 Position = HMM_LinearCombineV4M4(HMM_V4V(Positions[Index], 1.0f), Skin);
+#ifdef HANDMADE_MATH__USE_SSE
+            _mm_stream_ps(OutPositions[Index].Elements, Position.SSE);
+#else
+            OutPositions[Index] = Position;
+#endif
+            if (Normals)
+            {
+                HMM_Vec4 Normal = HMM_LinearCombineV4M4(HMM_V4V(Normals[Index], 0.0f), Skin);
+#ifdef HANDMADE_MATH__USE_SSE
+                _mm_stream_ps(OutNormals[Index].Elements, Normal.SSE);
+#else
+                OutNormals[Index] = Normal;
+#endif
+            }
+        }
+    }
+
+#ifdef HANDMADE_MATH__USE_SSE
+    /* NOTE: Non-temporal stores are weakly ordered, so make them visible before returning. */
+    _mm_sfence();
+#endif
+}
+
+/*
+ * Dual quaternions
+ *
+ * A unit dual quaternion represents a rotation followed by a translation: the
+ * real part is the rotation quaternion and the dual part is half the
+ * translation (as a pure quaternion) multiplied by it. Unlike matrices, unit
+ * dual quaternions blend into rigid transforms, so skinning with them keeps
+ * volume at twisted joints. Like quaternions, DQ and -DQ are the same
+ * transform.
+ */
+
+COVERAGE(HMM_DQ, 1)
+static inline HMM_DualQuat HMM_DQ(HMM_Quat Real, HMM_Quat Dual)
+{
+    ASSERT_COVERED(HMM_DQ);
+
+    HMM_DualQuat Result;
+    Result.Real = Real;
+    Result.Dual = Dual;
+
+    return Result;
+}
+
+COVERAGE(HMM_DQFromQV3, 1)
+// Builds the transform that rotates by Rotation (which should be normalized) and then translates by Translation.
+static inline HMM_DualQuat HMM_DQFromQV3(HMM_Quat Rotation, HMM_Vec3 Translation)
+{
+    ASSERT_COVERED(HMM_DQFromQV3);
+
+    HMM_DualQuat Result;
+    Result.Real = Rotation;
+    Result.Dual = HMM_MulQ(HMM_Q(Translation.X * 0.5f, Translation.Y * 0.5f, Translation.Z * 0.5f, 0.0f), Rotation);
+
+    return Result;
+}
+
+COVERAGE(HMM_DQTranslation, 1)
+// The translation of a unit dual quaternion.
+static inline HMM_Vec3 HMM_DQTranslation(HMM_DualQuat DQ)
+{
+    ASSERT_COVERED(HMM_DQTranslation);
+
+    /* NOTE: This is the vector part of 2 * Dual * conjugate(Real). */
+    HMM_Vec3 Result = HMM_SubV3(HMM_MulV3F(DQ.Dual.XYZ, DQ.Real.W), HMM_MulV3F(DQ.Real.XYZ, DQ.Dual.W));
+    Result = HMM_SubV3(Result, HMM_Cross(DQ.Dual.XYZ, DQ.Real.XYZ));
+
+    return HMM_MulV3F(Result, 2.0f);
+}
+
+COVERAGE(HMM_AddDQ, 1)
+static inline HMM_DualQuat HMM_AddDQ(HMM_DualQuat Left, HMM_DualQuat Right)
+{
+    ASSERT_COVERED(HMM_AddDQ);
+
+    return HMM_DQ(HMM_AddQ(Left.Real, Right.Real), HMM_AddQ(Left.Dual, Right.Dual));
+}
+
+COVERAGE(HMM_MulDQF, 1)
+static inline HMM_DualQuat HMM_MulDQF(HMM_DualQuat Left, float Multiplicative)
+{
+    ASSERT_COVERED(HMM_MulDQF);
+
+    return HMM_DQ(HMM_MulQF(Left.Real, Multiplicative), HMM_MulQF(Left.Dual, Multiplicative));
+}
+
+COVERAGE(HMM_MulDQ, 1)
+// Composes two transforms: the result applies Right first and then Left, like HMM_MulM4.
+static inline HMM_DualQuat HMM_MulDQ(HMM_DualQuat Left, HMM_DualQuat Right)
+{
+    ASSERT_COVERED(HMM_MulDQ);
+
+    HMM_DualQuat Result;
+    Result.Real = HMM_MulQ(Left.Real, Right.Real);
+    Result.Dual = HMM_AddQ(HMM_MulQ(Left.Real, Right.Dual), HMM_MulQ(Left.Dual, Right.Real));
+
+    return Result;
+}
+
+COVERAGE(HMM_InvDQ, 1)
+static inline HMM_DualQuat HMM_InvDQ(HMM_DualQuat DQ)
+{
+    ASSERT_COVERED(HMM_InvDQ);
+
+    HMM_DualQuat Result;
+    Result.Real = HMM_InvQ(DQ.Real);
+    Result.Dual = HMM_MulQF(HMM_MulQ(HMM_MulQ(Result.Real, DQ.Dual), Result.Real), -1.0f);
+
+    return Result;
+}
+
+COVERAGE(HMM_NormDQ, 1)
+// Turns a blend of unit dual quaternions back into a rigid transform: the real part is scaled to unit
+// length, and the dual part is scaled the same way and made orthogonal to it.
+static inline HMM_DualQuat HMM_NormDQ(HMM_DualQuat DQ)
+{
+    ASSERT_COVERED(HMM_NormDQ);
+
+    float InvLength = HMM_InvSqrtF(HMM_DotQ(DQ.Real, DQ.Real));
+
+    HMM_DualQuat Result;
+    Result.Real = HMM_MulQF(DQ.Real, InvLength);
+    Result.Dual = HMM_MulQF(DQ.Dual, InvLength);
+    Result.Dual = HMM_SubQ(Result.Dual, HMM_MulQF(Result.Real, HMM_DotQ(Result.Real, Result.Dual)));
+
+    return Result;
+}
+
+COVERAGE(HMM_RotateV3DQ, 1)
+// Applies only the rotation, e.g. to a normal.
+static inline HMM_Vec3 HMM_RotateV3DQ(HMM_Vec3 V, HMM_DualQuat DQ)
+{
+    ASSERT_COVERED(HMM_RotateV3DQ);
+
+    return HMM_RotateV3Q(V, DQ.Real);
+}
+
+COVERAGE(HMM_TransformV3DQ, 1)
+// Rotates and then translates a point by a unit dual quaternion.
+static inline HMM_Vec3 HMM_TransformV3DQ(HMM_Vec3 V, HMM_DualQuat DQ)
+{
+    ASSERT_COVERED(HMM_TransformV3DQ);
+
+    return HMM_AddV3(HMM_RotateV3Q(V, DQ.Real), HMM_DQTranslation(DQ));
+}
+
+COVERAGE(HMM_DQToM4, 1)
+// DQ is normalized first, so it may have any nonzero scale.
+static inline HMM_Mat4 HMM_DQToM4(HMM_DualQuat DQ)
+{
+    ASSERT_COVERED(HMM_DQToM4);
+
+    HMM_DualQuat Unit = HMM_NormDQ(DQ);
+    HMM_Mat4 Result = HMM_QToM4(Unit.Real);
+    Result.Columns[3] = HMM_V4V(HMM_DQTranslation(Unit), 1.0f);
+
+    return Result;
+}
+
+COVERAGE(HMM_M4ToDQ, 1)
+// The inverse of HMM_DQToM4. M must be a rotation and translation without scale.
+static inline HMM_DualQuat HMM_M4ToDQ(HMM_Mat4 M)
+{
+    ASSERT_COVERED(HMM_M4ToDQ);
+
+    return HMM_DQFromQV3(HMM_M4ToQ_RH(M), M.Columns[3].XYZ);
+}
+
+COVERAGE(HMM_ScLerp, 1)
+// Screw linear interpolation. The result moves from Left to Right along a single screw motion (a
+// rotation about an axis combined with a translation along it) at constant speed, taking the
+// shortest path. Both inputs must be unit dual quaternions.
+static inline HMM_DualQuat HMM_ScLerp(HMM_DualQuat Left, float Time, HMM_DualQuat Right)
+{
+    ASSERT_COVERED(HMM_ScLerp);
+
+    if (HMM_DotQ(Left.Real, Right.Real) < 0.0f)
+    {
+        Right = HMM_MulDQF(Right, -1.0f);
+    }
+
+    /* NOTE: Right = Left * Diff, so the result is Left * Diff^Time. Diff is raised to the power by
+       scaling its screw parameters: the half angle and the half pitch (translation along the axis). */
+    HMM_DualQuat Diff = HMM_MulDQ(HMM_DQ(HMM_Q(-Left.Real.X, -Left.Real.Y, -Left.Real.Z, Left.Real.W),
+                                         HMM_Q(-Left.Dual.X, -Left.Dual.Y, -Left.Dual.Z, Left.Dual.W)), Right);
+    float SinHalf = HMM_LenV3(Diff.Real.XYZ);
+
+    HMM_DualQuat Power;
+    if (SinHalf < 1e-6f)
+    {
+        /* NOTE: No rotation, so the screw axis is undefined; this is a pure translation. */
+        Power.Real = HMM_Q(0.0f, 0.0f, 0.0f, 1.0f);
+        Power.Dual = HMM_MulQF(Diff.Dual, Time);
+        Power.Dual.W = 0.0f;
+    }
+    else
+    {
+        /* NOTE: acos loses precision near 1, so small angles come from asin(SinHalf) instead. */
+        float HalfAngle = (Diff.Real.W < 0.7f)
+            ? HMM_ACosF(Diff.Real.W)
+            : HMM_AngleRad(HMM_PI32 / 2.0f) - HMM_ACosF(SinHalf);
+        float HalfPitch = -Diff.Dual.W / SinHalf;
+        HMM_Vec3 Axis = HMM_MulV3F(Diff.Real.XYZ, 1.0f / SinHalf);
+        HMM_Vec3 Moment = HMM_MulV3F(HMM_SubV3(Diff.Dual.XYZ, HMM_MulV3F(Axis, HalfPitch * Diff.Real.W)), 1.0f / SinHalf);
+
+        HMM_Vec2 SinCos = HMM_SinCosF(HalfAngle * Time);
+        HalfPitch *= Time;
+
+        Power.Real.XYZ = HMM_MulV3F(Axis, SinCos.X);
+        Power.Real.W = SinCos.Y;
+        Power.Dual.XYZ = HMM_AddV3(HMM_MulV3F(Moment, SinCos.X), HMM_MulV3F(Axis, HalfPitch * SinCos.Y));
+        Power.Dual.W = -HalfPitch * SinCos.X;
+    }
+
+    return HMM_MulDQ(Left, Power);
+}
+
+COVERAGE(HMM_BlendDQ, 1)
+// Dual quaternion linear blending: the weighted sum of Count unit dual quaternions, normalized. Each
+// one is first flipped into the hemisphere of the first, so that the blend takes the short way.
+static inline HMM_DualQuat HMM_BlendDQ(const HMM_DualQuat *DQs, const float *Weights, int Count)
+{
+    ASSERT_COVERED(HMM_BlendDQ);
+
+    HMM_DualQuat Result = HMM_MulDQF(DQs[0], Weights[0]);
+    for (int Index = 1; Index < Count; ++Index)
+    {
+        float Weight = _HMM_FlipSignF(Weights[Index], HMM_DotQ(DQs[0].Real, DQs[Index].Real) < 0.0f);
+        Result = HMM_AddDQ(Result, HMM_MulDQF(DQs[Index], Weight));
+    }
+
+    return HMM_NormDQ(Result);
+}
+
+#ifdef HANDMADE_MATH__USE_SSE
+// Weight, negated if Real is not in the hemisphere of Pivot, in every lane.
+static inline __m128 _HMM_AlignedWeightPS(__m128 Pivot, __m128 Real, float Weight)
+{
+    /* NOTE: Kept in registers; HMM_DotQ and a scalar compare would round-trip through memory. */
+    __m128 Dot = _mm_mul_ps(Pivot, Real);
+    Dot = _mm_add_ps(Dot, _mm_shuffle_ps(Dot, Dot, _MM_SHUFFLE(2, 3, 0, 1)));
+    Dot = _mm_add_ps(Dot, _mm_shuffle_ps(Dot, Dot, _MM_SHUFFLE(1, 0, 3, 2)));
+    __m128 Sign = _mm_and_ps(_mm_cmplt_ps(Dot, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+    return _mm_xor_ps(_mm_set1_ps(Weight), Sign);
+}
+#endif
+
+// HMM_BlendDQ for the four palette entries of one vertex, without the normalization.
+static inline HMM_DualQuat _HMM_BlendPaletteDQ(const HMM_DualQuat *Palette, const unsigned short *Bones, const HMM_Vec4 *Weights)
+{
+    const HMM_DualQuat *DQ0 = &Palette[Bones[0]];
+    const HMM_DualQuat *DQ1 = &Palette[Bones[1]];
+    const HMM_DualQuat *DQ2 = &Palette[Bones[2]];
+    const HMM_DualQuat *DQ3 = &Palette[Bones[3]];
+
+    HMM_DualQuat Result;
+
+#ifdef HANDMADE_MATH__USE_AVX
+    __m128 W1 = _HMM_AlignedWeightPS(DQ0->Real.SSE, DQ1->Real.SSE, Weights->Y);
+    __m128 W2 = _HMM_AlignedWeightPS(DQ0->Real.SSE, DQ2->Real.SSE, Weights->Z);
+    __m128 W3 = _HMM_AlignedWeightPS(DQ0->Real.SSE, DQ3->Real.SSE, Weights->W);
+
+    __m256 Blend = _mm256_mul_ps(_mm256_loadu_ps(DQ0->Elements), _mm256_broadcast_ss(&Weights->X));
+    Blend = _HMM_MADD256_PS(_mm256_loadu_ps(DQ1->Elements), _mm256_insertf128_ps(_mm256_castps128_ps256(W1), W1, 1), Blend);
+    Blend = _HMM_MADD256_PS(_mm256_loadu_ps(DQ2->Elements), _mm256_insertf128_ps(_mm256_castps128_ps256(W2), W2, 1), Blend);
+    Blend = _HMM_MADD256_PS(_mm256_loadu_ps(DQ3->Elements), _mm256_insertf128_ps(_mm256_castps128_ps256(W3), W3, 1), Blend);
+    _mm256_storeu_ps(Result.Elements, Blend);
+#elif defined(HANDMADE_MATH__USE_SSE)
+    __m128 W0 = _mm_set1_ps(Weights->X);
+    __m128 W1 = _HMM_AlignedWeightPS(DQ0->Real.SSE, DQ1->Real.SSE, Weights->Y);
+    __m128 W2 = _HMM_AlignedWeightPS(DQ0->Real.SSE, DQ2->Real.SSE, Weights->Z);
+    __m128 W3 = _HMM_AlignedWeightPS(DQ0->Real.SSE, DQ3->Real.SSE, Weights->W);
+
+    __m128 Real = _mm_mul_ps(DQ0->Real.SSE, W0);
+    __m128 Dual = _mm_mul_ps(DQ0->Dual.SSE, W0);
+    Real = _HMM_MADD_PS(DQ1->Real.SSE, W1, Real);
+    Dual = _HMM_MADD_PS(DQ1->Dual.SSE, W1, Dual);
+    Real = _HMM_MADD_PS(DQ2->Real.SSE, W2, Real);
+    Dual = _HMM_MADD_PS(DQ2->Dual.SSE, W2, Dual);
+    Result.Real.SSE = _HMM_MADD_PS(DQ3->Real.SSE, W3, Real);
+    Result.Dual.SSE = _HMM_MADD_PS(DQ3->Dual.SSE, W3, Dual);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float W1 = _HMM_FlipSignF(Weights->Y, vaddvq_f32(vmulq_f32(DQ0->Real.NEON, DQ1->Real.NEON)) < 0.0f);
+    float W2 = _HMM_FlipSignF(Weights->Z, vaddvq_f32(vmulq_f32(DQ0->Real.NEON, DQ2->Real.NEON)) < 0.0f);
+    float W3 = _HMM_FlipSignF(Weights->W, vaddvq_f32(vmulq_f32(DQ0->Real.NEON, DQ3->Real.NEON)) < 0.0f);
+
+    float32x4_t Real = vmulq_n_f32(DQ0->Real.NEON, Weights->X);
+    float32x4_t Dual = vmulq_n_f32(DQ0->Dual.NEON, Weights->X);
+    Real = vfmaq_n_f32(Real, DQ1->Real.NEON, W1);
+    Dual = vfmaq_n_f32(Dual, DQ1->Dual.NEON, W1);
+    Real = vfmaq_n_f32(Real, DQ2->Real.NEON, W2);
+    Dual = vfmaq_n_f32(Dual, DQ2->Dual.NEON, W2);
+    Result.Real.NEON = vfmaq_n_f32(Real, DQ3->Real.NEON, W3);
+    Result.Dual.NEON = vfmaq_n_f32(Dual, DQ3->Dual.NEON, W3);
+#else
+    float W1 = _HMM_FlipSignF(Weights->Y, HMM_DotQ(DQ0->Real, DQ1->Real) < 0.0f);
+    float W2 = _HMM_FlipSignF(Weights->Z, HMM_DotQ(DQ0->Real, DQ2->Real) < 0.0f);
+    float W3 = _HMM_FlipSignF(Weights->W, HMM_DotQ(DQ0->Real, DQ3->Real) < 0.0f);
+
+    for (int Element = 0; Element < 8; ++Element)
+    {
+        float Blend = DQ0->Elements[Element] * Weights->X;
+        Blend += DQ1->Elements[Element] * W1;
+        Blend += DQ2->Elements[Element] * W2;
+        Result.Elements[Element] = Blend + DQ3->Elements[Element] * W3;
+    }
+#endif
+
+    return Result;
+}
+
+// The matrix of a blended dual quaternion, normalizing it on the way. Transforming by a matrix is
+// cheaper than two quaternion rotations, and both the rotation and the translation are quadratic in
+// the blend, so they are scaled by the squared inverse length instead of normalizing first.
+static inline HMM_Mat4 _HMM_DQToSkinM4(HMM_DualQuat DQ)
+{
+    HMM_Mat4 Result;
+
+#ifdef HANDMADE_MATH__USE_SSE
+    /* NOTE: Each column is the identity plus Scale times two broadcast components of the real part
+       multiplied by shuffles of it. The translation is the vector part of Dual * conjugate(Real). */
+    __m128 R = DQ.Real.SSE;
+    __m128 Scale = _mm_mul_ps(R, R);
+    Scale = _mm_add_ps(Scale, _mm_shuffle_ps(Scale, Scale, _MM_SHUFFLE(2, 3, 0, 1)));
+    Scale = _mm_add_ps(Scale, _mm_shuffle_ps(Scale, Scale, _MM_SHUFFLE(1, 0, 3, 2)));
+    Scale = _mm_div_ps(_mm_set1_ps(2.0f), Scale);
+    __m128 X = _mm_shuffle_ps(R, R, _MM_SHUFFLE(0, 0, 0, 0));
+    __m128 Y = _mm_shuffle_ps(R, R, _MM_SHUFFLE(1, 1, 1, 1));
+    __m128 Z = _mm_shuffle_ps(R, R, _MM_SHUFFLE(2, 2, 2, 2));
+
+    __m128 Column = _mm_mul_ps(Y, _mm_mul_ps(_mm_shuffle_ps(R, R, _MM_SHUFFLE(0, 3, 0, 1)), _mm_setr_ps(-1.0f, 1.0f, -1.0f, 0.0f)));
+    Column = _HMM_MADD_PS(Z, _mm_mul_ps(_mm_shuffle_ps(R, R, _MM_SHUFFLE(0, 0, 3, 2)), _mm_setr_ps(-1.0f, 1.0f, 1.0f, 0.0f)), Column);
+    Result.Columns[0].SSE = _HMM_MADD_PS(Scale, Column, _mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f));
+
+    Column = _mm_mul_ps(X, _mm_mul_ps(_mm_shuffle_ps(R, R, _MM_SHUFFLE(0, 3, 0, 1)), _mm_setr_ps(1.0f, -1.0f, 1.0f, 0.0f)));
+    Column = _HMM_MADD_PS(Z, _mm_mul_ps(_mm_shuffle_ps(R, R, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(-1.0f, -1.0f, 1.0f, 0.0f)), Column);
+    Result.Columns[1].SSE = _HMM_MADD_PS(Scale, Column, _mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f));
+
+    Column = _mm_mul_ps(X, _mm_mul_ps(_mm_shuffle_ps(R, R, _MM_SHUFFLE(0, 0, 3, 2)), _mm_setr_ps(1.0f, -1.0f, -1.0f, 0.0f)));
+    Column = _HMM_MADD_PS(Y, _mm_mul_ps(_mm_shuffle_ps(R, R, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(1.0f, 1.0f, -1.0f, 0.0f)), Column);
+    Result.Columns[2].SSE = _HMM_MADD_PS(Scale, Column, _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f));
+
+    HMM_Quat Conjugate;
+    Conjugate.SSE = _mm_xor_ps(R, _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f));
+    __m128 Translation = HMM_MulQ(DQ.Dual, Conjugate).SSE;
+    Result.Columns[3].SSE = _HMM_MADD_PS(Translation, _mm_and_ps(Scale, _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0))), _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+#else
+    HMM_Quat R = DQ.Real;
+    HMM_Quat D = DQ.Dual;
+    float Scale = 2.0f / HMM_DotQ(R, R);
+
+    float XX = R.X * R.X, YY = R.Y * R.Y, ZZ = R.Z * R.Z;
+    float XY = R.X * R.Y, XZ = R.X * R.Z, YZ = R.Y * R.Z;
+    float WX = R.W * R.X, WY = R.W * R.Y, WZ = R.W * R.Z;
+
+    Result.Columns[0] = HMM_V4(1.0f - Scale * (YY + ZZ), Scale * (XY + WZ), Scale * (XZ - WY), 0.0f);
+    Result.Columns[1] = HMM_V4(Scale * (XY - WZ), 1.0f - Scale * (XX + ZZ), Scale * (YZ + WX), 0.0f);
+    Result.Columns[2] = HMM_V4(Scale * (XZ + WY), Scale * (YZ - WX), 1.0f - Scale * (XX + YY), 0.0f);
+    Result.Columns[3] = HMM_V4(Scale * (R.W * D.X - D.W * R.X + R.Y * D.Z - R.Z * D.Y),
+                               Scale * (R.W * D.Y - D.W * R.Y + R.Z * D.X - R.X * D.Z),
+                               Scale * (R.W * D.Z - D.W * R.Z + R.X * D.Y - R.Y * D.X),
+                               1.0f);
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_SkinDQV3Array, 1)
+// Dual quaternion skinning. The arguments are the same as for HMM_SkinV3Array, but each palette
+// entry is a unit dual quaternion, and normals stay unit length.
+static inline void HMM_SkinDQV3Array(const HMM_DualQuat *Palette, const unsigned short *Bones, const HMM_Vec4 *Weights,
+                                     const HMM_Vec3 *Positions, const HMM_Vec3 *Normals,
+                                     HMM_Vec3 *OutPositions, HMM_Vec3 *OutNormals, int Count)
+{
+    ASSERT_COVERED(HMM_SkinDQV3Array);
+
+    for (int Index = 0; Index < Count; ++Index)
+    {
+        HMM_DualQuat Blend = _HMM_BlendPaletteDQ(Palette, &Bones[4 * Index], &Weights[Index]);
+        HMM_Mat4 Skin = _HMM_DQToSkinM4(Blend);
+
+        OutPositions[Index] = HMM_LinearCombineV4M4(HMM_V4V(Positions[Index], 1.0f), Skin).XYZ;
+        if (Normals)
+        {
+            OutNormals[Index] = HMM_LinearCombineV4M4(HMM_V4V(Normals[Index], 0.0f), Skin).XYZ;
+        }
+    }
+}
+
+/*
+ * TRS transforms
+ *
+ * An HMM_TRS is the usual output of animation sampling: a translation, a
+ * rotation and a scale, applied as T * R * S. Building the matrix directly
+ * skips the three intermediate matrices and two matrix products of
+ * HMM_Translate, HMM_QToM4 and HMM_Scale. Composition and inversion stay
+ * in TRS form, which is exact when the scale is uniform; with non-uniform
+ * scale and rotation the true result has shear, which a TRS can't hold.
+ */
+
+COVERAGE(HMM_TRSFrom, 1)
+static inline HMM_TRS HMM_TRSFrom(HMM_Vec3 Translation, HMM_Quat Rotation, HMM_Vec3 Scale)
+{
+    ASSERT_COVERED(HMM_TRSFrom);
+
+    HMM_TRS Result;
+    Result.Translation = HMM_V3ToV3A(Translation);
+    Result.Rotation = Rotation;
+    Result.Scale = HMM_V3ToV3A(Scale);
+
+    return Result;
+}
+
+// HMM_RotateV3Q for a padded vector.
+static inline HMM_Vec3A _HMM_RotateV3AQ(HMM_Vec3A V, HMM_Quat Q)
+{
+#ifdef HANDMADE_MATH__USE_SSE
+    /* NOTE: Reading Q.W as a float makes some compilers copy Q to memory and reload it. */
+    __m128 t = _HMM_CrossSSE(Q.SSE, V.SSE);
+    t = _mm_add_ps(t, t);
+
+    HMM_Vec3A Result;
+    Result.SSE = _mm_add_ps(V.SSE, _HMM_CrossSSE(Q.SSE, t));
+    Result.SSE = _HMM_MADD_PS(t, _mm_shuffle_ps(Q.SSE, Q.SSE, _MM_SHUFFLE(3, 3, 3, 3)), Result.SSE);
+    return Result;
+#else
+    HMM_Vec3A QV;
+#ifdef HANDMADE_MATH__USE_NEON
+    QV.NEON = Q.NEON;
+#else
+    QV.XYZ = Q.XYZ;
+#endif
+
+    HMM_Vec3A t = HMM_MulV3AF(HMM_CrossV3A(QV, V), 2.0f);
+    return HMM_AddV3A(V, HMM_AddV3A(HMM_MulV3AF(t, Q.W), HMM_CrossV3A(QV, t)));
+#endif
+}
+
+// The columns of the rotation matrix of Rotation, each multiplied by the matching component of Scale.
+static inline void _HMM_TRSColumns(HMM_Quat Rotation, HMM_Vec3A Scale, HMM_Vec4 *Columns)
+{
+    _HMM_UnitQToM4Columns(Rotation, Columns);
+#ifdef HANDMADE_MATH__USE_SSE
+    Columns[0].SSE = _mm_mul_ps(Columns[0].SSE, _mm_shuffle_ps(Scale.SSE, Scale.SSE, _MM_SHUFFLE(0, 0, 0, 0)));
+    Columns[1].SSE = _mm_mul_ps(Columns[1].SSE, _mm_shuffle_ps(Scale.SSE, Scale.SSE, _MM_SHUFFLE(1, 1, 1, 1)));
+    Columns[2].SSE = _mm_mul_ps(Columns[2].SSE, _mm_shuffle_ps(Scale.SSE, Scale.SSE, _MM_SHUFFLE(2, 2, 2, 2)));
+#else
+    Columns[0] = HMM_MulV4F(Columns[0], Scale.X);
+    Columns[1] = HMM_MulV4F(Columns[1], Scale.Y);
+    Columns[2] = HMM_MulV4F(Columns[2], Scale.Z);
+#endif
+}
+
+COVERAGE(HMM_TRSToM4, 1)
+// Returns Translate(Translation) * QToM4(Rotation) * Scale(Scale). Unlike HMM_QToM4, Rotation is not
+// normalized here; it must already be a unit quaternion.
+static inline HMM_Mat4 HMM_TRSToM4(HMM_TRS Transform)
+{
+    ASSERT_COVERED(HMM_TRSToM4);
+
+    HMM_Mat4 Result;
+    _HMM_TRSColumns(Transform.Rotation, Transform.Scale, Result.Columns);
+    Result.Columns[3] = HMM_V3AToV4(Transform.Translation, 1.0f);
+
+    return Result;
+}
+
+COVERAGE(HMM_TRSToInvM4, 1)
+// Returns the inverse of HMM_TRSToM4(Transform), without a general matrix inverse. This is exact for
+// any non-zero scale.
+static inline HMM_Mat4 HMM_TRSToInvM4(HMM_TRS Transform)
+{
+    ASSERT_COVERED(HMM_TRSToInvM4);
+
+    /* NOTE: The inverse is Scale^-1 * Rotation^T * Translate(-Translation). Scaling the rotation's
+       columns by the reciprocal scale and transposing gives the first part. */
+    HMM_Vec3A InvScale = HMM_DivV3A(HMM_V3A(1.0f, 1.0f, 1.0f), Transform.Scale);
+    HMM_Mat4 Result;
+    _HMM_TRSColumns(Transform.Rotation, InvScale, Result.Columns);
+    Result.Columns[3] = HMM_V4(0.0f, 0.0f, 0.0f, 1.0f);
+    Result = HMM_TransposeM4(Result);
+
+    HMM_Vec4 Translation = HMM_LinearCombineV4M4(HMM_V3AToV4(Transform.Translation, 0.0f), Result);
+    Result.Columns[3] = HMM_SubV4(HMM_V4(0.0f, 0.0f, 0.0f, 1.0f), Translation);
+
+    return Result;
+}
+
+COVERAGE(HMM_MulTRS, 1)
+// Composes two transforms, so that the result applies Right first: T = Left.T + Left.R * (Left.S *
+// Right.T), R = Left.R * Right.R and S = Left.S * Right.S. Exact when Left's scale is uniform.
+static inline HMM_TRS HMM_MulTRS(HMM_TRS Left, HMM_TRS Right)
+{
+    ASSERT_COVERED(HMM_MulTRS);
+
+    HMM_TRS Result;
+    Result.Translation = HMM_AddV3A(Left.Translation, _HMM_RotateV3AQ(HMM_MulV3A(Left.Scale, Right.Translation), Left.Rotation));
+    Result.Rotation = HMM_MulQ(Left.Rotation, Right.Rotation);
+    Result.Scale = HMM_MulV3A(Left.Scale, Right.Scale);
+
+    return Result;
+}
+
+COVERAGE(HMM_InvTRS, 1)
+// The transform that undoes Transform, so that HMM_MulTRS(HMM_InvTRS(A), A) is the identity. Exact when
+// the scale is uniform; otherwise use HMM_TRSToInvM4.
+static inline HMM_TRS HMM_InvTRS(HMM_TRS Transform)
+{
+    ASSERT_COVERED(HMM_InvTRS);
+
+    HMM_TRS Result;
+    Result.Rotation = HMM_Q(-Transform.Rotation.X, -Transform.Rotation.Y, -Transform.Rotation.Z, Transform.Rotation.W);
+    Result.Scale = HMM_DivV3A(HMM_V3A(1.0f, 1.0f, 1.0f), Transform.Scale);
+    Result.Translation = HMM_MulV3A(Result.Scale, _HMM_RotateV3AQ(Transform.Translation, Result.Rotation));
+    Result.Translation = HMM_SubV3A(HMM_V3A(0.0f, 0.0f, 0.0f), Result.Translation);
+
+    return Result;
+}
+
+COVERAGE(HMM_LerpTRS, 1)
+// Interpolates translation and scale linearly and rotation with HMM_NLerp, taking the short way around.
+static inline HMM_TRS HMM_LerpTRS(HMM_TRS Left, float Time, HMM_TRS Right)
+{
+    ASSERT_COVERED(HMM_LerpTRS);
+
+    float RotationTime = _HMM_FlipSignF(Time, HMM_DotQ(Left.Rotation, Right.Rotation) < 0.0f);
+
+    HMM_TRS Result;
+    Result.Translation = HMM_AddV3A(HMM_MulV3AF(Left.Translation, 1.0f - Time), HMM_MulV3AF(Right.Translation, Time));
+    Result.Rotation = HMM_NormQ(HMM_AddQ(HMM_MulQF(Left.Rotation, 1.0f - Time), HMM_MulQF(Right.Rotation, RotationTime)));
+    Result.Scale = HMM_AddV3A(HMM_MulV3AF(Left.Scale, 1.0f - Time), HMM_MulV3AF(Right.Scale, Time));
+
+    return Result;
+}
+
+COVERAGE(HMM_BlendTRS, 1)
+// The weighted sum of Count transforms, for blending animation poses. The weights should add up to 1.
+// Rotations are flipped into the hemisphere of the first before summing, then normalized.
+static inline HMM_TRS HMM_BlendTRS(const HMM_TRS *Transforms, const float *Weights, int Count)
+{
+    ASSERT_COVERED(HMM_BlendTRS);
+
+    HMM_TRS Result;
+    Result.Translation = HMM_MulV3AF(Transforms[0].Translation, Weights[0]);
+    Result.Rotation = HMM_MulQF(Transforms[0].Rotation, Weights[0]);
+    Result.Scale = HMM_MulV3AF(Transforms[0].Scale, Weights[0]);
+    for (int Index = 1; Index < Count; ++Index)
+    {
+        float Weight = _HMM_FlipSignF(Weights[Index], HMM_DotQ(Transforms[0].Rotation, Transforms[Index].Rotation) < 0.0f);
+        Result.Translation = HMM_AddV3A(Result.Translation, HMM_MulV3AF(Transforms[Index].Translation, Weights[Index]));
+        Result.Rotation = HMM_AddQ(Result.Rotation, HMM_MulQF(Transforms[Index].Rotation, Weight));
+        Result.Scale = HMM_AddV3A(Result.Scale, HMM_MulV3AF(Transforms[Index].Scale, Weights[Index]));
+    }
+    Result.Rotation = HMM_NormQ(Result.Rotation);
+
+    return Result;
+}
+
+COVERAGE(HMM_TRSToM4Array, 1)
+// Converts Count transforms with HMM_TRSToM4, for example a sampled pose into a skinning palette.
+static inline void HMM_TRSToM4Array(const HMM_TRS *In, HMM_Mat4 *Out, int Count)
+{
+    ASSERT_COVERED(HMM_TRSToM4Array);
+
+    for (int Index = 0; Index < Count; ++Index)
+    {
+        HMM_Mat4 Result;
+        _HMM_TRSColumns(In[Index].Rotation, In[Index].Scale, Result.Columns);
+        Result.Columns[3] = HMM_V3AToV4(In[Index].Translation, 1.0f);
+        Out[Index] = Result;
+    }
+}
+
+/*
+ * Animation sampling
+ *
+ * A track is a list of keys with increasing times. The tracks of one value
+ * type in a clip are stored back to back: track I owns keys KeyOffsets[I] to
+ * KeyOffsets[I + 1] - 1 of the shared Times and Values arrays, so a clip is
+ * three flat arrays instead of one allocation per track. Sampling keeps a
+ * cursor per track (the key found last time, starting at 0). During normal
+ * playback the next sample is at or just after the previous one, so finding
+ * its keys takes a step or two instead of a binary search. Seeking backwards,
+ * such as when a clip loops, falls back to a binary search.
+ *
+ * Values are stored as plain HMM_Vec3s and HMM_Quats rather than in SoA
+ * blocks. This is deliberate: tracks have different key counts and each is at
+ * its own key, so the keys sampled together are never adjacent in memory. The
+ * samplers instead gather a block of key pairs and interpolate them together.
+ */
+
+// Returns the last index in [Low, High] whose time is at or before Time, or Low if there is none.
+static inline int _HMM_SearchKey(const float *Times, int Low, int High, float Time)
+{
+    while (Low < High)
+    {
+        int Mid = (Low + High + 1) / 2;
+        if (Times[Mid] <= Time)
+        {
+            Low = Mid;
+        }
+        else
+        {
+            High = Mid - 1;
+        }
+    }
+
+    return Low;
+}
+
+COVERAGE(HMM_SampleKey, 1)
+// Finds the keys around Time in a track of Count keys. On return, *Cursor is the index of the key
+// before Time, and the result is how far Time is from that key to the next one, clamped to [0, 1]
+// outside the track. *Cursor should hold the result of the previous call, or 0.
+static inline float HMM_SampleKey(const float *Times, int Count, float Time, int *Cursor)
+{
+    ASSERT_COVERED(HMM_SampleKey);
+
+    int Last = Count - 2;
+    if (Last < 0)
+    {
+        *Cursor = 0;
+        return 0.0f;
+    }
+
+    int Key = HMM_MIN(HMM_MAX(*Cursor, 0), Last);
+    if (Time < Times[Key])
+    {
+        Key = _HMM_SearchKey(Times, 0, Key, Time);
+    }
+    else
+    {
+        /* NOTE: A few linear steps cover normal playback; anything further is a seek. */
+        for (int Step = 0; Key < Last && Times[Key + 1] <= Time; ++Step)
+        {
+            if (Step == 4)
+            {
+                Key = _HMM_SearchKey(Times, Key, Last, Time);
+                break;
+            }
+            ++Key;
+        }
+    }
+    *Cursor = Key;
+
+    float Factor = (Time - Times[Key]) / (Times[Key + 1] - Times[Key]);
+    return HMM_Clamp(0.0f, Factor, 1.0f);
+}
+
+COVERAGE(HMM_SampleV3Tracks, 1)
+// Samples TrackCount vector tracks at Time, interpolating linearly, and writes one value per track to
+// Out. Cursors holds one cursor per track, as for HMM_SampleKey. Every track needs at least one key.
+static inline void HMM_SampleV3Tracks(const int *KeyOffsets, const float *Times, const HMM_Vec3 *Values,
+                                      int TrackCount, float Time, int *Cursors, HMM_Vec3 *Out)
+{
+    ASSERT_COVERED(HMM_SampleV3Tracks);
+
+    /* NOTE: The key pairs are gathered a block at a time, transposed, and interpolated together. */
+    for (int Block = 0; Block < TrackCount; Block += HMM_SOA_WIDTH)
+    {
+        HMM_Vec3 Left[HMM_SOA_WIDTH], Right[HMM_SOA_WIDTH];
+        HMM_FloatSoA Factors = HMM_SoAF(0.0f);
+        int BlockCount = HMM_MIN(TrackCount - Block, HMM_SOA_WIDTH);
+        for (int Index = 0; Index < BlockCount; ++Index)
+        {
+            int Track = Block + Index;
+            int First = KeyOffsets[Track];
+            int Count = KeyOffsets[Track + 1] - First;
+            Factors.Elements[Index] = HMM_SampleKey(&Times[First], Count, Time, &Cursors[Track]);
+
+            int Key = First + Cursors[Track];
+            Left[Index] = Values[Key];
+            Right[Index] = Values[(Count > 1) ? Key + 1 : Key];
+        }
+
+        HMM_Vec3SoA LeftSoA, RightSoA, Result;
+        HMM_V3ArrayToSoA(Left, &LeftSoA, BlockCount);
+        HMM_V3ArrayToSoA(Right, &RightSoA, BlockCount);
+
+        HMM_FloatSoA LeftFactors = _HMM_SubSoA(HMM_SoAF(1.0f), Factors);
+        Result.X = _HMM_AddSoA(_HMM_MulSoA(LeftSoA.X, LeftFactors), _HMM_MulSoA(RightSoA.X, Factors));
+        Result.Y = _HMM_AddSoA(_HMM_MulSoA(LeftSoA.Y, LeftFactors), _HMM_MulSoA(RightSoA.Y, Factors));
+        Result.Z = _HMM_AddSoA(_HMM_MulSoA(LeftSoA.Z, LeftFactors), _HMM_MulSoA(RightSoA.Z, Factors));
+        HMM_SoAToV3Array(&Result, &Out[Block], BlockCount);
+    }
+}
+
+COVERAGE(HMM_SampleQTracks, 1)
+// Samples TrackCount rotation tracks at Time with HMM_NLerp. Like HMM_NLerp, this doesn't take the
+// short way around, so each key should be in the same hemisphere as the one before it (negate it if
+// the dot product is negative when building the track). Otherwise as HMM_SampleV3Tracks.
+static inline void HMM_SampleQTracks(const int *KeyOffsets, const float *Times, const HMM_Quat *Values,
+                                     int TrackCount, float Time, int *Cursors, HMM_Quat *Out)
+{
+    ASSERT_COVERED(HMM_SampleQTracks);
+
+    /* NOTE: The key pairs are gathered a block at a time and interpolated together by the same
+       kernel as HMM_NLerpArray. */
+    for (int Block = 0; Block < TrackCount; Block += HMM_SOA_WIDTH)
+    {
+        HMM_Quat Left[HMM_SOA_WIDTH], Right[HMM_SOA_WIDTH];
+        float Factors[HMM_SOA_WIDTH];
+        int BlockCount = HMM_MIN(TrackCount - Block, HMM_SOA_WIDTH);
+        for (int Index = 0; Index < BlockCount; ++Index)
+        {
+            int Track = Block + Index;
+            int First = KeyOffsets[Track];
+            int Count = KeyOffsets[Track + 1] - First;
+            Factors[Index] = HMM_SampleKey(&Times[First], Count, Time, &Cursors[Track]);
+
+            int Key = First + Cursors[Track];
+            Left[Index] = Values[Key];
+            Right[Index] = Values[(Count > 1) ? Key + 1 : Key];
+        }
+        _HMM_LerpQArray(Left, Factors, 0.0f, Right, &Out[Block], BlockCount, 0);
+    }
+}
+
+/*
+ * Compressed formats
+ *
+ * Smaller encodings of rotations and vectors for animation keys and network
+ * messages, where memory and bandwidth cost more than the arithmetic to
+ * unpack them. The array functions unpack four values at a time.
+ *
+ *   HMM_PackedQuat32   4 bytes   unit quaternion   error < 2e-3 per component
+ *   HMM_PackedQuat48   6 bytes   unit quaternion   error < 7e-5 per component
+ *   HMM_HalfVec3       6 bytes   any vector        relative error < 2^-11
+ *   HMM_FixedVec3      6 bytes   vector in a box   error < (Max - Min) / 131070
+ *   HMM_OctVec3        4 bytes   unit vector       error < 7e-5 per component
+ *
+ * The quaternion formats store the "smallest three" components. Q and -Q are
+ * the same rotation, so the largest component can be made positive, and then
+ * rebuilt from the other three since the length is one. The other three lie
+ * in [-1/sqrt(2), 1/sqrt(2)], which is all the range their bits have to cover.
+ */
+
+// Maps a smallest-three component from [-1/sqrt(2), 1/sqrt(2)] to an integer in [0, Scale].
+static inline unsigned int _HMM_QuantizeSmallestF(float Value, float Scale)
+{
+    float Unit = HMM_Clamp(-1.0f, Value * 1.41421356f, 1.0f);
+    return (unsigned int)((Unit * 0.5f + 0.5f) * Scale + 0.5f);
+}
+
+// Returns the index of the component of Q with the largest magnitude.
+static inline int _HMM_LargestComponentQ(HMM_Quat Q)
+{
+    int Result = 0;
+    for (int Index = 1; Index < 4; ++Index)
+    {
+        if (HMM_ABS(Q.Elements[Index]) > HMM_ABS(Q.Elements[Result]))
+        {
+            Result = Index;
+        }
+    }
+
+    return Result;
+}
+
+// Rebuilds a unit quaternion from the index of its largest component and the other three, in order.
+static inline HMM_Quat _HMM_SmallestThreeQ(int Largest, float A, float B, float C)
+{
+    float Others[3] = { A, B, C };
+    float LargestValue = HMM_SqrtF(HMM_MAX(0.0f, 1.0f - (A * A + B * B + C * C)));
+
+    HMM_Quat Result;
+    for (int Index = 0, Next = 0; Index < 4; ++Index)
+    {
+        Result.Elements[Index] = (Index == Largest) ? LargestValue : Others[Next++];
+    }
+
+    return Result;
+}
+
+#ifdef HANDMADE_MATH__USE_SSE2
+// Rebuilds four quaternions from smallest-three components, one per lane, and stores them to Out.
+static inline void _HMM_SmallestThreeQSSE(__m128i Largest, __m128 A, __m128 B, __m128 C, HMM_Quat *Out)
+{
+    __m128 Sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(A, A), _mm_mul_ps(B, B)), _mm_mul_ps(C, C));
+    __m128 L = _mm_sqrt_ps(_mm_max_ps(_mm_setzero_ps(), _mm_sub_ps(_mm_set1_ps(1.0f), Sum)));
+
+    __m128 Is0 = _mm_castsi128_ps(_mm_cmpeq_epi32(Largest, _mm_setzero_si128()));
+    __m128 Is1 = _mm_castsi128_ps(_mm_cmpeq_epi32(Largest, _mm_set1_epi32(1)));
+    __m128 Is2 = _mm_castsi128_ps(_mm_cmpeq_epi32(Largest, _mm_set1_epi32(2)));
+    __m128 Is3 = _mm_castsi128_ps(_mm_cmpeq_epi32(Largest, _mm_set1_epi32(3)));
+
+    __m128 X = _mm_or_ps(_mm_and_ps(Is0, L), _mm_andnot_ps(Is0, A));
+    __m128 Y = _mm_or_ps(_mm_and_ps(Is1, L), _mm_andnot_ps(Is1, B));
+    Y = _mm_or_ps(_mm_and_ps(Is0, A), _mm_andnot_ps(Is0, Y));
+    __m128 Z = _mm_or_ps(_mm_and_ps(Is2, L), _mm_andnot_ps(Is2, B));
+    Z = _mm_or_ps(_mm_and_ps(Is3, C), _mm_andnot_ps(Is3, Z));
+    __m128 W = _mm_or_ps(_mm_and_ps(Is3, L), _mm_andnot_ps(Is3, C));
+
+    _MM_TRANSPOSE4_PS(X, Y, Z, W);
+    Out[0].SSE = X;
+    Out[1].SSE = Y;
+    Out[2].SSE = Z;
+    Out[3].SSE = W;
+}
+#elif defined(HANDMADE_MATH__USE_NEON)
+static inline void _HMM_SmallestThreeQNEON(uint32x4_t Largest, float32x4_t A, float32x4_t B, float32x4_t C, HMM_Quat *Out)
+{
+    float32x4_t Sum = vfmaq_f32(vfmaq_f32(vmulq_f32(A, A), B, B), C, C);
+    float32x4_t L = vsqrtq_f32(vmaxq_f32(vdupq_n_f32(0.0f), vsubq_f32(vdupq_n_f32(1.0f), Sum)));
+
+    uint32x4_t Is0 = vceqq_u32(Largest, vdupq_n_u32(0));
+    uint32x4_t Is1 = vceqq_u32(Largest, vdupq_n_u32(1));
+    uint32x4_t Is2 = vceqq_u32(Largest, vdupq_n_u32(2));
+    uint32x4_t Is3 = vceqq_u32(Largest, vdupq_n_u32(3));
+
+    float32x4x4_t Result;
+    Result.val[0] = vbslq_f32(Is0, L, A);
+    Result.val[1] = vbslq_f32(Is0, A, vbslq_f32(Is1, L, B));
+    Result.val[2] = vbslq_f32(Is3, C, vbslq_f32(Is2, L, B));
+    Result.val[3] = vbslq_f32(Is3, L, C);
+    vst4q_f32(&Out[0].Elements[0], Result);
+}
+#endif
+
+COVERAGE(HMM_PackQ32, 1)
+// Packs a unit quaternion into 32 bits. Q and -Q pack to the same bits.
+static inline HMM_PackedQuat32 HMM_PackQ32(HMM_Quat Q)
+{
+    ASSERT_COVERED(HMM_PackQ32);
+
+    int Largest = _HMM_LargestComponentQ(Q);
+    float Sign = (Q.Elements[Largest] < 0.0f) ? -1.0f : 1.0f;
+
+    /* NOTE: The index of the largest component ends up in the top two bits. */
+    HMM_PackedQuat32 Result;
+    Result.Bits = (unsigned int)Largest;
+    for (int Index = 0; Index < 4; ++Index)
+    {
+        if (Index != Largest)
+        {
+            Result.Bits = (Result.Bits << 10) | _HMM_QuantizeSmallestF(Q.Elements[Index] * Sign, 1023.0f);
+        }
+    }
+
+    return Result;
+}
+
+COVERAGE(HMM_UnpackQ32, 1)
+static inline HMM_Quat HMM_UnpackQ32(HMM_PackedQuat32 P)
 {
-    ASSERT_COVERED(HMM_DeterminantM4);
+    ASSERT_COVERED(HMM_UnpackQ32);
 
-    HMM_Vec3 C01 = HMM_Cross(Matrix.Columns[0].XYZ, Matrix.Columns[1].XYZ);
-    HMM_Vec3 C23 = HMM_Cross(Matrix.Columns[2].XYZ, Matrix.Columns[3].XYZ);
-    HMM_Vec3 B10 = HMM_SubV3(HMM_MulV3F(Matrix.Columns[0].XYZ, Matrix.Columns[1].W), HMM_MulV3F(Matrix.Columns[1].XYZ, Matrix.Columns[0].W));
-    HMM_Vec3 B32 = HMM_SubV3(HMM_MulV3F(Matrix.Columns[2].XYZ, Matrix.Columns[3].W), HMM_MulV3F(Matrix.Columns[3].XYZ, Matrix.Columns[2].W));
+    const float Step = 1.41421356f / 1023.0f;
+    return _HMM_SmallestThreeQ((int)(P.Bits >> 30),
+                               (float)((P.Bits >> 20) & 1023) * Step - 0.70710678f,
+                               (float)((P.Bits >> 10) & 1023) * Step - 0.70710678f,
+                               (float)(P.Bits & 1023) * Step - 0.70710678f);
+}
 
-    return HMM_DotV3(C01, B32) + HMM_DotV3(C23, B10);
+COVERAGE(HMM_UnpackQ32Array, 1)
+// Unpacks Count quaternions, giving the same results as HMM_UnpackQ32 up to the last bit.
+static inline void HMM_UnpackQ32Array(const HMM_PackedQuat32 *In, HMM_Quat *Out, int Count)
+{
+    ASSERT_COVERED(HMM_UnpackQ32Array);
+
+    int Index = 0;
+#ifdef HANDMADE_MATH__USE_SSE2
+    __m128i Mask = _mm_set1_epi32(1023);
+    __m128 Step = _mm_set1_ps(1.41421356f / 1023.0f);
+    __m128 Offset = _mm_set1_ps(-0.70710678f);
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        __m128i Bits = _mm_loadu_si128((const __m128i *)&In[Index]);
+        __m128 A = _HMM_MADD_PS(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(Bits, 20), Mask)), Step, Offset);
+        __m128 B = _HMM_MADD_PS(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(Bits, 10), Mask)), Step, Offset);
+        __m128 C = _HMM_MADD_PS(_mm_cvtepi32_ps(_mm_and_si128(Bits, Mask)), Step, Offset);
+        _HMM_SmallestThreeQSSE(_mm_srli_epi32(Bits, 30), A, B, C, &Out[Index]);
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    uint32x4_t Mask = vdupq_n_u32(1023);
+    float32x4_t Step = vdupq_n_f32(1.41421356f / 1023.0f);
+    float32x4_t Offset = vdupq_n_f32(-0.70710678f);
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        uint32x4_t Bits = vld1q_u32(&In[Index].Bits);
+        float32x4_t A = vfmaq_f32(Offset, vcvtq_f32_u32(vandq_u32(vshrq_n_u32(Bits, 20), Mask)), Step);
+        float32x4_t B = vfmaq_f32(Offset, vcvtq_f32_u32(vandq_u32(vshrq_n_u32(Bits, 10), Mask)), Step);
+        float32x4_t C = vfmaq_f32(Offset, vcvtq_f32_u32(vandq_u32(Bits, Mask)), Step);
+        _HMM_SmallestThreeQNEON(vshrq_n_u32(Bits, 30), A, B, C, &Out[Index]);
+    }
+#endif
+
+    for (; Index < Count; ++Index)
+    {
+        Out[Index] = HMM_UnpackQ32(In[Index]);
+    }
 }
 
-COVERAGE(HMM_InvGeneralM4, 1)
-// Returns a general-purpose inverse of an HMM_Mat4. Note that special-purpose inverses of many transformations
-// are available and will be more efficient.
-static inline HMM_Mat4 HMM_InvGeneralM4(HMM_Mat4 Matrix)
+COVERAGE(HMM_PackQ48, 1)
+// Packs a unit quaternion into 48 bits. Q and -Q pack to the same bits.
+static inline HMM_PackedQuat48 HMM_PackQ48(HMM_Quat Q)
 {
-    ASSERT_COVERED(HMM_InvGeneralM4);
+    ASSERT_COVERED(HMM_PackQ48);
 
-    HMM_Vec3 C01 = HMM_Cross(Matrix.Columns[0].XYZ, Matrix.Columns[1].XYZ);
-    HMM_Vec3 C23 = HMM_Cross(Matrix.Columns[2].XYZ, Matrix.Columns[3].XYZ);
-    HMM_Vec3 B10 = HMM_SubV3(HMM_MulV3F(Matrix.Columns[0].XYZ, Matrix.Columns[1].W), HMM_MulV3F(Matrix.Columns[1].XYZ, Matrix.Columns[0].W));
-    HMM_Vec3 B32 = HMM_SubV3(HMM_MulV3F(Matrix.Columns[2].XYZ, Matrix.Columns[3].W), HMM_MulV3F(Matrix.Columns[3].XYZ, Matrix.Columns[2].W));
+    int Largest = _HMM_LargestComponentQ(Q);
+    float Sign = (Q.Elements[Largest] < 0.0f) ? -1.0f : 1.0f;
+
+    HMM_PackedQuat48 Result;
+    for (int Index = 0, Next = 0; Index < 4; ++Index)
+    {
+        if (Index != Largest)
+        {
+            Result.Bits[Next++] = (unsigned short)_HMM_QuantizeSmallestF(Q.Elements[Index] * Sign, 32767.0f);
+        }
+    }
 
-    float InvDeterminant = 1.0f / (HMM_DotV3(C01, B32) + HMM_DotV3(C23, B10));
-    C01 = HMM_MulV3F(C01, InvDeterminant);
-    C23 = HMM_MulV3F(C23, InvDeterminant);
-    B10 = HMM_MulV3F(B10, InvDeterminant);
-    B32 = HMM_MulV3F(B32, InvDeterminant);
+    /* NOTE: The index of the largest component is split over the top bits of the first two words. */
+    Result.Bits[0] |= (unsigned short)((Largest & 2) << 14);
+    Result.Bits[1] |= (unsigned short)((Largest & 1) << 15);
 
-    HMM_Mat4 Result;
-    Result.Columns[0] = HMM_V4V(HMM_AddV3(HMM_Cross(Matrix.Columns[1].XYZ, B32), HMM_MulV3F(C23, Matrix.Columns[1].W)), -HMM_DotV3(Matrix.Columns[1].XYZ, C23));
-    Result.Columns[1] = HMM_V4V(HMM_SubV3(HMM_Cross(B32, Matrix.Columns[0].XYZ), HMM_MulV3F(C23, Matrix.Columns[0].W)), +HMM_DotV3(Matrix.Columns[0].XYZ, C23));
-    Result.Columns[2] = HMM_V4V(HMM_AddV3(HMM_Cross(Matrix.Columns[3].XYZ, B10), HMM_MulV3F(C01, Matrix.Columns[3].W)), -HMM_DotV3(Matrix.Columns[3].XYZ, C01));
-    Result.Columns[3] = HMM_V4V(HMM_SubV3(HMM_Cross(B10, Matrix.Columns[2].XYZ), HMM_MulV3F(C01, Matrix.Columns[2].W)), +HMM_DotV3(Matrix.Columns[2].XYZ, C01));
+    return Result;
+}
 
-    return HMM_TransposeM4(Result);
+COVERAGE(HMM_UnpackQ48, 1)
+static inline HMM_Quat HMM_UnpackQ48(HMM_PackedQuat48 P)
+{
+    ASSERT_COVERED(HMM_UnpackQ48);
+
+    const float Step = 1.41421356f / 32767.0f;
+    return _HMM_SmallestThreeQ(((P.Bits[0] >> 14) & 2) | (P.Bits[1] >> 15),
+                               (float)(P.Bits[0] & 32767) * Step - 0.70710678f,
+                               (float)(P.Bits[1] & 32767) * Step - 0.70710678f,
+                               (float)(P.Bits[2] & 32767) * Step - 0.70710678f);
+}
+
+COVERAGE(HMM_UnpackQ48Array, 1)
+// Unpacks Count quaternions, giving the same results as HMM_UnpackQ48 up to the last bit.
+static inline void HMM_UnpackQ48Array(const HMM_PackedQuat48 *In, HMM_Quat *Out, int Count)
+{
+    ASSERT_COVERED(HMM_UnpackQ48Array);
+
+    int Index = 0;
+#ifdef HANDMADE_MATH__USE_SSE2
+    __m128i Zero = _mm_setzero_si128();
+    __m128i Mask = _mm_set1_epi32(32767);
+    __m128 Step = _mm_set1_ps(1.41421356f / 32767.0f);
+    __m128 Offset = _mm_set1_ps(-0.70710678f);
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        /* NOTE: Four packed quaternions are 24 bytes. The words are widened to 32 bits and then
+           separated like the floats of four HMM_Vec3s. */
+        const __m128i *Source = (const __m128i *)&In[Index];
+        __m128i Words0 = _mm_loadu_si128(Source);
+        __m128i Words1 = _mm_loadl_epi64(Source + 1);
+        __m128 First, Second, Third;
+        _HMM_DeinterleaveV3SSE(_mm_castsi128_ps(_mm_unpacklo_epi16(Words0, Zero)),
+                               _mm_castsi128_ps(_mm_unpackhi_epi16(Words0, Zero)),
+                               _mm_castsi128_ps(_mm_unpacklo_epi16(Words1, Zero)), &First, &Second, &Third);
+
+        __m128i W0 = _mm_castps_si128(First);
+        __m128i W1 = _mm_castps_si128(Second);
+        __m128i W2 = _mm_castps_si128(Third);
+        __m128i Largest = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(W0, 14), _mm_set1_epi32(2)), _mm_srli_epi32(W1, 15));
+        __m128 A = _HMM_MADD_PS(_mm_cvtepi32_ps(_mm_and_si128(W0, Mask)), Step, Offset);
+        __m128 B = _HMM_MADD_PS(_mm_cvtepi32_ps(_mm_and_si128(W1, Mask)), Step, Offset);
+        __m128 C = _HMM_MADD_PS(_mm_cvtepi32_ps(_mm_and_si128(W2, Mask)), Step, Offset);
+        _HMM_SmallestThreeQSSE(Largest, A, B, C, &Out[Index]);
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    uint32x4_t Mask = vdupq_n_u32(32767);
+    float32x4_t Step = vdupq_n_f32(1.41421356f / 32767.0f);
+    float32x4_t Offset = vdupq_n_f32(-0.70710678f);
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        uint16x4x3_t Words = vld3_u16(&In[Index].Bits[0]);
+        uint32x4_t W0 = vmovl_u16(Words.val[0]);
+        uint32x4_t W1 = vmovl_u16(Words.val[1]);
+        uint32x4_t W2 = vmovl_u16(Words.val[2]);
+        uint32x4_t Largest = vorrq_u32(vandq_u32(vshrq_n_u32(W0, 14), vdupq_n_u32(2)), vshrq_n_u32(W1, 15));
+        float32x4_t A = vfmaq_f32(Offset, vcvtq_f32_u32(vandq_u32(W0, Mask)), Step);
+        float32x4_t B = vfmaq_f32(Offset, vcvtq_f32_u32(vandq_u32(W1, Mask)), Step);
+        float32x4_t C = vfmaq_f32(Offset, vcvtq_f32_u32(vandq_u32(W2, Mask)), Step);
+        _HMM_SmallestThreeQNEON(Largest, A, B, C, &Out[Index]);
+    }
+#endif
+
+    for (; Index < Count; ++Index)
+    {
+        Out[Index] = HMM_UnpackQ48(In[Index]);
+    }
+}
+
+/* Converts a float to half precision, rounding to nearest even. Floats too large for a half become
+   infinity. (From Fabian Giesen's float_to_half_fast3_rtne.) */
+static inline unsigned short _HMM_FloatToHalf(float Float)
+{
+    _HMM_FloatBits Bits, DenormMagic;
+    Bits.F = Float;
+    DenormMagic.U = ((127 - 15) + (23 - 10) + 1) << 23;
+
+    unsigned int Sign = Bits.U & 0x80000000u;
+    unsigned int Result;
+    Bits.U ^= Sign;
+    if (Bits.U >= (127u + 16u) << 23)
+    {
+        /* Infinity or NaN */
+        Result = (Bits.U > (255u << 23)) ? 0x7e00 : 0x7c00;
+    }
+    else if (Bits.U < (113u << 23))
+    {
+        /* Denormal or zero. The addition shifts the mantissa into place and rounds it. */
+        Bits.F += DenormMagic.F;
+        Result = Bits.U - DenormMagic.U;
+    }
+    else
+    {
+        /* Rebias the exponent and round the mantissa to nearest even */
+        unsigned int MantissaOdd = (Bits.U >> 13) & 1;
+        Bits.U += ((unsigned int)(15 - 127) << 23) + 0xfff + MantissaOdd;
+        Result = Bits.U >> 13;
+    }
+
+    return (unsigned short)(Result | (Sign >> 16));
+}
+
+// Converts a half to a float. This is exact, including for denormals, infinities and NaNs.
+static inline float _HMM_HalfToFloat(unsigned short Half)
+{
+    _HMM_FloatBits Result, Magic;
+    Magic.U = (254 - 15) << 23;
+
+    /* NOTE: Multiplying by the magic number rebiases the exponent, and normalizes denormals. */
+    unsigned int ExponentMantissa = Half & 0x7fffu;
+    Result.U = ExponentMantissa << 13;
+    Result.F *= Magic.F;
+    if (ExponentMantissa > 0x7bff)
+    {
+        Result.U |= 255u << 23;
+    }
+    Result.U |= (unsigned int)(Half & 0x8000u) << 16;
+
+    return Result.F;
+}
+
+#ifdef HANDMADE_MATH__USE_SSE2
+// Converts four halves, in the low 16 bits of each lane, to floats like _HMM_HalfToFloat.
+static inline __m128 _HMM_HalfToFloatSSE(__m128i Halves)
+{
+    __m128i ExponentMantissa = _mm_and_si128(Halves, _mm_set1_epi32(0x7fff));
+    __m128i Sign = _mm_slli_epi32(_mm_xor_si128(Halves, ExponentMantissa), 16);
+    __m128 Result = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(ExponentMantissa, 13)),
+                               _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+    __m128i InfNaN = _mm_and_si128(_mm_cmpgt_epi32(ExponentMantissa, _mm_set1_epi32(0x7bff)), _mm_set1_epi32(255 << 23));
+    return _mm_or_ps(Result, _mm_castsi128_ps(_mm_or_si128(Sign, InfNaN)));
+}
+#endif
+
+COVERAGE(HMM_PackHalfV3, 1)
+// Packs a vector into half precision floats, rounding to nearest even.
+static inline HMM_HalfVec3 HMM_PackHalfV3(HMM_Vec3 V)
+{
+    ASSERT_COVERED(HMM_PackHalfV3);
+
+    HMM_HalfVec3 Result;
+    Result.Elements[0] = _HMM_FloatToHalf(V.X);
+    Result.Elements[1] = _HMM_FloatToHalf(V.Y);
+    Result.Elements[2] = _HMM_FloatToHalf(V.Z);
+    return Result;
+}
+
+COVERAGE(HMM_UnpackHalfV3, 1)
+static inline HMM_Vec3 HMM_UnpackHalfV3(HMM_HalfVec3 P)
+{
+    ASSERT_COVERED(HMM_UnpackHalfV3);
+
+    HMM_Vec3 Result;
+    Result.X = _HMM_HalfToFloat(P.Elements[0]);
+    Result.Y = _HMM_HalfToFloat(P.Elements[1]);
+    Result.Z = _HMM_HalfToFloat(P.Elements[2]);
+    return Result;
+}
+
+COVERAGE(HMM_UnpackHalfV3Array, 1)
+// Unpacks Count vectors, giving the same results as HMM_UnpackHalfV3.
+static inline void HMM_UnpackHalfV3Array(const HMM_HalfVec3 *In, HMM_Vec3 *Out, int Count)
+{
+    ASSERT_COVERED(HMM_UnpackHalfV3Array);
+
+    /* NOTE: Every component is converted the same way, so the vectors are treated as one flat
+       array of halves. */
+    const unsigned short *Source = (const unsigned short *)In;
+    float *Dest = (float *)Out;
+    int Total = Count * 3;
+
+    int Index = 0;
+#ifdef HANDMADE_MATH__USE_SSE2
+    __m128i Zero = _mm_setzero_si128();
+    for (; Index + 8 <= Total; Index += 8)
+    {
+        __m128i Halves = _mm_loadu_si128((const __m128i *)&Source[Index]);
+        _mm_storeu_ps(&Dest[Index], _HMM_HalfToFloatSSE(_mm_unpacklo_epi16(Halves, Zero)));
+        _mm_storeu_ps(&Dest[Index + 4], _HMM_HalfToFloatSSE(_mm_unpackhi_epi16(Halves, Zero)));
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    for (; Index + 8 <= Total; Index += 8)
+    {
+        uint16x8_t Halves = vld1q_u16(&Source[Index]);
+        vst1q_f32(&Dest[Index], vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(Halves))));
+        vst1q_f32(&Dest[Index + 4], vcvt_f32_f16(vreinterpret_f16_u16(vget_high_u16(Halves))));
+    }
+#endif
+
+    for (; Index < Total; ++Index)
+    {
+        Dest[Index] = _HMM_HalfToFloat(Source[Index]);
+    }
+}
+
+// Returns the size of one step of HMM_FixedVec3 for the box from Min to Max.
+static inline HMM_Vec3 _HMM_FixedStepV3(HMM_Vec3 Min, HMM_Vec3 Max)
+{
+    HMM_Vec3 Result;
+    Result.X = (Max.X - Min.X) * (1.0f / 65535.0f);
+    Result.Y = (Max.Y - Min.Y) * (1.0f / 65535.0f);
+    Result.Z = (Max.Z - Min.Z) * (1.0f / 65535.0f);
+    return Result;
+}
+
+COVERAGE(HMM_PackFixedV3, 1)
+// Packs a vector inside the box from Min to Max, rounding each component to the nearest of 65536
+// evenly spaced values. Components outside the box are clamped to it. Max must be greater than Min.
+static inline HMM_FixedVec3 HMM_PackFixedV3(HMM_Vec3 V, HMM_Vec3 Min, HMM_Vec3 Max)
+{
+    ASSERT_COVERED(HMM_PackFixedV3);
+
+    HMM_FixedVec3 Result;
+    for (int Index = 0; Index < 3; ++Index)
+    {
+        float Unit = (V.Elements[Index] - Min.Elements[Index]) / (Max.Elements[Index] - Min.Elements[Index]);
+        Result.Elements[Index] = (unsigned short)(HMM_Clamp(0.0f, Unit, 1.0f) * 65535.0f + 0.5f);
+    }
+
+    return Result;
+}
+
+COVERAGE(HMM_UnpackFixedV3, 1)
+static inline HMM_Vec3 HMM_UnpackFixedV3(HMM_FixedVec3 P, HMM_Vec3 Min, HMM_Vec3 Max)
+{
+    ASSERT_COVERED(HMM_UnpackFixedV3);
+
+    HMM_Vec3 Step = _HMM_FixedStepV3(Min, Max);
+    HMM_Vec3 Result;
+    Result.X = (float)P.Elements[0] * Step.X + Min.X;
+    Result.Y = (float)P.Elements[1] * Step.Y + Min.Y;
+    Result.Z = (float)P.Elements[2] * Step.Z + Min.Z;
+    return Result;
+}
+
+COVERAGE(HMM_UnpackFixedV3Array, 1)
+// Unpacks Count vectors that were all packed with the same box, giving the same results as
+// HMM_UnpackFixedV3 up to the last bit.
+static inline void HMM_UnpackFixedV3Array(const HMM_FixedVec3 *In, HMM_Vec3 Min, HMM_Vec3 Max, HMM_Vec3 *Out, int Count)
+{
+    ASSERT_COVERED(HMM_UnpackFixedV3Array);
+
+    int Index = 0;
+#ifdef HANDMADE_MATH__USE_SSE2
+    HMM_Vec3 Step = _HMM_FixedStepV3(Min, Max);
+
+    /* NOTE: Four vectors are 12 components in a row, so instead of separating them, each group of four
+       components is scaled by the steps and offsets of the components it holds. */
+    __m128i Zero = _mm_setzero_si128();
+    __m128 Step0 = _mm_setr_ps(Step.X, Step.Y, Step.Z, Step.X);
+    __m128 Step1 = _mm_setr_ps(Step.Y, Step.Z, Step.X, Step.Y);
+    __m128 Step2 = _mm_setr_ps(Step.Z, Step.X, Step.Y, Step.Z);
+    __m128 Min0 = _mm_setr_ps(Min.X, Min.Y, Min.Z, Min.X);
+    __m128 Min1 = _mm_setr_ps(Min.Y, Min.Z, Min.X, Min.Y);
+    __m128 Min2 = _mm_setr_ps(Min.Z, Min.X, Min.Y, Min.Z);
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        const __m128i *Source = (const __m128i *)&In[Index];
+        __m128i Words0 = _mm_loadu_si128(Source);
+        __m128i Words1 = _mm_loadl_epi64(Source + 1);
+
+        float *Dest = &Out[Index].Elements[0];
+        _mm_storeu_ps(Dest + 0, _HMM_MADD_PS(_mm_cvtepi32_ps(_mm_unpacklo_epi16(Words0, Zero)), Step0, Min0));
+        _mm_storeu_ps(Dest + 4, _HMM_MADD_PS(_mm_cvtepi32_ps(_mm_unpackhi_epi16(Words0, Zero)), Step1, Min1));
+        _mm_storeu_ps(Dest + 8, _HMM_MADD_PS(_mm_cvtepi32_ps(_mm_unpacklo_epi16(Words1, Zero)), Step2, Min2));
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    HMM_Vec3 Step = _HMM_FixedStepV3(Min, Max);
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        uint16x4x3_t Words = vld3_u16(&In[Index].Elements[0]);
+        float32x4x3_t Result;
+        Result.val[0] = vfmaq_n_f32(vdupq_n_f32(Min.X), vcvtq_f32_u32(vmovl_u16(Words.val[0])), Step.X);
+        Result.val[1] = vfmaq_n_f32(vdupq_n_f32(Min.Y), vcvtq_f32_u32(vmovl_u16(Words.val[1])), Step.Y);
+        Result.val[2] = vfmaq_n_f32(vdupq_n_f32(Min.Z), vcvtq_f32_u32(vmovl_u16(Words.val[2])), Step.Z);
+        vst3q_f32(&Out[Index].Elements[0], Result);
+    }
+#endif
+
+    for (; Index < Count; ++Index)
+    {
+        Out[Index] = HMM_UnpackFixedV3(In[Index], Min, Max);
+    }
+}
+
+// Rounds a value in [-1, 1] to a signed 16-bit integer in [-32767, 32767].
+static inline short _HMM_QuantizeSignedF(float Value)
+{
+    float Scaled = HMM_Clamp(-1.0f, Value, 1.0f) * 32767.0f;
+    return (short)(Scaled + ((Scaled < 0.0f) ? -0.5f : 0.5f));
+}
+
+COVERAGE(HMM_PackOctV3, 1)
+// Packs a unit vector into 32 bits. The vector is projected onto the octahedron |X| + |Y| + |Z| = 1,
+// whose lower half is folded out over the corners of the square below the upper half.
+static inline HMM_OctVec3 HMM_PackOctV3(HMM_Vec3 V)
+{
+    ASSERT_COVERED(HMM_PackOctV3);
+
+    float Scale = 1.0f / (HMM_ABS(V.X) + HMM_ABS(V.Y) + HMM_ABS(V.Z));
+    float X = V.X * Scale;
+    float Y = V.Y * Scale;
+    if (V.Z < 0.0f)
+    {
+        float FoldedX = (1.0f - HMM_ABS(Y)) * ((X >= 0.0f) ? 1.0f : -1.0f);
+        Y = (1.0f - HMM_ABS(X)) * ((Y >= 0.0f) ? 1.0f : -1.0f);
+        X = FoldedX;
+    }
+
+    HMM_OctVec3 Result;
+    Result.X = _HMM_QuantizeSignedF(X);
+    Result.Y = _HMM_QuantizeSignedF(Y);
+    return Result;
+}
+
+COVERAGE(HMM_UnpackOctV3, 1)
+static inline HMM_Vec3 HMM_UnpackOctV3(HMM_OctVec3 P)
+{
+    ASSERT_COVERED(HMM_UnpackOctV3);
+
+    float X = (float)P.X * (1.0f / 32767.0f);
+    float Y = (float)P.Y * (1.0f / 32767.0f);
+    float Z = 1.0f - HMM_ABS(X) - HMM_ABS(Y);
+
+    /* NOTE: Unfolds the lower half. In the upper half (Z >= 0), Fold is zero. */
+    float Fold = HMM_MAX(-Z, 0.0f);
+    X -= (X >= 0.0f) ? Fold : -Fold;
+    Y -= (Y >= 0.0f) ? Fold : -Fold;
+
+    return HMM_NormV3(HMM_V3(X, Y, Z));
+}
+
+COVERAGE(HMM_UnpackOctV3Array, 1)
+// Unpacks Count vectors, giving the same results as HMM_UnpackOctV3 up to the last bit.
+static inline void HMM_UnpackOctV3Array(const HMM_OctVec3 *In, HMM_Vec3 *Out, int Count)
+{
+    ASSERT_COVERED(HMM_UnpackOctV3Array);
+
+    int Index = 0;
+#ifdef HANDMADE_MATH__USE_SSE2
+    __m128 Step = _mm_set1_ps(1.0f / 32767.0f);
+    __m128 SignBit = _mm_set1_ps(-0.0f);
+    __m128 One = _mm_set1_ps(1.0f);
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        __m128i Words = _mm_loadu_si128((const __m128i *)&In[Index]);
+        __m128 X = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Words, 16), 16)), Step);
+        __m128 Y = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(Words, 16)), Step);
+        __m128 Z = _mm_sub_ps(_mm_sub_ps(One, _mm_andnot_ps(SignBit, X)), _mm_andnot_ps(SignBit, Y));
+
+        __m128 Fold = _mm_max_ps(_mm_xor_ps(Z, SignBit), _mm_setzero_ps());
+        X = _mm_sub_ps(X, _mm_or_ps(Fold, _mm_and_ps(SignBit, X)));
+        Y = _mm_sub_ps(Y, _mm_or_ps(Fold, _mm_and_ps(SignBit, Y)));
+
+        __m128 LengthSquared = _HMM_MADD_PS(Z, Z, _HMM_MADD_PS(Y, Y, _mm_mul_ps(X, X)));
+        __m128 InvLength = _mm_div_ps(One, _mm_sqrt_ps(LengthSquared));
+        _HMM_StoreV3x4SSE(&Out[Index].Elements[0], _mm_mul_ps(X, InvLength), _mm_mul_ps(Y, InvLength), _mm_mul_ps(Z, InvLength));
+    }
+#elif defined(HANDMADE_MATH__USE_NEON)
+    uint32x4_t SignBit = vdupq_n_u32(0x80000000u);
+    float32x4_t One = vdupq_n_f32(1.0f);
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        int16x4x2_t Words = vld2_s16(&In[Index].X);
+        float32x4_t X = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(Words.val[0])), 1.0f / 32767.0f);
+        float32x4_t Y = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(Words.val[1])), 1.0f / 32767.0f);
+        float32x4_t Z = vsubq_f32(vsubq_f32(One, vabsq_f32(X)), vabsq_f32(Y));
+
+        float32x4_t Fold = vmaxq_f32(vnegq_f32(Z), vdupq_n_f32(0.0f));
+        X = vsubq_f32(X, vbslq_f32(SignBit, X, Fold));
+        Y = vsubq_f32(Y, vbslq_f32(SignBit, Y, Fold));
+
+        float32x4_t LengthSquared = vfmaq_f32(vfmaq_f32(vmulq_f32(X, X), Y, Y), Z, Z);
+        float32x4_t InvLength = vdivq_f32(One, vsqrtq_f32(LengthSquared));
+        float32x4x3_t Result;
+        Result.val[0] = vmulq_f32(X, InvLength);
+        Result.val[1] = vmulq_f32(Y, InvLength);
+        Result.val[2] = vmulq_f32(Z, InvLength);
+        vst3q_f32(&Out[Index].Elements[0], Result);
+    }
+#endif
+
+    for (; Index < Count; ++Index)
+    {
+        Out[Index] = HMM_UnpackOctV3(In[Index]);
+    }
 }
 
 /*
- * Common graphics transformations
+ * Double precision
+ *
+ * These mirror the float vector, matrix and quaternion functions for the
+ * HMM_DVec3, HMM_DVec4, HMM_DMat4 and HMM_DQuat types. As elsewhere, an "F"
+ * suffix means a scalar argument, which is a double here. A large world can
+ * keep its positions in double, subtract the camera position, and convert
+ * the (now small) result to float for rendering with HMM_DV3ToV3 or
+ * HMM_DM4ToM4. HMM_DVec3 is scalar; the four-wide types use two SSE2 or
+ * NEON registers, or one AVX register.
  */
 
-COVERAGE(HMM_Orthographic_RH_NO, 1)
-// Produces a right-handed orthographic projection matrix with Z ranging from -1 to 1 (the GL convention).
-// Left, Right, Bottom, and Top specify the coordinates of their respective clipping planes.
-// Near and Far specify the distances to the near and far clipping planes.
-static inline HMM_Mat4 HMM_Orthographic_RH_NO(float Left, float Right, float Bottom, float Top, float Near, float Far)
+#ifdef HANDMADE_MATH__USE_AVX
+/* NOTE: The AVX paths build their registers from the two SSE halves of each value. Structs passed by
+   value are often copied in 16-byte pieces, which a 32-byte load can't forward from. */
+static inline __m256d _HMM_CombinePD(__m128d Low, __m128d High)
 {
-    ASSERT_COVERED(HMM_Orthographic_RH_NO);
+    return _mm256_insertf128_pd(_mm256_castpd128_pd256(Low), High, 1);
+}
+#endif
 
-    HMM_Mat4 Result = {0};
+static inline double _HMM_ToRadD(double Angle)
+{
+#if defined(HANDMADE_MATH_USE_RADIANS)
+    double Result = Angle;
+#elif defined(HANDMADE_MATH_USE_DEGREES)
+    double Result = Angle * (HMM_PI / HMM_DEG180);
+#elif defined(HANDMADE_MATH_USE_TURNS)
+    double Result = Angle * (HMM_PI / HMM_TURNHALF);
+#endif
 
-    Result.Elements[0][0] = 2.0f / (Right - Left);
-    Result.Elements[1][1] = 2.0f / (Top - Bottom);
-    Result.Elements[2][2] = 2.0f / (Near - Far);
-    Result.Elements[3][3] = 1.0f;
+    return Result;
+}
+
+COVERAGE(HMM_SqrtD, 1)
+static inline double HMM_SqrtD(double Value)
+{
+    ASSERT_COVERED(HMM_SqrtD);
+
+    double Result;
+
+#ifdef HANDMADE_MATH__USE_SSE2
+    __m128d In = _mm_set_sd(Value);
+    __m128d Out = _mm_sqrt_sd(In, In);
+    Result = _mm_cvtsd_f64(Out);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float64x2_t In = vdupq_n_f64(Value);
+    float64x2_t Out = vsqrtq_f64(In);
+    Result = vgetq_lane_f64(Out, 0);
+#else
+    Result = HMM_SQRT(Value);
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_DV3, 1)
+static inline HMM_DVec3 HMM_DV3(double X, double Y, double Z)
+{
+    ASSERT_COVERED(HMM_DV3);
+
+    HMM_DVec3 Result;
+    Result.X = X;
+    Result.Y = Y;
+    Result.Z = Z;
+
+    return Result;
+}
+
+COVERAGE(HMM_AddDV3, 1)
+static inline HMM_DVec3 HMM_AddDV3(HMM_DVec3 Left, HMM_DVec3 Right)
+{
+    ASSERT_COVERED(HMM_AddDV3);
+
+    HMM_DVec3 Result;
+    Result.X = Left.X + Right.X;
+    Result.Y = Left.Y + Right.Y;
+    Result.Z = Left.Z + Right.Z;
+
+    return Result;
+}
+
+COVERAGE(HMM_SubDV3, 1)
+static inline HMM_DVec3 HMM_SubDV3(HMM_DVec3 Left, HMM_DVec3 Right)
+{
+    ASSERT_COVERED(HMM_SubDV3);
+
+    HMM_DVec3 Result;
+    Result.X = Left.X - Right.X;
+    Result.Y = Left.Y - Right.Y;
+    Result.Z = Left.Z - Right.Z;
+
+    return Result;
+}
+
+COVERAGE(HMM_MulDV3, 1)
+static inline HMM_DVec3 HMM_MulDV3(HMM_DVec3 Left, HMM_DVec3 Right)
+{
+    ASSERT_COVERED(HMM_MulDV3);
+
+    HMM_DVec3 Result;
+    Result.X = Left.X * Right.X;
+    Result.Y = Left.Y * Right.Y;
+    Result.Z = Left.Z * Right.Z;
+
+    return Result;
+}
+
+COVERAGE(HMM_MulDV3F, 1)
+static inline HMM_DVec3 HMM_MulDV3F(HMM_DVec3 Left, double Right)
+{
+    ASSERT_COVERED(HMM_MulDV3F);
+
+    HMM_DVec3 Result;
+    Result.X = Left.X * Right;
+    Result.Y = Left.Y * Right;
+    Result.Z = Left.Z * Right;
+
+    return Result;
+}
+
+COVERAGE(HMM_DivDV3F, 1)
+static inline HMM_DVec3 HMM_DivDV3F(HMM_DVec3 Left, double Right)
+{
+    ASSERT_COVERED(HMM_DivDV3F);
 
-    Result.Elements[3][0] = (Left + Right) / (Left - Right);
-    Result.Elements[3][1] = (Bottom + Top) / (Bottom - Top);
-    Result.Elements[3][2] = (Near + Far) / (Near - Far);
+    HMM_DVec3 Result;
+    Result.X = Left.X / Right;
+    Result.Y = Left.Y / Right;
+    Result.Z = Left.Z / Right;
 
     return Result;
 }
 
-COVERAGE(HMM_Orthographic_RH_ZO, 1)
-// Produces a right-handed orthographic projection matrix with Z ranging from 0 to 1 (the DirectX convention).
-// Left, Right, Bottom, and Top specify the coordinates of their respective clipping planes.
-// Near and Far specify the distances to the near and far clipping planes.
-static inline HMM_Mat4 HMM_Orthographic_RH_ZO(float Left, float Right, float Bottom, float Top, float Near, float Far)
+COVERAGE(HMM_DotDV3, 1)
+static inline double HMM_DotDV3(HMM_DVec3 Left, HMM_DVec3 Right)
 {
-    ASSERT_COVERED(HMM_Orthographic_RH_ZO);
+    ASSERT_COVERED(HMM_DotDV3);
 
-    HMM_Mat4 Result = {0};
+    return (Left.X * Right.X) + (Left.Y * Right.Y) + (Left.Z * Right.Z);
+}
 
-    Result.Elements[0][0] = 2.0f / (Right - Left);
-    Result.Elements[1][1] = 2.0f / (Top - Bottom);
-    Result.Elements[2][2] = 1.0f / (Near - Far);
-    Result.Elements[3][3] = 1.0f;
+COVERAGE(HMM_CrossDV3, 1)
+static inline HMM_DVec3 HMM_CrossDV3(HMM_DVec3 Left, HMM_DVec3 Right)
+{
+    ASSERT_COVERED(HMM_CrossDV3);
 
-    Result.Elements[3][0] = (Left + Right) / (Left - Right);
-    Result.Elements[3][1] = (Bottom + Top) / (Bottom - Top);
-    Result.Elements[3][2] = (Near) / (Near - Far);
+    HMM_DVec3 Result;
+    Result.X = (Left.Y * Right.Z) - (Left.Z * Right.Y);
+    Result.Y = (Left.Z * Right.X) - (Left.X * Right.Z);
+    Result.Z = (Left.X * Right.Y) - (Left.Y * Right.X);
 
     return Result;
 }
 
-COVERAGE(HMM_Orthographic_LH_NO, 1)
-// Produces a left-handed orthographic projection matrix with Z ranging from -1 to 1 (the GL convention).
-// Left, Right, Bottom, and Top specify the coordinates of their respective clipping planes.
-// Near and Far specify the distances to the near and far clipping planes.
-static inline HMM_Mat4 HMM_Orthographic_LH_NO(float Left, float Right, float Bottom, float Top, float Near, float Far)
+COVERAGE(HMM_LenSqrDV3, 1)
+static inline double HMM_LenSqrDV3(HMM_DVec3 A)
 {
-    ASSERT_COVERED(HMM_Orthographic_LH_NO);
+    ASSERT_COVERED(HMM_LenSqrDV3);
 
-    HMM_Mat4 Result = HMM_Orthographic_RH_NO(Left, Right, Bottom, Top, Near, Far);
-    Result.Elements[2][2] = -Result.Elements[2][2];
+    return HMM_DotDV3(A, A);
+}
 
-    return Result;
+COVERAGE(HMM_LenDV3, 1)
+static inline double HMM_LenDV3(HMM_DVec3 A)
+{
+    ASSERT_COVERED(HMM_LenDV3);
+
+    return HMM_SqrtD(HMM_LenSqrDV3(A));
 }
 
-COVERAGE(HMM_Orthographic_LH_ZO, 1)
-// Produces a left-handed orthographic projection matrix with Z ranging from 0 to 1 (the DirectX convention).
-// Left, Right, Bottom, and Top specify the coordinates of their respective clipping planes.
-// Near and Far specify the distances to the near and far clipping planes.
-static inline HMM_Mat4 HMM_Orthographic_LH_ZO(float Left, float Right, float Bottom, float Top, float Near, float Far)
+COVERAGE(HMM_NormDV3, 1)
+static inline HMM_DVec3 HMM_NormDV3(HMM_DVec3 A)
 {
-    ASSERT_COVERED(HMM_Orthographic_LH_ZO);
+    ASSERT_COVERED(HMM_NormDV3);
 
-    HMM_Mat4 Result = HMM_Orthographic_RH_ZO(Left, Right, Bottom, Top, Near, Far);
-    Result.Elements[2][2] = -Result.Elements[2][2];
+    return HMM_MulDV3F(A, 1.0 / HMM_LenDV3(A));
+}
 
-    return Result;
+COVERAGE(HMM_LerpDV3, 1)
+static inline HMM_DVec3 HMM_LerpDV3(HMM_DVec3 A, double Time, HMM_DVec3 B)
+{
+    ASSERT_COVERED(HMM_LerpDV3);
+
+    return HMM_AddDV3(HMM_MulDV3F(A, 1.0 - Time), HMM_MulDV3F(B, Time));
 }
 
-COVERAGE(HMM_InvOrthographic, 1)
-// Returns an inverse for the given orthographic projection matrix. Works for all orthographic
-// projection matrices, regardless of handedness or NDC convention.
-static inline HMM_Mat4 HMM_InvOrthographic(HMM_Mat4 OrthoMatrix)
+COVERAGE(HMM_DV4, 1)
+static inline HMM_DVec4 HMM_DV4(double X, double Y, double Z, double W)
 {
-    ASSERT_COVERED(HMM_InvOrthographic);
+    ASSERT_COVERED(HMM_DV4);
 
-    HMM_Mat4 Result = {0};
-    Result.Elements[0][0] = 1.0f / OrthoMatrix.Elements[0][0];
-    Result.Elements[1][1] = 1.0f / OrthoMatrix.Elements[1][1];
-    Result.Elements[2][2] = 1.0f / OrthoMatrix.Elements[2][2];
-    Result.Elements[3][3] = 1.0f;
+    HMM_DVec4 Result;
 
-    Result.Elements[3][0] = -OrthoMatrix.Elements[3][0] * Result.Elements[0][0];
-    Result.Elements[3][1] = -OrthoMatrix.Elements[3][1] * Result.Elements[1][1];
-    Result.Elements[3][2] = -OrthoMatrix.Elements[3][2] * Result.Elements[2][2];
+#ifdef HANDMADE_MATH__USE_AVX
+    _mm256_storeu_pd(Result.Elements, _mm256_setr_pd(X, Y, Z, W));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    Result.SSE[0] = _mm_setr_pd(X, Y);
+    Result.SSE[1] = _mm_setr_pd(Z, W);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON[0] = vsetq_lane_f64(Y, vdupq_n_f64(X), 1);
+    Result.NEON[1] = vsetq_lane_f64(W, vdupq_n_f64(Z), 1);
+#else
+    Result.X = X;
+    Result.Y = Y;
+    Result.Z = Z;
+    Result.W = W;
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_Perspective_RH_NO, 1)
-static inline HMM_Mat4 HMM_Perspective_RH_NO(float FOV, float AspectRatio, float Near, float Far)
+COVERAGE(HMM_DV4V, 1)
+static inline HMM_DVec4 HMM_DV4V(HMM_DVec3 Vector, double W)
 {
-    ASSERT_COVERED(HMM_Perspective_RH_NO);
+    ASSERT_COVERED(HMM_DV4V);
 
-    HMM_Mat4 Result = {0};
+    return HMM_DV4(Vector.X, Vector.Y, Vector.Z, W);
+}
 
-    // See https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/gluPerspective.xml
+COVERAGE(HMM_AddDV4, 1)
+static inline HMM_DVec4 HMM_AddDV4(HMM_DVec4 Left, HMM_DVec4 Right)
+{
+    ASSERT_COVERED(HMM_AddDV4);
 
-    float Cotangent = 1.0f / HMM_TanF(FOV / 2.0f);
-    Result.Elements[0][0] = Cotangent / AspectRatio;
-    Result.Elements[1][1] = Cotangent;
-    Result.Elements[2][3] = -1.0f;
+    HMM_DVec4 Result;
 
-    Result.Elements[2][2] = (Near + Far) / (Near - Far);
-    Result.Elements[3][2] = (2.0f * Near * Far) / (Near - Far);
+#ifdef HANDMADE_MATH__USE_AVX
+    _mm256_storeu_pd(Result.Elements, _mm256_add_pd(_HMM_CombinePD(Left.SSE[0], Left.SSE[1]), _HMM_CombinePD(Right.SSE[0], Right.SSE[1])));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    Result.SSE[0] = _mm_add_pd(Left.SSE[0], Right.SSE[0]);
+    Result.SSE[1] = _mm_add_pd(Left.SSE[1], Right.SSE[1]);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON[0] = vaddq_f64(Left.NEON[0], Right.NEON[0]);
+    Result.NEON[1] = vaddq_f64(Left.NEON[1], Right.NEON[1]);
+#else
+    Result.X = Left.X + Right.X;
+    Result.Y = Left.Y + Right.Y;
+    Result.Z = Left.Z + Right.Z;
+    Result.W = Left.W + Right.W;
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_Perspective_RH_ZO, 1)
-static inline HMM_Mat4 HMM_Perspective_RH_ZO(float FOV, float AspectRatio, float Near, float Far)
+COVERAGE(HMM_SubDV4, 1)
+static inline HMM_DVec4 HMM_SubDV4(HMM_DVec4 Left, HMM_DVec4 Right)
 {
-    ASSERT_COVERED(HMM_Perspective_RH_ZO);
-
-    HMM_Mat4 Result = {0};
-
-    // See https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/gluPerspective.xml
+    ASSERT_COVERED(HMM_SubDV4);
 
-    float Cotangent = 1.0f / HMM_TanF(FOV / 2.0f);
-    Result.Elements[0][0] = Cotangent / AspectRatio;
-    Result.Elements[1][1] = Cotangent;
-    Result.Elements[2][3] = -1.0f;
+    HMM_DVec4 Result;
 
-    Result.Elements[2][2] = (Far) / (Near - Far);
-    Result.Elements[3][2] = (Near * Far) / (Near - Far);
+#ifdef HANDMADE_MATH__USE_AVX
+    _mm256_storeu_pd(Result.Elements, _mm256_sub_pd(_HMM_CombinePD(Left.SSE[0], Left.SSE[1]), _HMM_CombinePD(Right.SSE[0], Right.SSE[1])));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    Result.SSE[0] = _mm_sub_pd(Left.SSE[0], Right.SSE[0]);
+    Result.SSE[1] = _mm_sub_pd(Left.SSE[1], Right.SSE[1]);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON[0] = vsubq_f64(Left.NEON[0], Right.NEON[0]);
+    Result.NEON[1] = vsubq_f64(Left.NEON[1], Right.NEON[1]);
+#else
+    Result.X = Left.X - Right.X;
+    Result.Y = Left.Y - Right.Y;
+    Result.Z = Left.Z - Right.Z;
+    Result.W = Left.W - Right.W;
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_Perspective_LH_NO, 1)
-static inline HMM_Mat4 HMM_Perspective_LH_NO(float FOV, float AspectRatio, float Near, float Far)
+COVERAGE(HMM_MulDV4, 1)
+static inline HMM_DVec4 HMM_MulDV4(HMM_DVec4 Left, HMM_DVec4 Right)
 {
-    ASSERT_COVERED(HMM_Perspective_LH_NO);
+    ASSERT_COVERED(HMM_MulDV4);
 
-    HMM_Mat4 Result = HMM_Perspective_RH_NO(FOV, AspectRatio, Near, Far);
-    Result.Elements[2][2] = -Result.Elements[2][2];
-    Result.Elements[2][3] = -Result.Elements[2][3];
+    HMM_DVec4 Result;
+
+#ifdef HANDMADE_MATH__USE_AVX
+    _mm256_storeu_pd(Result.Elements, _mm256_mul_pd(_HMM_CombinePD(Left.SSE[0], Left.SSE[1]), _HMM_CombinePD(Right.SSE[0], Right.SSE[1])));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    Result.SSE[0] = _mm_mul_pd(Left.SSE[0], Right.SSE[0]);
+    Result.SSE[1] = _mm_mul_pd(Left.SSE[1], Right.SSE[1]);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON[0] = vmulq_f64(Left.NEON[0], Right.NEON[0]);
+    Result.NEON[1] = vmulq_f64(Left.NEON[1], Right.NEON[1]);
+#else
+    Result.X = Left.X * Right.X;
+    Result.Y = Left.Y * Right.Y;
+    Result.Z = Left.Z * Right.Z;
+    Result.W = Left.W * Right.W;
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_Perspective_LH_ZO, 1)
-static inline HMM_Mat4 HMM_Perspective_LH_ZO(float FOV, float AspectRatio, float Near, float Far)
+COVERAGE(HMM_MulDV4F, 1)
+static inline HMM_DVec4 HMM_MulDV4F(HMM_DVec4 Left, double Right)
 {
-    ASSERT_COVERED(HMM_Perspective_LH_ZO);
+    ASSERT_COVERED(HMM_MulDV4F);
 
-    HMM_Mat4 Result = HMM_Perspective_RH_ZO(FOV, AspectRatio, Near, Far);
-    Result.Elements[2][2] = -Result.Elements[2][2];
-    Result.Elements[2][3] = -Result.Elements[2][3];
+    HMM_DVec4 Result;
+
+#ifdef HANDMADE_MATH__USE_AVX
+    _mm256_storeu_pd(Result.Elements, _mm256_mul_pd(_HMM_CombinePD(Left.SSE[0], Left.SSE[1]), _mm256_set1_pd(Right)));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    __m128d Scalar = _mm_set1_pd(Right);
+    Result.SSE[0] = _mm_mul_pd(Left.SSE[0], Scalar);
+    Result.SSE[1] = _mm_mul_pd(Left.SSE[1], Scalar);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.NEON[0] = vmulq_n_f64(Left.NEON[0], Right);
+    Result.NEON[1] = vmulq_n_f64(Left.NEON[1], Right);
+#else
+    Result.X = Left.X * Right;
+    Result.Y = Left.Y * Right;
+    Result.Z = Left.Z * Right;
+    Result.W = Left.W * Right;
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_InvPerspective_RH, 1)
-static inline HMM_Mat4 HMM_InvPerspective_RH(HMM_Mat4 PerspectiveMatrix)
+COVERAGE(HMM_DivDV4F, 1)
+static inline HMM_DVec4 HMM_DivDV4F(HMM_DVec4 Left, double Right)
 {
-    ASSERT_COVERED(HMM_InvPerspective_RH);
+    ASSERT_COVERED(HMM_DivDV4F);
 
-    HMM_Mat4 Result = {0};
-    Result.Elements[0][0] = 1.0f / PerspectiveMatrix.Elements[0][0];
-    Result.Elements[1][1] = 1.0f / PerspectiveMatrix.Elements[1][1];
-    Result.Elements[2][2] = 0.0f;
+    HMM_DVec4 Result;
 
-    Result.Elements[2][3] = 1.0f / PerspectiveMatrix.Elements[3][2];
-    Result.Elements[3][3] = PerspectiveMatrix.Elements[2][2] * Result.Elements[2][3];
-    Result.Elements[3][2] = PerspectiveMatrix.Elements[2][3];
+#ifdef HANDMADE_MATH__USE_AVX
+    _mm256_storeu_pd(Result.Elements, _mm256_div_pd(_HMM_CombinePD(Left.SSE[0], Left.SSE[1]), _mm256_set1_pd(Right)));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    __m128d Scalar = _mm_set1_pd(Right);
+    Result.SSE[0] = _mm_div_pd(Left.SSE[0], Scalar);
+    Result.SSE[1] = _mm_div_pd(Left.SSE[1], Scalar);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float64x2_t Scalar = vdupq_n_f64(Right);
+    Result.NEON[0] = vdivq_f64(Left.NEON[0], Scalar);
+    Result.NEON[1] = vdivq_f64(Left.NEON[1], Scalar);
+#else
+    Result.X = Left.X / Right;
+    Result.Y = Left.Y / Right;
+    Result.Z = Left.Z / Right;
+    Result.W = Left.W / Right;
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_InvPerspective_LH, 1)
-static inline HMM_Mat4 HMM_InvPerspective_LH(HMM_Mat4 PerspectiveMatrix)
+COVERAGE(HMM_DotDV4, 1)
+static inline double HMM_DotDV4(HMM_DVec4 Left, HMM_DVec4 Right)
 {
-    ASSERT_COVERED(HMM_InvPerspective_LH);
+    ASSERT_COVERED(HMM_DotDV4);
 
-    HMM_Mat4 Result = {0};
-    Result.Elements[0][0] = 1.0f / PerspectiveMatrix.Elements[0][0];
-    Result.Elements[1][1] = 1.0f / PerspectiveMatrix.Elements[1][1];
-    Result.Elements[2][2] = 0.0f;
+    double Result;
 
-    Result.Elements[2][3] = 1.0f / PerspectiveMatrix.Elements[3][2];
-    Result.Elements[3][3] = PerspectiveMatrix.Elements[2][2] * -Result.Elements[2][3];
-    Result.Elements[3][2] = PerspectiveMatrix.Elements[2][3];
+#ifdef HANDMADE_MATH__USE_AVX
+    __m256d Products = _mm256_mul_pd(_HMM_CombinePD(Left.SSE[0], Left.SSE[1]), _HMM_CombinePD(Right.SSE[0], Right.SSE[1]));
+    __m128d Sum = _mm_add_pd(_mm256_castpd256_pd128(Products), _mm256_extractf128_pd(Products, 1));
+    Result = _mm_cvtsd_f64(_mm_add_sd(Sum, _mm_unpackhi_pd(Sum, Sum)));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    __m128d Sum = _mm_add_pd(_mm_mul_pd(Left.SSE[0], Right.SSE[0]), _mm_mul_pd(Left.SSE[1], Right.SSE[1]));
+    Result = _mm_cvtsd_f64(_mm_add_sd(Sum, _mm_unpackhi_pd(Sum, Sum)));
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result = vaddvq_f64(vaddq_f64(vmulq_f64(Left.NEON[0], Right.NEON[0]), vmulq_f64(Left.NEON[1], Right.NEON[1])));
+#else
+    Result = ((Left.X * Right.X) + (Left.Z * Right.Z)) + ((Left.Y * Right.Y) + (Left.W * Right.W));
+#endif
 
     return Result;
 }
 
-COVERAGE(HMM_Translate, 1)
-static inline HMM_Mat4 HMM_Translate(HMM_Vec3 Translation)
+COVERAGE(HMM_DM4D, 1)
+static inline HMM_DMat4 HMM_DM4D(double Diagonal)
 {
-    ASSERT_COVERED(HMM_Translate);
+    ASSERT_COVERED(HMM_DM4D);
 
-    HMM_Mat4 Result = HMM_M4D(1.0f);
-    Result.Elements[3][0] = Translation.X;
-    Result.Elements[3][1] = Translation.Y;
-    Result.Elements[3][2] = Translation.Z;
+    HMM_DMat4 Result = {0};
+    Result.Elements[0][0] = Diagonal;
+    Result.Elements[1][1] = Diagonal;
+    Result.Elements[2][2] = Diagonal;
+    Result.Elements[3][3] = Diagonal;
 
     return Result;
 }
 
-COVERAGE(HMM_InvTranslate, 1)
-static inline HMM_Mat4 HMM_InvTranslate(HMM_Mat4 TranslationMatrix)
+COVERAGE(HMM_TransposeDM4, 1)
+static inline HMM_DMat4 HMM_TransposeDM4(HMM_DMat4 Matrix)
+{
+    ASSERT_COVERED(HMM_TransposeDM4);
+
+    HMM_DMat4 Result;
+
+#ifdef HANDMADE_MATH__USE_AVX
+    __m256d Column0 = _HMM_CombinePD(Matrix.Columns[0].SSE[0], Matrix.Columns[0].SSE[1]);
+    __m256d Column1 = _HMM_CombinePD(Matrix.Columns[1].SSE[0], Matrix.Columns[1].SSE[1]);
+    __m256d Column2 = _HMM_CombinePD(Matrix.Columns[2].SSE[0], Matrix.Columns[2].SSE[1]);
+    __m256d Column3 = _HMM_CombinePD(Matrix.Columns[3].SSE[0], Matrix.Columns[3].SSE[1]);
+    __m256d Even01 = _mm256_unpacklo_pd(Column0, Column1);
+    __m256d Odd01 = _mm256_unpackhi_pd(Column0, Column1);
+    __m256d Even23 = _mm256_unpacklo_pd(Column2, Column3);
+    __m256d Odd23 = _mm256_unpackhi_pd(Column2, Column3);
+    _mm256_storeu_pd(Result.Columns[0].Elements, _mm256_permute2f128_pd(Even01, Even23, 0x20));
+    _mm256_storeu_pd(Result.Columns[1].Elements, _mm256_permute2f128_pd(Odd01, Odd23, 0x20));
+    _mm256_storeu_pd(Result.Columns[2].Elements, _mm256_permute2f128_pd(Even01, Even23, 0x31));
+    _mm256_storeu_pd(Result.Columns[3].Elements, _mm256_permute2f128_pd(Odd01, Odd23, 0x31));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    /* NOTE: Each 2x2 block is transposed on its own, and the off-diagonal blocks swap places. */
+    Result.Columns[0].SSE[0] = _mm_unpacklo_pd(Matrix.Columns[0].SSE[0], Matrix.Columns[1].SSE[0]);
+    Result.Columns[0].SSE[1] = _mm_unpacklo_pd(Matrix.Columns[2].SSE[0], Matrix.Columns[3].SSE[0]);
+    Result.Columns[1].SSE[0] = _mm_unpackhi_pd(Matrix.Columns[0].SSE[0], Matrix.Columns[1].SSE[0]);
+    Result.Columns[1].SSE[1] = _mm_unpackhi_pd(Matrix.Columns[2].SSE[0], Matrix.Columns[3].SSE[0]);
+    Result.Columns[2].SSE[0] = _mm_unpacklo_pd(Matrix.Columns[0].SSE[1], Matrix.Columns[1].SSE[1]);
+    Result.Columns[2].SSE[1] = _mm_unpacklo_pd(Matrix.Columns[2].SSE[1], Matrix.Columns[3].SSE[1]);
+    Result.Columns[3].SSE[0] = _mm_unpackhi_pd(Matrix.Columns[0].SSE[1], Matrix.Columns[1].SSE[1]);
+    Result.Columns[3].SSE[1] = _mm_unpackhi_pd(Matrix.Columns[2].SSE[1], Matrix.Columns[3].SSE[1]);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    Result.Columns[0].NEON[0] = vzip1q_f64(Matrix.Columns[0].NEON[0], Matrix.Columns[1].NEON[0]);
+    Result.Columns[0].NEON[1] = vzip1q_f64(Matrix.Columns[2].NEON[0], Matrix.Columns[3].NEON[0]);
+    Result.Columns[1].NEON[0] = vzip2q_f64(Matrix.Columns[0].NEON[0], Matrix.Columns[1].NEON[0]);
+    Result.Columns[1].NEON[1] = vzip2q_f64(Matrix.Columns[2].NEON[0], Matrix.Columns[3].NEON[0]);
+    Result.Columns[2].NEON[0] = vzip1q_f64(Matrix.Columns[0].NEON[1], Matrix.Columns[1].NEON[1]);
+    Result.Columns[2].NEON[1] = vzip1q_f64(Matrix.Columns[2].NEON[1], Matrix.Columns[3].NEON[1]);
+    Result.Columns[3].NEON[0] = vzip2q_f64(Matrix.Columns[0].NEON[1], Matrix.Columns[1].NEON[1]);
+    Result.Columns[3].NEON[1] = vzip2q_f64(Matrix.Columns[2].NEON[1], Matrix.Columns[3].NEON[1]);
+#else
+    for (int Column = 0; Column < 4; ++Column)
+    {
+        for (int Row = 0; Row < 4; ++Row)
+        {
+            Result.Elements[Column][Row] = Matrix.Elements[Row][Column];
+        }
+    }
+#endif
+
+    return Result;
+}
+
+static inline HMM_DVec4 _HMM_LinearCombineDV4DM4(HMM_DVec4 Left, HMM_DMat4 Right)
+{
+    HMM_DVec4 Result;
+
+#ifdef HANDMADE_MATH__USE_AVX
+    __m256d Sum = _mm256_mul_pd(_HMM_CombinePD(Right.Columns[0].SSE[0], Right.Columns[0].SSE[1]), _mm256_broadcast_sd(&Left.Elements[0]));
+    Sum = _HMM_MADD256_PD(_HMM_CombinePD(Right.Columns[1].SSE[0], Right.Columns[1].SSE[1]), _mm256_broadcast_sd(&Left.Elements[1]), Sum);
+    Sum = _HMM_MADD256_PD(_HMM_CombinePD(Right.Columns[2].SSE[0], Right.Columns[2].SSE[1]), _mm256_broadcast_sd(&Left.Elements[2]), Sum);
+    Sum = _HMM_MADD256_PD(_HMM_CombinePD(Right.Columns[3].SSE[0], Right.Columns[3].SSE[1]), _mm256_broadcast_sd(&Left.Elements[3]), Sum);
+    _mm256_storeu_pd(Result.Elements, Sum);
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    __m128d X = _mm_unpacklo_pd(Left.SSE[0], Left.SSE[0]);
+    __m128d Y = _mm_unpackhi_pd(Left.SSE[0], Left.SSE[0]);
+    __m128d Z = _mm_unpacklo_pd(Left.SSE[1], Left.SSE[1]);
+    __m128d W = _mm_unpackhi_pd(Left.SSE[1], Left.SSE[1]);
+    __m128d Sum0 = _mm_mul_pd(Right.Columns[0].SSE[0], X);
+    __m128d Sum1 = _mm_mul_pd(Right.Columns[0].SSE[1], X);
+    Sum0 = _HMM_MADD_PD(Right.Columns[1].SSE[0], Y, Sum0);
+    Sum1 = _HMM_MADD_PD(Right.Columns[1].SSE[1], Y, Sum1);
+    Sum0 = _HMM_MADD_PD(Right.Columns[2].SSE[0], Z, Sum0);
+    Sum1 = _HMM_MADD_PD(Right.Columns[2].SSE[1], Z, Sum1);
+    Result.SSE[0] = _HMM_MADD_PD(Right.Columns[3].SSE[0], W, Sum0);
+    Result.SSE[1] = _HMM_MADD_PD(Right.Columns[3].SSE[1], W, Sum1);
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float64x2_t Sum0 = vmulq_laneq_f64(Right.Columns[0].NEON[0], Left.NEON[0], 0);
+    float64x2_t Sum1 = vmulq_laneq_f64(Right.Columns[0].NEON[1], Left.NEON[0], 0);
+    Sum0 = vfmaq_laneq_f64(Sum0, Right.Columns[1].NEON[0], Left.NEON[0], 1);
+    Sum1 = vfmaq_laneq_f64(Sum1, Right.Columns[1].NEON[1], Left.NEON[0], 1);
+    Sum0 = vfmaq_laneq_f64(Sum0, Right.Columns[2].NEON[0], Left.NEON[1], 0);
+    Sum1 = vfmaq_laneq_f64(Sum1, Right.Columns[2].NEON[1], Left.NEON[1], 0);
+    Result.NEON[0] = vfmaq_laneq_f64(Sum0, Right.Columns[3].NEON[0], Left.NEON[1], 1);
+    Result.NEON[1] = vfmaq_laneq_f64(Sum1, Right.Columns[3].NEON[1], Left.NEON[1], 1);
+#else
+    for (int Row = 0; Row < 4; ++Row)
+    {
+        double Sum = Right.Elements[0][Row] * Left.X;
+        Sum += Right.Elements[1][Row] * Left.Y;
+        Sum += Right.Elements[2][Row] * Left.Z;
+        Result.Elements[Row] = Sum + Right.Elements[3][Row] * Left.W;
+    }
+#endif
+
+    return Result;
+}
+
+COVERAGE(HMM_MulDM4, 1)
+static inline HMM_DMat4 HMM_MulDM4(HMM_DMat4 Left, HMM_DMat4 Right)
 {
-    ASSERT_COVERED(HMM_InvTranslate);
+    ASSERT_COVERED(HMM_MulDM4);
 
-    HMM_Mat4 Result = TranslationMatrix;
-    Result.Elements[3][0] = -Result.Elements[3][0];
-    Result.Elements[3][1] = -Result.Elements[3][1];
-    Result.Elements[3][2] = -Result.Elements[3][2];
+    HMM_DMat4 Result;
+    Result.Columns[0] = _HMM_LinearCombineDV4DM4(Right.Columns[0], Left);
+    Result.Columns[1] = _HMM_LinearCombineDV4DM4(Right.Columns[1], Left);
+    Result.Columns[2] = _HMM_LinearCombineDV4DM4(Right.Columns[2], Left);
+    Result.Columns[3] = _HMM_LinearCombineDV4DM4(Right.Columns[3], Left);
 
     return Result;
 }
 
-COVERAGE(HMM_Rotate_RH, 1)
-static inline HMM_Mat4 HMM_Rotate_RH(float Angle, HMM_Vec3 Axis)
+COVERAGE(HMM_MulDM4V4, 1)
+static inline HMM_DVec4 HMM_MulDM4V4(HMM_DMat4 Matrix, HMM_DVec4 Vector)
 {
-    ASSERT_COVERED(HMM_Rotate_RH);
+    ASSERT_COVERED(HMM_MulDM4V4);
 
-    HMM_Mat4 Result = HMM_M4D(1.0f);
+    return _HMM_LinearCombineDV4DM4(Vector, Matrix);
+}
 
-    Axis = HMM_NormV3(Axis);
+// Same method as HMM_InvGeneralM4.
+COVERAGE(HMM_InvGeneralDM4, 1)
+static inline HMM_DMat4 HMM_InvGeneralDM4(HMM_DMat4 Matrix)
+{
+    ASSERT_COVERED(HMM_InvGeneralDM4);
 
-    float SinTheta = HMM_SinF(Angle);
-    float CosTheta = HMM_CosF(Angle);
-    float CosValue = 1.0f - CosTheta;
+    HMM_DVec3 Column0 = Matrix.Columns[0].XYZ;
+    HMM_DVec3 Column1 = Matrix.Columns[1].XYZ;
+    HMM_DVec3 Column2 = Matrix.Columns[2].XYZ;
+    HMM_DVec3 Column3 = Matrix.Columns[3].XYZ;
 
-    Result.Elements[0][0] = (Axis.X * Axis.X * CosValue) + CosTheta;
-    Result.Elements[0][1] = (Axis.X * Axis.Y * CosValue) + (Axis.Z * SinTheta);
-    Result.Elements[0][2] = (Axis.X * Axis.Z * CosValue) - (Axis.Y * SinTheta);
+    HMM_DVec3 C01 = HMM_CrossDV3(Column0, Column1);
+    HMM_DVec3 C23 = HMM_CrossDV3(Column2, Column3);
+    HMM_DVec3 B10 = HMM_SubDV3(HMM_MulDV3F(Column0, Matrix.Columns[1].W), HMM_MulDV3F(Column1, Matrix.Columns[0].W));
+    HMM_DVec3 B32 = HMM_SubDV3(HMM_MulDV3F(Column2, Matrix.Columns[3].W), HMM_MulDV3F(Column3, Matrix.Columns[2].W));
 
-    Result.Elements[1][0] = (Axis.Y * Axis.X * CosValue) - (Axis.Z * SinTheta);
-    Result.Elements[1][1] = (Axis.Y * Axis.Y * CosValue) + CosTheta;
-    Result.Elements[1][2] = (Axis.Y * Axis.Z * CosValue) + (Axis.X * SinTheta);
+    double InvDeterminant = 1.0 / (HMM_DotDV3(C01, B32) + HMM_DotDV3(C23, B10));
+    C01 = HMM_MulDV3F(C01, InvDeterminant);
+    C23 = HMM_MulDV3F(C23, InvDeterminant);
+    B10 = HMM_MulDV3F(B10, InvDeterminant);
+    B32 = HMM_MulDV3F(B32, InvDeterminant);
 
-    Result.Elements[2][0] = (Axis.Z * Axis.X * CosValue) + (Axis.Y * SinTheta);
-    Result.Elements[2][1] = (Axis.Z * Axis.Y * CosValue) - (Axis.X * SinTheta);
-    Result.Elements[2][2] = (Axis.Z * Axis.Z * CosValue) + CosTheta;
+    HMM_DMat4 Result;
+    Result.Columns[0] = HMM_DV4V(HMM_AddDV3(HMM_CrossDV3(Column1, B32), HMM_MulDV3F(C23, Matrix.Columns[1].W)), -HMM_DotDV3(Column1, C23));
+    Result.Columns[1] = HMM_DV4V(HMM_SubDV3(HMM_CrossDV3(B32, Column0), HMM_MulDV3F(C23, Matrix.Columns[0].W)), +HMM_DotDV3(Column0, C23));
+    Result.Columns[2] = HMM_DV4V(HMM_AddDV3(HMM_CrossDV3(Column3, B10), HMM_MulDV3F(C01, Matrix.Columns[3].W)), -HMM_DotDV3(Column3, C01));
+    Result.Columns[3] = HMM_DV4V(HMM_SubDV3(HMM_CrossDV3(B10, Column2), HMM_MulDV3F(C01, Matrix.Columns[2].W)), +HMM_DotDV3(Column2, C01));
 
-    return Result;
+    return HMM_TransposeDM4(Result);
 }
 
-COVERAGE(HMM_Rotate_LH, 1)
-static inline HMM_Mat4 HMM_Rotate_LH(float Angle, HMM_Vec3 Axis)
+COVERAGE(HMM_DTranslate, 1)
+static inline HMM_DMat4 HMM_DTranslate(HMM_DVec3 Translation)
 {
-    ASSERT_COVERED(HMM_Rotate_LH);
-    /* NOTE(lcf): Matrix will be inverse/transpose of RH. */
-    return HMM_Rotate_RH(-Angle, Axis);
-}
+    ASSERT_COVERED(HMM_DTranslate);
 
-COVERAGE(HMM_InvRotate, 1)
-static inline HMM_Mat4 HMM_InvRotate(HMM_Mat4 RotationMatrix)
-{
-    ASSERT_COVERED(HMM_InvRotate);
-    return HMM_TransposeM4(RotationMatrix);
+    HMM_DMat4 Result = HMM_DM4D(1.0);
+    Result.Columns[3] = HMM_DV4V(Translation, 1.0);
+
+    return Result;
 }
 
-COVERAGE(HMM_Scale, 1)
-static inline HMM_Mat4 HMM_Scale(HMM_Vec3 Scale)
+static inline HMM_DMat4 _HMM_DLookAt(HMM_DVec3 F, HMM_DVec3 S, HMM_DVec3 U, HMM_DVec3 Eye)
 {
-    ASSERT_COVERED(HMM_Scale);
+    HMM_DMat4 Result;
 
-    HMM_Mat4 Result = HMM_M4D(1.0f);
-    Result.Elements[0][0] = Scale.X;
-    Result.Elements[1][1] = Scale.Y;
-    Result.Elements[2][2] = Scale.Z;
+    /* NOTE: The rows are S, U and -F, with the translation in the fourth column. */
+    Result.Columns[0] = HMM_DV4(S.X, U.X, -F.X, 0.0);
+    Result.Columns[1] = HMM_DV4(S.Y, U.Y, -F.Y, 0.0);
+    Result.Columns[2] = HMM_DV4(S.Z, U.Z, -F.Z, 0.0);
+    Result.Columns[3] = HMM_DV4(-HMM_DotDV3(S, Eye), -HMM_DotDV3(U, Eye), HMM_DotDV3(F, Eye), 1.0);
 
     return Result;
 }
 
-COVERAGE(HMM_InvScale, 1)
-static inline HMM_Mat4 HMM_InvScale(HMM_Mat4 ScaleMatrix)
+COVERAGE(HMM_DLookAt_RH, 1)
+static inline HMM_DMat4 HMM_DLookAt_RH(HMM_DVec3 Eye, HMM_DVec3 Center, HMM_DVec3 Up)
 {
-    ASSERT_COVERED(HMM_InvScale);
+    ASSERT_COVERED(HMM_DLookAt_RH);
 
-    HMM_Mat4 Result = ScaleMatrix;
-    Result.Elements[0][0] = 1.0f / Result.Elements[0][0];
-    Result.Elements[1][1] = 1.0f / Result.Elements[1][1];
-    Result.Elements[2][2] = 1.0f / Result.Elements[2][2];
+    HMM_DVec3 F = HMM_NormDV3(HMM_SubDV3(Center, Eye));
+    HMM_DVec3 S = HMM_NormDV3(HMM_CrossDV3(F, Up));
+    HMM_DVec3 U = HMM_CrossDV3(S, F);
+
+    return _HMM_DLookAt(F, S, U, Eye);
+}
+
+COVERAGE(HMM_DLookAt_LH, 1)
+static inline HMM_DMat4 HMM_DLookAt_LH(HMM_DVec3 Eye, HMM_DVec3 Center, HMM_DVec3 Up)
+{
+    ASSERT_COVERED(HMM_DLookAt_LH);
 
-    return Result;
+    HMM_DVec3 F = HMM_NormDV3(HMM_SubDV3(Eye, Center));
+    HMM_DVec3 S = HMM_NormDV3(HMM_CrossDV3(F, Up));
+    HMM_DVec3 U = HMM_CrossDV3(S, F);
+
+    return _HMM_DLookAt(F, S, U, Eye);
 }
 
-static inline HMM_Mat4 _HMM_LookAt(HMM_Vec3 F,  HMM_Vec3 S, HMM_Vec3 U,  HMM_Vec3 Eye)
+COVERAGE(HMM_DPerspective_RH_NO, 1)
+static inline HMM_DMat4 HMM_DPerspective_RH_NO(double FOV, double AspectRatio, double Near, double Far)
 {
-    HMM_Mat4 Result;
-
-    Result.Elements[0][0] = S.X;
-    Result.Elements[0][1] = U.X;
-    Result.Elements[0][2] = -F.X;
-    Result.Elements[0][3] = 0.0f;
+    ASSERT_COVERED(HMM_DPerspective_RH_NO);
 
-    Result.Elements[1][0] = S.Y;
-    Result.Elements[1][1] = U.Y;
-    Result.Elements[1][2] = -F.Y;
-    Result.Elements[1][3] = 0.0f;
+    HMM_DMat4 Result = {0};
 
-    Result.Elements[2][0] = S.Z;
-    Result.Elements[2][1] = U.Z;
-    Result.Elements[2][2] = -F.Z;
-    Result.Elements[2][3] = 0.0f;
+    double Cotangent = 1.0 / HMM_TAN(_HMM_ToRadD(FOV / 2.0));
+    Result.Elements[0][0] = Cotangent / AspectRatio;
+    Result.Elements[1][1] = Cotangent;
+    Result.Elements[2][3] = -1.0;
 
-    Result.Elements[3][0] = -HMM_DotV3(S, Eye);
-    Result.Elements[3][1] = -HMM_DotV3(U, Eye);
-    Result.Elements[3][2] = HMM_DotV3(F, Eye);
-    Result.Elements[3][3] = 1.0f;
+    Result.Elements[2][2] = (Near + Far) / (Near - Far);
+    Result.Elements[3][2] = (2.0 * Near * Far) / (Near - Far);
 
     return Result;
 }
 
-COVERAGE(HMM_LookAt_RH, 1)
-static inline HMM_Mat4 HMM_LookAt_RH(HMM_Vec3 Eye, HMM_Vec3 Center, HMM_Vec3 Up)
+COVERAGE(HMM_DPerspective_RH_ZO, 1)
+static inline HMM_DMat4 HMM_DPerspective_RH_ZO(double FOV, double AspectRatio, double Near, double Far)
 {
-    ASSERT_COVERED(HMM_LookAt_RH);
+    ASSERT_COVERED(HMM_DPerspective_RH_ZO);
+
+    HMM_DMat4 Result = {0};
+
+    double Cotangent = 1.0 / HMM_TAN(_HMM_ToRadD(FOV / 2.0));
+    Result.Elements[0][0] = Cotangent / AspectRatio;
+    Result.Elements[1][1] = Cotangent;
+    Result.Elements[2][3] = -1.0;
 
-    HMM_Vec3 F = HMM_NormV3(HMM_SubV3(Center, Eye));
-    HMM_Vec3 S = HMM_NormV3(HMM_Cross(F, Up));
-    HMM_Vec3 U = HMM_Cross(S, F);
+    Result.Elements[2][2] = (Far) / (Near - Far);
+    Result.Elements[3][2] = (Near * Far) / (Near - Far);
 
-    return _HMM_LookAt(F, S, U, Eye);
+    return Result;
 }
 
-COVERAGE(HMM_LookAt_LH, 1)
-static inline HMM_Mat4 HMM_LookAt_LH(HMM_Vec3 Eye, HMM_Vec3 Center, HMM_Vec3 Up)
+COVERAGE(HMM_DPerspective_LH_NO, 1)
+static inline HMM_DMat4 HMM_DPerspective_LH_NO(double FOV, double AspectRatio, double Near, double Far)
 {
-    ASSERT_COVERED(HMM_LookAt_LH);
+    ASSERT_COVERED(HMM_DPerspective_LH_NO);
 
-    HMM_Vec3 F = HMM_NormV3(HMM_SubV3(Eye, Center));
-    HMM_Vec3 S = HMM_NormV3(HMM_Cross(F, Up));
-    HMM_Vec3 U = HMM_Cross(S, F);
+    HMM_DMat4 Result = HMM_DPerspective_RH_NO(FOV, AspectRatio, Near, Far);
+    Result.Elements[2][2] = -Result.Elements[2][2];
+    Result.Elements[2][3] = -Result.Elements[2][3];
 
-    return _HMM_LookAt(F, S, U, Eye);
+    return Result;
 }
 
-COVERAGE(HMM_InvLookAt, 1)
-static inline HMM_Mat4 HMM_InvLookAt(HMM_Mat4 Matrix)
+COVERAGE(HMM_DPerspective_LH_ZO, 1)
+static inline HMM_DMat4 HMM_DPerspective_LH_ZO(double FOV, double AspectRatio, double Near, double Far)
 {
-    ASSERT_COVERED(HMM_InvLookAt);
-    HMM_Mat4 Result;
-
-    HMM_Mat3 Rotation = {0};
-    Rotation.Columns[0] = Matrix.Columns[0].XYZ;
-    Rotation.Columns[1] = Matrix.Columns[1].XYZ;
-    Rotation.Columns[2] = Matrix.Columns[2].XYZ;
-    Rotation = HMM_TransposeM3(Rotation);
+    ASSERT_COVERED(HMM_DPerspective_LH_ZO);
 
-    Result.Columns[0] = HMM_V4V(Rotation.Columns[0], 0.0f);
-    Result.Columns[1] = HMM_V4V(Rotation.Columns[1], 0.0f);
-    Result.Columns[2] = HMM_V4V(Rotation.Columns[2], 0.0f);
-    Result.Columns[3] = HMM_MulV4F(Matrix.Columns[3], -1.0f);
-    Result.Elements[3][0] = -1.0f * Matrix.Elements[3][0] /
-        (Rotation.Elements[0][0] + Rotation.Elements[0][1] + Rotation.Elements[0][2]);
-    Result.Elements[3][1] = -1.0f * Matrix.Elements[3][1] /
-        (Rotation.Elements[1][0] + Rotation.Elements[1][1] + Rotation.Elements[1][2]);
-    Result.Elements[3][2] = -1.0f * Matrix.Elements[3][2] /
-        (Rotation.Elements[2][0] + Rotation.Elements[2][1] + Rotation.Elements[2][2]);
-    Result.Elements[3][3] = 1.0f;
+    HMM_DMat4 Result = HMM_DPerspective_RH_ZO(FOV, AspectRatio, Near, Far);
+    Result.Elements[2][2] = -Result.Elements[2][2];
+    Result.Elements[2][3] = -Result.Elements[2][3];
 
     return Result;
 }
 
-/*
- * Quaternion operations
- */
-
-COVERAGE(HMM_Q, 1)
-static inline HMM_Quat HMM_Q(float X, float Y, float Z, float W)
+COVERAGE(HMM_DQuatXYZW, 1)
+static inline HMM_DQuat HMM_DQuatXYZW(double X, double Y, double Z, double W)
 {
-    ASSERT_COVERED(HMM_Q);
+    ASSERT_COVERED(HMM_DQuatXYZW);
 
-    HMM_Quat Result;
+    HMM_DQuat Result;
 
-#ifdef HANDMADE_MATH__USE_SSE
-    Result.SSE = _mm_setr_ps(X, Y, Z, W);
+#ifdef HANDMADE_MATH__USE_AVX
+    _mm256_storeu_pd(Result.Elements, _mm256_setr_pd(X, Y, Z, W));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    Result.SSE[0] = _mm_setr_pd(X, Y);
+    Result.SSE[1] = _mm_setr_pd(Z, W);
 #elif defined(HANDMADE_MATH__USE_NEON)
-    float32x4_t v = { X, Y, Z, W };
-    Result.NEON = v;
+    Result.NEON[0] = vsetq_lane_f64(Y, vdupq_n_f64(X), 1);
+    Result.NEON[1] = vsetq_lane_f64(W, vdupq_n_f64(Z), 1);
 #else
     Result.X = X;
     Result.Y = Y;
@@ -2114,40 +9505,22 @@ static inline HMM_Quat HMM_Q(float X, float Y, float Z, float W)
     return Result;
 }
 
-COVERAGE(HMM_QV4, 1)
-static inline HMM_Quat HMM_QV4(HMM_Vec4 Vector)
-{
-    ASSERT_COVERED(HMM_QV4);
-
-    HMM_Quat Result;
-
-#ifdef HANDMADE_MATH__USE_SSE
-    Result.SSE = Vector.SSE;
-#elif defined(HANDMADE_MATH__USE_NEON)
-    Result.NEON = Vector.NEON;
-#else
-    Result.X = Vector.X;
-    Result.Y = Vector.Y;
-    Result.Z = Vector.Z;
-    Result.W = Vector.W;
-#endif
-
-    return Result;
-}
-
-COVERAGE(HMM_AddQ, 1)
-static inline HMM_Quat HMM_AddQ(HMM_Quat Left, HMM_Quat Right)
+COVERAGE(HMM_AddDQuat, 1)
+static inline HMM_DQuat HMM_AddDQuat(HMM_DQuat Left, HMM_DQuat Right)
 {
-    ASSERT_COVERED(HMM_AddQ);
+    ASSERT_COVERED(HMM_AddDQuat);
 
-    HMM_Quat Result;
+    HMM_DQuat Result;
 
-#ifdef HANDMADE_MATH__USE_SSE
-    Result.SSE = _mm_add_ps(Left.SSE, Right.SSE);
+#ifdef HANDMADE_MATH__USE_AVX
+    _mm256_storeu_pd(Result.Elements, _mm256_add_pd(_HMM_CombinePD(Left.SSE[0], Left.SSE[1]), _HMM_CombinePD(Right.SSE[0], Right.SSE[1])));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    Result.SSE[0] = _mm_add_pd(Left.SSE[0], Right.SSE[0]);
+    Result.SSE[1] = _mm_add_pd(Left.SSE[1], Right.SSE[1]);
 #elif defined(HANDMADE_MATH__USE_NEON)
-    Result.NEON = vaddq_f32(Left.NEON, Right.NEON);
+    Result.NEON[0] = vaddq_f64(Left.NEON[0], Right.NEON[0]);
+    Result.NEON[1] = vaddq_f64(Left.NEON[1], Right.NEON[1]);
 #else
-
     Result.X = Left.X + Right.X;
     Result.Y = Left.Y + Right.Y;
     Result.Z = Left.Z + Right.Z;
@@ -2157,17 +9530,21 @@ static inline HMM_Quat HMM_AddQ(HMM_Quat Left, HMM_Quat Right)
     return Result;
 }
 
-COVERAGE(HMM_SubQ, 1)
-static inline HMM_Quat HMM_SubQ(HMM_Quat Left, HMM_Quat Right)
+COVERAGE(HMM_SubDQuat, 1)
+static inline HMM_DQuat HMM_SubDQuat(HMM_DQuat Left, HMM_DQuat Right)
 {
-    ASSERT_COVERED(HMM_SubQ);
+    ASSERT_COVERED(HMM_SubDQuat);
 
-    HMM_Quat Result;
+    HMM_DQuat Result;
 
-#ifdef HANDMADE_MATH__USE_SSE
-    Result.SSE = _mm_sub_ps(Left.SSE, Right.SSE);
+#ifdef HANDMADE_MATH__USE_AVX
+    _mm256_storeu_pd(Result.Elements, _mm256_sub_pd(_HMM_CombinePD(Left.SSE[0], Left.SSE[1]), _HMM_CombinePD(Right.SSE[0], Right.SSE[1])));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    Result.SSE[0] = _mm_sub_pd(Left.SSE[0], Right.SSE[0]);
+    Result.SSE[1] = _mm_sub_pd(Left.SSE[1], Right.SSE[1]);
 #elif defined(HANDMADE_MATH__USE_NEON)
-    Result.NEON = vsubq_f32(Left.NEON, Right.NEON);
+    Result.NEON[0] = vsubq_f64(Left.NEON[0], Right.NEON[0]);
+    Result.NEON[1] = vsubq_f64(Left.NEON[1], Right.NEON[1]);
 #else
     Result.X = Left.X - Right.X;
     Result.Y = Left.Y - Right.Y;
@@ -2178,79 +9555,94 @@ static inline HMM_Quat HMM_SubQ(HMM_Quat Left, HMM_Quat Right)
     return Result;
 }
 
-COVERAGE(HMM_MulQ, 1)
-static inline HMM_Quat HMM_MulQ(HMM_Quat Left, HMM_Quat Right)
-{
-    ASSERT_COVERED(HMM_MulQ);
-
-    HMM_Quat Result;
-
-#ifdef HANDMADE_MATH__USE_SSE
-    __m128 SSEResultOne = _mm_xor_ps(_mm_shuffle_ps(Left.SSE, Left.SSE, _MM_SHUFFLE(0, 0, 0, 0)), _mm_setr_ps(0.f, -0.f, 0.f, -0.f));
-    __m128 SSEResultTwo = _mm_shuffle_ps(Right.SSE, Right.SSE, _MM_SHUFFLE(0, 1, 2, 3));
-    __m128 SSEResultThree = _mm_mul_ps(SSEResultTwo, SSEResultOne);
-
-    SSEResultOne = _mm_xor_ps(_mm_shuffle_ps(Left.SSE, Left.SSE, _MM_SHUFFLE(1, 1, 1, 1)) , _mm_setr_ps(0.f, 0.f, -0.f, -0.f));
-    SSEResultTwo = _mm_shuffle_ps(Right.SSE, Right.SSE, _MM_SHUFFLE(1, 0, 3, 2));
-    SSEResultThree = _mm_add_ps(SSEResultThree, _mm_mul_ps(SSEResultTwo, SSEResultOne));
-
-    SSEResultOne = _mm_xor_ps(_mm_shuffle_ps(Left.SSE, Left.SSE, _MM_SHUFFLE(2, 2, 2, 2)), _mm_setr_ps(-0.f, 0.f, 0.f, -0.f));
-    SSEResultTwo = _mm_shuffle_ps(Right.SSE, Right.SSE, _MM_SHUFFLE(2, 3, 0, 1));
-    SSEResultThree = _mm_add_ps(SSEResultThree, _mm_mul_ps(SSEResultTwo, SSEResultOne));
-
-    SSEResultOne = _mm_shuffle_ps(Left.SSE, Left.SSE, _MM_SHUFFLE(3, 3, 3, 3));
-    SSEResultTwo = _mm_shuffle_ps(Right.SSE, Right.SSE, _MM_SHUFFLE(3, 2, 1, 0));
-    Result.SSE = _mm_add_ps(SSEResultThree, _mm_mul_ps(SSEResultTwo, SSEResultOne));
+COVERAGE(HMM_MulDQuat, 1)
+static inline HMM_DQuat HMM_MulDQuat(HMM_DQuat Left, HMM_DQuat Right)
+{
+    ASSERT_COVERED(HMM_MulDQuat);
+
+    HMM_DQuat Result;
+
+    /* NOTE: The product is the sum of Right's components, reordered and with flipped signs, times
+       each of Left's components:
+         Left.X * ( W, -Z,  Y, -X)
+         Left.Y * ( Z,  W, -X, -Y)
+         Left.Z * (-Y,  X,  W, -Z)
+         Left.W * ( X,  Y,  Z,  W) */
+#ifdef HANDMADE_MATH__USE_AVX
+    __m256d R = _HMM_CombinePD(Right.SSE[0], Right.SSE[1]);
+    __m256d ZWXY = _mm256_permute2f128_pd(R, R, 0x01);
+    __m256d WZYX = _mm256_permute_pd(ZWXY, 0x5);
+    __m256d YXWZ = _mm256_permute_pd(R, 0x5);
+    __m256d Sum = _mm256_mul_pd(_mm256_broadcast_sd(&Left.W), R);
+    Sum = _HMM_MADD256_PD(_mm256_broadcast_sd(&Left.X), _mm256_xor_pd(WZYX, _mm256_setr_pd(0.0, -0.0, 0.0, -0.0)), Sum);
+    Sum = _HMM_MADD256_PD(_mm256_broadcast_sd(&Left.Y), _mm256_xor_pd(ZWXY, _mm256_setr_pd(0.0, 0.0, -0.0, -0.0)), Sum);
+    Sum = _HMM_MADD256_PD(_mm256_broadcast_sd(&Left.Z), _mm256_xor_pd(YXWZ, _mm256_setr_pd(-0.0, 0.0, 0.0, -0.0)), Sum);
+    _mm256_storeu_pd(Result.Elements, Sum);
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    __m128d XY = Right.SSE[0];
+    __m128d ZW = Right.SSE[1];
+    __m128d YX = _mm_shuffle_pd(XY, XY, 1);
+    __m128d WZ = _mm_shuffle_pd(ZW, ZW, 1);
+    __m128d PlusMinus = _mm_setr_pd(0.0, -0.0);
+    __m128d MinusMinus = _mm_set1_pd(-0.0);
+    __m128d MinusPlus = _mm_setr_pd(-0.0, 0.0);
+    __m128d LeftX = _mm_unpacklo_pd(Left.SSE[0], Left.SSE[0]);
+    __m128d LeftY = _mm_unpackhi_pd(Left.SSE[0], Left.SSE[0]);
+    __m128d LeftZ = _mm_unpacklo_pd(Left.SSE[1], Left.SSE[1]);
+    __m128d LeftW = _mm_unpackhi_pd(Left.SSE[1], Left.SSE[1]);
+
+    __m128d Sum0 = _mm_mul_pd(LeftW, XY);
+    Sum0 = _HMM_MADD_PD(LeftX, _mm_xor_pd(WZ, PlusMinus), Sum0);
+    Sum0 = _HMM_MADD_PD(LeftY, ZW, Sum0);
+    Result.SSE[0] = _HMM_MADD_PD(LeftZ, _mm_xor_pd(YX, MinusPlus), Sum0);
+
+    __m128d Sum1 = _mm_mul_pd(LeftW, ZW);
+    Sum1 = _HMM_MADD_PD(LeftX, _mm_xor_pd(YX, PlusMinus), Sum1);
+    Sum1 = _HMM_MADD_PD(LeftY, _mm_xor_pd(XY, MinusMinus), Sum1);
+    Result.SSE[1] = _HMM_MADD_PD(LeftZ, _mm_xor_pd(WZ, PlusMinus), Sum1);
 #elif defined(HANDMADE_MATH__USE_NEON)
-    float32x4_t Right1032 = vrev64q_f32(Right.NEON);
-    float32x4_t Right3210 = vcombine_f32(vget_high_f32(Right1032), vget_low_f32(Right1032));
-    float32x4_t Right2301 = vrev64q_f32(Right3210);
-
-    float32x4_t FirstSign = {1.0f, -1.0f, 1.0f, -1.0f};
-    Result.NEON = vmulq_f32(Right3210, vmulq_f32(vdupq_laneq_f32(Left.NEON, 0), FirstSign));
-    float32x4_t SecondSign = {1.0f, 1.0f, -1.0f, -1.0f};
-    Result.NEON = vfmaq_f32(Result.NEON, Right2301, vmulq_f32(vdupq_laneq_f32(Left.NEON, 1), SecondSign));
-    float32x4_t ThirdSign = {-1.0f, 1.0f, 1.0f, -1.0f};
-    Result.NEON = vfmaq_f32(Result.NEON, Right1032, vmulq_f32(vdupq_laneq_f32(Left.NEON, 2), ThirdSign));
-    Result.NEON = vfmaq_laneq_f32(Result.NEON, Right.NEON, Left.NEON, 3);
-
+    float64x2_t XY = Right.NEON[0];
+    float64x2_t ZW = Right.NEON[1];
+    float64x2_t YX = vextq_f64(XY, XY, 1);
+    float64x2_t WZ = vextq_f64(ZW, ZW, 1);
+    float64x2_t PlusMinus = vsetq_lane_f64(-1.0, vdupq_n_f64(1.0), 1);
+    float64x2_t MinusPlus = vsetq_lane_f64(1.0, vdupq_n_f64(-1.0), 1);
+
+    float64x2_t Sum0 = vmulq_laneq_f64(XY, Left.NEON[1], 1);
+    Sum0 = vfmaq_laneq_f64(Sum0, vmulq_f64(WZ, PlusMinus), Left.NEON[0], 0);
+    Sum0 = vfmaq_laneq_f64(Sum0, ZW, Left.NEON[0], 1);
+    Result.NEON[0] = vfmaq_laneq_f64(Sum0, vmulq_f64(YX, MinusPlus), Left.NEON[1], 0);
+
+    float64x2_t Sum1 = vmulq_laneq_f64(ZW, Left.NEON[1], 1);
+    Sum1 = vfmaq_laneq_f64(Sum1, vmulq_f64(YX, PlusMinus), Left.NEON[0], 0);
+    Sum1 = vfmsq_laneq_f64(Sum1, XY, Left.NEON[0], 1);
+    Result.NEON[1] = vfmaq_laneq_f64(Sum1, vmulq_f64(WZ, PlusMinus), Left.NEON[1], 0);
 #else
-    Result.X =  Right.Elements[3] * +Left.Elements[0];
-    Result.Y =  Right.Elements[2] * -Left.Elements[0];
-    Result.Z =  Right.Elements[1] * +Left.Elements[0];
-    Result.W =  Right.Elements[0] * -Left.Elements[0];
-
-    Result.X += Right.Elements[2] * +Left.Elements[1];
-    Result.Y += Right.Elements[3] * +Left.Elements[1];
-    Result.Z += Right.Elements[0] * -Left.Elements[1];
-    Result.W += Right.Elements[1] * -Left.Elements[1];
-
-    Result.X += Right.Elements[1] * -Left.Elements[2];
-    Result.Y += Right.Elements[0] * +Left.Elements[2];
-    Result.Z += Right.Elements[3] * +Left.Elements[2];
-    Result.W += Right.Elements[2] * -Left.Elements[2];
-
-    Result.X += Right.Elements[0] * +Left.Elements[3];
-    Result.Y += Right.Elements[1] * +Left.Elements[3];
-    Result.Z += Right.Elements[2] * +Left.Elements[3];
-    Result.W += Right.Elements[3] * +Left.Elements[3];
+    Result.X = Left.W * Right.X + Left.X * Right.W + Left.Y * Right.Z - Left.Z * Right.Y;
+    Result.Y = Left.W * Right.Y - Left.X * Right.Z + Left.Y * Right.W + Left.Z * Right.X;
+    Result.Z = Left.W * Right.Z + Left.X * Right.Y - Left.Y * Right.X + Left.Z * Right.W;
+    Result.W = Left.W * Right.W - Left.X * Right.X - Left.Y * Right.Y - Left.Z * Right.Z;
 #endif
 
     return Result;
 }
 
-COVERAGE(HMM_MulQF, 1)
-static inline HMM_Quat HMM_MulQF(HMM_Quat Left, float Multiplicative)
+COVERAGE(HMM_MulDQuatF, 1)
+static inline HMM_DQuat HMM_MulDQuatF(HMM_DQuat Left, double Multiplicative)
 {
-    ASSERT_COVERED(HMM_MulQF);
+    ASSERT_COVERED(HMM_MulDQuatF);
 
-    HMM_Quat Result;
+    HMM_DQuat Result;
 
-#ifdef HANDMADE_MATH__USE_SSE
-    __m128 Scalar = _mm_set1_ps(Multiplicative);
-    Result.SSE = _mm_mul_ps(Left.SSE, Scalar);
+#ifdef HANDMADE_MATH__USE_AVX
+    _mm256_storeu_pd(Result.Elements, _mm256_mul_pd(_HMM_CombinePD(Left.SSE[0], Left.SSE[1]), _mm256_set1_pd(Multiplicative)));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    __m128d Scalar = _mm_set1_pd(Multiplicative);
+    Result.SSE[0] = _mm_mul_pd(Left.SSE[0], Scalar);
+    Result.SSE[1] = _mm_mul_pd(Left.SSE[1], Scalar);
 #elif defined(HANDMADE_MATH__USE_NEON)
-    Result.NEON = vmulq_n_f32(Left.NEON, Multiplicative);
+    Result.NEON[0] = vmulq_n_f64(Left.NEON[0], Multiplicative);
+    Result.NEON[1] = vmulq_n_f64(Left.NEON[1], Multiplicative);
 #else
     Result.X = Left.X * Multiplicative;
     Result.Y = Left.Y * Multiplicative;
@@ -2261,19 +9653,23 @@ static inline HMM_Quat HMM_MulQF(HMM_Quat Left, float Multiplicative)
     return Result;
 }
 
-COVERAGE(HMM_DivQF, 1)
-static inline HMM_Quat HMM_DivQF(HMM_Quat Left, float Divnd)
+COVERAGE(HMM_DivDQuatF, 1)
+static inline HMM_DQuat HMM_DivDQuatF(HMM_DQuat Left, double Divnd)
 {
-    ASSERT_COVERED(HMM_DivQF);
+    ASSERT_COVERED(HMM_DivDQuatF);
 
-    HMM_Quat Result;
+    HMM_DQuat Result;
 
-#ifdef HANDMADE_MATH__USE_SSE
-    __m128 Scalar = _mm_set1_ps(Divnd);
-    Result.SSE = _mm_div_ps(Left.SSE, Scalar);
+#ifdef HANDMADE_MATH__USE_AVX
+    _mm256_storeu_pd(Result.Elements, _mm256_div_pd(_HMM_CombinePD(Left.SSE[0], Left.SSE[1]), _mm256_set1_pd(Divnd)));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    __m128d Scalar = _mm_set1_pd(Divnd);
+    Result.SSE[0] = _mm_div_pd(Left.SSE[0], Scalar);
+    Result.SSE[1] = _mm_div_pd(Left.SSE[1], Scalar);
 #elif defined(HANDMADE_MATH__USE_NEON)
-    float32x4_t Scalar = vdupq_n_f32(Divnd);
-    Result.NEON = vdivq_f32(Left.NEON, Scalar);
+    float64x2_t Scalar = vdupq_n_f64(Divnd);
+    Result.NEON[0] = vdivq_f64(Left.NEON[0], Scalar);
+    Result.NEON[1] = vdivq_f64(Left.NEON[1], Scalar);
 #else
     Result.X = Left.X / Divnd;
     Result.Y = Left.Y / Divnd;
@@ -2284,25 +9680,22 @@ static inline HMM_Quat HMM_DivQF(HMM_Quat Left, float Divnd)
     return Result;
 }
 
-COVERAGE(HMM_DotQ, 1)
-static inline float HMM_DotQ(HMM_Quat Left, HMM_Quat Right)
+COVERAGE(HMM_DotDQuat, 1)
+static inline double HMM_DotDQuat(HMM_DQuat Left, HMM_DQuat Right)
 {
-    ASSERT_COVERED(HMM_DotQ);
+    ASSERT_COVERED(HMM_DotDQuat);
 
-    float Result;
+    double Result;
 
-#ifdef HANDMADE_MATH__USE_SSE
-    __m128 SSEResultOne = _mm_mul_ps(Left.SSE, Right.SSE);
-    __m128 SSEResultTwo = _mm_shuffle_ps(SSEResultOne, SSEResultOne, _MM_SHUFFLE(2, 3, 0, 1));
-    SSEResultOne = _mm_add_ps(SSEResultOne, SSEResultTwo);
-    SSEResultTwo = _mm_shuffle_ps(SSEResultOne, SSEResultOne, _MM_SHUFFLE(0, 1, 2, 3));
-    SSEResultOne = _mm_add_ps(SSEResultOne, SSEResultTwo);
-    _mm_store_ss(&Result, SSEResultOne);
+#ifdef HANDMADE_MATH__USE_AVX
+    __m256d Products = _mm256_mul_pd(_HMM_CombinePD(Left.SSE[0], Left.SSE[1]), _HMM_CombinePD(Right.SSE[0], Right.SSE[1]));
+    __m128d Sum = _mm_add_pd(_mm256_castpd256_pd128(Products), _mm256_extractf128_pd(Products, 1));
+    Result = _mm_cvtsd_f64(_mm_add_sd(Sum, _mm_unpackhi_pd(Sum, Sum)));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    __m128d Sum = _mm_add_pd(_mm_mul_pd(Left.SSE[0], Right.SSE[0]), _mm_mul_pd(Left.SSE[1], Right.SSE[1]));
+    Result = _mm_cvtsd_f64(_mm_add_sd(Sum, _mm_unpackhi_pd(Sum, Sum)));
 #elif defined(HANDMADE_MATH__USE_NEON)
-    float32x4_t NEONMultiplyResult = vmulq_f32(Left.NEON, Right.NEON);
-    float32x4_t NEONHalfAdd = vpaddq_f32(NEONMultiplyResult, NEONMultiplyResult);
-    float32x4_t NEONFullAdd = vpaddq_f32(NEONHalfAdd, NEONHalfAdd);
-    Result = vgetq_lane_f32(NEONFullAdd, 0);
+    Result = vaddvq_f64(vaddq_f64(vmulq_f64(Left.NEON[0], Right.NEON[0]), vmulq_f64(Left.NEON[1], Right.NEON[1])));
 #else
     Result = ((Left.X * Right.X) + (Left.Z * Right.Z)) + ((Left.Y * Right.Y) + (Left.W * Right.W));
 #endif
@@ -2310,352 +9703,348 @@ static inline float HMM_DotQ(HMM_Quat Left, HMM_Quat Right)
     return Result;
 }
 
-COVERAGE(HMM_InvQ, 1)
-static inline HMM_Quat HMM_InvQ(HMM_Quat Left)
+COVERAGE(HMM_NormDQuat, 1)
+static inline HMM_DQuat HMM_NormDQuat(HMM_DQuat Quat)
 {
-    ASSERT_COVERED(HMM_InvQ);
-
-    HMM_Quat Result;
-    Result.X = -Left.X;
-    Result.Y = -Left.Y;
-    Result.Z = -Left.Z;
-    Result.W = Left.W;
+    ASSERT_COVERED(HMM_NormDQuat);
 
-    return HMM_DivQF(Result, (HMM_DotQ(Left, Left)));
+    return HMM_MulDQuatF(Quat, 1.0 / HMM_SqrtD(HMM_DotDQuat(Quat, Quat)));
 }
 
-COVERAGE(HMM_NormQ, 1)
-static inline HMM_Quat HMM_NormQ(HMM_Quat Quat)
+COVERAGE(HMM_InvDQuat, 1)
+static inline HMM_DQuat HMM_InvDQuat(HMM_DQuat Left)
 {
-    ASSERT_COVERED(HMM_NormQ);
+    ASSERT_COVERED(HMM_InvDQuat);
 
-    /* NOTE(lcf): Take advantage of SSE implementation in HMM_NormV4 */
-    HMM_Vec4 Vec = HMM_V4(Quat.X, Quat.Y, Quat.Z, Quat.W);
-    Vec = HMM_NormV4(Vec);
-    HMM_Quat Result = HMM_QV4(Vec);
-
-    return Result;
+    HMM_DQuat Conjugate = HMM_DQuatXYZW(-Left.X, -Left.Y, -Left.Z, Left.W);
+    return HMM_MulDQuatF(Conjugate, 1.0 / HMM_DotDQuat(Left, Left));
 }
 
-static inline HMM_Quat _HMM_MixQ(HMM_Quat Left, float MixLeft, HMM_Quat Right, float MixRight) {
-    HMM_Quat Result;
-
-#ifdef HANDMADE_MATH__USE_SSE
-    __m128 ScalarLeft = _mm_set1_ps(MixLeft);
-    __m128 ScalarRight = _mm_set1_ps(MixRight);
-    __m128 SSEResultOne = _mm_mul_ps(Left.SSE, ScalarLeft);
-    __m128 SSEResultTwo = _mm_mul_ps(Right.SSE, ScalarRight);
-    Result.SSE = _mm_add_ps(SSEResultOne, SSEResultTwo);
-#elif defined(HANDMADE_MATH__USE_NEON)
-    float32x4_t ScaledLeft = vmulq_n_f32(Left.NEON, MixLeft);
-    float32x4_t ScaledRight = vmulq_n_f32(Right.NEON, MixRight);
-    Result.NEON = vaddq_f32(ScaledLeft, ScaledRight);
-#else
-    Result.X = Left.X*MixLeft + Right.X*MixRight;
-    Result.Y = Left.Y*MixLeft + Right.Y*MixRight;
-    Result.Z = Left.Z*MixLeft + Right.Z*MixRight;
-    Result.W = Left.W*MixLeft + Right.W*MixRight;
-#endif
-
-    return Result;
+static inline HMM_DQuat _HMM_MixDQuat(HMM_DQuat Left, double MixLeft, HMM_DQuat Right, double MixRight)
+{
+    return HMM_AddDQuat(HMM_MulDQuatF(Left, MixLeft), HMM_MulDQuatF(Right, MixRight));
 }
 
-COVERAGE(HMM_NLerp, 1)
-static inline HMM_Quat HMM_NLerp(HMM_Quat Left, float Time, HMM_Quat Right)
+COVERAGE(HMM_NLerpDQuat, 1)
+static inline HMM_DQuat HMM_NLerpDQuat(HMM_DQuat Left, double Time, HMM_DQuat Right)
 {
-    ASSERT_COVERED(HMM_NLerp);
-
-    HMM_Quat Result = _HMM_MixQ(Left, 1.0f-Time, Right, Time);
-    Result = HMM_NormQ(Result);
+    ASSERT_COVERED(HMM_NLerpDQuat);
 
-    return Result;
+    return HMM_NormDQuat(_HMM_MixDQuat(Left, 1.0 - Time, Right, Time));
 }
 
-COVERAGE(HMM_SLerp, 1)
-static inline HMM_Quat HMM_SLerp(HMM_Quat Left, float Time, HMM_Quat Right)
+COVERAGE(HMM_SLerpDQuat, 1)
+static inline HMM_DQuat HMM_SLerpDQuat(HMM_DQuat Left, double Time, HMM_DQuat Right)
 {
-    ASSERT_COVERED(HMM_SLerp);
+    ASSERT_COVERED(HMM_SLerpDQuat);
 
-    HMM_Quat Result;
+    HMM_DQuat Result;
 
-    float Cos_Theta = HMM_DotQ(Left, Right);
+    double Cos_Theta = HMM_DotDQuat(Left, Right);
 
-    if (Cos_Theta < 0.0f) { /* NOTE(lcf): Take shortest path on Hyper-sphere */
+    if (Cos_Theta < 0.0) { /* NOTE: Take the shortest path on the hypersphere. */
         Cos_Theta = -Cos_Theta;
-        Right = HMM_Q(-Right.X, -Right.Y, -Right.Z, -Right.W);
+        Right = HMM_MulDQuatF(Right, -1.0);
     }
 
-    /* NOTE(lcf): Use Normalized Linear interpolation when vectors are roughly not L.I. */
-    if (Cos_Theta > 0.9995f) {
-        Result = HMM_NLerp(Left, Time, Right);
+    /* NOTE: HMM_SLerp switches to HMM_NLerp below about 1.8 degrees, where NLerp is only accurate to
+       float precision. Here the switch is at about 0.03 degrees. */
+    if (Cos_Theta > 0.9999999) {
+        Result = HMM_NLerpDQuat(Left, Time, Right);
     } else {
-        float Angle = HMM_ACosF(Cos_Theta);
-        float MixLeft = HMM_SinF((1.0f - Time) * Angle);
-        float MixRight = HMM_SinF(Time * Angle);
-
-        Result = _HMM_MixQ(Left, MixLeft, Right, MixRight);
-        Result = HMM_NormQ(Result);
-    }
-
-    return Result;
-}
-
-COVERAGE(HMM_QToM4, 1)
-static inline HMM_Mat4 HMM_QToM4(HMM_Quat Left)
-{
-    ASSERT_COVERED(HMM_QToM4);
-
-    HMM_Mat4 Result;
-
-    HMM_Quat NormalizedQ = HMM_NormQ(Left);
+        double Angle = HMM_ACOS(Cos_Theta);
+        double MixLeft = HMM_SIN((1.0 - Time) * Angle);
+        double MixRight = HMM_SIN(Time * Angle);
 
-    float XX, YY, ZZ,
-          XY, XZ, YZ,
-          WX, WY, WZ;
+        Result = HMM_NormDQuat(_HMM_MixDQuat(Left, MixLeft, Right, MixRight));
+    }
 
-    XX = NormalizedQ.X * NormalizedQ.X;
-    YY = NormalizedQ.Y * NormalizedQ.Y;
-    ZZ = NormalizedQ.Z * NormalizedQ.Z;
-    XY = NormalizedQ.X * NormalizedQ.Y;
-    XZ = NormalizedQ.X * NormalizedQ.Z;
-    YZ = NormalizedQ.Y * NormalizedQ.Z;
-    WX = NormalizedQ.W * NormalizedQ.X;
-    WY = NormalizedQ.W * NormalizedQ.Y;
-    WZ = NormalizedQ.W * NormalizedQ.Z;
+    return Result;
+}
 
-    Result.Elements[0][0] = 1.0f - 2.0f * (YY + ZZ);
-    Result.Elements[0][1] = 2.0f * (XY + WZ);
-    Result.Elements[0][2] = 2.0f * (XZ - WY);
-    Result.Elements[0][3] = 0.0f;
+COVERAGE(HMM_DQuatToDM4, 1)
+static inline HMM_DMat4 HMM_DQuatToDM4(HMM_DQuat Left)
+{
+    ASSERT_COVERED(HMM_DQuatToDM4);
 
-    Result.Elements[1][0] = 2.0f * (XY - WZ);
-    Result.Elements[1][1] = 1.0f - 2.0f * (XX + ZZ);
-    Result.Elements[1][2] = 2.0f * (YZ + WX);
-    Result.Elements[1][3] = 0.0f;
+    HMM_DQuat NormalizedQ = HMM_NormDQuat(Left);
 
-    Result.Elements[2][0] = 2.0f * (XZ + WY);
-    Result.Elements[2][1] = 2.0f * (YZ - WX);
-    Result.Elements[2][2] = 1.0f - 2.0f * (XX + YY);
-    Result.Elements[2][3] = 0.0f;
+    double XX = NormalizedQ.X * NormalizedQ.X;
+    double YY = NormalizedQ.Y * NormalizedQ.Y;
+    double ZZ = NormalizedQ.Z * NormalizedQ.Z;
+    double XY = NormalizedQ.X * NormalizedQ.Y;
+    double XZ = NormalizedQ.X * NormalizedQ.Z;
+    double YZ = NormalizedQ.Y * NormalizedQ.Z;
+    double WX = NormalizedQ.W * NormalizedQ.X;
+    double WY = NormalizedQ.W * NormalizedQ.Y;
+    double WZ = NormalizedQ.W * NormalizedQ.Z;
 
-    Result.Elements[3][0] = 0.0f;
-    Result.Elements[3][1] = 0.0f;
-    Result.Elements[3][2] = 0.0f;
-    Result.Elements[3][3] = 1.0f;
+    HMM_DMat4 Result;
+    Result.Columns[0] = HMM_DV4(1.0 - 2.0 * (YY + ZZ), 2.0 * (XY + WZ), 2.0 * (XZ - WY), 0.0);
+    Result.Columns[1] = HMM_DV4(2.0 * (XY - WZ), 1.0 - 2.0 * (XX + ZZ), 2.0 * (YZ + WX), 0.0);
+    Result.Columns[2] = HMM_DV4(2.0 * (XZ + WY), 2.0 * (YZ - WX), 1.0 - 2.0 * (XX + YY), 0.0);
+    Result.Columns[3] = HMM_DV4(0.0, 0.0, 0.0, 1.0);
 
     return Result;
 }
 
-// This method taken from Mike Day at Insomniac Games.
-// https://d3cw3dd2w32x2b.cloudfront.net/wp-content/uploads/2015/01/matrix-to-quat.pdf
-//
-// Note that as mentioned at the top of the paper, the paper assumes the matrix
-// would be *post*-multiplied to a vector to rotate it, meaning the matrix is
-// the transpose of what we're dealing with. But, because our matrices are
-// stored in column-major order, the indices *appear* to match the paper.
-//
-// For example, m12 in the paper is row 1, column 2. We need to transpose it to
-// row 2, column 1. But, because the column comes first when referencing
-// elements, it looks like M.Elements[1][2].
-//
-// Don't be confused! Or if you must be confused, at least trust this
-// comment. :)
-COVERAGE(HMM_M4ToQ_RH, 4)
-static inline HMM_Quat HMM_M4ToQ_RH(HMM_Mat4 M)
+COVERAGE(HMM_DQuatFromAxisAngle_RH, 1)
+static inline HMM_DQuat HMM_DQuatFromAxisAngle_RH(HMM_DVec3 Axis, double Angle)
 {
-    float T;
-    HMM_Quat Q;
+    ASSERT_COVERED(HMM_DQuatFromAxisAngle_RH);
 
-    if (M.Elements[2][2] < 0.0f) {
-        if (M.Elements[0][0] > M.Elements[1][1]) {
-            ASSERT_COVERED(HMM_M4ToQ_RH);
+    HMM_DVec3 AxisNormalized = HMM_NormDV3(Axis);
+    double HalfAngle = _HMM_ToRadD(Angle / 2.0);
+    double Sin = HMM_SIN(HalfAngle);
 
-            T = 1 + M.Elements[0][0] - M.Elements[1][1] - M.Elements[2][2];
-            Q = HMM_Q(
-                T,
-                M.Elements[0][1] + M.Elements[1][0],
-                M.Elements[2][0] + M.Elements[0][2],
-                M.Elements[1][2] - M.Elements[2][1]
-            );
-        } else {
-            ASSERT_COVERED(HMM_M4ToQ_RH);
+    return HMM_DQuatXYZW(AxisNormalized.X * Sin, AxisNormalized.Y * Sin, AxisNormalized.Z * Sin, HMM_COS(HalfAngle));
+}
 
-            T = 1 - M.Elements[0][0] + M.Elements[1][1] - M.Elements[2][2];
-            Q = HMM_Q(
-                M.Elements[0][1] + M.Elements[1][0],
-                T,
-                M.Elements[1][2] + M.Elements[2][1],
-                M.Elements[2][0] - M.Elements[0][2]
-            );
-        }
-    } else {
-        if (M.Elements[0][0] < -M.Elements[1][1]) {
-            ASSERT_COVERED(HMM_M4ToQ_RH);
+COVERAGE(HMM_DQuatFromAxisAngle_LH, 1)
+static inline HMM_DQuat HMM_DQuatFromAxisAngle_LH(HMM_DVec3 Axis, double Angle)
+{
+    ASSERT_COVERED(HMM_DQuatFromAxisAngle_LH);
 
-            T = 1 - M.Elements[0][0] - M.Elements[1][1] + M.Elements[2][2];
-            Q = HMM_Q(
-                M.Elements[2][0] + M.Elements[0][2],
-                M.Elements[1][2] + M.Elements[2][1],
-                T,
-                M.Elements[0][1] - M.Elements[1][0]
-            );
-        } else {
-            ASSERT_COVERED(HMM_M4ToQ_RH);
+    return HMM_DQuatFromAxisAngle_RH(Axis, -Angle);
+}
 
-            T = 1 + M.Elements[0][0] + M.Elements[1][1] + M.Elements[2][2];
-            Q = HMM_Q(
-                M.Elements[1][2] - M.Elements[2][1],
-                M.Elements[2][0] - M.Elements[0][2],
-                M.Elements[0][1] - M.Elements[1][0],
-                T
-            );
-        }
-    }
+// Same method as HMM_RotateV3Q.
+COVERAGE(HMM_RotateDV3DQuat, 1)
+static inline HMM_DVec3 HMM_RotateDV3DQuat(HMM_DVec3 V, HMM_DQuat Q)
+{
+    ASSERT_COVERED(HMM_RotateDV3DQuat);
 
-    Q = HMM_MulQF(Q, 0.5f / HMM_SqrtF(T));
+    HMM_DVec3 t = HMM_MulDV3F(HMM_CrossDV3(Q.XYZ, V), 2.0);
+    return HMM_AddDV3(V, HMM_AddDV3(HMM_MulDV3F(t, Q.W), HMM_CrossDV3(Q.XYZ, t)));
+}
 
-    return Q;
+/*
+ * Conversion between single and double precision. Converting to float rounds to
+ * the nearest value; converting to double is exact.
+ */
+
+static inline void _HMM_FloatsToDoubles4(const float *In, double *Out)
+{
+#ifdef HANDMADE_MATH__USE_AVX
+    _mm256_storeu_pd(Out, _mm256_cvtps_pd(_mm_loadu_ps(In)));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    __m128 Floats = _mm_loadu_ps(In);
+    _mm_storeu_pd(Out, _mm_cvtps_pd(Floats));
+    _mm_storeu_pd(Out + 2, _mm_cvtps_pd(_mm_movehl_ps(Floats, Floats)));
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float32x4_t Floats = vld1q_f32(In);
+    vst1q_f64(Out, vcvt_f64_f32(vget_low_f32(Floats)));
+    vst1q_f64(Out + 2, vcvt_high_f64_f32(Floats));
+#else
+    Out[0] = (double)In[0];
+    Out[1] = (double)In[1];
+    Out[2] = (double)In[2];
+    Out[3] = (double)In[3];
+#endif
 }
 
-COVERAGE(HMM_M4ToQ_LH, 4)
-static inline HMM_Quat HMM_M4ToQ_LH(HMM_Mat4 M)
+static inline void _HMM_DoublesToFloats4(const double *In, float *Out)
 {
-    float T;
-    HMM_Quat Q;
+#ifdef HANDMADE_MATH__USE_AVX
+    _mm_storeu_ps(Out, _mm256_cvtpd_ps(_HMM_CombinePD(_mm_loadu_pd(In), _mm_loadu_pd(In + 2))));
+#elif defined(HANDMADE_MATH__USE_SSE2)
+    _mm_storeu_ps(Out, _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(In)), _mm_cvtpd_ps(_mm_loadu_pd(In + 2))));
+#elif defined(HANDMADE_MATH__USE_NEON)
+    vst1q_f32(Out, vcvt_high_f32_f64(vcvt_f32_f64(vld1q_f64(In)), vld1q_f64(In + 2)));
+#else
+    Out[0] = (float)In[0];
+    Out[1] = (float)In[1];
+    Out[2] = (float)In[2];
+    Out[3] = (float)In[3];
+#endif
+}
 
-    if (M.Elements[2][2] < 0.0f) {
-        if (M.Elements[0][0] > M.Elements[1][1]) {
-            ASSERT_COVERED(HMM_M4ToQ_LH);
+COVERAGE(HMM_V3ToDV3, 1)
+static inline HMM_DVec3 HMM_V3ToDV3(HMM_Vec3 V)
+{
+    ASSERT_COVERED(HMM_V3ToDV3);
 
-            T = 1 + M.Elements[0][0] - M.Elements[1][1] - M.Elements[2][2];
-            Q = HMM_Q(
-                T,
-                M.Elements[0][1] + M.Elements[1][0],
-                M.Elements[2][0] + M.Elements[0][2],
-                M.Elements[2][1] - M.Elements[1][2]
-            );
-        } else {
-            ASSERT_COVERED(HMM_M4ToQ_LH);
+    return HMM_DV3((double)V.X, (double)V.Y, (double)V.Z);
+}
 
-            T = 1 - M.Elements[0][0] + M.Elements[1][1] - M.Elements[2][2];
-            Q = HMM_Q(
-                M.Elements[0][1] + M.Elements[1][0],
-                T,
-                M.Elements[1][2] + M.Elements[2][1],
-                M.Elements[0][2] - M.Elements[2][0]
-            );
-        }
-    } else {
-        if (M.Elements[0][0] < -M.Elements[1][1]) {
-            ASSERT_COVERED(HMM_M4ToQ_LH);
+COVERAGE(HMM_DV3ToV3, 1)
+static inline HMM_Vec3 HMM_DV3ToV3(HMM_DVec3 V)
+{
+    ASSERT_COVERED(HMM_DV3ToV3);
 
-            T = 1 - M.Elements[0][0] - M.Elements[1][1] + M.Elements[2][2];
-            Q = HMM_Q(
-                M.Elements[2][0] + M.Elements[0][2],
-                M.Elements[1][2] + M.Elements[2][1],
-                T,
-                M.Elements[1][0] - M.Elements[0][1]
-            );
-        } else {
-            ASSERT_COVERED(HMM_M4ToQ_LH);
+    return HMM_V3((float)V.X, (float)V.Y, (float)V.Z);
+}
 
-            T = 1 + M.Elements[0][0] + M.Elements[1][1] + M.Elements[2][2];
-            Q = HMM_Q(
-                M.Elements[2][1] - M.Elements[1][2],
-                M.Elements[0][2] - M.Elements[2][0],
-                M.Elements[1][0] - M.Elements[0][2],
-                T
-            );
-        }
-    }
+COVERAGE(HMM_V4ToDV4, 1)
+static inline HMM_DVec4 HMM_V4ToDV4(HMM_Vec4 V)
+{
+    ASSERT_COVERED(HMM_V4ToDV4);
 
-    Q = HMM_MulQF(Q, 0.5f / HMM_SqrtF(T));
+    HMM_DVec4 Result;
+    _HMM_FloatsToDoubles4(V.Elements, Result.Elements);
 
-    return Q;
+    return Result;
 }
 
+COVERAGE(HMM_DV4ToV4, 1)
+static inline HMM_Vec4 HMM_DV4ToV4(HMM_DVec4 V)
+{
+    ASSERT_COVERED(HMM_DV4ToV4);
 
-COVERAGE(HMM_QFromAxisAngle_RH, 1)
-static inline HMM_Quat HMM_QFromAxisAngle_RH(HMM_Vec3 Axis, float Angle)
+    HMM_Vec4 Result;
+    _HMM_DoublesToFloats4(V.Elements, Result.Elements);
+
+    return Result;
+}
+
+COVERAGE(HMM_M4ToDM4, 1)
+static inline HMM_DMat4 HMM_M4ToDM4(HMM_Mat4 Matrix)
 {
-    ASSERT_COVERED(HMM_QFromAxisAngle_RH);
+    ASSERT_COVERED(HMM_M4ToDM4);
 
-    HMM_Quat Result;
+    HMM_DMat4 Result;
+    _HMM_FloatsToDoubles4(Matrix.Elements[0], Result.Elements[0]);
+    _HMM_FloatsToDoubles4(Matrix.Elements[1], Result.Elements[1]);
+    _HMM_FloatsToDoubles4(Matrix.Elements[2], Result.Elements[2]);
+    _HMM_FloatsToDoubles4(Matrix.Elements[3], Result.Elements[3]);
 
-    HMM_Vec3 AxisNormalized = HMM_NormV3(Axis);
-    float SineOfRotation = HMM_SinF(Angle / 2.0f);
+    return Result;
+}
+
+COVERAGE(HMM_DM4ToM4, 1)
+static inline HMM_Mat4 HMM_DM4ToM4(HMM_DMat4 Matrix)
+{
+    ASSERT_COVERED(HMM_DM4ToM4);
 
-    Result.XYZ = HMM_MulV3F(AxisNormalized, SineOfRotation);
-    Result.W = HMM_CosF(Angle / 2.0f);
+    HMM_Mat4 Result;
+    _HMM_DoublesToFloats4(Matrix.Elements[0], Result.Elements[0]);
+    _HMM_DoublesToFloats4(Matrix.Elements[1], Result.Elements[1]);
+    _HMM_DoublesToFloats4(Matrix.Elements[2], Result.Elements[2]);
+    _HMM_DoublesToFloats4(Matrix.Elements[3], Result.Elements[3]);
 
     return Result;
 }
 
-COVERAGE(HMM_QFromAxisAngle_LH, 1)
-static inline HMM_Quat HMM_QFromAxisAngle_LH(HMM_Vec3 Axis, float Angle)
+COVERAGE(HMM_QToDQuat, 1)
+static inline HMM_DQuat HMM_QToDQuat(HMM_Quat Q)
 {
-    ASSERT_COVERED(HMM_QFromAxisAngle_LH);
+    ASSERT_COVERED(HMM_QToDQuat);
 
-    return HMM_QFromAxisAngle_RH(Axis, -Angle);
+    HMM_DQuat Result;
+    _HMM_FloatsToDoubles4(Q.Elements, Result.Elements);
+
+    return Result;
 }
 
-COVERAGE(HMM_QFromNormPair, 1)
-static inline HMM_Quat HMM_QFromNormPair(HMM_Vec3 Left, HMM_Vec3 Right)
+COVERAGE(HMM_DQuatToQ, 1)
+static inline HMM_Quat HMM_DQuatToQ(HMM_DQuat Q)
 {
-    ASSERT_COVERED(HMM_QFromNormPair);
+    ASSERT_COVERED(HMM_DQuatToQ);
 
     HMM_Quat Result;
+    _HMM_DoublesToFloats4(Q.Elements, Result.Elements);
 
-    Result.XYZ = HMM_Cross(Left, Right);
-    Result.W = 1.0f + HMM_DotV3(Left, Right);
-
-    return HMM_NormQ(Result);
+    return Result;
 }
 
-COVERAGE(HMM_QFromVecPair, 1)
-static inline HMM_Quat HMM_QFromVecPair(HMM_Vec3 Left, HMM_Vec3 Right)
-{
-    ASSERT_COVERED(HMM_QFromVecPair);
+/*
+ * Camera-relative rendering
+ *
+ * Far from the origin a float has too few bits left for the fraction, so
+ * a model matrix built from a float world position makes objects jitter as
+ * the camera moves. These functions take double world positions and a
+ * double camera position, subtract them in double, and only then convert
+ * to float. The result is a float model-view matrix for a camera at the
+ * origin, which works with HMM_Perspective_* and the float batch functions.
+ */
 
-    return HMM_QFromNormPair(HMM_NormV3(Left), HMM_NormV3(Right));
+/* NOTE: Returns (Position - Camera) rounded to float, with W = 0. The difference is taken in double
+   so the rounding only loses bits of the (small) offset. */
+static inline HMM_Vec4 _HMM_CameraRelativeV4(const HMM_DVec3 *Position, const HMM_DVec3 *Camera)
+{
+    HMM_Vec4 Result;
+#ifdef HANDMADE_MATH__USE_SSE2
+    __m128d XY = _mm_sub_pd(_mm_loadu_pd(&Position->X), _mm_loadu_pd(&Camera->X));
+    __m128d Z = _mm_sub_sd(_mm_load_sd(&Position->Z), _mm_load_sd(&Camera->Z));
+    Result.SSE = _mm_movelh_ps(_mm_cvtpd_ps(XY), _mm_cvtpd_ps(Z));
+#elif defined(HANDMADE_MATH__USE_NEON)
+    float64x2_t XY = vsubq_f64(vld1q_f64(&Position->X), vld1q_f64(&Camera->X));
+    float64x1_t Z = vsub_f64(vld1_f64(&Position->Z), vld1_f64(&Camera->Z));
+    Result.NEON = vcvt_high_f32_f64(vcvt_f32_f64(XY), vcombine_f64(Z, vdup_n_f64(0.0)));
+#else
+    Result.X = (float)(Position->X - Camera->X);
+    Result.Y = (float)(Position->Y - Camera->Y);
+    Result.Z = (float)(Position->Z - Camera->Z);
+    Result.W = 0.0f;
+#endif
+    return Result;
 }
 
-COVERAGE(HMM_RotateV2, 1)
-static inline HMM_Vec2 HMM_RotateV2(HMM_Vec2 V, float Angle)
+COVERAGE(HMM_CameraRelativeView, 1)
+// Returns View (for example from HMM_DLookAt_RH) in float with the camera moved to the origin,
+// for use with the camera-relative functions below.
+static inline HMM_Mat4 HMM_CameraRelativeView(HMM_DMat4 View)
 {
-    ASSERT_COVERED(HMM_RotateV2)
+    ASSERT_COVERED(HMM_CameraRelativeView);
 
-    float sinA = HMM_SinF(Angle);
-    float cosA = HMM_CosF(Angle);
+    HMM_Mat4 Result = HMM_DM4ToM4(View);
+    Result.Columns[3] = HMM_V4(0.0f, 0.0f, 0.0f, 1.0f);
 
-    return HMM_V2(V.X * cosA - V.Y * sinA, V.X * sinA + V.Y * cosA);
+    return Result;
 }
 
-// implementation from
-// https://blog.molecular-matters.com/2013/05/24/a-faster-quaternion-vector-multiplication/
-COVERAGE(HMM_RotateV3Q, 1)
-static inline HMM_Vec3 HMM_RotateV3Q(HMM_Vec3 V, HMM_Quat Q)
+COVERAGE(HMM_CameraRelativeV3, 1)
+// Returns Position - Camera in float.
+static inline HMM_Vec3 HMM_CameraRelativeV3(HMM_DVec3 Position, HMM_DVec3 Camera)
 {
-    ASSERT_COVERED(HMM_RotateV3Q);
+    ASSERT_COVERED(HMM_CameraRelativeV3);
 
-    HMM_Vec3 t = HMM_MulV3F(HMM_Cross(Q.XYZ, V), 2);
-    return HMM_AddV3(V, HMM_AddV3(HMM_MulV3F(t, Q.W), HMM_Cross(Q.XYZ, t)));
+    return _HMM_CameraRelativeV4(&Position, &Camera).XYZ;
 }
 
-COVERAGE(HMM_RotateV3AxisAngle_LH, 1)
-static inline HMM_Vec3 HMM_RotateV3AxisAngle_LH(HMM_Vec3 V, HMM_Vec3 Axis, float Angle) {
-    ASSERT_COVERED(HMM_RotateV3AxisAngle_LH);
+COVERAGE(HMM_CameraRelativeV3Array, 1)
+// Writes Positions[i] - Camera in float to Out, for example for instance data.
+static inline void HMM_CameraRelativeV3Array(const HMM_DVec3 *Positions, HMM_DVec3 Camera, HMM_Vec3 *Out, int Count)
+{
+    ASSERT_COVERED(HMM_CameraRelativeV3Array);
 
-    return HMM_RotateV3Q(V, HMM_QFromAxisAngle_LH(Axis, Angle));
+    for (int Index = 0; Index < Count; ++Index)
+    {
+        Out[Index] = _HMM_CameraRelativeV4(&Positions[Index], &Camera).XYZ;
+    }
 }
 
-COVERAGE(HMM_RotateV3AxisAngle_RH, 1)
-static inline HMM_Vec3 HMM_RotateV3AxisAngle_RH(HMM_Vec3 V, HMM_Vec3 Axis, float Angle) {
-    ASSERT_COVERED(HMM_RotateV3AxisAngle_RH);
+COVERAGE(HMM_CameraRelativeModelView, 1)
+// Returns View * Translate(Position - Camera) * Model in float. View is the camera-relative view
+// from HMM_CameraRelativeView, and Model is an affine float transform (rotation, scale and a
+// small local offset) around Position.
+static inline HMM_Mat4 HMM_CameraRelativeModelView(HMM_Mat4 View, HMM_DVec3 Camera, HMM_DVec3 Position, HMM_Mat4 Model)
+{
+    ASSERT_COVERED(HMM_CameraRelativeModelView);
 
-    return HMM_RotateV3Q(V, HMM_QFromAxisAngle_RH(Axis, Angle));
+    HMM_Mat4 Result = HMM_MulM4(View, Model);
+    HMM_Vec4 Offset = HMM_LinearCombineV4M4(_HMM_CameraRelativeV4(&Position, &Camera), View);
+    Result.Columns[3] = HMM_AddV4(Result.Columns[3], Offset);
+
+    return Result;
 }
 
+COVERAGE(HMM_CameraRelativeModelViewArray, 1)
+// Writes HMM_CameraRelativeModelView(View, Camera, Positions[i], Models[i]) to Out. Models may
+// be NULL for objects with no local transform. Out may be the same array as Models.
+static inline void HMM_CameraRelativeModelViewArray(HMM_Mat4 View, HMM_DVec3 Camera, const HMM_DVec3 *Positions,
+                                                    const HMM_Mat4 *Models, HMM_Mat4 *Out, int Count)
+{
+    ASSERT_COVERED(HMM_CameraRelativeModelViewArray);
+
+    for (int Index = 0; Index < Count; ++Index)
+    {
+        HMM_Mat4 ModelView = Models ? HMM_MulM4(View, Models[Index]) : View;
+        HMM_Vec4 Offset = HMM_LinearCombineV4M4(_HMM_CameraRelativeV4(&Positions[Index], &Camera), View);
+        ModelView.Columns[3] = HMM_AddV4(ModelView.Columns[3], Offset);
+        Out[Index] = ModelView;
+    }
+}
 
 #ifdef __cplusplus
 }
@@ -2684,6 +10073,34 @@ static inline float HMM_Len(HMM_Vec4 A)
     return HMM_LenV4(A);
 }
 
+COVERAGE(HMM_LenV3ACPP, 1)
+static inline float HMM_Len(HMM_Vec3A A)
+{
+    ASSERT_COVERED(HMM_LenV3ACPP);
+    return HMM_LenV3A(A);
+}
+
+COVERAGE(HMM_LenV3SoACPP, 1)
+static inline HMM_FloatSoA HMM_Len(HMM_Vec3SoA A)
+{
+    ASSERT_COVERED(HMM_LenV3SoACPP);
+    return HMM_LenV3SoA(A);
+}
+
+COVERAGE(HMM_LenV4SoACPP, 1)
+static inline HMM_FloatSoA HMM_Len(HMM_Vec4SoA A)
+{
+    ASSERT_COVERED(HMM_LenV4SoACPP);
+    return HMM_LenV4SoA(A);
+}
+
+COVERAGE(HMM_LenDV3CPP, 1)
+static inline double HMM_Len(HMM_DVec3 A)
+{
+    ASSERT_COVERED(HMM_LenDV3CPP);
+    return HMM_LenDV3(A);
+}
+
 COVERAGE(HMM_LenSqrV2CPP, 1)
 static inline float HMM_LenSqr(HMM_Vec2 A)
 {
@@ -2698,11 +10115,25 @@ static inline float HMM_LenSqr(HMM_Vec3 A)
     return HMM_LenSqrV3(A);
 }
 
-COVERAGE(HMM_LenSqrV4CPP, 1)
-static inline float HMM_LenSqr(HMM_Vec4 A)
+COVERAGE(HMM_LenSqrV4CPP, 1)
+static inline float HMM_LenSqr(HMM_Vec4 A)
+{
+    ASSERT_COVERED(HMM_LenSqrV4CPP);
+    return HMM_LenSqrV4(A);
+}
+
+COVERAGE(HMM_LenSqrV3ACPP, 1)
+static inline float HMM_LenSqr(HMM_Vec3A A)
+{
+    ASSERT_COVERED(HMM_LenSqrV3ACPP);
+    return HMM_LenSqrV3A(A);
+}
+
+COVERAGE(HMM_LenSqrDV3CPP, 1)
+static inline double HMM_LenSqr(HMM_DVec3 A)
 {
-    ASSERT_COVERED(HMM_LenSqrV4CPP);
-    return HMM_LenSqrV4(A);
+    ASSERT_COVERED(HMM_LenSqrDV3CPP);
+    return HMM_LenSqrDV3(A);
 }
 
 COVERAGE(HMM_NormV2CPP, 1)
@@ -2726,6 +10157,13 @@ static inline HMM_Vec4 HMM_Norm(HMM_Vec4 A)
     return HMM_NormV4(A);
 }
 
+COVERAGE(HMM_NormV3ACPP, 1)
+static inline HMM_Vec3A HMM_Norm(HMM_Vec3A A)
+{
+    ASSERT_COVERED(HMM_NormV3ACPP);
+    return HMM_NormV3A(A);
+}
+
 COVERAGE(HMM_NormQCPP, 1)
 static inline HMM_Quat HMM_Norm(HMM_Quat A)
 {
@@ -2733,6 +10171,41 @@ static inline HMM_Quat HMM_Norm(HMM_Quat A)
     return HMM_NormQ(A);
 }
 
+COVERAGE(HMM_NormDQCPP, 1)
+static inline HMM_DualQuat HMM_Norm(HMM_DualQuat A)
+{
+    ASSERT_COVERED(HMM_NormDQCPP);
+    return HMM_NormDQ(A);
+}
+
+COVERAGE(HMM_NormV3SoACPP, 1)
+static inline HMM_Vec3SoA HMM_Norm(HMM_Vec3SoA A)
+{
+    ASSERT_COVERED(HMM_NormV3SoACPP);
+    return HMM_NormV3SoA(A);
+}
+
+COVERAGE(HMM_NormV4SoACPP, 1)
+static inline HMM_Vec4SoA HMM_Norm(HMM_Vec4SoA A)
+{
+    ASSERT_COVERED(HMM_NormV4SoACPP);
+    return HMM_NormV4SoA(A);
+}
+
+COVERAGE(HMM_NormDV3CPP, 1)
+static inline HMM_DVec3 HMM_Norm(HMM_DVec3 A)
+{
+    ASSERT_COVERED(HMM_NormDV3CPP);
+    return HMM_NormDV3(A);
+}
+
+COVERAGE(HMM_NormDQuatCPP, 1)
+static inline HMM_DQuat HMM_Norm(HMM_DQuat Q)
+{
+    ASSERT_COVERED(HMM_NormDQuatCPP);
+    return HMM_NormDQuat(Q);
+}
+
 COVERAGE(HMM_DotV2CPP, 1)
 static inline float HMM_Dot(HMM_Vec2 Left, HMM_Vec2 VecTwo)
 {
@@ -2754,6 +10227,41 @@ static inline float HMM_Dot(HMM_Vec4 Left, HMM_Vec4 VecTwo)
     return HMM_DotV4(Left, VecTwo);
 }
 
+COVERAGE(HMM_DotV3ACPP, 1)
+static inline float HMM_Dot(HMM_Vec3A Left, HMM_Vec3A Right)
+{
+    ASSERT_COVERED(HMM_DotV3ACPP);
+    return HMM_DotV3A(Left, Right);
+}
+
+COVERAGE(HMM_DotV3SoACPP, 1)
+static inline HMM_FloatSoA HMM_Dot(HMM_Vec3SoA Left, HMM_Vec3SoA VecTwo)
+{
+    ASSERT_COVERED(HMM_DotV3SoACPP);
+    return HMM_DotV3SoA(Left, VecTwo);
+}
+
+COVERAGE(HMM_DotV4SoACPP, 1)
+static inline HMM_FloatSoA HMM_Dot(HMM_Vec4SoA Left, HMM_Vec4SoA VecTwo)
+{
+    ASSERT_COVERED(HMM_DotV4SoACPP);
+    return HMM_DotV4SoA(Left, VecTwo);
+}
+
+COVERAGE(HMM_DotDV3CPP, 1)
+static inline double HMM_Dot(HMM_DVec3 Left, HMM_DVec3 Right)
+{
+    ASSERT_COVERED(HMM_DotDV3CPP);
+    return HMM_DotDV3(Left, Right);
+}
+
+COVERAGE(HMM_DotDV4CPP, 1)
+static inline double HMM_Dot(HMM_DVec4 Left, HMM_DVec4 Right)
+{
+    ASSERT_COVERED(HMM_DotDV4CPP);
+    return HMM_DotDV4(Left, Right);
+}
+
 COVERAGE(HMM_LerpV2CPP, 1)
 static inline HMM_Vec2 HMM_Lerp(HMM_Vec2 Left, float Time, HMM_Vec2 Right)
 {
@@ -2775,6 +10283,27 @@ static inline HMM_Vec4 HMM_Lerp(HMM_Vec4 Left, float Time, HMM_Vec4 Right)
     return HMM_LerpV4(Left, Time, Right);
 }
 
+COVERAGE(HMM_LerpV3SoACPP, 1)
+static inline HMM_Vec3SoA HMM_Lerp(HMM_Vec3SoA Left, float Time, HMM_Vec3SoA Right)
+{
+    ASSERT_COVERED(HMM_LerpV3SoACPP);
+    return HMM_LerpV3SoA(Left, Time, Right);
+}
+
+COVERAGE(HMM_LerpV4SoACPP, 1)
+static inline HMM_Vec4SoA HMM_Lerp(HMM_Vec4SoA Left, float Time, HMM_Vec4SoA Right)
+{
+    ASSERT_COVERED(HMM_LerpV4SoACPP);
+    return HMM_LerpV4SoA(Left, Time, Right);
+}
+
+COVERAGE(HMM_LerpDV3CPP, 1)
+static inline HMM_DVec3 HMM_Lerp(HMM_DVec3 Left, double Time, HMM_DVec3 Right)
+{
+    ASSERT_COVERED(HMM_LerpDV3CPP);
+    return HMM_LerpDV3(Left, Time, Right);
+}
+
 COVERAGE(HMM_TransposeM2CPP, 1)
 static inline HMM_Mat2 HMM_Transpose(HMM_Mat2 Matrix)
 {
@@ -2796,6 +10325,13 @@ static inline HMM_Mat4 HMM_Transpose(HMM_Mat4 Matrix)
     return HMM_TransposeM4(Matrix);
 }
 
+COVERAGE(HMM_TransposeDM4CPP, 1)
+static inline HMM_DMat4 HMM_Transpose(HMM_DMat4 Matrix)
+{
+    ASSERT_COVERED(HMM_TransposeDM4CPP);
+    return HMM_TransposeDM4(Matrix);
+}
+
 COVERAGE(HMM_DeterminantM2CPP, 1)
 static inline float HMM_Determinant(HMM_Mat2 Matrix)
 {
@@ -2838,6 +10374,13 @@ static inline HMM_Mat4 HMM_InvGeneral(HMM_Mat4 Matrix)
     return HMM_InvGeneralM4(Matrix);
 }
 
+COVERAGE(HMM_InvGeneralDM4CPP, 1)
+static inline HMM_DMat4 HMM_InvGeneral(HMM_DMat4 Matrix)
+{
+    ASSERT_COVERED(HMM_InvGeneralDM4CPP);
+    return HMM_InvGeneralDM4(Matrix);
+}
+
 COVERAGE(HMM_DotQCPP, 1)
 static inline float HMM_Dot(HMM_Quat QuatOne, HMM_Quat QuatTwo)
 {
@@ -2845,6 +10388,13 @@ static inline float HMM_Dot(HMM_Quat QuatOne, HMM_Quat QuatTwo)
     return HMM_DotQ(QuatOne, QuatTwo);
 }
 
+COVERAGE(HMM_DotDQuatCPP, 1)
+static inline double HMM_Dot(HMM_DQuat QuatOne, HMM_DQuat QuatTwo)
+{
+    ASSERT_COVERED(HMM_DotDQuatCPP);
+    return HMM_DotDQuat(QuatOne, QuatTwo);
+}
+
 COVERAGE(HMM_AddV2CPP, 1)
 static inline HMM_Vec2 HMM_Add(HMM_Vec2 Left, HMM_Vec2 Right)
 {
@@ -2866,6 +10416,13 @@ static inline HMM_Vec4 HMM_Add(HMM_Vec4 Left, HMM_Vec4 Right)
     return HMM_AddV4(Left, Right);
 }
 
+COVERAGE(HMM_AddV3ACPP, 1)
+static inline HMM_Vec3A HMM_Add(HMM_Vec3A Left, HMM_Vec3A Right)
+{
+    ASSERT_COVERED(HMM_AddV3ACPP);
+    return HMM_AddV3A(Left, Right);
+}
+
 COVERAGE(HMM_AddM2CPP, 1)
 static inline HMM_Mat2 HMM_Add(HMM_Mat2 Left, HMM_Mat2 Right)
 {
@@ -2894,6 +10451,48 @@ static inline HMM_Quat HMM_Add(HMM_Quat Left, HMM_Quat Right)
     return HMM_AddQ(Left, Right);
 }
 
+COVERAGE(HMM_AddDQCPP, 1)
+static inline HMM_DualQuat HMM_Add(HMM_DualQuat Left, HMM_DualQuat Right)
+{
+    ASSERT_COVERED(HMM_AddDQCPP);
+    return HMM_AddDQ(Left, Right);
+}
+
+COVERAGE(HMM_AddV3SoACPP, 1)
+static inline HMM_Vec3SoA HMM_Add(HMM_Vec3SoA Left, HMM_Vec3SoA Right)
+{
+    ASSERT_COVERED(HMM_AddV3SoACPP);
+    return HMM_AddV3SoA(Left, Right);
+}
+
+COVERAGE(HMM_AddV4SoACPP, 1)
+static inline HMM_Vec4SoA HMM_Add(HMM_Vec4SoA Left, HMM_Vec4SoA Right)
+{
+    ASSERT_COVERED(HMM_AddV4SoACPP);
+    return HMM_AddV4SoA(Left, Right);
+}
+
+COVERAGE(HMM_AddDV3CPP, 1)
+static inline HMM_DVec3 HMM_Add(HMM_DVec3 Left, HMM_DVec3 Right)
+{
+    ASSERT_COVERED(HMM_AddDV3CPP);
+    return HMM_AddDV3(Left, Right);
+}
+
+COVERAGE(HMM_AddDV4CPP, 1)
+static inline HMM_DVec4 HMM_Add(HMM_DVec4 Left, HMM_DVec4 Right)
+{
+    ASSERT_COVERED(HMM_AddDV4CPP);
+    return HMM_AddDV4(Left, Right);
+}
+
+COVERAGE(HMM_AddDQuatCPP, 1)
+static inline HMM_DQuat HMM_Add(HMM_DQuat Left, HMM_DQuat Right)
+{
+    ASSERT_COVERED(HMM_AddDQuatCPP);
+    return HMM_AddDQuat(Left, Right);
+}
+
 COVERAGE(HMM_SubV2CPP, 1)
 static inline HMM_Vec2 HMM_Sub(HMM_Vec2 Left, HMM_Vec2 Right)
 {
@@ -2915,6 +10514,13 @@ static inline HMM_Vec4 HMM_Sub(HMM_Vec4 Left, HMM_Vec4 Right)
     return HMM_SubV4(Left, Right);
 }
 
+COVERAGE(HMM_SubV3ACPP, 1)
+static inline HMM_Vec3A HMM_Sub(HMM_Vec3A Left, HMM_Vec3A Right)
+{
+    ASSERT_COVERED(HMM_SubV3ACPP);
+    return HMM_SubV3A(Left, Right);
+}
+
 COVERAGE(HMM_SubM2CPP, 1)
 static inline HMM_Mat2 HMM_Sub(HMM_Mat2 Left, HMM_Mat2 Right)
 {
@@ -2943,6 +10549,41 @@ static inline HMM_Quat HMM_Sub(HMM_Quat Left, HMM_Quat Right)
     return HMM_SubQ(Left, Right);
 }
 
+COVERAGE(HMM_SubV3SoACPP, 1)
+static inline HMM_Vec3SoA HMM_Sub(HMM_Vec3SoA Left, HMM_Vec3SoA Right)
+{
+    ASSERT_COVERED(HMM_SubV3SoACPP);
+    return HMM_SubV3SoA(Left, Right);
+}
+
+COVERAGE(HMM_SubV4SoACPP, 1)
+static inline HMM_Vec4SoA HMM_Sub(HMM_Vec4SoA Left, HMM_Vec4SoA Right)
+{
+    ASSERT_COVERED(HMM_SubV4SoACPP);
+    return HMM_SubV4SoA(Left, Right);
+}
+
+COVERAGE(HMM_SubDV3CPP, 1)
+static inline HMM_DVec3 HMM_Sub(HMM_DVec3 Left, HMM_DVec3 Right)
+{
+    ASSERT_COVERED(HMM_SubDV3CPP);
+    return HMM_SubDV3(Left, Right);
+}
+
+COVERAGE(HMM_SubDV4CPP, 1)
+static inline HMM_DVec4 HMM_Sub(HMM_DVec4 Left, HMM_DVec4 Right)
+{
+    ASSERT_COVERED(HMM_SubDV4CPP);
+    return HMM_SubDV4(Left, Right);
+}
+
+COVERAGE(HMM_SubDQuatCPP, 1)
+static inline HMM_DQuat HMM_Sub(HMM_DQuat Left, HMM_DQuat Right)
+{
+    ASSERT_COVERED(HMM_SubDQuatCPP);
+    return HMM_SubDQuat(Left, Right);
+}
+
 COVERAGE(HMM_MulV2CPP, 1)
 static inline HMM_Vec2 HMM_Mul(HMM_Vec2 Left, HMM_Vec2 Right)
 {
@@ -2978,6 +10619,13 @@ static inline HMM_Vec4 HMM_Mul(HMM_Vec4 Left, HMM_Vec4 Right)
     return HMM_MulV4(Left, Right);
 }
 
+COVERAGE(HMM_MulV3ACPP, 1)
+static inline HMM_Vec3A HMM_Mul(HMM_Vec3A Left, HMM_Vec3A Right)
+{
+    ASSERT_COVERED(HMM_MulV3ACPP);
+    return HMM_MulV3A(Left, Right);
+}
+
 COVERAGE(HMM_MulV4FCPP, 1)
 static inline HMM_Vec4 HMM_Mul(HMM_Vec4 Left, float Right)
 {
@@ -2985,6 +10633,13 @@ static inline HMM_Vec4 HMM_Mul(HMM_Vec4 Left, float Right)
     return HMM_MulV4F(Left, Right);
 }
 
+COVERAGE(HMM_MulV3AFCPP, 1)
+static inline HMM_Vec3A HMM_Mul(HMM_Vec3A Left, float Right)
+{
+    ASSERT_COVERED(HMM_MulV3AFCPP);
+    return HMM_MulV3AF(Left, Right);
+}
+
 COVERAGE(HMM_MulM2CPP, 1)
 static inline HMM_Mat2 HMM_Mul(HMM_Mat2 Left, HMM_Mat2 Right)
 {
@@ -3006,6 +10661,13 @@ static inline HMM_Mat4 HMM_Mul(HMM_Mat4 Left, HMM_Mat4 Right)
     return HMM_MulM4(Left, Right);
 }
 
+COVERAGE(HMM_MulA34CPP, 1)
+static inline HMM_Affine3x4 HMM_Mul(HMM_Affine3x4 Left, HMM_Affine3x4 Right)
+{
+    ASSERT_COVERED(HMM_MulA34CPP);
+    return HMM_MulA34(Left, Right);
+}
+
 COVERAGE(HMM_MulM2FCPP, 1)
 static inline HMM_Mat2 HMM_Mul(HMM_Mat2 Left, float Right)
 {
@@ -3055,6 +10717,20 @@ static inline HMM_Quat HMM_Mul(HMM_Quat Left, HMM_Quat Right)
     return HMM_MulQ(Left, Right);
 }
 
+COVERAGE(HMM_MulDQCPP, 1)
+static inline HMM_DualQuat HMM_Mul(HMM_DualQuat Left, HMM_DualQuat Right)
+{
+    ASSERT_COVERED(HMM_MulDQCPP);
+    return HMM_MulDQ(Left, Right);
+}
+
+COVERAGE(HMM_MulTRSCPP, 1)
+static inline HMM_TRS HMM_Mul(HMM_TRS Left, HMM_TRS Right)
+{
+    ASSERT_COVERED(HMM_MulTRSCPP);
+    return HMM_MulTRS(Left, Right);
+}
+
 COVERAGE(HMM_MulQFCPP, 1)
 static inline HMM_Quat HMM_Mul(HMM_Quat Left, float Right)
 {
@@ -3062,6 +10738,97 @@ static inline HMM_Quat HMM_Mul(HMM_Quat Left, float Right)
     return HMM_MulQF(Left, Right);
 }
 
+COVERAGE(HMM_MulDQFCPP, 1)
+static inline HMM_DualQuat HMM_Mul(HMM_DualQuat Left, float Right)
+{
+    ASSERT_COVERED(HMM_MulDQFCPP);
+    return HMM_MulDQF(Left, Right);
+}
+
+COVERAGE(HMM_MulV3SoACPP, 1)
+static inline HMM_Vec3SoA HMM_Mul(HMM_Vec3SoA Left, HMM_Vec3SoA Right)
+{
+    ASSERT_COVERED(HMM_MulV3SoACPP);
+    return HMM_MulV3SoA(Left, Right);
+}
+
+COVERAGE(HMM_MulV3SoAFCPP, 1)
+static inline HMM_Vec3SoA HMM_Mul(HMM_Vec3SoA Left, float Right)
+{
+    ASSERT_COVERED(HMM_MulV3SoAFCPP);
+    return HMM_MulV3SoAF(Left, Right);
+}
+
+COVERAGE(HMM_MulV4SoACPP, 1)
+static inline HMM_Vec4SoA HMM_Mul(HMM_Vec4SoA Left, HMM_Vec4SoA Right)
+{
+    ASSERT_COVERED(HMM_MulV4SoACPP);
+    return HMM_MulV4SoA(Left, Right);
+}
+
+COVERAGE(HMM_MulV4SoAFCPP, 1)
+static inline HMM_Vec4SoA HMM_Mul(HMM_Vec4SoA Left, float Right)
+{
+    ASSERT_COVERED(HMM_MulV4SoAFCPP);
+    return HMM_MulV4SoAF(Left, Right);
+}
+
+COVERAGE(HMM_MulDV3CPP, 1)
+static inline HMM_DVec3 HMM_Mul(HMM_DVec3 Left, HMM_DVec3 Right)
+{
+    ASSERT_COVERED(HMM_MulDV3CPP);
+    return HMM_MulDV3(Left, Right);
+}
+
+COVERAGE(HMM_MulDV4CPP, 1)
+static inline HMM_DVec4 HMM_Mul(HMM_DVec4 Left, HMM_DVec4 Right)
+{
+    ASSERT_COVERED(HMM_MulDV4CPP);
+    return HMM_MulDV4(Left, Right);
+}
+
+COVERAGE(HMM_MulDV3FCPP, 1)
+static inline HMM_DVec3 HMM_Mul(HMM_DVec3 Left, double Right)
+{
+    ASSERT_COVERED(HMM_MulDV3FCPP);
+    return HMM_MulDV3F(Left, Right);
+}
+
+COVERAGE(HMM_MulDV4FCPP, 1)
+static inline HMM_DVec4 HMM_Mul(HMM_DVec4 Left, double Right)
+{
+    ASSERT_COVERED(HMM_MulDV4FCPP);
+    return HMM_MulDV4F(Left, Right);
+}
+
+COVERAGE(HMM_MulDM4CPP, 1)
+static inline HMM_DMat4 HMM_Mul(HMM_DMat4 Left, HMM_DMat4 Right)
+{
+    ASSERT_COVERED(HMM_MulDM4CPP);
+    return HMM_MulDM4(Left, Right);
+}
+
+COVERAGE(HMM_MulDM4V4CPP, 1)
+static inline HMM_DVec4 HMM_Mul(HMM_DMat4 Matrix, HMM_DVec4 Vector)
+{
+    ASSERT_COVERED(HMM_MulDM4V4CPP);
+    return HMM_MulDM4V4(Matrix, Vector);
+}
+
+COVERAGE(HMM_MulDQuatCPP, 1)
+static inline HMM_DQuat HMM_Mul(HMM_DQuat Left, HMM_DQuat Right)
+{
+    ASSERT_COVERED(HMM_MulDQuatCPP);
+    return HMM_MulDQuat(Left, Right);
+}
+
+COVERAGE(HMM_MulDQuatFCPP, 1)
+static inline HMM_DQuat HMM_Mul(HMM_DQuat Left, double Right)
+{
+    ASSERT_COVERED(HMM_MulDQuatFCPP);
+    return HMM_MulDQuatF(Left, Right);
+}
+
 COVERAGE(HMM_DivV2CPP, 1)
 static inline HMM_Vec2 HMM_Div(HMM_Vec2 Left, HMM_Vec2 Right)
 {
@@ -3097,6 +10864,13 @@ static inline HMM_Vec4 HMM_Div(HMM_Vec4 Left, HMM_Vec4 Right)
     return HMM_DivV4(Left, Right);
 }
 
+COVERAGE(HMM_DivV3ACPP, 1)
+static inline HMM_Vec3A HMM_Div(HMM_Vec3A Left, HMM_Vec3A Right)
+{
+    ASSERT_COVERED(HMM_DivV3ACPP);
+    return HMM_DivV3A(Left, Right);
+}
+
 COVERAGE(HMM_DivV4FCPP, 1)
 static inline HMM_Vec4 HMM_Div(HMM_Vec4 Left, float Right)
 {
@@ -3104,6 +10878,13 @@ static inline HMM_Vec4 HMM_Div(HMM_Vec4 Left, float Right)
     return HMM_DivV4F(Left, Right);
 }
 
+COVERAGE(HMM_DivV3AFCPP, 1)
+static inline HMM_Vec3A HMM_Div(HMM_Vec3A Left, float Right)
+{
+    ASSERT_COVERED(HMM_DivV3AFCPP);
+    return HMM_DivV3AF(Left, Right);
+}
+
 COVERAGE(HMM_DivM2FCPP, 1)
 static inline HMM_Mat2 HMM_Div(HMM_Mat2 Left, float Right)
 {
@@ -3132,6 +10913,27 @@ static inline HMM_Quat HMM_Div(HMM_Quat Left, float Right)
     return HMM_DivQF(Left, Right);
 }
 
+COVERAGE(HMM_DivDV3FCPP, 1)
+static inline HMM_DVec3 HMM_Div(HMM_DVec3 Left, double Right)
+{
+    ASSERT_COVERED(HMM_DivDV3FCPP);
+    return HMM_DivDV3F(Left, Right);
+}
+
+COVERAGE(HMM_DivDV4FCPP, 1)
+static inline HMM_DVec4 HMM_Div(HMM_DVec4 Left, double Right)
+{
+    ASSERT_COVERED(HMM_DivDV4FCPP);
+    return HMM_DivDV4F(Left, Right);
+}
+
+COVERAGE(HMM_DivDQuatFCPP, 1)
+static inline HMM_DQuat HMM_Div(HMM_DQuat Left, double Right)
+{
+    ASSERT_COVERED(HMM_DivDQuatFCPP);
+    return HMM_DivDQuatF(Left, Right);
+}
+
 COVERAGE(HMM_EqV2CPP, 1)
 static inline HMM_Bool HMM_Eq(HMM_Vec2 Left, HMM_Vec2 Right)
 {
@@ -3174,6 +10976,13 @@ static inline HMM_Vec4 operator+(HMM_Vec4 Left, HMM_Vec4 Right)
     return HMM_AddV4(Left, Right);
 }
 
+COVERAGE(HMM_AddV3AOp, 1)
+static inline HMM_Vec3A operator+(HMM_Vec3A Left, HMM_Vec3A Right)
+{
+    ASSERT_COVERED(HMM_AddV3AOp);
+    return HMM_AddV3A(Left, Right);
+}
+
 COVERAGE(HMM_AddM2Op, 1)
 static inline HMM_Mat2 operator+(HMM_Mat2 Left, HMM_Mat2 Right)
 {
@@ -3202,6 +11011,48 @@ static inline HMM_Quat operator+(HMM_Quat Left, HMM_Quat Right)
     return HMM_AddQ(Left, Right);
 }
 
+COVERAGE(HMM_AddDQOp, 1)
+static inline HMM_DualQuat operator+(HMM_DualQuat Left, HMM_DualQuat Right)
+{
+    ASSERT_COVERED(HMM_AddDQOp);
+    return HMM_AddDQ(Left, Right);
+}
+
+COVERAGE(HMM_AddV3SoAOp, 1)
+static inline HMM_Vec3SoA operator+(HMM_Vec3SoA Left, HMM_Vec3SoA Right)
+{
+    ASSERT_COVERED(HMM_AddV3SoAOp);
+    return HMM_AddV3SoA(Left, Right);
+}
+
+COVERAGE(HMM_AddV4SoAOp, 1)
+static inline HMM_Vec4SoA operator+(HMM_Vec4SoA Left, HMM_Vec4SoA Right)
+{
+    ASSERT_COVERED(HMM_AddV4SoAOp);
+    return HMM_AddV4SoA(Left, Right);
+}
+
+COVERAGE(HMM_AddDV3Op, 1)
+static inline HMM_DVec3 operator+(HMM_DVec3 Left, HMM_DVec3 Right)
+{
+    ASSERT_COVERED(HMM_AddDV3Op);
+    return HMM_AddDV3(Left, Right);
+}
+
+COVERAGE(HMM_AddDV4Op, 1)
+static inline HMM_DVec4 operator+(HMM_DVec4 Left, HMM_DVec4 Right)
+{
+    ASSERT_COVERED(HMM_AddDV4Op);
+    return HMM_AddDV4(Left, Right);
+}
+
+COVERAGE(HMM_AddDQuatOp, 1)
+static inline HMM_DQuat operator+(HMM_DQuat Left, HMM_DQuat Right)
+{
+    ASSERT_COVERED(HMM_AddDQuatOp);
+    return HMM_AddDQuat(Left, Right);
+}
+
 COVERAGE(HMM_SubV2Op, 1)
 static inline HMM_Vec2 operator-(HMM_Vec2 Left, HMM_Vec2 Right)
 {
@@ -3223,6 +11074,13 @@ static inline HMM_Vec4 operator-(HMM_Vec4 Left, HMM_Vec4 Right)
     return HMM_SubV4(Left, Right);
 }
 
+COVERAGE(HMM_SubV3AOp, 1)
+static inline HMM_Vec3A operator-(HMM_Vec3A Left, HMM_Vec3A Right)
+{
+    ASSERT_COVERED(HMM_SubV3AOp);
+    return HMM_SubV3A(Left, Right);
+}
+
 COVERAGE(HMM_SubM2Op, 1)
 static inline HMM_Mat2 operator-(HMM_Mat2 Left, HMM_Mat2 Right)
 {
@@ -3251,6 +11109,41 @@ static inline HMM_Quat operator-(HMM_Quat Left, HMM_Quat Right)
     return HMM_SubQ(Left, Right);
 }
 
+COVERAGE(HMM_SubV3SoAOp, 1)
+static inline HMM_Vec3SoA operator-(HMM_Vec3SoA Left, HMM_Vec3SoA Right)
+{
+    ASSERT_COVERED(HMM_SubV3SoAOp);
+    return HMM_SubV3SoA(Left, Right);
+}
+
+COVERAGE(HMM_SubV4SoAOp, 1)
+static inline HMM_Vec4SoA operator-(HMM_Vec4SoA Left, HMM_Vec4SoA Right)
+{
+    ASSERT_COVERED(HMM_SubV4SoAOp);
+    return HMM_SubV4SoA(Left, Right);
+}
+
+COVERAGE(HMM_SubDV3Op, 1)
+static inline HMM_DVec3 operator-(HMM_DVec3 Left, HMM_DVec3 Right)
+{
+    ASSERT_COVERED(HMM_SubDV3Op);
+    return HMM_SubDV3(Left, Right);
+}
+
+COVERAGE(HMM_SubDV4Op, 1)
+static inline HMM_DVec4 operator-(HMM_DVec4 Left, HMM_DVec4 Right)
+{
+    ASSERT_COVERED(HMM_SubDV4Op);
+    return HMM_SubDV4(Left, Right);
+}
+
+COVERAGE(HMM_SubDQuatOp, 1)
+static inline HMM_DQuat operator-(HMM_DQuat Left, HMM_DQuat Right)
+{
+    ASSERT_COVERED(HMM_SubDQuatOp);
+    return HMM_SubDQuat(Left, Right);
+}
+
 COVERAGE(HMM_MulV2Op, 1)
 static inline HMM_Vec2 operator*(HMM_Vec2 Left, HMM_Vec2 Right)
 {
@@ -3258,46 +11151,116 @@ static inline HMM_Vec2 operator*(HMM_Vec2 Left, HMM_Vec2 Right)
     return HMM_MulV2(Left, Right);
 }
 
-COVERAGE(HMM_MulV3Op, 1)
-static inline HMM_Vec3 operator*(HMM_Vec3 Left, HMM_Vec3 Right)
+COVERAGE(HMM_MulV3Op, 1)
+static inline HMM_Vec3 operator*(HMM_Vec3 Left, HMM_Vec3 Right)
+{
+    ASSERT_COVERED(HMM_MulV3Op);
+    return HMM_MulV3(Left, Right);
+}
+
+COVERAGE(HMM_MulV4Op, 1)
+static inline HMM_Vec4 operator*(HMM_Vec4 Left, HMM_Vec4 Right)
+{
+    ASSERT_COVERED(HMM_MulV4Op);
+    return HMM_MulV4(Left, Right);
+}
+
+COVERAGE(HMM_MulV3AOp, 1)
+static inline HMM_Vec3A operator*(HMM_Vec3A Left, HMM_Vec3A Right)
+{
+    ASSERT_COVERED(HMM_MulV3AOp);
+    return HMM_MulV3A(Left, Right);
+}
+
+COVERAGE(HMM_MulM2Op, 1)
+static inline HMM_Mat2 operator*(HMM_Mat2 Left, HMM_Mat2 Right)
+{
+    ASSERT_COVERED(HMM_MulM2Op);
+    return HMM_MulM2(Left, Right);
+}
+
+COVERAGE(HMM_MulM3Op, 1)
+static inline HMM_Mat3 operator*(HMM_Mat3 Left, HMM_Mat3 Right)
+{
+    ASSERT_COVERED(HMM_MulM3Op);
+    return HMM_MulM3(Left, Right);
+}
+
+COVERAGE(HMM_MulM4Op, 1)
+static inline HMM_Mat4 operator*(HMM_Mat4 Left, HMM_Mat4 Right)
+{
+    ASSERT_COVERED(HMM_MulM4Op);
+    return HMM_MulM4(Left, Right);
+}
+
+COVERAGE(HMM_MulA34Op, 1)
+static inline HMM_Affine3x4 operator*(HMM_Affine3x4 Left, HMM_Affine3x4 Right)
+{
+    ASSERT_COVERED(HMM_MulA34Op);
+    return HMM_MulA34(Left, Right);
+}
+
+COVERAGE(HMM_MulQOp, 1)
+static inline HMM_Quat operator*(HMM_Quat Left, HMM_Quat Right)
+{
+    ASSERT_COVERED(HMM_MulQOp);
+    return HMM_MulQ(Left, Right);
+}
+
+COVERAGE(HMM_MulDQOp, 1)
+static inline HMM_DualQuat operator*(HMM_DualQuat Left, HMM_DualQuat Right)
+{
+    ASSERT_COVERED(HMM_MulDQOp);
+    return HMM_MulDQ(Left, Right);
+}
+
+COVERAGE(HMM_MulTRSOp, 1)
+static inline HMM_TRS operator*(HMM_TRS Left, HMM_TRS Right)
+{
+    ASSERT_COVERED(HMM_MulTRSOp);
+    return HMM_MulTRS(Left, Right);
+}
+
+COVERAGE(HMM_MulV3SoAOp, 1)
+static inline HMM_Vec3SoA operator*(HMM_Vec3SoA Left, HMM_Vec3SoA Right)
 {
-    ASSERT_COVERED(HMM_MulV3Op);
-    return HMM_MulV3(Left, Right);
+    ASSERT_COVERED(HMM_MulV3SoAOp);
+    return HMM_MulV3SoA(Left, Right);
 }
 
-COVERAGE(HMM_MulV4Op, 1)
-static inline HMM_Vec4 operator*(HMM_Vec4 Left, HMM_Vec4 Right)
+COVERAGE(HMM_MulV4SoAOp, 1)
+static inline HMM_Vec4SoA operator*(HMM_Vec4SoA Left, HMM_Vec4SoA Right)
 {
-    ASSERT_COVERED(HMM_MulV4Op);
-    return HMM_MulV4(Left, Right);
+    ASSERT_COVERED(HMM_MulV4SoAOp);
+    return HMM_MulV4SoA(Left, Right);
 }
 
-COVERAGE(HMM_MulM2Op, 1)
-static inline HMM_Mat2 operator*(HMM_Mat2 Left, HMM_Mat2 Right)
+COVERAGE(HMM_MulDV3Op, 1)
+static inline HMM_DVec3 operator*(HMM_DVec3 Left, HMM_DVec3 Right)
 {
-    ASSERT_COVERED(HMM_MulM2Op);
-    return HMM_MulM2(Left, Right);
+    ASSERT_COVERED(HMM_MulDV3Op);
+    return HMM_MulDV3(Left, Right);
 }
 
-COVERAGE(HMM_MulM3Op, 1)
-static inline HMM_Mat3 operator*(HMM_Mat3 Left, HMM_Mat3 Right)
+COVERAGE(HMM_MulDV4Op, 1)
+static inline HMM_DVec4 operator*(HMM_DVec4 Left, HMM_DVec4 Right)
 {
-    ASSERT_COVERED(HMM_MulM3Op);
-    return HMM_MulM3(Left, Right);
+    ASSERT_COVERED(HMM_MulDV4Op);
+    return HMM_MulDV4(Left, Right);
 }
 
-COVERAGE(HMM_MulM4Op, 1)
-static inline HMM_Mat4 operator*(HMM_Mat4 Left, HMM_Mat4 Right)
+COVERAGE(HMM_MulDM4Op, 1)
+static inline HMM_DMat4 operator*(HMM_DMat4 Left, HMM_DMat4 Right)
 {
-    ASSERT_COVERED(HMM_MulM4Op);
-    return HMM_MulM4(Left, Right);
+    ASSERT_COVERED(HMM_MulDM4Op);
+    return HMM_MulDM4(Left, Right);
 }
 
-COVERAGE(HMM_MulQOp, 1)
-static inline HMM_Quat operator*(HMM_Quat Left, HMM_Quat Right)
+COVERAGE(HMM_MulDQuatOp, 1)
+static inline HMM_DQuat operator*(HMM_DQuat Left, HMM_DQuat Right)
 {
-    ASSERT_COVERED(HMM_MulQOp);
-    return HMM_MulQ(Left, Right);
+    ASSERT_COVERED(HMM_MulDQuatOp);
+    return HMM_MulDQuat(Left, Right);
 }
 
 COVERAGE(HMM_MulV2FOp, 1)
@@ -3321,6 +11284,13 @@ static inline HMM_Vec4 operator*(HMM_Vec4 Left, float Right)
     return HMM_MulV4F(Left, Right);
 }
 
+COVERAGE(HMM_MulV3AFOp, 1)
+static inline HMM_Vec3A operator*(HMM_Vec3A Left, float Right)
+{
+    ASSERT_COVERED(HMM_MulV3AFOp);
+    return HMM_MulV3AF(Left, Right);
+}
+
 COVERAGE(HMM_MulM2FOp, 1)
 static inline HMM_Mat2 operator*(HMM_Mat2 Left, float Right)
 {
@@ -3349,6 +11319,48 @@ static inline HMM_Quat operator*(HMM_Quat Left, float Right)
     return HMM_MulQF(Left, Right);
 }
 
+COVERAGE(HMM_MulDQFOp, 1)
+static inline HMM_DualQuat operator*(HMM_DualQuat Left, float Right)
+{
+    ASSERT_COVERED(HMM_MulDQFOp);
+    return HMM_MulDQF(Left, Right);
+}
+
+COVERAGE(HMM_MulV3SoAFOp, 1)
+static inline HMM_Vec3SoA operator*(HMM_Vec3SoA Left, float Right)
+{
+    ASSERT_COVERED(HMM_MulV3SoAFOp);
+    return HMM_MulV3SoAF(Left, Right);
+}
+
+COVERAGE(HMM_MulV4SoAFOp, 1)
+static inline HMM_Vec4SoA operator*(HMM_Vec4SoA Left, float Right)
+{
+    ASSERT_COVERED(HMM_MulV4SoAFOp);
+    return HMM_MulV4SoAF(Left, Right);
+}
+
+COVERAGE(HMM_MulDV3FOp, 1)
+static inline HMM_DVec3 operator*(HMM_DVec3 Left, double Right)
+{
+    ASSERT_COVERED(HMM_MulDV3FOp);
+    return HMM_MulDV3F(Left, Right);
+}
+
+COVERAGE(HMM_MulDV4FOp, 1)
+static inline HMM_DVec4 operator*(HMM_DVec4 Left, double Right)
+{
+    ASSERT_COVERED(HMM_MulDV4FOp);
+    return HMM_MulDV4F(Left, Right);
+}
+
+COVERAGE(HMM_MulDQuatFOp, 1)
+static inline HMM_DQuat operator*(HMM_DQuat Left, double Right)
+{
+    ASSERT_COVERED(HMM_MulDQuatFOp);
+    return HMM_MulDQuatF(Left, Right);
+}
+
 COVERAGE(HMM_MulV2FOpLeft, 1)
 static inline HMM_Vec2 operator*(float Left, HMM_Vec2 Right)
 {
@@ -3370,6 +11382,13 @@ static inline HMM_Vec4 operator*(float Left, HMM_Vec4 Right)
     return HMM_MulV4F(Right, Left);
 }
 
+COVERAGE(HMM_MulV3AFOpLeft, 1)
+static inline HMM_Vec3A operator*(float Left, HMM_Vec3A Right)
+{
+    ASSERT_COVERED(HMM_MulV3AFOpLeft);
+    return HMM_MulV3AF(Right, Left);
+}
+
 COVERAGE(HMM_MulM2FOpLeft, 1)
 static inline HMM_Mat2 operator*(float Left, HMM_Mat2 Right)
 {
@@ -3398,6 +11417,48 @@ static inline HMM_Quat operator*(float Left, HMM_Quat Right)
     return HMM_MulQF(Right, Left);
 }
 
+COVERAGE(HMM_MulDQFOpLeft, 1)
+static inline HMM_DualQuat operator*(float Left, HMM_DualQuat Right)
+{
+    ASSERT_COVERED(HMM_MulDQFOpLeft);
+    return HMM_MulDQF(Right, Left);
+}
+
+COVERAGE(HMM_MulV3SoAFOpLeft, 1)
+static inline HMM_Vec3SoA operator*(float Left, HMM_Vec3SoA Right)
+{
+    ASSERT_COVERED(HMM_MulV3SoAFOpLeft);
+    return HMM_MulV3SoAF(Right, Left);
+}
+
+COVERAGE(HMM_MulV4SoAFOpLeft, 1)
+static inline HMM_Vec4SoA operator*(float Left, HMM_Vec4SoA Right)
+{
+    ASSERT_COVERED(HMM_MulV4SoAFOpLeft);
+    return HMM_MulV4SoAF(Right, Left);
+}
+
+COVERAGE(HMM_MulDV3FOpLeft, 1)
+static inline HMM_DVec3 operator*(double Left, HMM_DVec3 Right)
+{
+    ASSERT_COVERED(HMM_MulDV3FOpLeft);
+    return HMM_MulDV3F(Right, Left);
+}
+
+COVERAGE(HMM_MulDV4FOpLeft, 1)
+static inline HMM_DVec4 operator*(double Left, HMM_DVec4 Right)
+{
+    ASSERT_COVERED(HMM_MulDV4FOpLeft);
+    return HMM_MulDV4F(Right, Left);
+}
+
+COVERAGE(HMM_MulDQuatFOpLeft, 1)
+static inline HMM_DQuat operator*(double Left, HMM_DQuat Right)
+{
+    ASSERT_COVERED(HMM_MulDQuatFOpLeft);
+    return HMM_MulDQuatF(Right, Left);
+}
+
 COVERAGE(HMM_MulM2V2Op, 1)
 static inline HMM_Vec2 operator*(HMM_Mat2 Matrix, HMM_Vec2 Vector)
 {
@@ -3419,6 +11480,13 @@ static inline HMM_Vec4 operator*(HMM_Mat4 Matrix, HMM_Vec4 Vector)
     return HMM_MulM4V4(Matrix, Vector);
 }
 
+COVERAGE(HMM_MulDM4V4Op, 1)
+static inline HMM_DVec4 operator*(HMM_DMat4 Matrix, HMM_DVec4 Vector)
+{
+    ASSERT_COVERED(HMM_MulDM4V4Op);
+    return HMM_MulDM4V4(Matrix, Vector);
+}
+
 COVERAGE(HMM_DivV2Op, 1)
 static inline HMM_Vec2 operator/(HMM_Vec2 Left, HMM_Vec2 Right)
 {
@@ -3440,6 +11508,13 @@ static inline HMM_Vec4 operator/(HMM_Vec4 Left, HMM_Vec4 Right)
     return HMM_DivV4(Left, Right);
 }
 
+COVERAGE(HMM_DivV3AOp, 1)
+static inline HMM_Vec3A operator/(HMM_Vec3A Left, HMM_Vec3A Right)
+{
+    ASSERT_COVERED(HMM_DivV3AOp);
+    return HMM_DivV3A(Left, Right);
+}
+
 COVERAGE(HMM_DivV2FOp, 1)
 static inline HMM_Vec2 operator/(HMM_Vec2 Left, float Right)
 {
@@ -3461,6 +11536,13 @@ static inline HMM_Vec4 operator/(HMM_Vec4 Left, float Right)
     return HMM_DivV4F(Left, Right);
 }
 
+COVERAGE(HMM_DivV3AFOp, 1)
+static inline HMM_Vec3A operator/(HMM_Vec3A Left, float Right)
+{
+    ASSERT_COVERED(HMM_DivV3AFOp);
+    return HMM_DivV3AF(Left, Right);
+}
+
 COVERAGE(HMM_DivM4FOp, 1)
 static inline HMM_Mat4 operator/(HMM_Mat4 Left, float Right)
 {
@@ -3489,6 +11571,27 @@ static inline HMM_Quat operator/(HMM_Quat Left, float Right)
     return HMM_DivQF(Left, Right);
 }
 
+COVERAGE(HMM_DivDV3FOp, 1)
+static inline HMM_DVec3 operator/(HMM_DVec3 Left, double Right)
+{
+    ASSERT_COVERED(HMM_DivDV3FOp);
+    return HMM_DivDV3F(Left, Right);
+}
+
+COVERAGE(HMM_DivDV4FOp, 1)
+static inline HMM_DVec4 operator/(HMM_DVec4 Left, double Right)
+{
+    ASSERT_COVERED(HMM_DivDV4FOp);
+    return HMM_DivDV4F(Left, Right);
+}
+
+COVERAGE(HMM_DivDQuatFOp, 1)
+static inline HMM_DQuat operator/(HMM_DQuat Left, double Right)
+{
+    ASSERT_COVERED(HMM_DivDQuatFOp);
+    return HMM_DivDQuatF(Left, Right);
+}
+
 COVERAGE(HMM_AddV2Assign, 1)
 static inline HMM_Vec2 &operator+=(HMM_Vec2 &Left, HMM_Vec2 Right)
 {
@@ -3801,6 +11904,27 @@ static inline HMM_Vec4 operator-(HMM_Vec4 In)
     return Result;
 }
 
+COVERAGE(HMM_UnaryMinusV3A, 1)
+static inline HMM_Vec3A operator-(HMM_Vec3A In)
+{
+    ASSERT_COVERED(HMM_UnaryMinusV3A);
+    return HMM_MulV3AF(In, -1.0f);
+}
+
+COVERAGE(HMM_UnaryMinusDV3, 1)
+static inline HMM_DVec3 operator-(HMM_DVec3 In)
+{
+    ASSERT_COVERED(HMM_UnaryMinusDV3);
+    return HMM_MulDV3F(In, -1.0);
+}
+
+COVERAGE(HMM_UnaryMinusDV4, 1)
+static inline HMM_DVec4 operator-(HMM_DVec4 In)
+{
+    ASSERT_COVERED(HMM_UnaryMinusDV4);
+    return HMM_MulDV4F(In, -1.0);
+}
+
 #endif /* __cplusplus*/
 
 #ifdef HANDMADE_MATH__USE_C11_GENERICS
@@ -3811,20 +11935,33 @@ void __hmm_invalid_generic(void);
     HMM_Vec2: HMM_AddV2, \
     HMM_Vec3: HMM_AddV3, \
     HMM_Vec4: HMM_AddV4, \
+    HMM_Vec3A: HMM_AddV3A, \
     HMM_Mat2: HMM_AddM2, \
     HMM_Mat3: HMM_AddM3, \
     HMM_Mat4: HMM_AddM4, \
-    HMM_Quat: HMM_AddQ   \
+    HMM_Quat: HMM_AddQ,  \
+    HMM_DualQuat: HMM_AddDQ, \
+    HMM_Vec3SoA: HMM_AddV3SoA, \
+    HMM_Vec4SoA: HMM_AddV4SoA, \
+    HMM_DVec3: HMM_AddDV3, \
+    HMM_DVec4: HMM_AddDV4, \
+    HMM_DQuat: HMM_AddDQuat  \
 )(A, B)
 
 #define HMM_Sub(A, B) _Generic((A), \
     HMM_Vec2: HMM_SubV2, \
     HMM_Vec3: HMM_SubV3, \
     HMM_Vec4: HMM_SubV4, \
+    HMM_Vec3A: HMM_SubV3A, \
     HMM_Mat2: HMM_SubM2, \
     HMM_Mat3: HMM_SubM3, \
     HMM_Mat4: HMM_SubM4, \
-    HMM_Quat: HMM_SubQ   \
+    HMM_Quat: HMM_SubQ,  \
+    HMM_Vec3SoA: HMM_SubV3SoA, \
+    HMM_Vec4SoA: HMM_SubV4SoA, \
+    HMM_DVec3: HMM_SubDV3, \
+    HMM_DVec4: HMM_SubDV4, \
+    HMM_DQuat: HMM_SubDQuat  \
 )(A, B)
 
 #define HMM_Mul(A, B) _Generic((B), \
@@ -3832,10 +11969,20 @@ void __hmm_invalid_generic(void);
         HMM_Vec2: HMM_MulV2F, \
         HMM_Vec3: HMM_MulV3F, \
         HMM_Vec4: HMM_MulV4F, \
+        HMM_Vec3A: HMM_MulV3AF, \
         HMM_Mat2: HMM_MulM2F, \
         HMM_Mat3: HMM_MulM3F, \
         HMM_Mat4: HMM_MulM4F, \
         HMM_Quat: HMM_MulQF,  \
+        HMM_DualQuat: HMM_MulDQF, \
+        HMM_Vec3SoA: HMM_MulV3SoAF, \
+        HMM_Vec4SoA: HMM_MulV4SoAF, \
+        default: __hmm_invalid_generic \
+    ), \
+    double: _Generic((A), \
+        HMM_DVec3: HMM_MulDV3F, \
+        HMM_DVec4: HMM_MulDV4F, \
+        HMM_DQuat: HMM_MulDQuatF, \
         default: __hmm_invalid_generic \
     ), \
     HMM_Vec2: _Generic((A), \
@@ -3853,10 +12000,24 @@ void __hmm_invalid_generic(void);
         HMM_Mat4: HMM_MulM4V4, \
         default: __hmm_invalid_generic \
     ), \
+    HMM_Vec3A: HMM_MulV3A, \
     HMM_Mat2: HMM_MulM2, \
     HMM_Mat3: HMM_MulM3, \
     HMM_Mat4: HMM_MulM4, \
-    HMM_Quat: HMM_MulQ   \
+    HMM_Affine3x4: HMM_MulA34, \
+    HMM_Quat: HMM_MulQ,  \
+    HMM_DualQuat: HMM_MulDQ, \
+    HMM_TRS: HMM_MulTRS, \
+    HMM_Vec3SoA: HMM_MulV3SoA, \
+    HMM_Vec4SoA: HMM_MulV4SoA, \
+    HMM_DVec3: HMM_MulDV3, \
+    HMM_DVec4: _Generic((A), \
+        HMM_DVec4: HMM_MulDV4,   \
+        HMM_DMat4: HMM_MulDM4V4, \
+        default: __hmm_invalid_generic \
+    ), \
+    HMM_DMat4: HMM_MulDM4, \
+    HMM_DQuat: HMM_MulDQuat  \
 )(A, B)
 
 #define HMM_Div(A, B) _Generic((B), \
@@ -3864,47 +12025,77 @@ void __hmm_invalid_generic(void);
         HMM_Vec2: HMM_DivV2F, \
         HMM_Vec3: HMM_DivV3F, \
         HMM_Vec4: HMM_DivV4F, \
+        HMM_Vec3A: HMM_DivV3AF, \
         HMM_Mat2: HMM_DivM2F, \
         HMM_Mat3: HMM_DivM3F, \
         HMM_Mat4: HMM_DivM4F, \
-        HMM_Quat: HMM_DivQF   \
+        HMM_Quat: HMM_DivQF,  \
+        default: __hmm_invalid_generic \
+    ), \
+    double: _Generic((A), \
+        HMM_DVec3: HMM_DivDV3F, \
+        HMM_DVec4: HMM_DivDV4F, \
+        HMM_DQuat: HMM_DivDQuatF, \
+        default: __hmm_invalid_generic \
     ), \
     HMM_Vec2: HMM_DivV2, \
     HMM_Vec3: HMM_DivV3, \
-    HMM_Vec4: HMM_DivV4  \
+    HMM_Vec4: HMM_DivV4, \
+    HMM_Vec3A: HMM_DivV3A  \
 )(A, B)
 
 #define HMM_Len(A) _Generic((A), \
     HMM_Vec2: HMM_LenV2, \
     HMM_Vec3: HMM_LenV3, \
-    HMM_Vec4: HMM_LenV4  \
+    HMM_Vec4: HMM_LenV4, \
+    HMM_Vec3A: HMM_LenV3A, \
+    HMM_Vec3SoA: HMM_LenV3SoA, \
+    HMM_Vec4SoA: HMM_LenV4SoA, \
+    HMM_DVec3: HMM_LenDV3  \
 )(A)
 
 #define HMM_LenSqr(A) _Generic((A), \
     HMM_Vec2: HMM_LenSqrV2, \
     HMM_Vec3: HMM_LenSqrV3, \
-    HMM_Vec4: HMM_LenSqrV4  \
+    HMM_Vec4: HMM_LenSqrV4, \
+    HMM_Vec3A: HMM_LenSqrV3A, \
+    HMM_DVec3: HMM_LenSqrDV3  \
 )(A)
 
 #define HMM_Norm(A) _Generic((A), \
     HMM_Vec2: HMM_NormV2, \
     HMM_Vec3: HMM_NormV3, \
     HMM_Vec4: HMM_NormV4, \
-    HMM_Quat: HMM_NormQ   \
+    HMM_Vec3A: HMM_NormV3A, \
+    HMM_Quat: HMM_NormQ,  \
+    HMM_DualQuat: HMM_NormDQ, \
+    HMM_Vec3SoA: HMM_NormV3SoA, \
+    HMM_Vec4SoA: HMM_NormV4SoA, \
+    HMM_DVec3: HMM_NormDV3, \
+    HMM_DQuat: HMM_NormDQuat  \
 )(A)
 
 #define HMM_Dot(A, B) _Generic((A), \
     HMM_Vec2: HMM_DotV2, \
     HMM_Vec3: HMM_DotV3, \
     HMM_Vec4: HMM_DotV4, \
-    HMM_Quat: HMM_DotQ   \
+    HMM_Vec3A: HMM_DotV3A, \
+    HMM_Quat: HMM_DotQ,  \
+    HMM_Vec3SoA: HMM_DotV3SoA, \
+    HMM_Vec4SoA: HMM_DotV4SoA, \
+    HMM_DVec3: HMM_DotDV3, \
+    HMM_DVec4: HMM_DotDV4, \
+    HMM_DQuat: HMM_DotDQuat  \
 )(A, B)
 
 #define HMM_Lerp(A, T, B) _Generic((A), \
     float: HMM_Lerp, \
     HMM_Vec2: HMM_LerpV2, \
     HMM_Vec3: HMM_LerpV3, \
-    HMM_Vec4: HMM_LerpV4  \
+    HMM_Vec4: HMM_LerpV4, \
+    HMM_Vec3SoA: HMM_LerpV3SoA, \
+    HMM_Vec4SoA: HMM_LerpV4SoA, \
+    HMM_DVec3: HMM_LerpDV3  \
 )(A, T, B)
 
 #define HMM_Eq(A, B) _Generic((A), \
@@ -3916,7 +12107,8 @@ void __hmm_invalid_generic(void);
 #define HMM_Transpose(M) _Generic((M), \
     HMM_Mat2: HMM_TransposeM2, \
     HMM_Mat3: HMM_TransposeM3, \
-    HMM_Mat4: HMM_TransposeM4  \
+    HMM_Mat4: HMM_TransposeM4, \
+    HMM_DMat4: HMM_TransposeDM4  \
 )(M)
 
 #define HMM_Determinant(M) _Generic((M), \
@@ -3928,7 +12120,8 @@ void __hmm_invalid_generic(void);
 #define HMM_InvGeneral(M) _Generic((M), \
     HMM_Mat2: HMM_InvGeneralM2, \
     HMM_Mat3: HMM_InvGeneralM3, \
-    HMM_Mat4: HMM_InvGeneralM4  \
+    HMM_Mat4: HMM_InvGeneralM4, \
+    HMM_DMat4: HMM_InvGeneralDM4  \
 )(M)
 
 #endif
@@ -3938,3 +12131,403 @@ void __hmm_invalid_generic(void);
 #endif
 
 #endif /* HANDMADE_MATH_H */
+
+/*
+ * Runtime dispatch implementation
+ */
+
+#if defined(HANDMADE_MATH_IMPLEMENTATION) && !defined(HANDMADE_MATH__IMPLEMENTED)
+#define HANDMADE_MATH__IMPLEMENTED
+
+#ifdef HANDMADE_MATH__USE_DISPATCH
+
+#ifdef _MSC_VER
+# include <intrin.h>
+# define _HMM_TARGET(Features)
+#else
+# include <cpuid.h>
+# define _HMM_TARGET(Features) __attribute__((target(Features)))
+#endif
+
+/*
+ * NOTE: The kernels below are compiled for their instruction set regardless of the compiler flags, so
+ * they can only use intrinsics, not the inline functions above. Each one works on two (AVX2) or four
+ * (AVX-512) elements at a time. In the last, partial step the missing elements are filled in with
+ * copies of the first one and never stored, which keeps every element on the same code path.
+ */
+
+_HMM_TARGET("avx2,fma")
+static void _HMM_MulM4V4ArrayAVX2(HMM_Mat4 Matrix, const HMM_Vec4 *In, int InStride, HMM_Vec4 *Out, int OutStride, int Count)
+{
+    const char *InBytes = (const char *)In;
+    char *OutBytes = (char *)Out;
+    int Index;
+
+    if (InStride == 0)
+    {
+        InStride = sizeof(HMM_Vec4);
+    }
+    if (OutStride == 0)
+    {
+        OutStride = sizeof(HMM_Vec4);
+    }
+
+    __m256 Column0 = _mm256_broadcast_ps(&Matrix.Columns[0].SSE);
+    __m256 Column1 = _mm256_broadcast_ps(&Matrix.Columns[1].SSE);
+    __m256 Column2 = _mm256_broadcast_ps(&Matrix.Columns[2].SSE);
+    __m256 Column3 = _mm256_broadcast_ps(&Matrix.Columns[3].SSE);
+
+    for (Index = 0; Index < Count; Index += 2)
+    {
+        int Second = (Index + 1 < Count);
+        __m128 V0 = _mm_loadu_ps((const float *)InBytes);
+        __m128 V1 = Second ? _mm_loadu_ps((const float *)(InBytes + InStride)) : V0;
+        __m256 V = _mm256_insertf128_ps(_mm256_castps128_ps256(V0), V1, 1);
+
+        __m256 R = _mm256_mul_ps(_mm256_permute_ps(V, 0x00), Column0);
+        R = _mm256_fmadd_ps(_mm256_permute_ps(V, 0x55), Column1, R);
+        R = _mm256_fmadd_ps(_mm256_permute_ps(V, 0xaa), Column2, R);
+        R = _mm256_fmadd_ps(_mm256_permute_ps(V, 0xff), Column3, R);
+
+        _mm_storeu_ps((float *)OutBytes, _mm256_castps256_ps128(R));
+        if (Second)
+        {
+            _mm_storeu_ps((float *)(OutBytes + OutStride), _mm256_extractf128_ps(R, 1));
+        }
+
+        InBytes += 2*InStride;
+        OutBytes += 2*OutStride;
+    }
+}
+
+_HMM_TARGET("avx2,fma")
+static void _HMM_MulQArrayAVX2(const HMM_Quat *Left, const HMM_Quat *Right, HMM_Quat *Out, int Count)
+{
+    __m256 SignOne = _mm256_setr_ps(0.f, -0.f, 0.f, -0.f, 0.f, -0.f, 0.f, -0.f);
+    __m256 SignTwo = _mm256_setr_ps(0.f, 0.f, -0.f, -0.f, 0.f, 0.f, -0.f, -0.f);
+    __m256 SignThree = _mm256_setr_ps(-0.f, 0.f, 0.f, -0.f, -0.f, 0.f, 0.f, -0.f);
+    int Index;
+
+    for (Index = 0; Index < Count; Index += 2)
+    {
+        int Second = (Index + 1 < Count) ? 1 : 0;
+        __m256 L = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Left[Index].Elements)), _mm_loadu_ps(Left[Index + Second].Elements), 1);
+        __m256 R = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Right[Index].Elements)), _mm_loadu_ps(Right[Index + Second].Elements), 1);
+
+        __m256 ResultOne = _mm256_xor_ps(_mm256_permute_ps(L, _MM_SHUFFLE(0, 0, 0, 0)), SignOne);
+        __m256 ResultTwo = _mm256_permute_ps(R, _MM_SHUFFLE(0, 1, 2, 3));
+        __m256 ResultThree = _mm256_mul_ps(ResultTwo, ResultOne);
+
+        ResultOne = _mm256_xor_ps(_mm256_permute_ps(L, _MM_SHUFFLE(1, 1, 1, 1)), SignTwo);
+        ResultTwo = _mm256_permute_ps(R, _MM_SHUFFLE(1, 0, 3, 2));
+        ResultThree = _mm256_fmadd_ps(ResultTwo, ResultOne, ResultThree);
+
+        ResultOne = _mm256_xor_ps(_mm256_permute_ps(L, _MM_SHUFFLE(2, 2, 2, 2)), SignThree);
+        ResultTwo = _mm256_permute_ps(R, _MM_SHUFFLE(2, 3, 0, 1));
+        ResultThree = _mm256_fmadd_ps(ResultTwo, ResultOne, ResultThree);
+
+        ResultOne = _mm256_permute_ps(L, _MM_SHUFFLE(3, 3, 3, 3));
+        ResultTwo = _mm256_permute_ps(R, _MM_SHUFFLE(3, 2, 1, 0));
+        ResultThree = _mm256_fmadd_ps(ResultTwo, ResultOne, ResultThree);
+
+        _mm_storeu_ps(Out[Index].Elements, _mm256_castps256_ps128(ResultThree));
+        if (Second)
+        {
+            _mm_storeu_ps(Out[Index + 1].Elements, _mm256_extractf128_ps(ResultThree, 1));
+        }
+    }
+}
+
+_HMM_TARGET("avx2,fma")
+static void _HMM_NormQArrayAVX2(const HMM_Quat *In, HMM_Quat *Out, int Count)
+{
+    int Index;
+
+    for (Index = 0; Index < Count; Index += 2)
+    {
+        int Second = (Index + 1 < Count) ? 1 : 0;
+        __m256 Q = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(In[Index].Elements)), _mm_loadu_ps(In[Index + Second].Elements), 1);
+
+        __m256 Swapped = _mm256_permute_ps(Q, _MM_SHUFFLE(2, 3, 0, 1));
+        __m256 Dot = _mm256_fmadd_ps(Swapped, Swapped, _mm256_mul_ps(Q, Q));
+        Dot = _mm256_add_ps(Dot, _mm256_permute_ps(Dot, _MM_SHUFFLE(0, 1, 2, 3)));
+        Dot = _mm256_permute_ps(Dot, _MM_SHUFFLE(0, 0, 0, 0));
+
+#ifdef HANDMADE_MATH_FAST_RSQRT
+        __m256 Estimate = _mm256_rsqrt_ps(Dot);
+        __m256 HalfDot = _mm256_mul_ps(Dot, _mm256_set1_ps(0.5f));
+        __m256 InvLength = _mm256_mul_ps(Estimate, _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(_mm256_mul_ps(HalfDot, Estimate), Estimate)));
+#else
+        __m256 InvLength = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(Dot));
+#endif
+        __m256 Result = _mm256_mul_ps(Q, InvLength);
+
+        _mm_storeu_ps(Out[Index].Elements, _mm256_castps256_ps128(Result));
+        if (Second)
+        {
+            _mm_storeu_ps(Out[Index + 1].Elements, _mm256_extractf128_ps(Result, 1));
+        }
+    }
+}
+
+_HMM_TARGET("avx512f,avx2,fma")
+static void _HMM_MulM4V4ArrayAVX512(HMM_Mat4 Matrix, const HMM_Vec4 *In, int InStride, HMM_Vec4 *Out, int OutStride, int Count)
+{
+    const char *InBytes = (const char *)In;
+    char *OutBytes = (char *)Out;
+    int Index;
+
+    if (InStride == 0)
+    {
+        InStride = sizeof(HMM_Vec4);
+    }
+    if (OutStride == 0)
+    {
+        OutStride = sizeof(HMM_Vec4);
+    }
+
+    __m512 Column0 = _mm512_broadcast_f32x4(Matrix.Columns[0].SSE);
+    __m512 Column1 = _mm512_broadcast_f32x4(Matrix.Columns[1].SSE);
+    __m512 Column2 = _mm512_broadcast_f32x4(Matrix.Columns[2].SSE);
+    __m512 Column3 = _mm512_broadcast_f32x4(Matrix.Columns[3].SSE);
+
+    for (Index = 0; Index < Count; Index += 4)
+    {
+        int Remaining = Count - Index;
+        __m128 V0 = _mm_loadu_ps((const float *)InBytes);
+        __m128 V1 = (Remaining > 1) ? _mm_loadu_ps((const float *)(InBytes + 1*InStride)) : V0;
+        __m128 V2 = (Remaining > 2) ? _mm_loadu_ps((const float *)(InBytes + 2*InStride)) : V0;
+        __m128 V3 = (Remaining > 3) ? _mm_loadu_ps((const float *)(InBytes + 3*InStride)) : V0;
+        __m512 V = _mm512_castps128_ps512(V0);
+        V = _mm512_insertf32x4(V, V1, 1);
+        V = _mm512_insertf32x4(V, V2, 2);
+        V = _mm512_insertf32x4(V, V3, 3);
+
+        __m512 R = _mm512_mul_ps(_mm512_permute_ps(V, 0x00), Column0);
+        R = _mm512_fmadd_ps(_mm512_permute_ps(V, 0x55), Column1, R);
+        R = _mm512_fmadd_ps(_mm512_permute_ps(V, 0xaa), Column2, R);
+        R = _mm512_fmadd_ps(_mm512_permute_ps(V, 0xff), Column3, R);
+
+        _mm_storeu_ps((float *)OutBytes, _mm512_castps512_ps128(R));
+        if (Remaining > 1)
+        {
+            _mm_storeu_ps((float *)(OutBytes + 1*OutStride), _mm512_extractf32x4_ps(R, 1));
+        }
+        if (Remaining > 2)
+        {
+            _mm_storeu_ps((float *)(OutBytes + 2*OutStride), _mm512_extractf32x4_ps(R, 2));
+        }
+        if (Remaining > 3)
+        {
+            _mm_storeu_ps((float *)(OutBytes + 3*OutStride), _mm512_extractf32x4_ps(R, 3));
+        }
+
+        InBytes += 4*InStride;
+        OutBytes += 4*OutStride;
+    }
+}
+
+_HMM_TARGET("avx512f,avx2,fma")
+static void _HMM_MulQArrayAVX512(const HMM_Quat *Left, const HMM_Quat *Right, HMM_Quat *Out, int Count)
+{
+    __m512i SignOne = _mm512_castps_si512(_mm512_broadcast_f32x4(_mm_setr_ps(0.f, -0.f, 0.f, -0.f)));
+    __m512i SignTwo = _mm512_castps_si512(_mm512_broadcast_f32x4(_mm_setr_ps(0.f, 0.f, -0.f, -0.f)));
+    __m512i SignThree = _mm512_castps_si512(_mm512_broadcast_f32x4(_mm_setr_ps(-0.f, 0.f, 0.f, -0.f)));
+    int Index;
+
+    for (Index = 0; Index < Count; Index += 4)
+    {
+        /* NOTE: Masked loads and stores only touch the quaternions that are actually in the arrays. */
+        int Remaining = (Count - Index < 4) ? Count - Index : 4;
+        __mmask16 Mask = (__mmask16)((1u << (4*Remaining)) - 1);
+        __m512 L = _mm512_maskz_loadu_ps(Mask, Left[Index].Elements);
+        __m512 R = _mm512_maskz_loadu_ps(Mask, Right[Index].Elements);
+
+        __m512 ResultOne = _mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(_mm512_permute_ps(L, _MM_SHUFFLE(0, 0, 0, 0))), SignOne));
+        __m512 ResultTwo = _mm512_permute_ps(R, _MM_SHUFFLE(0, 1, 2, 3));
+        __m512 ResultThree = _mm512_mul_ps(ResultTwo, ResultOne);
+
+        ResultOne = _mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(_mm512_permute_ps(L, _MM_SHUFFLE(1, 1, 1, 1))), SignTwo));
+        ResultTwo = _mm512_permute_ps(R, _MM_SHUFFLE(1, 0, 3, 2));
+        ResultThree = _mm512_fmadd_ps(ResultTwo, ResultOne, ResultThree);
+
+        ResultOne = _mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(_mm512_permute_ps(L, _MM_SHUFFLE(2, 2, 2, 2))), SignThree));
+        ResultTwo = _mm512_permute_ps(R, _MM_SHUFFLE(2, 3, 0, 1));
+        ResultThree = _mm512_fmadd_ps(ResultTwo, ResultOne, ResultThree);
+
+        ResultOne = _mm512_permute_ps(L, _MM_SHUFFLE(3, 3, 3, 3));
+        ResultTwo = _mm512_permute_ps(R, _MM_SHUFFLE(3, 2, 1, 0));
+        ResultThree = _mm512_fmadd_ps(ResultTwo, ResultOne, ResultThree);
+
+        _mm512_mask_storeu_ps(Out[Index].Elements, Mask, ResultThree);
+    }
+}
+
+_HMM_TARGET("avx512f,avx2,fma")
+static void _HMM_NormQArrayAVX512(const HMM_Quat *In, HMM_Quat *Out, int Count)
+{
+    int Index;
+
+    for (Index = 0; Index < Count; Index += 4)
+    {
+        /* NOTE: The masked-off lanes load as zero, so their (unused) results are NaN, not a fault. */
+        int Remaining = (Count - Index < 4) ? Count - Index : 4;
+        __mmask16 Mask = (__mmask16)((1u << (4*Remaining)) - 1);
+        __m512 Q = _mm512_maskz_loadu_ps(Mask, In[Index].Elements);
+
+        __m512 Swapped = _mm512_permute_ps(Q, _MM_SHUFFLE(2, 3, 0, 1));
+        __m512 Dot = _mm512_fmadd_ps(Swapped, Swapped, _mm512_mul_ps(Q, Q));
+        Dot = _mm512_add_ps(Dot, _mm512_permute_ps(Dot, _MM_SHUFFLE(0, 1, 2, 3)));
+        Dot = _mm512_permute_ps(Dot, _MM_SHUFFLE(0, 0, 0, 0));
+
+#ifdef HANDMADE_MATH_FAST_RSQRT
+        __m512 Estimate = _mm512_rsqrt14_ps(Dot);
+        __m512 HalfDot = _mm512_mul_ps(Dot, _mm512_set1_ps(0.5f));
+        __m512 InvLength = _mm512_mul_ps(Estimate, _mm512_sub_ps(_mm512_set1_ps(1.5f), _mm512_mul_ps(_mm512_mul_ps(HalfDot, Estimate), Estimate)));
+#else
+        __m512 InvLength = _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_sqrt_ps(Dot));
+#endif
+        __m512 Result = _mm512_mul_ps(Q, InvLength);
+        _mm512_mask_storeu_ps(Out[Index].Elements, Mask, Result);
+    }
+}
+
+static HMM_SIMDTier _HMM_DetectSIMDTier(void)
+{
+    unsigned int Leaf1[4] = {0};
+    unsigned int Leaf7[4] = {0};
+    unsigned int MaxLeaf;
+    unsigned long long XCR0;
+
+#ifdef _MSC_VER
+    int Registers[4];
+    __cpuid(Registers, 0);
+    MaxLeaf = (unsigned int)Registers[0];
+    __cpuid(Registers, 1);
+    Leaf1[2] = (unsigned int)Registers[2];
+    if (MaxLeaf >= 7)
+    {
+        __cpuidex(Registers, 7, 0);
+        Leaf7[1] = (unsigned int)Registers[1];
+    }
+#else
+    MaxLeaf = __get_cpuid_max(0, 0);
+    __cpuid(1, Leaf1[0], Leaf1[1], Leaf1[2], Leaf1[3]);
+    if (MaxLeaf >= 7)
+    {
+        __cpuid_count(7, 0, Leaf7[0], Leaf7[1], Leaf7[2], Leaf7[3]);
+    }
+#endif
+
+    /* NOTE: Wider registers also need OS support, which XCR0 reports once OSXSAVE (ECX bit 27) is set. */
+    if (!(Leaf1[2] & (1u << 27)) || !(Leaf1[2] & (1u << 28)))
+    {
+        return HMM_SIMD_TIER_SSE;
+    }
+
+#ifdef _MSC_VER
+    XCR0 = _xgetbv(0);
+#else
+    {
+        unsigned int XCR0Low, XCR0High;
+        __asm__ __volatile__("xgetbv" : "=a"(XCR0Low), "=d"(XCR0High) : "c"(0));
+        XCR0 = ((unsigned long long)XCR0High << 32) | XCR0Low;
+    }
+#endif
+
+    /* XMM and YMM state, then FMA (leaf 1 ECX bit 12) and AVX2 (leaf 7 EBX bit 5) */
+    if ((XCR0 & 0x06) != 0x06 || !(Leaf1[2] & (1u << 12)) || !(Leaf7[1] & (1u << 5)))
+    {
+        return HMM_SIMD_TIER_SSE;
+    }
+
+    /* Opmask and ZMM state, then AVX-512F (leaf 7 EBX bit 16) */
+    if ((XCR0 & 0xe6) != 0xe6 || !(Leaf7[1] & (1u << 16)))
+    {
+        return HMM_SIMD_TIER_AVX2;
+    }
+
+    return HMM_SIMD_TIER_AVX512;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* NOTE: The selected table is read and written atomically, so batch calls from several threads may race
+   to select the first tier, or run while HMM_SetSIMDTier changes it. */
+#ifdef _MSC_VER
+# define _HMM_LOAD_DISPATCH(Pointer) ((const _HMM_DispatchTable *)_InterlockedCompareExchangePointer((void *volatile *)&(Pointer), 0, 0))
+# define _HMM_STORE_DISPATCH(Pointer, Value) _InterlockedExchangePointer((void *volatile *)&(Pointer), (void *)(Value))
+#else
+# define _HMM_LOAD_DISPATCH(Pointer) __atomic_load_n(&(Pointer), __ATOMIC_ACQUIRE)
+# define _HMM_STORE_DISPATCH(Pointer, Value) __atomic_store_n(&(Pointer), (Value), __ATOMIC_RELEASE)
+#endif
+
+static const _HMM_DispatchTable _HMM_DispatchBase = {
+    HMM_SIMD_TIER_SSE, _HMM_MulM4V4ArrayBase, _HMM_MulQArrayBase, _HMM_NormQArrayBase
+};
+
+static const _HMM_DispatchTable _HMM_DispatchAVX2 = {
+    HMM_SIMD_TIER_AVX2, _HMM_MulM4V4ArrayAVX2, _HMM_MulQArrayAVX2, _HMM_NormQArrayAVX2
+};
+
+static const _HMM_DispatchTable _HMM_DispatchAVX512 = {
+    HMM_SIMD_TIER_AVX512, _HMM_MulM4V4ArrayAVX512, _HMM_MulQArrayAVX512, _HMM_NormQArrayAVX512
+};
+
+static const _HMM_DispatchTable *_HMM_SelectedDispatch = 0;
+
+const _HMM_DispatchTable *_HMM_GetDispatch(void)
+{
+    const _HMM_DispatchTable *Result = _HMM_LOAD_DISPATCH(_HMM_SelectedDispatch);
+    if (!Result)
+    {
+        HMM_SetSIMDTier(HMM_SIMD_TIER_AVX512);
+        Result = _HMM_LOAD_DISPATCH(_HMM_SelectedDispatch);
+    }
+
+    return Result;
+}
+
+COVERAGE(HMM_GetSIMDTier, 1)
+HMM_SIMDTier HMM_GetSIMDTier(void)
+{
+    ASSERT_COVERED(HMM_GetSIMDTier);
+
+    return _HMM_GetDispatch()->Tier;
+}
+
+COVERAGE(HMM_SetSIMDTier, 1)
+HMM_SIMDTier HMM_SetSIMDTier(HMM_SIMDTier Tier)
+{
+    ASSERT_COVERED(HMM_SetSIMDTier);
+
+    HMM_SIMDTier Supported = _HMM_DetectSIMDTier();
+    if (Tier > Supported)
+    {
+        Tier = Supported;
+    }
+
+    /* NOTE: There are no separate AVX kernels; the baseline ones are whatever this file was compiled for. */
+    const _HMM_DispatchTable *Table = &_HMM_DispatchBase;
+    if (Tier >= HMM_SIMD_TIER_AVX512)
+    {
+        Table = &_HMM_DispatchAVX512;
+    }
+    else if (Tier >= HMM_SIMD_TIER_AVX2)
+    {
+        Table = &_HMM_DispatchAVX2;
+    }
+
+    _HMM_STORE_DISPATCH(_HMM_SelectedDispatch, Table);
+    return Table->Tier;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HANDMADE_MATH__USE_DISPATCH */
+
+#endif /* HANDMADE_MATH_IMPLEMENTATION */
@@ -2,4 +2,5 @@
 #include "HandmadeTest.h"
 #endif
 
+#define HANDMADE_MATH_IMPLEMENTATION
 #include "../HandmadeMath.h"
@@ -225,6 +225,11 @@ INITIALIZER(_HMT_COVERCASE_FUNCNAME_INIT(name)) { \
     HMT_EXPECT_FLOAT_EQ_MSG(_actual.Elements[3][2], _expected.Elements[3][2], "incorrect [3][2]"); \
     HMT_EXPECT_FLOAT_EQ_MSG(_actual.Elements[3][3], _expected.Elements[3][3], "incorrect [3][3]");
 #define EXPECT_NEAR(_actual, _expected, _epsilon) HMT_EXPECT_NEAR(_actual, _expected, _epsilon)
+#define EXPECT_V4_NEAR(_actual, _expected, _epsilon) \
+    HMT_EXPECT_NEAR_MSG(_actual.X, _expected.X, _epsilon, "incorrect X"); \
+    HMT_EXPECT_NEAR_MSG(_actual.Y, _expected.Y, _epsilon, "incorrect Y"); \
+    HMT_EXPECT_NEAR_MSG(_actual.Z, _expected.Z, _epsilon, "incorrect Z"); \
+    HMT_EXPECT_NEAR_MSG(_actual.W, _expected.W, _epsilon, "incorrect W");
 #define EXPECT_M4_NEAR(_actual, _expected, _epsilon) \
     HMT_EXPECT_NEAR_MSG(_actual.Elements[0][0], _expected.Elements[0][0], _epsilon, "incorrect [0][0]"); \
     HMT_EXPECT_NEAR_MSG(_actual.Elements[0][1], _expected.Elements[0][1], _epsilon, "incorrect [0][1]"); \
@@ -248,6 +253,22 @@ INITIALIZER(_HMT_COVERCASE_FUNCNAME_INIT(name)) { \
 
 #endif // HANDMADETEST_H
 
+/*
+  Fixtures shared by Handmade Math's tests. HandmadeTest.h is included again by
+  each test category, after HandmadeMath.h, which is when these are defined.
+*/
+#if defined(HANDMADE_MATH_H) && !defined(HANDMADETEST_FIXTURES_H)
+#define HANDMADETEST_FIXTURES_H
+
+// A rotation, a non-uniform scale and a translation that all vary with i.
+static inline HMM_Mat4 HMMTest_AffineM4(int i)
+{
+    HMM_Mat4 Rotation = HMM_Rotate_RH(0.3f * i + 0.1f, HMM_NormV3(HMM_V3(1.0f, 0.5f * i, -1.0f)));
+    HMM_Mat4 Scale = HMM_Scale(HMM_V3(1.0f + 0.1f * i, 2.0f, 0.5f));
+    return HMM_MulM4(HMM_Translate(HMM_V3(1.0f * i, -2.0f, 0.5f * i)), HMM_MulM4(Rotation, Scale));
+}
+#endif // HANDMADETEST_FIXTURES_H
+
 #ifdef HANDMADE_TEST_IMPLEMENTATION
 
 #ifndef HANDMADE_TEST_IMPLEMENTATION_GUARD
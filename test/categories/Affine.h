@@ -0,0 +1,116 @@
+#include "../HandmadeTest.h"
+
+TEST(Affine, Conversion)
+{
+    HMM_Mat4 m = HMMTest_AffineM4(3);
+    HMM_Affine3x4 a = HMM_M4ToA34(m);
+
+    // Stored row by row, with the translation in W
+    EXPECT_FLOAT_EQ(a.Elements[0][3], 3.0f);
+    EXPECT_FLOAT_EQ(a.Elements[1][3], -2.0f);
+    EXPECT_FLOAT_EQ(a.Elements[2][3], 1.5f);
+    EXPECT_FLOAT_EQ(a.Elements[1][0], m.Elements[0][1]);
+    EXPECT_FLOAT_EQ(a.Elements[0][1], m.Elements[1][0]);
+
+    EXPECT_M4_EQ(HMM_A34ToM4(a), m);
+    EXPECT_M4_EQ(HMM_A34ToM4(HMM_A34D(1.0f)), HMM_M4D(1.0f));
+}
+
+TEST(Affine, Multiplication)
+{
+    HMM_Mat4 m1 = HMMTest_AffineM4(1);
+    HMM_Mat4 m2 = HMMTest_AffineM4(4);
+    HMM_Affine3x4 a1 = HMM_M4ToA34(m1);
+    HMM_Affine3x4 a2 = HMM_M4ToA34(m2);
+    HMM_Mat4 expected = HMM_MulM4(m1, m2);
+
+    {
+        HMM_Affine3x4 result = HMM_MulA34(a1, a2);
+        EXPECT_M4_NEAR(HMM_A34ToM4(result), expected, 1e-5f);
+    }
+#if HANDMADE_MATH__USE_C11_GENERICS || defined(__cplusplus)
+    {
+        HMM_Affine3x4 result = HMM_Mul(a1, a2);
+        EXPECT_M4_NEAR(HMM_A34ToM4(result), expected, 1e-5f);
+    }
+#endif
+#ifdef __cplusplus
+    {
+        HMM_Affine3x4 result = a1 * a2;
+        EXPECT_M4_NEAR(HMM_A34ToM4(result), expected, 1e-5f);
+        EXPECT_V4_EQ(result[2], result.Rows[2]);
+    }
+#endif
+
+    HMM_Affine3x4 lefts[5], rights[5], outs[5];
+    for (int i = 0; i < 5; ++i)
+    {
+        lefts[i] = HMM_M4ToA34(HMMTest_AffineM4(i));
+        rights[i] = HMM_M4ToA34(HMMTest_AffineM4(4 - i));
+    }
+    HMM_MulA34Array(lefts, rights, outs, 5);
+    for (int i = 0; i < 5; ++i)
+    {
+        HMM_Affine3x4 expectedA34 = HMM_MulA34(lefts[i], rights[i]);
+        EXPECT_TRUE(memcmp(&outs[i], &expectedA34, sizeof(expectedA34)) == 0);
+    }
+
+    // In place
+    HMM_MulA34Array(lefts, rights, lefts, 5);
+    EXPECT_TRUE(memcmp(lefts, outs, sizeof(outs)) == 0);
+}
+
+TEST(Affine, Transform)
+{
+    HMM_Mat4 m = HMMTest_AffineM4(2);
+    HMM_Affine3x4 a = HMM_M4ToA34(m);
+    HMM_Vec3 v = HMM_V3(1.0f, -2.0f, 3.0f);
+
+    {
+        HMM_Vec4 expected = HMM_MulM4V4(m, HMM_V4V(v, 1.0f));
+        HMM_Vec3 result = HMM_TransformPointA34(a, v);
+        EXPECT_NEAR(result.X, expected.X, 1e-5f);
+        EXPECT_NEAR(result.Y, expected.Y, 1e-5f);
+        EXPECT_NEAR(result.Z, expected.Z, 1e-5f);
+    }
+    {
+        HMM_Vec4 expected = HMM_MulM4V4(m, HMM_V4V(v, 0.0f));
+        HMM_Vec3 result = HMM_TransformDirA34(a, v);
+        EXPECT_NEAR(result.X, expected.X, 1e-5f);
+        EXPECT_NEAR(result.Y, expected.Y, 1e-5f);
+        EXPECT_NEAR(result.Z, expected.Z, 1e-5f);
+    }
+
+    HMM_Vec3 points[7], outs[7];
+    for (int i = 0; i < 7; ++i)
+    {
+        points[i] = HMM_V3(1.0f * i, -0.5f * i, 2.0f);
+    }
+    HMM_TransformPointA34Array(a, points, outs, 7);
+    for (int i = 0; i < 7; ++i)
+    {
+        HMM_Vec3 expected = HMM_TransformPointA34(a, points[i]);
+        EXPECT_NEAR(outs[i].X, expected.X, 1e-5f);
+        EXPECT_NEAR(outs[i].Y, expected.Y, 1e-5f);
+        EXPECT_NEAR(outs[i].Z, expected.Z, 1e-5f);
+    }
+
+    // In place
+    HMM_TransformPointA34Array(a, points, points, 7);
+    EXPECT_TRUE(memcmp(points, outs, sizeof(outs)) == 0);
+}
+
+TEST(Affine, Inverse)
+{
+    {
+        HMM_Mat4 m = HMM_MulM4(HMM_Translate(HMM_V3(1.0f, -2.0f, 3.0f)), HMM_Rotate_RH(1.2f, HMM_NormV3(HMM_V3(1.0f, 2.0f, -1.0f))));
+        HMM_Affine3x4 inverse = HMM_InvRigidA34(HMM_M4ToA34(m));
+        EXPECT_M4_NEAR(HMM_A34ToM4(inverse), HMM_InvGeneralM4(m), 1e-5f);
+    }
+    {
+        HMM_Mat4 m = HMMTest_AffineM4(3);
+        HMM_Affine3x4 inverse = HMM_InvA34(HMM_M4ToA34(m));
+        EXPECT_M4_NEAR(HMM_A34ToM4(inverse), HMM_InvGeneralM4(m), 1e-5f);
+        EXPECT_M4_NEAR(HMM_A34ToM4(HMM_MulA34(inverse, HMM_M4ToA34(m))), HMM_M4D(1.0f), 1e-5f);
+    }
+}
@@ -0,0 +1,103 @@
+#include "../HandmadeTest.h"
+
+TEST(Animation, SampleKey)
+{
+    const float times[5] = { 0.0f, 0.5f, 1.0f, 2.0f, 4.0f };
+    int cursor = 0;
+
+    EXPECT_FLOAT_EQ(HMM_SampleKey(times, 5, 0.25f, &cursor), 0.5f);
+    EXPECT_TRUE(cursor == 0);
+
+    // Forward, a key at a time
+    EXPECT_FLOAT_EQ(HMM_SampleKey(times, 5, 0.75f, &cursor), 0.5f);
+    EXPECT_TRUE(cursor == 1);
+    EXPECT_FLOAT_EQ(HMM_SampleKey(times, 5, 1.0f, &cursor), 0.0f);
+    EXPECT_TRUE(cursor == 2);
+    EXPECT_FLOAT_EQ(HMM_SampleKey(times, 5, 3.0f, &cursor), 0.5f);
+    EXPECT_TRUE(cursor == 3);
+
+    // Past the end and before the start
+    EXPECT_FLOAT_EQ(HMM_SampleKey(times, 5, 5.0f, &cursor), 1.0f);
+    EXPECT_TRUE(cursor == 3);
+    EXPECT_FLOAT_EQ(HMM_SampleKey(times, 5, -1.0f, &cursor), 0.0f);
+    EXPECT_TRUE(cursor == 0);
+
+    // Backwards
+    cursor = 3;
+    EXPECT_FLOAT_EQ(HMM_SampleKey(times, 5, 0.625f, &cursor), 0.25f);
+    EXPECT_TRUE(cursor == 1);
+
+    // A single key
+    cursor = 7;
+    EXPECT_FLOAT_EQ(HMM_SampleKey(times, 1, 2.0f, &cursor), 0.0f);
+    EXPECT_TRUE(cursor == 0);
+
+    // A long jump forward takes the binary search
+    {
+        float longTimes[40];
+        for (int i = 0; i < 40; ++i)
+        {
+            longTimes[i] = 0.5f * i;
+        }
+        cursor = 0;
+        EXPECT_FLOAT_EQ(HMM_SampleKey(longTimes, 40, 15.25f, &cursor), 0.5f);
+        EXPECT_TRUE(cursor == 30);
+        EXPECT_FLOAT_EQ(HMM_SampleKey(longTimes, 40, 15.75f, &cursor), 0.5f);
+        EXPECT_TRUE(cursor == 31);
+    }
+}
+
+TEST(Animation, SampleTracks)
+{
+    // Eleven tracks with 1 to 4 keys each, so the rotations fill more than one block
+    int keyOffsets[12];
+    float times[44];
+    HMM_Vec3 vectors[44];
+    HMM_Quat quats[44];
+    int keyCount = 0;
+    for (int track = 0; track < 11; ++track)
+    {
+        keyOffsets[track] = keyCount;
+        for (int key = 0; key <= track % 4; ++key)
+        {
+            times[keyCount] = 0.5f * key + 0.125f * track;
+            vectors[keyCount] = HMM_V3(1.0f * key, -2.0f * track, 0.5f * key * key);
+            quats[keyCount] = HMM_QFromAxisAngle_RH(HMM_NormV3(HMM_V3(1.0f, 0.5f * track, -1.0f)), 0.4f * key + 0.1f * track);
+            ++keyCount;
+        }
+    }
+    keyOffsets[11] = keyCount;
+
+    int vectorCursors[11] = { 0 };
+    int quatCursors[11] = { 0 };
+    for (int frame = 0; frame < 30; ++frame)
+    {
+        // Plays through, then loops back to the start
+        float time = 0.1f * (frame % 20);
+        HMM_Vec3 vectorOut[11];
+        HMM_Quat quatOut[11];
+        HMM_SampleV3Tracks(keyOffsets, times, vectors, 11, time, vectorCursors, vectorOut);
+        HMM_SampleQTracks(keyOffsets, times, quats, 11, time, quatCursors, quatOut);
+
+        for (int track = 0; track < 11; ++track)
+        {
+            int first = keyOffsets[track];
+            int count = keyOffsets[track + 1] - first;
+            int key = 0;
+            while (key < count - 2 && times[first + key + 1] <= time)
+            {
+                ++key;
+            }
+            int next = (count > 1) ? key + 1 : key;
+            float factor = (count > 1) ? HMM_Clamp(0.0f, (time - times[first + key]) / (times[first + next] - times[first + key]), 1.0f) : 0.0f;
+
+            HMM_Vec3 expectedVector = HMM_LerpV3(vectors[first + key], factor, vectors[first + next]);
+            HMM_Quat expectedQuat = HMM_NLerp(quats[first + key], factor, quats[first + next]);
+            EXPECT_NEAR(vectorOut[track].X, expectedVector.X, 1e-6f);
+            EXPECT_NEAR(vectorOut[track].Y, expectedVector.Y, 1e-6f);
+            EXPECT_NEAR(vectorOut[track].Z, expectedVector.Z, 1e-6f);
+            EXPECT_V4_NEAR(HMM_V4(quatOut[track].X, quatOut[track].Y, quatOut[track].Z, quatOut[track].W),
+                           HMM_V4(expectedQuat.X, expectedQuat.Y, expectedQuat.Z, expectedQuat.W), 1e-6f);
+        }
+    }
+}
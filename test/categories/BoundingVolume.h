@@ -0,0 +1,258 @@
+#include "../HandmadeTest.h"
+#include "../hmm_random.h"
+
+static HMM_AABB BoundsTestBox(unsigned int *State)
+{
+    HMM_Vec3 Center = HMM_V3(HMMTest_Random(State, -10.0f, 10.0f), HMMTest_Random(State, -10.0f, 10.0f), HMMTest_Random(State, -10.0f, 10.0f));
+    HMM_Vec3 Extent = HMM_V3(HMMTest_Random(State, 0.1f, 4.0f), HMMTest_Random(State, 0.1f, 4.0f), HMMTest_Random(State, 0.1f, 4.0f));
+
+    HMM_AABB Result;
+    Result.Min = HMM_SubV3(Center, Extent);
+    Result.Max = HMM_AddV3(Center, Extent);
+    return Result;
+}
+
+// The box around the eight transformed corners, which Arvo's method should match.
+static HMM_AABB BoundsTestTransformCorners(HMM_Mat4 Matrix, HMM_AABB Box)
+{
+    HMM_Vec3 Corners[8];
+    for (int Corner = 0; Corner < 8; ++Corner)
+    {
+        HMM_Vec3 Point = HMM_V3(Box.Bounds[Corner & 1].X, Box.Bounds[(Corner >> 1) & 1].Y, Box.Bounds[Corner >> 2].Z);
+        Corners[Corner] = HMM_MulM4V4(Matrix, HMM_V4V(Point, 1.0f)).XYZ;
+    }
+    return HMM_AABBFromPoints(Corners, 8);
+}
+
+#define EXPECT_AABB_NEAR(_actual, _expected, _epsilon) \
+    do { \
+        HMM_AABB _a = (_actual), _e = (_expected); \
+        EXPECT_NEAR(_a.Min.X, _e.Min.X, _epsilon); \
+        EXPECT_NEAR(_a.Min.Y, _e.Min.Y, _epsilon); \
+        EXPECT_NEAR(_a.Min.Z, _e.Min.Z, _epsilon); \
+        EXPECT_NEAR(_a.Max.X, _e.Max.X, _epsilon); \
+        EXPECT_NEAR(_a.Max.Y, _e.Max.Y, _epsilon); \
+        EXPECT_NEAR(_a.Max.Z, _e.Max.Z, _epsilon); \
+    } while (0)
+
+TEST(BoundingVolume, AABB)
+{
+    HMM_Vec3 points[3] = { HMM_V3(1.0f, -2.0f, 3.0f), HMM_V3(-1.0f, 4.0f, 0.0f), HMM_V3(0.5f, 0.0f, 5.0f) };
+    HMM_AABB box = HMM_AABBFromPoints(points, 3);
+    EXPECT_V4_EQ(HMM_V4V(box.Min, 0.0f), HMM_V4(-1.0f, -2.0f, 0.0f, 0.0f));
+    EXPECT_V4_EQ(HMM_V4V(box.Max, 0.0f), HMM_V4(1.0f, 4.0f, 5.0f, 0.0f));
+    EXPECT_V4_EQ(HMM_V4V(HMM_AABBCenter(box), 0.0f), HMM_V4(0.0f, 1.0f, 2.5f, 0.0f));
+    EXPECT_V4_EQ(HMM_V4V(HMM_AABBHalfExtents(box), 0.0f), HMM_V4(1.0f, 3.0f, 2.5f, 0.0f));
+
+    // An empty box merges to the other box
+    HMM_AABB empty = HMM_AABBFromPoints(points, 0);
+    HMM_AABB merged = HMM_MergeAABB(empty, box);
+    EXPECT_TRUE(memcmp(&merged, &box, sizeof(box)) == 0);
+
+    EXPECT_TRUE(HMM_AABBContainsV3(box, HMM_V3(0.0f, 0.0f, 1.0f)));
+    EXPECT_TRUE(HMM_AABBContainsV3(box, box.Max));
+    EXPECT_FALSE(HMM_AABBContainsV3(box, HMM_V3(0.0f, 0.0f, 5.5f)));
+
+    HMM_AABB inner = { { HMM_V3(-0.5f, 0.0f, 1.0f), HMM_V3(0.5f, 1.0f, 2.0f) } };
+    HMM_AABB touching = { { HMM_V3(1.0f, 0.0f, 1.0f), HMM_V3(2.0f, 1.0f, 2.0f) } };
+    HMM_AABB apart = { { HMM_V3(1.5f, 0.0f, 1.0f), HMM_V3(2.0f, 1.0f, 2.0f) } };
+    EXPECT_TRUE(HMM_AABBContainsAABB(box, inner));
+    EXPECT_FALSE(HMM_AABBContainsAABB(inner, box));
+    EXPECT_FALSE(HMM_AABBContainsAABB(box, touching));
+    EXPECT_TRUE(HMM_AABBOverlap(box, touching));
+    EXPECT_FALSE(HMM_AABBOverlap(box, apart));
+    EXPECT_FALSE(HMM_AABBOverlap(apart, box));
+
+    merged = HMM_MergeAABB(box, apart);
+    EXPECT_V4_EQ(HMM_V4V(merged.Min, 0.0f), HMM_V4(-1.0f, -2.0f, 0.0f, 0.0f));
+    EXPECT_V4_EQ(HMM_V4V(merged.Max, 0.0f), HMM_V4(2.0f, 4.0f, 5.0f, 0.0f));
+}
+
+TEST(BoundingVolume, TransformAABB)
+{
+    unsigned int State = 7;
+    for (int i = 0; i < 8; ++i)
+    {
+        HMM_Mat4 m = HMMTest_AffineM4(i);
+        HMM_AABB box = BoundsTestBox(&State);
+        EXPECT_AABB_NEAR(HMM_TransformAABB(m, box), BoundsTestTransformCorners(m, box), 1e-4f);
+    }
+
+    HMM_Mat4 m = HMMTest_AffineM4(3);
+    HMM_AABB boxes[11], outs[11];
+    for (int i = 0; i < 11; ++i)
+    {
+        boxes[i] = BoundsTestBox(&State);
+    }
+    HMM_TransformAABBArray(m, boxes, outs, 11);
+    for (int i = 0; i < 11; ++i)
+    {
+        HMM_AABB expected = HMM_TransformAABB(m, boxes[i]);
+        EXPECT_TRUE(memcmp(&outs[i], &expected, sizeof(expected)) == 0);
+    }
+
+    // In place
+    HMM_TransformAABBArray(m, boxes, boxes, 11);
+    EXPECT_TRUE(memcmp(boxes, outs, sizeof(outs)) == 0);
+}
+
+TEST(BoundingVolume, AABBArrays)
+{
+    enum { Count = 29 };
+    unsigned int State = 11;
+    HMM_AABB boxes[Count];
+    for (int i = 0; i < Count; ++i)
+    {
+        boxes[i] = BoundsTestBox(&State);
+    }
+
+    HMM_AABB merged = HMM_MergeAABBArray(boxes, Count);
+    HMM_AABB expected = boxes[0];
+    for (int i = 1; i < Count; ++i)
+    {
+        expected = HMM_MergeAABB(expected, boxes[i]);
+    }
+    EXPECT_TRUE(memcmp(&merged, &expected, sizeof(expected)) == 0);
+
+    HMM_AABB query = { { HMM_V3(-3.0f, -3.0f, -3.0f), HMM_V3(4.0f, 3.0f, 5.0f) } };
+    unsigned char overlaps[(Count + 7) / 8];
+    HMM_AABBOverlapArray(query, boxes, overlaps, Count);
+
+    int overlapping = 0;
+    for (int i = 0; i < Count; ++i)
+    {
+        HMM_Bool overlap = (overlaps[i / 8] >> (i % 8)) & 1;
+        EXPECT_TRUE(overlap == HMM_AABBOverlap(query, boxes[i]));
+        overlapping += overlap;
+    }
+    EXPECT_GT((float)overlapping, 0.0f);
+    EXPECT_LT((float)overlapping, (float)Count);
+
+    // Bits past Count are cleared
+    EXPECT_TRUE((overlaps[Count / 8] >> (Count % 8)) == 0);
+}
+
+TEST(BoundingVolume, Sphere)
+{
+    HMM_Sphere a = { { HMM_V3(0.0f, 0.0f, 0.0f), 1.0f } };
+    HMM_Sphere b = { { HMM_V3(3.0f, 0.0f, 0.0f), 1.0f } };
+    HMM_Sphere inner = { { HMM_V3(0.2f, 0.0f, 0.0f), 0.5f } };
+
+    EXPECT_TRUE(HMM_SphereContainsV3(a, HMM_V3(0.0f, 0.6f, 0.8f)));
+    EXPECT_FALSE(HMM_SphereContainsV3(a, HMM_V3(0.0f, 0.8f, 0.8f)));
+    EXPECT_FALSE(HMM_SphereOverlap(a, b));
+    b.Radius = 2.0f;
+    EXPECT_TRUE(HMM_SphereOverlap(a, b));
+
+    {
+        HMM_Sphere merged = HMM_MergeSphere(a, b);
+        EXPECT_NEAR(merged.Center.X, 2.0f, 1e-6f);
+        EXPECT_NEAR(merged.Center.Y, 0.0f, 1e-6f);
+        EXPECT_NEAR(merged.Radius, 3.0f, 1e-6f);
+    }
+    {
+        HMM_Sphere merged = HMM_MergeSphere(inner, a);
+        EXPECT_TRUE(memcmp(&merged, &a, sizeof(a)) == 0);
+    }
+
+    HMM_AABB box = { { HMM_V3(1.5f, -1.0f, -1.0f), HMM_V3(2.0f, 1.0f, 1.0f) } };
+    EXPECT_FALSE(HMM_SphereOverlapAABB(a, box));
+    EXPECT_TRUE(HMM_SphereOverlapAABB(b, box));
+    a.Center = HMM_V3(1.0f, 1.0f, 0.0f);
+    EXPECT_TRUE(HMM_SphereOverlapAABB(a, box));
+
+    HMM_Sphere around = HMM_SphereFromAABB(box);
+    EXPECT_NEAR(around.Center.X, 1.75f, 1e-6f);
+    EXPECT_NEAR(around.Radius, HMM_SqrtF(0.0625f + 2.0f), 1e-6f);
+    HMM_AABB back = HMM_AABBFromSphere(around);
+    EXPECT_TRUE(HMM_AABBContainsAABB(back, box));
+}
+
+TEST(BoundingVolume, TransformSphere)
+{
+    HMM_Mat4 m = HMMTest_AffineM4(2);
+    HMM_Sphere sphere = { { HMM_V3(1.0f, -2.0f, 3.0f), 1.5f } };
+
+    HMM_Sphere result = HMM_TransformSphere(m, sphere);
+    HMM_Vec4 center = HMM_MulM4V4(m, HMM_V4V(sphere.Center, 1.0f));
+    EXPECT_NEAR(result.Center.X, center.X, 1e-5f);
+    EXPECT_NEAR(result.Center.Y, center.Y, 1e-5f);
+    EXPECT_NEAR(result.Center.Z, center.Z, 1e-5f);
+    EXPECT_NEAR(result.Radius, 1.5f * 2.0f, 1e-5f);
+
+    HMM_Sphere spheres[7], outs[7];
+    for (int i = 0; i < 7; ++i)
+    {
+        spheres[i].Center = HMM_V3(1.0f * i, -0.5f * i, 2.0f);
+        spheres[i].Radius = 0.25f * i;
+    }
+    HMM_TransformSphereArray(m, spheres, outs, 7);
+    for (int i = 0; i < 7; ++i)
+    {
+        HMM_Sphere expected = HMM_TransformSphere(m, spheres[i]);
+        EXPECT_V4_NEAR(outs[i].CenterRadius, expected.CenterRadius, 1e-5f);
+    }
+}
+
+TEST(BoundingVolume, OBB)
+{
+    HMM_AABB box = { { HMM_V3(-1.0f, -2.0f, -0.5f), HMM_V3(3.0f, 2.0f, 0.5f) } };
+    HMM_Mat4 m = HMMTest_AffineM4(1);
+    HMM_OBB obb = HMM_OBBFromAABB(m, box);
+
+    EXPECT_NEAR(obb.HalfExtents.X, 2.0f * 1.1f, 1e-5f);
+    EXPECT_NEAR(obb.HalfExtents.Y, 2.0f * 2.0f, 1e-5f);
+    EXPECT_NEAR(obb.HalfExtents.Z, 0.5f * 0.5f, 1e-5f);
+    EXPECT_NEAR(HMM_DotV3(obb.Axes.Columns[0], obb.Axes.Columns[1]), 0.0f, 1e-5f);
+    EXPECT_NEAR(HMM_LenV3(obb.Axes.Columns[2]), 1.0f, 1e-5f);
+
+    // The axis-aligned box around the oriented one is the transformed box
+    EXPECT_AABB_NEAR(HMM_AABBFromOBB(obb), HMM_TransformAABB(m, box), 1e-4f);
+
+    // Points inside the original box stay inside
+    unsigned int State = 3;
+    for (int i = 0; i < 16; ++i)
+    {
+        HMM_Vec3 point = HMM_V3(HMMTest_Random(&State, -1.0f, 3.0f), HMMTest_Random(&State, -2.0f, 2.0f), HMMTest_Random(&State, -0.5f, 0.5f));
+        HMM_Vec3 transformed = HMM_MulM4V4(m, HMM_V4V(point, 1.0f)).XYZ;
+        EXPECT_TRUE(HMM_OBBContainsV3(obb, HMM_AddV3(HMM_MulV3F(HMM_SubV3(transformed, obb.Center), 0.99f), obb.Center)));
+    }
+    EXPECT_FALSE(HMM_OBBContainsV3(obb, HMM_AddV3(obb.Center, HMM_MulV3F(obb.Axes.Columns[2], 0.3f))));
+
+    // Transforming the oriented box matches building it from the combined transform
+    HMM_Mat4 rigid = HMM_MulM4(HMM_Translate(HMM_V3(4.0f, 0.0f, -1.0f)), HMM_Rotate_RH(0.9f, HMM_NormV3(HMM_V3(0.0f, 1.0f, 1.0f))));
+    HMM_OBB moved = HMM_TransformOBB(rigid, obb);
+    HMM_OBB expected = HMM_OBBFromAABB(HMM_MulM4(rigid, m), box);
+    EXPECT_V4_NEAR(HMM_V4V(moved.Center, 0.0f), HMM_V4V(expected.Center, 0.0f), 1e-4f);
+    EXPECT_V4_NEAR(HMM_V4V(moved.HalfExtents, 0.0f), HMM_V4V(expected.HalfExtents, 0.0f), 1e-4f);
+    EXPECT_V4_NEAR(HMM_V4V(moved.Axes.Columns[1], 0.0f), HMM_V4V(expected.Axes.Columns[1], 0.0f), 1e-5f);
+}
+
+TEST(BoundingVolume, OBBOverlap)
+{
+    HMM_AABB unit = { { HMM_V3(-1.0f, -1.0f, -1.0f), HMM_V3(1.0f, 1.0f, 1.0f) } };
+    HMM_OBB a = HMM_OBBFromAABB(HMM_M4D(1.0f), unit);
+
+    // Face-separated
+    HMM_OBB b = HMM_OBBFromAABB(HMM_Translate(HMM_V3(2.5f, 0.0f, 0.0f)), unit);
+    EXPECT_FALSE(HMM_OBBOverlap(a, b));
+    b = HMM_OBBFromAABB(HMM_Translate(HMM_V3(1.9f, 0.0f, 0.0f)), unit);
+    EXPECT_TRUE(HMM_OBBOverlap(a, b));
+
+    // Rotated 45 degrees about Z, so its edge reaches sqrt(2) along X
+    HMM_Mat4 rotation = HMM_Rotate_RH(HMM_AngleDeg(45.0f), HMM_V3(0.0f, 0.0f, 1.0f));
+    b = HMM_OBBFromAABB(HMM_MulM4(HMM_Translate(HMM_V3(2.3f, 0.0f, 0.0f)), rotation), unit);
+    EXPECT_TRUE(HMM_OBBOverlap(a, b));
+    b = HMM_OBBFromAABB(HMM_MulM4(HMM_Translate(HMM_V3(2.5f, 0.0f, 0.0f)), rotation), unit);
+    EXPECT_FALSE(HMM_OBBOverlap(a, b));
+
+    // Ridges crossing at right angles, which only an edge-edge axis separates. They touch at a distance of 2 * sqrt(2).
+    a = HMM_OBBFromAABB(HMM_Rotate_RH(HMM_AngleDeg(45.0f), HMM_V3(1.0f, 0.0f, 0.0f)), unit);
+    rotation = HMM_Rotate_RH(HMM_AngleDeg(45.0f), HMM_V3(0.0f, 0.0f, 1.0f));
+    b = HMM_OBBFromAABB(HMM_MulM4(HMM_Translate(HMM_V3(0.0f, 2.9f, 0.0f)), rotation), unit);
+    EXPECT_FALSE(HMM_OBBOverlap(a, b));
+    EXPECT_FALSE(HMM_OBBOverlap(b, a));
+    b = HMM_OBBFromAABB(HMM_MulM4(HMM_Translate(HMM_V3(0.0f, 2.7f, 0.0f)), rotation), unit);
+    EXPECT_TRUE(HMM_OBBOverlap(a, b));
+    EXPECT_TRUE(HMM_OBBOverlap(b, a));
+}
@@ -0,0 +1,94 @@
+#include "../HandmadeTest.h"
+
+static HMM_DVec3 CameraRelativeTestPosition(int i)
+{
+    return HMM_DV3(6.4e9 + 1.25 * i, -3.1e8 - 0.5 * i, 1.7e7 + 0.125 * i);
+}
+
+TEST(CameraRelative, Positions)
+{
+    HMM_DVec3 camera = HMM_DV3(6.4e9 + 0.75, -3.1e8 + 0.5, 1.7e7 - 1.0);
+
+    {
+        HMM_Vec3 result = HMM_CameraRelativeV3(HMM_DV3(6.4e9 + 3.0, -3.1e8 - 2.0, 1.7e7 + 0.25), camera);
+        EXPECT_FLOAT_EQ(result.X, 2.25f);
+        EXPECT_FLOAT_EQ(result.Y, -2.5f);
+        EXPECT_FLOAT_EQ(result.Z, 1.25f);
+    }
+
+    HMM_DVec3 positions[5];
+    HMM_Vec3 outs[5];
+    for (int i = 0; i < 5; ++i)
+    {
+        positions[i] = CameraRelativeTestPosition(i);
+    }
+    HMM_CameraRelativeV3Array(positions, camera, outs, 5);
+    for (int i = 0; i < 5; ++i)
+    {
+        HMM_Vec3 expected = HMM_CameraRelativeV3(positions[i], camera);
+        EXPECT_TRUE(memcmp(&outs[i], &expected, sizeof(expected)) == 0);
+        EXPECT_FLOAT_EQ(outs[i].X, 1.25f * i - 0.75f);
+    }
+}
+
+TEST(CameraRelative, View)
+{
+    HMM_DVec3 eye = HMM_DV3(6.4e9, -3.1e8, 1.7e7);
+    HMM_DMat4 view = HMM_DLookAt_RH(eye, HMM_AddDV3(eye, HMM_DV3(1.0, 2.0, -3.0)), HMM_DV3(0.0, 0.0, 1.0));
+    HMM_Mat4 result = HMM_CameraRelativeView(view);
+
+    HMM_Mat4 expected = HMM_LookAt_RH(HMM_V3(0.0f, 0.0f, 0.0f), HMM_V3(1.0f, 2.0f, -3.0f), HMM_V3(0.0f, 0.0f, 1.0f));
+    EXPECT_M4_NEAR(result, expected, 1e-6f);
+}
+
+TEST(CameraRelative, ModelView)
+{
+    HMM_DVec3 eye = HMM_DV3(6.4e9 - 20.0, -3.1e8 + 5.0, 1.7e7 + 3.0);
+    HMM_DMat4 view = HMM_DLookAt_RH(eye, HMM_DV3(6.4e9, -3.1e8, 1.7e7), HMM_DV3(0.0, 0.0, 1.0));
+    HMM_Mat4 relativeView = HMM_CameraRelativeView(view);
+
+    HMM_DVec3 positions[5];
+    HMM_Mat4 models[5], outs[5];
+    for (int i = 0; i < 5; ++i)
+    {
+        positions[i] = CameraRelativeTestPosition(i);
+        models[i] = HMMTest_AffineM4(i);
+    }
+
+    {
+        // Matches the product done entirely in double
+        HMM_DMat4 model = HMM_MulDM4(HMM_DTranslate(positions[3]), HMM_M4ToDM4(models[3]));
+        HMM_Mat4 expected = HMM_DM4ToM4(HMM_MulDM4(view, model));
+        HMM_Mat4 result = HMM_CameraRelativeModelView(relativeView, eye, positions[3], models[3]);
+        EXPECT_M4_NEAR(result, expected, 1e-4f);
+
+        // Doing it in float loses whole units at this distance
+        HMM_Mat4 naive = HMM_MulM4(HMM_DM4ToM4(view), HMM_MulM4(HMM_Translate(HMM_DV3ToV3(positions[3])), models[3]));
+        EXPECT_GT(HMM_LenV3(HMM_SubV3(naive.Columns[3].XYZ, expected.Columns[3].XYZ)), 1.0f);
+    }
+
+    HMM_CameraRelativeModelViewArray(relativeView, eye, positions, models, outs, 5);
+    for (int i = 0; i < 5; ++i)
+    {
+        HMM_Mat4 expected = HMM_CameraRelativeModelView(relativeView, eye, positions[i], models[i]);
+        EXPECT_TRUE(memcmp(&outs[i], &expected, sizeof(expected)) == 0);
+    }
+
+    // No local transforms
+    HMM_CameraRelativeModelViewArray(relativeView, eye, positions, NULL, outs, 5);
+    for (int i = 0; i < 5; ++i)
+    {
+        HMM_Mat4 expected = HMM_CameraRelativeModelView(relativeView, eye, positions[i], HMM_M4D(1.0f));
+        EXPECT_M4_NEAR(outs[i], expected, 1e-6f);
+    }
+
+    // In place
+    HMM_Mat4 inPlace[5];
+    memcpy(inPlace, models, sizeof(models));
+    HMM_CameraRelativeModelViewArray(relativeView, eye, positions, inPlace, inPlace, 5);
+    for (int i = 0; i < 5; ++i)
+    {
+        HMM_Mat4 expected = HMM_CameraRelativeModelView(relativeView, eye, positions[i], models[i]);
+        EXPECT_TRUE(memcmp(&inPlace[i], &expected, sizeof(expected)) == 0);
+    }
+}
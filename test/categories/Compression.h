@@ -0,0 +1,233 @@
+#include "../HandmadeTest.h"
+
+static HMM_Quat CompressionTestQ(int i)
+{
+    HMM_Vec3 axis = HMM_NormV3(HMM_V3(HMM_SinF(0.7f * i), HMM_CosF(1.3f * i), 0.5f - 0.01f * i));
+    return HMM_QFromAxisAngle_RH(axis, 0.37f * i - 3.0f);
+}
+
+static HMM_Vec3 CompressionTestDir(int i)
+{
+    return HMM_NormV3(HMM_V3(HMM_SinF(0.9f * i), HMM_CosF(0.4f * i), HMM_SinF(0.23f * i + 1.0f)));
+}
+
+// The largest difference between the components of Expected and Actual, allowing for Actual
+// being the negated quaternion.
+static float CompressionQError(HMM_Quat Expected, HMM_Quat Actual)
+{
+    if (HMM_DotQ(Expected, Actual) < 0.0f)
+    {
+        Actual = HMM_MulQF(Actual, -1.0f);
+    }
+
+    float error = 0.0f;
+    for (int i = 0; i < 4; ++i)
+    {
+        error = HMM_MAX(error, HMM_ABS(Expected.Elements[i] - Actual.Elements[i]));
+    }
+    return error;
+}
+
+TEST(Compression, SmallestThree)
+{
+    float maxError32 = 0.0f;
+    float maxError48 = 0.0f;
+    for (int i = 0; i < 200; ++i)
+    {
+        HMM_Quat q = CompressionTestQ(i);
+        HMM_Quat q32 = HMM_UnpackQ32(HMM_PackQ32(q));
+        HMM_Quat q48 = HMM_UnpackQ48(HMM_PackQ48(q));
+        maxError32 = HMM_MAX(maxError32, CompressionQError(q, q32));
+        maxError48 = HMM_MAX(maxError48, CompressionQError(q, q48));
+        EXPECT_NEAR(HMM_DotQ(q32, q32), 1.0f, 1e-6f);
+        EXPECT_NEAR(HMM_DotQ(q48, q48), 1.0f, 1e-6f);
+    }
+    EXPECT_LT(maxError32, 2e-3f);
+    EXPECT_LT(maxError48, 7e-5f);
+
+    // The largest component is stored as an index, and comes back positive
+    {
+        HMM_Quat q = HMM_NormQ(HMM_Q(0.1f, 0.2f, -0.9f, 0.3f));
+        HMM_PackedQuat32 p32 = HMM_PackQ32(q);
+        HMM_PackedQuat48 p48 = HMM_PackQ48(q);
+        EXPECT_TRUE(p32.Bits >> 30 == 2);
+        EXPECT_TRUE(p48.Bits[0] >> 15 == 1 && p48.Bits[1] >> 15 == 0);
+
+        HMM_Quat negated = HMM_MulQF(q, -1.0f);
+        EXPECT_TRUE(HMM_PackQ32(negated).Bits == p32.Bits);
+        EXPECT_NEAR(HMM_UnpackQ32(p32).Z, -q.Z, 2e-3f);
+        EXPECT_NEAR(HMM_UnpackQ48(p48).Z, -q.Z, 7e-5f);
+    }
+    {
+        HMM_Quat q = HMM_NormQ(HMM_Q(-0.2f, 0.8f, 0.1f, 0.3f));
+        EXPECT_TRUE(HMM_PackQ32(q).Bits >> 30 == 1);
+        EXPECT_TRUE(HMM_PackQ48(q).Bits[0] >> 15 == 0 && HMM_PackQ48(q).Bits[1] >> 15 == 1);
+        EXPECT_NEAR(HMM_UnpackQ48(HMM_PackQ48(q)).Y, q.Y, 7e-5f);
+    }
+
+    // Arrays, with a partial block at the end
+    HMM_PackedQuat32 packed32[7];
+    HMM_PackedQuat48 packed48[7];
+    HMM_Quat outs32[7], outs48[7];
+    for (int i = 0; i < 7; ++i)
+    {
+        packed32[i] = HMM_PackQ32(CompressionTestQ(3 * i));
+        packed48[i] = HMM_PackQ48(CompressionTestQ(3 * i));
+    }
+    HMM_UnpackQ32Array(packed32, outs32, 7);
+    HMM_UnpackQ48Array(packed48, outs48, 7);
+    for (int i = 0; i < 7; ++i)
+    {
+        EXPECT_V4_NEAR(outs32[i], HMM_UnpackQ32(packed32[i]), 1e-6f);
+        EXPECT_V4_NEAR(outs48[i], HMM_UnpackQ48(packed48[i]), 1e-6f);
+    }
+}
+
+TEST(Compression, Half)
+{
+    {
+        HMM_HalfVec3 p = HMM_PackHalfV3(HMM_V3(1.0f, -2.0f, 65504.0f));
+        EXPECT_TRUE(p.Elements[0] == 0x3c00 && p.Elements[1] == 0xc000 && p.Elements[2] == 0x7bff);
+    }
+    {
+        // Ties round to even
+        HMM_HalfVec3 p = HMM_PackHalfV3(HMM_V3(1.0f + 1.0f / 2048.0f, 1.0f + 3.0f / 2048.0f, -(1.0f + 1.0f / 4096.0f)));
+        EXPECT_TRUE(p.Elements[0] == 0x3c00 && p.Elements[1] == 0x3c02 && p.Elements[2] == 0xbc00);
+    }
+    {
+        // Denormals, and overflow to infinity
+        float smallest = 1.0f / 16777216.0f;
+        HMM_HalfVec3 p = HMM_PackHalfV3(HMM_V3(3.0f * smallest, 0.5f * smallest, 1e6f));
+        EXPECT_TRUE(p.Elements[0] == 0x0003 && p.Elements[1] == 0x0000 && p.Elements[2] == 0x7c00);
+
+        HMM_Vec3 v = HMM_UnpackHalfV3(p);
+        EXPECT_FLOAT_EQ(v.X, 3.0f * smallest);
+        EXPECT_FLOAT_EQ(v.Y, 0.0f);
+        EXPECT_GT(v.Z, 3.4e38f);
+        EXPECT_TRUE(HMM_PackHalfV3(v).Elements[2] == 0x7c00);
+    }
+    {
+        // NaN survives a round trip
+        HMM_HalfVec3 p;
+        p.Elements[0] = 0x7e00;
+        p.Elements[1] = 0xfc00;
+        p.Elements[2] = 0x8000;
+        HMM_HalfVec3 again = HMM_PackHalfV3(HMM_UnpackHalfV3(p));
+        EXPECT_TRUE(memcmp(&again, &p, sizeof(p)) == 0);
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        HMM_Vec3 v = HMM_MulV3F(CompressionTestDir(i), 0.01f * (i * i) + 0.001f);
+        HMM_Vec3 result = HMM_UnpackHalfV3(HMM_PackHalfV3(v));
+        for (int c = 0; c < 3; ++c)
+        {
+            EXPECT_LT(HMM_ABS(result.Elements[c] - v.Elements[c]), HMM_ABS(v.Elements[c]) / 2048.0f + 3e-8f);
+        }
+    }
+
+    // Arrays, with a partial block at the end
+    HMM_HalfVec3 packed[7];
+    HMM_Vec3 outs[7];
+    for (int i = 0; i < 7; ++i)
+    {
+        packed[i] = HMM_PackHalfV3(HMM_MulV3F(CompressionTestDir(i), 100.0f * i - 300.0f));
+    }
+    packed[2].Elements[1] = 0x0201;
+    packed[5].Elements[0] = 0xfc00;
+    HMM_UnpackHalfV3Array(packed, outs, 7);
+    for (int i = 0; i < 7; ++i)
+    {
+        HMM_Vec3 expected = HMM_UnpackHalfV3(packed[i]);
+        EXPECT_TRUE(memcmp(&outs[i], &expected, sizeof(expected)) == 0);
+    }
+}
+
+TEST(Compression, Fixed)
+{
+    HMM_Vec3 min = HMM_V3(-10.0f, 0.0f, -1.0f);
+    HMM_Vec3 max = HMM_V3(10.0f, 5.0f, 3.0f);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        HMM_Vec3 v = HMM_V3(HMM_SinF(0.3f * i) * 10.0f, 0.05f * i, HMM_CosF(0.7f * i) * 2.0f + 1.0f);
+        HMM_Vec3 result = HMM_UnpackFixedV3(HMM_PackFixedV3(v, min, max), min, max);
+        EXPECT_NEAR(result.X, v.X, 20.0f / 131070.0f + 1e-6f);
+        EXPECT_NEAR(result.Y, v.Y, 5.0f / 131070.0f + 1e-6f);
+        EXPECT_NEAR(result.Z, v.Z, 4.0f / 131070.0f + 1e-6f);
+    }
+
+    {
+        // Clamped to the box
+        HMM_FixedVec3 p = HMM_PackFixedV3(HMM_V3(-20.0f, 6.0f, 3.0f), min, max);
+        EXPECT_TRUE(p.Elements[0] == 0 && p.Elements[1] == 65535 && p.Elements[2] == 65535);
+
+        HMM_Vec3 v = HMM_UnpackFixedV3(p, min, max);
+        EXPECT_FLOAT_EQ(v.X, -10.0f);
+        EXPECT_NEAR(v.Y, 5.0f, 1e-6f);
+        EXPECT_NEAR(v.Z, 3.0f, 1e-6f);
+    }
+
+    // Arrays, with a partial block at the end
+    HMM_FixedVec3 packed[7];
+    HMM_Vec3 outs[7];
+    for (int i = 0; i < 7; ++i)
+    {
+        packed[i] = HMM_PackFixedV3(HMM_V3(3.0f * i - 9.0f, 0.7f * i, 0.5f * i - 1.0f), min, max);
+    }
+    HMM_UnpackFixedV3Array(packed, min, max, outs, 7);
+    for (int i = 0; i < 7; ++i)
+    {
+        HMM_Vec3 expected = HMM_UnpackFixedV3(packed[i], min, max);
+        EXPECT_NEAR(outs[i].X, expected.X, 1e-6f);
+        EXPECT_NEAR(outs[i].Y, expected.Y, 1e-6f);
+        EXPECT_NEAR(outs[i].Z, expected.Z, 1e-6f);
+    }
+}
+
+TEST(Compression, Octahedral)
+{
+    float maxError = 0.0f;
+    for (int i = 0; i < 200; ++i)
+    {
+        HMM_Vec3 v = CompressionTestDir(i);
+        HMM_Vec3 result = HMM_UnpackOctV3(HMM_PackOctV3(v));
+        for (int c = 0; c < 3; ++c)
+        {
+            maxError = HMM_MAX(maxError, HMM_ABS(result.Elements[c] - v.Elements[c]));
+        }
+    }
+    EXPECT_LT(maxError, 7e-5f);
+
+    {
+        // The poles and the folded lower half
+        HMM_Vec3 down = HMM_UnpackOctV3(HMM_PackOctV3(HMM_V3(0.0f, 0.0f, -1.0f)));
+        EXPECT_NEAR(down.X, 0.0f, 1e-6f);
+        EXPECT_NEAR(down.Y, 0.0f, 1e-6f);
+        EXPECT_NEAR(down.Z, -1.0f, 1e-6f);
+
+        HMM_Vec3 up = HMM_UnpackOctV3(HMM_PackOctV3(HMM_V3(0.0f, 0.0f, 1.0f)));
+        EXPECT_NEAR(up.Z, 1.0f, 1e-6f);
+
+        HMM_OctVec3 p = HMM_PackOctV3(HMM_NormV3(HMM_V3(-1.0f, 2.0f, -3.0f)));
+        EXPECT_TRUE(p.X < 0 && p.Y > 0);
+        HMM_Vec3 v = HMM_UnpackOctV3(p);
+        EXPECT_NEAR(v.Z, -3.0f / HMM_SqrtF(14.0f), 7e-5f);
+    }
+
+    // Arrays, with a partial block at the end
+    HMM_OctVec3 packed[7];
+    HMM_Vec3 outs[7];
+    for (int i = 0; i < 7; ++i)
+    {
+        packed[i] = HMM_PackOctV3(CompressionTestDir(5 * i));
+    }
+    HMM_UnpackOctV3Array(packed, outs, 7);
+    for (int i = 0; i < 7; ++i)
+    {
+        HMM_Vec3 expected = HMM_UnpackOctV3(packed[i]);
+        EXPECT_NEAR(outs[i].X, expected.X, 1e-6f);
+        EXPECT_NEAR(outs[i].Y, expected.Y, 1e-6f);
+        EXPECT_NEAR(outs[i].Z, expected.Z, 1e-6f);
+    }
+}
@@ -0,0 +1,71 @@
+#include "../HandmadeTest.h"
+
+TEST(Dispatch, Tiers)
+{
+    HMM_SIMDTier original = HMM_GetSIMDTier();
+#ifdef HANDMADE_MATH_NO_SIMD
+    EXPECT_TRUE(original == HMM_SIMD_TIER_NONE);
+#else
+    EXPECT_TRUE(original != HMM_SIMD_TIER_NONE);
+#endif
+
+    HMM_Mat4 m4 = HMM_M4();
+    for (int Column = 0; Column < 4; ++Column)
+    {
+        for (int Row = 0; Row < 4; ++Row)
+        {
+            m4.Elements[Column][Row] = 0.25f * (float)(Column * 4 + Row) - 1.3f;
+        }
+    }
+
+    HMM_Vec4 vectors[7];
+    HMM_Quat left[7];
+    HMM_Quat right[7];
+    for (int i = 0; i < 7; ++i)
+    {
+        vectors[i] = HMM_V4(0.1f * i, 1.0f - 0.3f * i, 2.5f + i, (i % 2) ? 1.0f : 0.0f);
+        left[i] = HMM_Q(1.0f + i, 2.0f - 0.5f * i, 3.0f, 0.25f * i - 4.0f);
+        right[i] = HMM_Q(-0.75f * i, 6.0f, 7.0f - i, 8.0f + 0.125f * i);
+    }
+
+    // Every tier gives the same results up to rounding, including for counts that don't fill a register.
+    for (int tier = HMM_SIMD_TIER_SSE; tier <= HMM_SIMD_TIER_AVX512; ++tier)
+    {
+        HMM_SIMDTier selected = HMM_SetSIMDTier((HMM_SIMDTier)tier);
+        EXPECT_TRUE(selected == HMM_GetSIMDTier());
+#ifdef HANDMADE_MATH__USE_DISPATCH
+        EXPECT_TRUE(selected >= HMM_SIMD_TIER_SSE && (int)selected <= tier);
+#else
+        EXPECT_TRUE(selected == original);
+#endif
+
+        for (int count = 1; count <= 7; count += 2)
+        {
+            HMM_Vec4 transformed[7];
+            HMM_Quat products[7];
+            HMM_Quat normalized[7];
+            transformed[count - 1] = HMM_V4(-7.0f, -7.0f, -7.0f, -7.0f);
+            products[count - 1] = HMM_Q(-7.0f, -7.0f, -7.0f, -7.0f);
+            normalized[count - 1] = HMM_Q(-7.0f, -7.0f, -7.0f, -7.0f);
+
+            HMM_MulM4V4Array(m4, vectors, 0, transformed, 0, count);
+            HMM_MulQArray(left, right, products, count);
+            HMM_NormQArray(left, normalized, count);
+
+            for (int i = 0; i < count; ++i)
+            {
+                HMM_Vec4 expectedTransformed = HMM_MulM4V4(m4, vectors[i]);
+                HMM_Quat expectedProduct = HMM_MulQ(left[i], right[i]);
+                HMM_Quat expectedNormalized = HMM_NormQ(left[i]);
+                for (int j = 0; j < 4; ++j)
+                {
+                    EXPECT_NEAR(transformed[i].Elements[j], expectedTransformed.Elements[j], 0.0001f);
+                    EXPECT_NEAR(products[i].Elements[j], expectedProduct.Elements[j], 0.0001f);
+                    EXPECT_NEAR(normalized[i].Elements[j], expectedNormalized.Elements[j], 0.0001f);
+                }
+            }
+        }
+    }
+
+    EXPECT_TRUE(HMM_SetSIMDTier(original) == original);
+}
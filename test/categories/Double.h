@@ -0,0 +1,290 @@
+#include "../HandmadeTest.h"
+
+#define EXPECT_DOUBLE_NEAR(_actual, _expected, _epsilon) \
+    do { \
+        double _d = (_actual) - (_expected); \
+        EXPECT_TRUE(-(_epsilon) <= _d && _d <= (_epsilon)); \
+    } while (0)
+
+#define EXPECT_DV3_NEAR(_actual, _expected, _epsilon) \
+    do { \
+        HMM_DVec3 _a = (_actual); \
+        HMM_DVec3 _e = (_expected); \
+        EXPECT_DOUBLE_NEAR(_a.X, _e.X, _epsilon); \
+        EXPECT_DOUBLE_NEAR(_a.Y, _e.Y, _epsilon); \
+        EXPECT_DOUBLE_NEAR(_a.Z, _e.Z, _epsilon); \
+    } while (0)
+
+TEST(Double, Vector)
+{
+    HMM_DVec3 a = HMM_DV3(1.0, 2.0, 3.0);
+    HMM_DVec3 b = HMM_DV3(4.0, -5.0, 6.0);
+
+    EXPECT_DV3_NEAR(HMM_AddDV3(a, b), HMM_DV3(5.0, -3.0, 9.0), 0.0);
+    EXPECT_DV3_NEAR(HMM_SubDV3(a, b), HMM_DV3(-3.0, 7.0, -3.0), 0.0);
+    EXPECT_DV3_NEAR(HMM_MulDV3(a, b), HMM_DV3(4.0, -10.0, 18.0), 0.0);
+    EXPECT_DV3_NEAR(HMM_MulDV3F(a, 2.0), HMM_DV3(2.0, 4.0, 6.0), 0.0);
+    EXPECT_DV3_NEAR(HMM_DivDV3F(a, 2.0), HMM_DV3(0.5, 1.0, 1.5), 0.0);
+    EXPECT_DV3_NEAR(HMM_CrossDV3(a, b), HMM_DV3(27.0, 6.0, -13.0), 0.0);
+    EXPECT_DV3_NEAR(HMM_LerpDV3(a, 0.5, b), HMM_DV3(2.5, -1.5, 4.5), 0.0);
+    EXPECT_DOUBLE_NEAR(HMM_DotDV3(a, b), 12.0, 0.0);
+    EXPECT_DOUBLE_NEAR(HMM_LenSqrDV3(a), 14.0, 0.0);
+    EXPECT_DOUBLE_NEAR(HMM_LenDV3(HMM_DV3(2.0, 3.0, 6.0)), 7.0, 0.0);
+    EXPECT_DOUBLE_NEAR(HMM_LenDV3(HMM_NormDV3(b)), 1.0, 1e-15);
+
+    // Differences of large coordinates keep their fractional part
+    HMM_DVec3 far = HMM_DV3(1.0e8 + 0.25, -3.0e9 - 0.125, 5.0e7 + 0.5);
+    EXPECT_DV3_NEAR(HMM_SubDV3(far, HMM_DV3(1.0e8, -3.0e9, 5.0e7)), HMM_DV3(0.25, -0.125, 0.5), 0.0);
+
+    HMM_DVec4 c = HMM_DV4(1.0, 2.0, 3.0, 4.0);
+    HMM_DVec4 d = HMM_DV4V(b, -1.0);
+    HMM_DVec4 sum = HMM_AddDV4(c, d);
+    HMM_DVec4 difference = HMM_SubDV4(c, d);
+    HMM_DVec4 scaled = HMM_MulDV4F(c, -0.5);
+    HMM_DVec4 product = HMM_MulDV4(c, d);
+    HMM_DVec4 quotient = HMM_DivDV4F(c, 4.0);
+    EXPECT_DV3_NEAR(sum.XYZ, HMM_DV3(5.0, -3.0, 9.0), 0.0);
+    EXPECT_DOUBLE_NEAR(sum.W, 3.0, 0.0);
+    EXPECT_DV3_NEAR(difference.XYZ, HMM_DV3(-3.0, 7.0, -3.0), 0.0);
+    EXPECT_DOUBLE_NEAR(difference.W, 5.0, 0.0);
+    EXPECT_DV3_NEAR(scaled.XYZ, HMM_DV3(-0.5, -1.0, -1.5), 0.0);
+    EXPECT_DOUBLE_NEAR(scaled.W, -2.0, 0.0);
+    EXPECT_DV3_NEAR(product.XYZ, HMM_DV3(4.0, -10.0, 18.0), 0.0);
+    EXPECT_DOUBLE_NEAR(product.W, -4.0, 0.0);
+    EXPECT_DV3_NEAR(quotient.XYZ, HMM_DV3(0.25, 0.5, 0.75), 0.0);
+    EXPECT_DOUBLE_NEAR(quotient.W, 1.0, 0.0);
+    EXPECT_DOUBLE_NEAR(HMM_DotDV4(c, d), 8.0, 0.0);
+}
+
+TEST(Double, Matrix)
+{
+    // Small integers, so the float and double products are both exact
+    HMM_Mat4 m1, m2;
+    for (int Column = 0; Column < 4; ++Column)
+    {
+        for (int Row = 0; Row < 4; ++Row)
+        {
+            m1.Elements[Column][Row] = (float)(Column * 4 + Row - 7);
+            m2.Elements[Column][Row] = (float)((Column + 2 * Row) % 5 - 2);
+        }
+    }
+    HMM_DMat4 d1 = HMM_M4ToDM4(m1);
+    HMM_DMat4 d2 = HMM_M4ToDM4(m2);
+
+    HMM_Mat4 product = HMM_DM4ToM4(HMM_MulDM4(d1, d2));
+    EXPECT_M4_EQ(product, HMM_MulM4(m1, m2));
+    EXPECT_M4_EQ(HMM_DM4ToM4(HMM_TransposeDM4(d1)), HMM_TransposeM4(m1));
+    EXPECT_V4_EQ(HMM_DV4ToV4(HMM_MulDM4V4(d1, HMM_DV4(1.0, -2.0, 3.0, 0.5))), HMM_MulM4V4(m1, HMM_V4(1.0f, -2.0f, 3.0f, 0.5f)));
+
+    HMM_DMat4 identity = HMM_DM4D(1.0);
+    EXPECT_M4_EQ(HMM_DM4ToM4(HMM_MulDM4(identity, d1)), m1);
+
+    HMM_DMat4 translate = HMM_DTranslate(HMM_DV3(1.0e9, 2.0, -3.0));
+    HMM_DVec4 moved = HMM_MulDM4V4(translate, HMM_DV4(0.5, 0.0, 0.0, 1.0));
+    EXPECT_DOUBLE_NEAR(moved.X, 1.0e9 + 0.5, 0.0);
+    EXPECT_DOUBLE_NEAR(moved.Y, 2.0, 0.0);
+    EXPECT_DOUBLE_NEAR(moved.Z, -3.0, 0.0);
+    EXPECT_DOUBLE_NEAR(moved.W, 1.0, 0.0);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        HMM_DMat4 m = HMM_M4ToDM4(HMMTest_AffineM4(i));
+        HMM_DMat4 inverse = HMM_InvGeneralDM4(m);
+        HMM_DMat4 shouldBeIdentity = HMM_MulDM4(inverse, m);
+        for (int Column = 0; Column < 4; ++Column)
+        {
+            for (int Row = 0; Row < 4; ++Row)
+            {
+                EXPECT_DOUBLE_NEAR(shouldBeIdentity.Elements[Column][Row], Column == Row ? 1.0 : 0.0, 1e-13);
+            }
+        }
+        EXPECT_M4_NEAR(HMM_DM4ToM4(inverse), HMM_InvGeneralM4(HMMTest_AffineM4(i)), 1e-5f);
+    }
+}
+
+TEST(Double, Projection)
+{
+    HMM_DVec3 eye = HMM_DV3(1.0, 0.0, 0.0);
+    HMM_DVec3 center = HMM_DV3(0.0, 2.0, 1.0);
+    HMM_DVec3 up = HMM_DV3(2.0, 1.0, 1.0);
+    HMM_Vec3 eyeF = HMM_V3(1.0f, 0.0f, 0.0f);
+    HMM_Vec3 centerF = HMM_V3(0.0f, 2.0f, 1.0f);
+    HMM_Vec3 upF = HMM_V3(2.0f, 1.0f, 1.0f);
+
+    EXPECT_M4_NEAR(HMM_DM4ToM4(HMM_DLookAt_RH(eye, center, up)), HMM_LookAt_RH(eyeF, centerF, upF), 1e-6f);
+    EXPECT_M4_NEAR(HMM_DM4ToM4(HMM_DLookAt_LH(eye, center, up)), HMM_LookAt_LH(eyeF, centerF, upF), 1e-6f);
+
+    float fov = HMM_AngleDeg(60.0f);
+    EXPECT_M4_NEAR(HMM_DM4ToM4(HMM_DPerspective_RH_NO(fov, 2.0, 1.0, 15.0)), HMM_Perspective_RH_NO(fov, 2.0f, 1.0f, 15.0f), 1e-6f);
+    EXPECT_M4_NEAR(HMM_DM4ToM4(HMM_DPerspective_RH_ZO(fov, 2.0, 1.0, 15.0)), HMM_Perspective_RH_ZO(fov, 2.0f, 1.0f, 15.0f), 1e-6f);
+    EXPECT_M4_NEAR(HMM_DM4ToM4(HMM_DPerspective_LH_NO(fov, 2.0, 1.0, 15.0)), HMM_Perspective_LH_NO(fov, 2.0f, 1.0f, 15.0f), 1e-6f);
+    EXPECT_M4_NEAR(HMM_DM4ToM4(HMM_DPerspective_LH_ZO(fov, 2.0, 1.0, 15.0)), HMM_Perspective_LH_ZO(fov, 2.0f, 1.0f, 15.0f), 1e-6f);
+
+    // The camera can be far from the origin without losing the view of nearby points
+    HMM_DVec3 offset = HMM_DV3(4.0e9, -7.0e8, 1.0e9);
+    HMM_DMat4 view = HMM_DLookAt_RH(HMM_AddDV3(eye, offset), HMM_AddDV3(center, offset), up);
+    HMM_DVec4 viewPoint = HMM_MulDM4V4(view, HMM_DV4V(HMM_AddDV3(center, offset), 1.0));
+    EXPECT_DOUBLE_NEAR(viewPoint.X, 0.0, 1e-5);
+    EXPECT_DOUBLE_NEAR(viewPoint.Y, 0.0, 1e-5);
+    EXPECT_DOUBLE_NEAR(viewPoint.Z, -HMM_LenDV3(HMM_SubDV3(center, eye)), 1e-5);
+}
+
+TEST(Double, Quaternion)
+{
+    HMM_Quat qa = HMM_QFromAxisAngle_RH(HMM_V3(1.0f, 2.0f, -1.0f), 0.7f);
+    HMM_Quat qb = HMM_QFromAxisAngle_RH(HMM_V3(-0.5f, 1.0f, 3.0f), 2.1f);
+    HMM_DQuat a = HMM_DQuatFromAxisAngle_RH(HMM_DV3(1.0, 2.0, -1.0), 0.7f);
+    HMM_DQuat b = HMM_DQuatFromAxisAngle_RH(HMM_DV3(-0.5, 1.0, 3.0), 2.1f);
+
+    EXPECT_V4_NEAR(HMM_DQuatToQ(a), qa, 1e-6f);
+    EXPECT_V4_NEAR(HMM_DQuatToQ(HMM_DQuatFromAxisAngle_LH(HMM_DV3(1.0, 2.0, -1.0), 0.7f)), HMM_QFromAxisAngle_LH(HMM_V3(1.0f, 2.0f, -1.0f), 0.7f), 1e-6f);
+    EXPECT_V4_NEAR(HMM_DQuatToQ(HMM_MulDQuat(a, b)), HMM_MulQ(qa, qb), 1e-6f);
+    EXPECT_V4_NEAR(HMM_DQuatToQ(HMM_MulDQuat(b, a)), HMM_MulQ(qb, qa), 1e-6f);
+    EXPECT_V4_NEAR(HMM_DQuatToQ(HMM_InvDQuat(a)), HMM_InvQ(qa), 1e-6f);
+    EXPECT_V4_NEAR(HMM_DQuatToQ(HMM_DivDQuatF(a, 2.0)), HMM_DivQF(qa, 2.0f), 1e-6f);
+    EXPECT_DOUBLE_NEAR(HMM_DotDQuat(a, b), (double)HMM_DotQ(qa, qb), 1e-6);
+    EXPECT_M4_NEAR(HMM_DM4ToM4(HMM_DQuatToDM4(a)), HMM_QToM4(qa), 1e-6f);
+
+    HMM_DQuat identity = HMM_MulDQuat(a, HMM_InvDQuat(a));
+    EXPECT_DV3_NEAR(identity.XYZ, HMM_DV3(0.0, 0.0, 0.0), 1e-15);
+    EXPECT_DOUBLE_NEAR(identity.W, 1.0, 1e-15);
+
+    HMM_DQuat unnormalized = HMM_MulDQuatF(a, 3.0);
+    EXPECT_V4_NEAR(HMM_DQuatToQ(HMM_NormDQuat(unnormalized)), qa, 1e-6f);
+    EXPECT_V4_NEAR(HMM_DQuatToQ(HMM_SubDQuat(HMM_AddDQuat(a, b), b)), qa, 1e-6f);
+
+    for (int i = 0; i <= 4; ++i)
+    {
+        float t = 0.25f * i;
+        EXPECT_V4_NEAR(HMM_DQuatToQ(HMM_SLerpDQuat(a, t, b)), HMM_SLerp(qa, t, qb), 1e-5f);
+        EXPECT_V4_NEAR(HMM_DQuatToQ(HMM_NLerpDQuat(a, t, b)), HMM_NLerp(qa, t, qb), 1e-5f);
+    }
+
+    // Nearly identical rotations are interpolated without collapsing to the endpoints
+    HMM_DQuat c = HMM_DQuatFromAxisAngle_RH(HMM_DV3(0.0, 0.0, 1.0), HMM_AngleDeg(0.0));
+    HMM_DQuat d = HMM_DQuatFromAxisAngle_RH(HMM_DV3(0.0, 0.0, 1.0), HMM_AngleDeg(1.0f));
+    HMM_DQuat halfway = HMM_SLerpDQuat(c, 0.5, d);
+    HMM_DQuat expected = HMM_DQuatFromAxisAngle_RH(HMM_DV3(0.0, 0.0, 1.0), HMM_AngleDeg(0.5f));
+    EXPECT_DOUBLE_NEAR(halfway.Z, expected.Z, 1e-12);
+    EXPECT_DOUBLE_NEAR(halfway.W, expected.W, 1e-12);
+
+    HMM_DVec3 v = HMM_DV3(1.0, -2.0, 0.5);
+    HMM_Vec3 rotated = HMM_DV3ToV3(HMM_RotateDV3DQuat(v, a));
+    HMM_Vec3 expectedRotated = HMM_RotateV3Q(HMM_DV3ToV3(v), qa);
+    EXPECT_NEAR(rotated.X, expectedRotated.X, 1e-5f);
+    EXPECT_NEAR(rotated.Y, expectedRotated.Y, 1e-5f);
+    EXPECT_NEAR(rotated.Z, expectedRotated.Z, 1e-5f);
+}
+
+TEST(Double, Conversion)
+{
+    HMM_Vec3 v3 = HMM_V3(0.1f, -1.0e7f, 3.0e-8f);
+    HMM_Vec4 v4 = HMM_V4(0.1f, -1.0e7f, 3.0e-8f, 42.5f);
+    HMM_Quat q = HMM_Q(0.1f, 0.2f, -0.3f, 0.9f);
+    HMM_Mat4 m = HMMTest_AffineM4(2);
+
+    // Float to double is exact, so the round trips are too
+    HMM_Vec3 v3Back = HMM_DV3ToV3(HMM_V3ToDV3(v3));
+    EXPECT_TRUE(memcmp(&v3Back, &v3, sizeof(v3)) == 0);
+    HMM_Vec4 v4Back = HMM_DV4ToV4(HMM_V4ToDV4(v4));
+    EXPECT_TRUE(memcmp(&v4Back, &v4, sizeof(v4)) == 0);
+    HMM_Quat qBack = HMM_DQuatToQ(HMM_QToDQuat(q));
+    EXPECT_TRUE(memcmp(&qBack, &q, sizeof(q)) == 0);
+    HMM_Mat4 mBack = HMM_DM4ToM4(HMM_M4ToDM4(m));
+    EXPECT_TRUE(memcmp(&mBack, &m, sizeof(m)) == 0);
+
+    HMM_DVec4 dv4 = HMM_V4ToDV4(v4);
+    EXPECT_DOUBLE_NEAR(dv4.X, (double)v4.X, 0.0);
+    EXPECT_DOUBLE_NEAR(dv4.Y, (double)v4.Y, 0.0);
+    EXPECT_DOUBLE_NEAR(dv4.Z, (double)v4.Z, 0.0);
+    EXPECT_DOUBLE_NEAR(dv4.W, (double)v4.W, 0.0);
+
+    // Double to float rounds to nearest
+    HMM_Vec4 rounded = HMM_DV4ToV4(HMM_DV4(0.1, 1.0e8 + 3.0, -1.0 / 3.0, 16777217.0));
+    EXPECT_NEAR(rounded.X, 0.1f, 0.0f);
+    EXPECT_NEAR(rounded.Y, 1.0e8f, 0.0f);
+    EXPECT_NEAR(rounded.Z, -1.0f / 3.0f, 0.0f);
+    EXPECT_NEAR(rounded.W, 16777216.0f, 0.0f);
+}
+
+#if HANDMADE_MATH__USE_C11_GENERICS || defined(__cplusplus)
+TEST(Double, Overloads)
+{
+    HMM_DVec3 a = HMM_DV3(1.0, 2.0, 3.0);
+    HMM_DVec3 b = HMM_DV3(4.0, -5.0, 6.0);
+    HMM_DVec4 c = HMM_DV4(1.0, 2.0, 3.0, 4.0);
+    HMM_DQuat q = HMM_DQuatFromAxisAngle_RH(a, 0.5f);
+    HMM_DQuat r = HMM_DQuatFromAxisAngle_RH(b, 1.5f);
+    HMM_DMat4 m = HMM_M4ToDM4(HMMTest_AffineM4(1));
+
+    EXPECT_DV3_NEAR(HMM_Add(a, b), HMM_AddDV3(a, b), 0.0);
+    EXPECT_DV3_NEAR(HMM_Sub(a, b), HMM_SubDV3(a, b), 0.0);
+    EXPECT_DV3_NEAR(HMM_Mul(a, b), HMM_MulDV3(a, b), 0.0);
+    EXPECT_DV3_NEAR(HMM_Mul(a, 2.0), HMM_MulDV3F(a, 2.0), 0.0);
+    EXPECT_DV3_NEAR(HMM_Div(a, 2.0), HMM_DivDV3F(a, 2.0), 0.0);
+    EXPECT_DV3_NEAR(HMM_Norm(a), HMM_NormDV3(a), 0.0);
+    EXPECT_DV3_NEAR(HMM_Lerp(a, 0.25, b), HMM_LerpDV3(a, 0.25, b), 0.0);
+    EXPECT_DOUBLE_NEAR(HMM_Dot(a, b), HMM_DotDV3(a, b), 0.0);
+    EXPECT_DOUBLE_NEAR(HMM_Len(a), HMM_LenDV3(a), 0.0);
+    EXPECT_DOUBLE_NEAR(HMM_LenSqr(a), HMM_LenSqrDV3(a), 0.0);
+
+    EXPECT_DOUBLE_NEAR(HMM_Add(c, c).W, 8.0, 0.0);
+    EXPECT_DOUBLE_NEAR(HMM_Sub(c, c).W, 0.0, 0.0);
+    EXPECT_DOUBLE_NEAR(HMM_Mul(c, 3.0).W, 12.0, 0.0);
+    EXPECT_DOUBLE_NEAR(HMM_Mul(c, c).W, 16.0, 0.0);
+    EXPECT_DOUBLE_NEAR(HMM_Div(c, 2.0).W, 2.0, 0.0);
+    EXPECT_DOUBLE_NEAR(HMM_Dot(c, c), 30.0, 0.0);
+    EXPECT_DOUBLE_NEAR(HMM_Mul(m, c).X, HMM_MulDM4V4(m, c).X, 0.0);
+
+    EXPECT_M4_EQ(HMM_DM4ToM4(HMM_Mul(m, m)), HMM_DM4ToM4(HMM_MulDM4(m, m)));
+    EXPECT_M4_EQ(HMM_DM4ToM4(HMM_Transpose(m)), HMM_DM4ToM4(HMM_TransposeDM4(m)));
+    EXPECT_M4_EQ(HMM_DM4ToM4(HMM_InvGeneral(m)), HMM_DM4ToM4(HMM_InvGeneralDM4(m)));
+
+    EXPECT_V4_EQ(HMM_DQuatToQ(HMM_Add(q, r)), HMM_DQuatToQ(HMM_AddDQuat(q, r)));
+    EXPECT_V4_EQ(HMM_DQuatToQ(HMM_Sub(q, r)), HMM_DQuatToQ(HMM_SubDQuat(q, r)));
+    EXPECT_V4_EQ(HMM_DQuatToQ(HMM_Mul(q, r)), HMM_DQuatToQ(HMM_MulDQuat(q, r)));
+    EXPECT_V4_EQ(HMM_DQuatToQ(HMM_Mul(q, 2.0)), HMM_DQuatToQ(HMM_MulDQuatF(q, 2.0)));
+    EXPECT_V4_EQ(HMM_DQuatToQ(HMM_Div(q, 2.0)), HMM_DQuatToQ(HMM_DivDQuatF(q, 2.0)));
+    EXPECT_V4_EQ(HMM_DQuatToQ(HMM_Norm(q)), HMM_DQuatToQ(HMM_NormDQuat(q)));
+    EXPECT_DOUBLE_NEAR(HMM_Dot(q, r), HMM_DotDQuat(q, r), 0.0);
+}
+#endif
+
+#ifdef __cplusplus
+TEST(Double, Operators)
+{
+    HMM_DVec3 a = HMM_DV3(1.0, 2.0, 3.0);
+    HMM_DVec3 b = HMM_DV3(4.0, -5.0, 6.0);
+    HMM_DVec4 c = HMM_DV4(1.0, 2.0, 3.0, 4.0);
+    HMM_DQuat q = HMM_DQuatFromAxisAngle_RH(a, 0.5f);
+    HMM_DQuat r = HMM_DQuatFromAxisAngle_RH(b, 1.5f);
+    HMM_DMat4 m = HMM_M4ToDM4(HMMTest_AffineM4(1));
+
+    EXPECT_DV3_NEAR(a + b, HMM_AddDV3(a, b), 0.0);
+    EXPECT_DV3_NEAR(a - b, HMM_SubDV3(a, b), 0.0);
+    EXPECT_DV3_NEAR(a * b, HMM_MulDV3(a, b), 0.0);
+    EXPECT_DV3_NEAR(a * 2.0, HMM_MulDV3F(a, 2.0), 0.0);
+    EXPECT_DV3_NEAR(2.0 * a, HMM_MulDV3F(a, 2.0), 0.0);
+    EXPECT_DV3_NEAR(a / 2.0, HMM_DivDV3F(a, 2.0), 0.0);
+    EXPECT_DV3_NEAR(-a, HMM_DV3(-1.0, -2.0, -3.0), 0.0);
+    EXPECT_DOUBLE_NEAR(a[2], 3.0, 0.0);
+
+    EXPECT_DOUBLE_NEAR((c + c)[3], 8.0, 0.0);
+    EXPECT_DOUBLE_NEAR((c - c)[3], 0.0, 0.0);
+    EXPECT_DOUBLE_NEAR((c * 3.0)[3], 12.0, 0.0);
+    EXPECT_DOUBLE_NEAR((3.0 * c)[3], 12.0, 0.0);
+    EXPECT_DOUBLE_NEAR((c * c)[3], 16.0, 0.0);
+    EXPECT_DOUBLE_NEAR((c / 2.0)[3], 2.0, 0.0);
+    EXPECT_DOUBLE_NEAR((-c)[3], -4.0, 0.0);
+    EXPECT_DOUBLE_NEAR((m * c).Y, HMM_MulDM4V4(m, c).Y, 0.0);
+    EXPECT_M4_EQ(HMM_DM4ToM4(m * m), HMM_DM4ToM4(HMM_MulDM4(m, m)));
+    EXPECT_DOUBLE_NEAR(m[3][0], m.Elements[3][0], 0.0);
+
+    EXPECT_V4_EQ(HMM_DQuatToQ(q + r), HMM_DQuatToQ(HMM_AddDQuat(q, r)));
+    EXPECT_V4_EQ(HMM_DQuatToQ(q - r), HMM_DQuatToQ(HMM_SubDQuat(q, r)));
+    EXPECT_V4_EQ(HMM_DQuatToQ(q * r), HMM_DQuatToQ(HMM_MulDQuat(q, r)));
+    EXPECT_V4_EQ(HMM_DQuatToQ(q * 2.0), HMM_DQuatToQ(HMM_MulDQuatF(q, 2.0)));
+    EXPECT_V4_EQ(HMM_DQuatToQ(2.0 * q), HMM_DQuatToQ(HMM_MulDQuatF(q, 2.0)));
+    EXPECT_V4_EQ(HMM_DQuatToQ(q / 2.0), HMM_DQuatToQ(HMM_DivDQuatF(q, 2.0)));
+}
+#endif
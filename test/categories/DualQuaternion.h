@@ -0,0 +1,237 @@
+#include "../HandmadeTest.h"
+
+#define DQ_TEST_VERTICES 100
+
+#define EXPECT_V3_NEAR(_actual, _expected, _epsilon) \
+    do { \
+        HMM_Vec3 _a = (_actual); \
+        HMM_Vec3 _e = (_expected); \
+        EXPECT_NEAR(_a.X, _e.X, _epsilon); \
+        EXPECT_NEAR(_a.Y, _e.Y, _epsilon); \
+        EXPECT_NEAR(_a.Z, _e.Z, _epsilon); \
+    } while (0)
+
+static HMM_DualQuat DualQuaternionTestDQ(int i)
+{
+    HMM_Quat rotation = HMM_QFromAxisAngle_RH(HMM_V3(1.0f, 0.5f * i, -1.0f), 0.4f * i + 0.2f);
+    return HMM_DQFromQV3(rotation, HMM_V3(1.0f * i, -2.0f, 0.5f * i));
+}
+
+TEST(DualQuaternion, Construction)
+{
+    HMM_Quat rotation = HMM_QFromAxisAngle_RH(HMM_V3(0.0f, 1.0f, 0.0f), HMM_AngleDeg(90.0f));
+    HMM_Vec3 translation = HMM_V3(1.0f, 2.0f, 3.0f);
+    HMM_DualQuat dq = HMM_DQFromQV3(rotation, translation);
+
+    EXPECT_V4_EQ(dq.Real, rotation);
+    EXPECT_V3_NEAR(HMM_DQTranslation(dq), translation, 1e-6f);
+
+    // Rotate first, then translate
+    EXPECT_V3_NEAR(HMM_TransformV3DQ(HMM_V3(1.0f, 0.0f, 0.0f), dq), HMM_V3(1.0f, 2.0f, 2.0f), 1e-6f);
+    EXPECT_V3_NEAR(HMM_RotateV3DQ(HMM_V3(1.0f, 0.0f, 0.0f), dq), HMM_V3(0.0f, 0.0f, -1.0f), 1e-6f);
+
+    HMM_DualQuat raw = HMM_DQ(rotation, dq.Dual);
+    EXPECT_TRUE(memcmp(&raw, &dq, sizeof(dq)) == 0);
+}
+
+TEST(DualQuaternion, Matrix)
+{
+    for (int i = 0; i < 5; ++i)
+    {
+        HMM_DualQuat dq = DualQuaternionTestDQ(i);
+        HMM_Mat4 expected = HMM_MulM4(HMM_Translate(HMM_DQTranslation(dq)), HMM_QToM4(dq.Real));
+
+        HMM_Mat4 m = HMM_DQToM4(dq);
+        EXPECT_M4_NEAR(m, expected, 1e-5f);
+        EXPECT_M4_NEAR(HMM_DQToM4(HMM_MulDQF(dq, 2.5f)), expected, 1e-5f);
+
+        HMM_DualQuat back = HMM_M4ToDQ(m);
+        if (HMM_DotQ(back.Real, dq.Real) < 0.0f)
+        {
+            back = HMM_MulDQF(back, -1.0f);
+        }
+        EXPECT_V4_NEAR(back.Real, dq.Real, 1e-5f);
+        EXPECT_V4_NEAR(back.Dual, dq.Dual, 1e-5f);
+    }
+}
+
+TEST(DualQuaternion, Multiplication)
+{
+    HMM_DualQuat a = DualQuaternionTestDQ(1);
+    HMM_DualQuat b = DualQuaternionTestDQ(3);
+    HMM_Mat4 expected = HMM_MulM4(HMM_DQToM4(a), HMM_DQToM4(b));
+
+    {
+        HMM_DualQuat result = HMM_MulDQ(a, b);
+        EXPECT_M4_NEAR(HMM_DQToM4(result), expected, 1e-5f);
+    }
+#if HANDMADE_MATH__USE_C11_GENERICS || defined(__cplusplus)
+    {
+        HMM_DualQuat result = HMM_Mul(a, b);
+        EXPECT_M4_NEAR(HMM_DQToM4(result), expected, 1e-5f);
+    }
+    {
+        HMM_DualQuat result = HMM_Add(HMM_Mul(a, 0.25f), HMM_Mul(a, 0.75f));
+        EXPECT_V4_NEAR(result.Real, a.Real, 1e-6f);
+        EXPECT_V4_NEAR(result.Dual, a.Dual, 1e-6f);
+    }
+#endif
+#ifdef __cplusplus
+    {
+        HMM_DualQuat result = a * b;
+        EXPECT_M4_NEAR(HMM_DQToM4(result), expected, 1e-5f);
+    }
+    {
+        HMM_DualQuat result = a * 0.25f + 0.75f * a;
+        EXPECT_V4_NEAR(result.Real, a.Real, 1e-6f);
+        EXPECT_V4_NEAR(result.Dual, a.Dual, 1e-6f);
+    }
+#endif
+
+    HMM_DualQuat identity = HMM_MulDQ(a, HMM_InvDQ(a));
+    EXPECT_V4_NEAR(identity.Real, HMM_Q(0.0f, 0.0f, 0.0f, 1.0f), 1e-6f);
+    EXPECT_V4_NEAR(identity.Dual, HMM_Q(0.0f, 0.0f, 0.0f, 0.0f), 1e-6f);
+}
+
+TEST(DualQuaternion, Normalize)
+{
+    HMM_DualQuat dq = DualQuaternionTestDQ(2);
+    HMM_DualQuat scaled = HMM_AddDQ(dq, HMM_MulDQF(dq, 2.0f));
+
+    {
+        HMM_DualQuat result = HMM_NormDQ(scaled);
+        EXPECT_V4_NEAR(result.Real, dq.Real, 1e-6f);
+        EXPECT_V4_NEAR(result.Dual, dq.Dual, 1e-6f);
+    }
+#if HANDMADE_MATH__USE_C11_GENERICS || defined(__cplusplus)
+    {
+        HMM_DualQuat result = HMM_Norm(scaled);
+        EXPECT_V4_NEAR(result.Real, dq.Real, 1e-6f);
+        EXPECT_V4_NEAR(result.Dual, dq.Dual, 1e-6f);
+    }
+#endif
+}
+
+TEST(DualQuaternion, ScLerp)
+{
+    HMM_DualQuat a = DualQuaternionTestDQ(1);
+    HMM_DualQuat b = DualQuaternionTestDQ(2);
+
+    // Endpoints
+    {
+        HMM_DualQuat result = HMM_ScLerp(a, 0.0f, b);
+        EXPECT_V4_NEAR(result.Real, a.Real, 1e-5f);
+        EXPECT_V4_NEAR(result.Dual, a.Dual, 1e-5f);
+
+        result = HMM_ScLerp(a, 1.0f, b);
+        EXPECT_V4_NEAR(result.Real, b.Real, 1e-5f);
+        EXPECT_V4_NEAR(result.Dual, b.Dual, 1e-5f);
+
+        // The shortest path does not depend on the sign of Right
+        result = HMM_ScLerp(a, 1.0f, HMM_MulDQF(b, -1.0f));
+        EXPECT_V4_NEAR(result.Real, b.Real, 1e-5f);
+        EXPECT_V4_NEAR(result.Dual, b.Dual, 1e-5f);
+    }
+
+    // Constant speed: two half steps make a whole one
+    {
+        HMM_DualQuat half = HMM_ScLerp(a, 0.5f, b);
+        HMM_DualQuat step = HMM_MulDQ(HMM_InvDQ(a), half);
+        HMM_DualQuat result = HMM_MulDQ(half, step);
+        EXPECT_V4_NEAR(result.Real, b.Real, 1e-5f);
+        EXPECT_V4_NEAR(result.Dual, b.Dual, 1e-5f);
+        EXPECT_NEAR(HMM_SqrtF(HMM_DotQ(half.Real, half.Real)), 1.0f, 1e-6f);
+        EXPECT_NEAR(HMM_DotQ(half.Real, half.Dual), 0.0f, 1e-6f);
+    }
+
+    // A pure rotation about the origin matches HMM_SLerp
+    {
+        HMM_DualQuat r1 = HMM_DQFromQV3(a.Real, HMM_V3(0.0f, 0.0f, 0.0f));
+        HMM_DualQuat r2 = HMM_DQFromQV3(b.Real, HMM_V3(0.0f, 0.0f, 0.0f));
+        HMM_DualQuat result = HMM_ScLerp(r1, 0.3f, r2);
+        EXPECT_V4_NEAR(result.Real, HMM_SLerp(a.Real, 0.3f, b.Real), 1e-5f);
+        EXPECT_V3_NEAR(HMM_DQTranslation(result), HMM_V3(0.0f, 0.0f, 0.0f), 1e-5f);
+    }
+
+    // A pure translation moves in a straight line
+    {
+        HMM_Quat rotation = a.Real;
+        HMM_DualQuat t1 = HMM_DQFromQV3(rotation, HMM_V3(1.0f, 2.0f, 3.0f));
+        HMM_DualQuat t2 = HMM_DQFromQV3(rotation, HMM_V3(-3.0f, 2.0f, 5.0f));
+        HMM_DualQuat result = HMM_ScLerp(t1, 0.25f, t2);
+        EXPECT_V4_NEAR(result.Real, rotation, 1e-6f);
+        EXPECT_V3_NEAR(HMM_DQTranslation(result), HMM_V3(0.0f, 2.0f, 3.5f), 1e-5f);
+    }
+
+    // A small rotation about an offset axis
+    {
+        HMM_Vec3 pivot = HMM_V3(5.0f, 0.0f, 0.0f);
+        HMM_Quat rotation = HMM_QFromAxisAngle_RH(HMM_V3(0.0f, 0.0f, 1.0f), HMM_AngleDeg(0.2f));
+        HMM_DualQuat start = HMM_DQFromQV3(HMM_Q(0.0f, 0.0f, 0.0f, 1.0f), HMM_V3(0.0f, 0.0f, 0.0f));
+        HMM_DualQuat end = HMM_DQFromQV3(rotation, HMM_SubV3(pivot, HMM_RotateV3Q(pivot, rotation)));
+        HMM_DualQuat result = HMM_ScLerp(start, 0.5f, end);
+        EXPECT_V3_NEAR(HMM_TransformV3DQ(pivot, result), pivot, 1e-5f);
+    }
+}
+
+TEST(DualQuaternion, Blend)
+{
+    HMM_DualQuat dqs[3] = { DualQuaternionTestDQ(1), DualQuaternionTestDQ(1), DualQuaternionTestDQ(4) };
+    dqs[1] = HMM_MulDQF(dqs[1], -1.0f);
+    float weights[3] = { 0.3f, 0.7f, 0.0f };
+
+    // Antipodal copies of the same transform blend to that transform
+    HMM_DualQuat result = HMM_BlendDQ(dqs, weights, 3);
+    EXPECT_V4_NEAR(result.Real, dqs[0].Real, 1e-6f);
+    EXPECT_V4_NEAR(result.Dual, dqs[0].Dual, 1e-6f);
+
+    weights[2] = 0.5f;
+    result = HMM_BlendDQ(dqs, weights, 3);
+    EXPECT_NEAR(HMM_SqrtF(HMM_DotQ(result.Real, result.Real)), 1.0f, 1e-6f);
+    EXPECT_NEAR(HMM_DotQ(result.Real, result.Dual), 0.0f, 1e-6f);
+}
+
+TEST(DualQuaternion, Skinning)
+{
+    static HMM_DualQuat palette[5];
+    static unsigned short bones[4 * DQ_TEST_VERTICES];
+    static HMM_Vec4 weights[DQ_TEST_VERTICES];
+    static HMM_Vec3 positions[DQ_TEST_VERTICES], normals[DQ_TEST_VERTICES];
+    static HMM_Vec3 outPositions[DQ_TEST_VERTICES], outNormals[DQ_TEST_VERTICES];
+
+    for (int i = 0; i < 5; ++i)
+    {
+        // Mix up the signs to exercise the hemisphere alignment
+        palette[i] = HMM_MulDQF(DualQuaternionTestDQ(i), (i % 2) ? -1.0f : 1.0f);
+    }
+    for (int i = 0; i < DQ_TEST_VERTICES; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            bones[4 * i + j] = (unsigned short)((i + 2 * j) % 5);
+        }
+        float unused = (i % 3 == 0) ? 0.0f : 0.1f;
+        weights[i] = HMM_V4(0.5f, 0.3f - 0.1f * (i % 2), 0.2f + 0.1f * (i % 2) - unused, unused);
+        positions[i] = HMM_V3(0.1f * i - 5.0f, 2.0f, 0.05f * i);
+        normals[i] = HMM_NormV3(HMM_V3(1.0f, 0.01f * i, -0.5f));
+    }
+
+    HMM_SkinDQV3Array(palette, bones, weights, positions, normals, outPositions, outNormals, DQ_TEST_VERTICES);
+
+    for (int i = 0; i < DQ_TEST_VERTICES; ++i)
+    {
+        HMM_DualQuat influences[4] = {
+            palette[bones[4 * i + 0]], palette[bones[4 * i + 1]],
+            palette[bones[4 * i + 2]], palette[bones[4 * i + 3]],
+        };
+        HMM_DualQuat skin = HMM_BlendDQ(influences, weights[i].Elements, 4);
+
+        EXPECT_V3_NEAR(outPositions[i], HMM_TransformV3DQ(positions[i], skin), 1e-5f);
+        EXPECT_V3_NEAR(outNormals[i], HMM_RotateV3DQ(normals[i], skin), 1e-6f);
+        EXPECT_NEAR(HMM_LenV3(outNormals[i]), 1.0f, 1e-6f);
+    }
+
+    // Positions only, in place
+    HMM_SkinDQV3Array(palette, bones, weights, positions, 0, positions, 0, DQ_TEST_VERTICES);
+    EXPECT_TRUE(memcmp(positions, outPositions, sizeof(positions)) == 0);
+}
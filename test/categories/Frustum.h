@@ -0,0 +1,167 @@
+#include "../HandmadeTest.h"
+#include "../hmm_random.h"
+
+static HMM_Bool FrustumTestPointInside(HMM_Frustum Frustum, HMM_Vec3 Point)
+{
+    for (int Plane = 0; Plane < 6; ++Plane)
+    {
+        if (HMM_DotV3(Frustum.Planes[Plane].XYZ, Point) + Frustum.Planes[Plane].W < 0.0f)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Returns the number of points where the frustum and a clip-space test disagree, and counts the points inside.
+static int FrustumTestCheckAgainstClip(HMM_Mat4 ViewProjection, HMM_Frustum Frustum, HMM_Bool ZeroToOne, int *Inside)
+{
+    unsigned int State = 1234;
+    int Mismatches = 0;
+    *Inside = 0;
+
+    for (int i = 0; i < 500; ++i)
+    {
+        HMM_Vec3 Point = HMM_V3(HMMTest_Random(&State, -30.0f, 30.0f), HMMTest_Random(&State, -30.0f, 30.0f), HMMTest_Random(&State, -30.0f, 30.0f));
+        HMM_Vec4 Clip = HMM_MulM4V4(ViewProjection, HMM_V4V(Point, 1.0f));
+        float MinZ = ZeroToOne ? 0.0f : -Clip.W;
+
+        // Skip points too close to a plane for the two tests to agree reliably
+        float Margin = 1e-3f * HMM_ABS(Clip.W);
+        if (HMM_ABS(HMM_ABS(Clip.X) - Clip.W) < Margin || HMM_ABS(HMM_ABS(Clip.Y) - Clip.W) < Margin
+            || HMM_ABS(Clip.Z - MinZ) < Margin || HMM_ABS(Clip.Z - Clip.W) < Margin)
+        {
+            continue;
+        }
+
+        HMM_Bool Expected = Clip.W > 0.0f && HMM_ABS(Clip.X) <= Clip.W && HMM_ABS(Clip.Y) <= Clip.W
+            && Clip.Z >= MinZ && Clip.Z <= Clip.W;
+        *Inside += Expected;
+        Mismatches += FrustumTestPointInside(Frustum, Point) != Expected;
+    }
+
+    return Mismatches;
+}
+
+// Also makes sure the points covered both cases
+#define EXPECT_FRUSTUM_MATCHES_CLIP(_viewProjection, _frustum, _zeroToOne) { \
+    int Inside; \
+    EXPECT_TRUE(FrustumTestCheckAgainstClip(_viewProjection, _frustum, _zeroToOne, &Inside) == 0); \
+    EXPECT_GT((float)Inside, 10.0f); \
+    EXPECT_LT((float)Inside, 490.0f); \
+}
+
+TEST(Frustum, Extraction)
+{
+    HMM_Mat4 ViewRH = HMM_LookAt_RH(HMM_V3(1.0f, 2.0f, 3.0f), HMM_V3(0.0f, 0.0f, -5.0f), HMM_V3(0.0f, 1.0f, 0.0f));
+    HMM_Mat4 ViewLH = HMM_LookAt_LH(HMM_V3(1.0f, 2.0f, 3.0f), HMM_V3(0.0f, 0.0f, -5.0f), HMM_V3(0.0f, 1.0f, 0.0f));
+
+    {
+        HMM_Mat4 ViewProjection = HMM_MulM4(HMM_Perspective_RH_NO(HMM_AngleDeg(60.0f), 1.5f, 0.5f, 40.0f), ViewRH);
+        EXPECT_FRUSTUM_MATCHES_CLIP(ViewProjection, HMM_FrustumFromM4_NO(ViewProjection), 0);
+    }
+    {
+        HMM_Mat4 ViewProjection = HMM_MulM4(HMM_Perspective_RH_ZO(HMM_AngleDeg(60.0f), 1.5f, 0.5f, 40.0f), ViewRH);
+        EXPECT_FRUSTUM_MATCHES_CLIP(ViewProjection, HMM_FrustumFromM4_ZO(ViewProjection), 1);
+    }
+    {
+        HMM_Mat4 ViewProjection = HMM_MulM4(HMM_Perspective_LH_NO(HMM_AngleDeg(60.0f), 1.5f, 0.5f, 40.0f), ViewLH);
+        EXPECT_FRUSTUM_MATCHES_CLIP(ViewProjection, HMM_FrustumFromM4_NO(ViewProjection), 0);
+    }
+    {
+        HMM_Mat4 ViewProjection = HMM_MulM4(HMM_Perspective_LH_ZO(HMM_AngleDeg(60.0f), 1.5f, 0.5f, 40.0f), ViewLH);
+        EXPECT_FRUSTUM_MATCHES_CLIP(ViewProjection, HMM_FrustumFromM4_ZO(ViewProjection), 1);
+    }
+    {
+        HMM_Mat4 ViewProjection = HMM_MulM4(HMM_Orthographic_RH_ZO(-20.0f, 20.0f, -15.0f, 15.0f, 1.0f, 40.0f), ViewRH);
+        EXPECT_FRUSTUM_MATCHES_CLIP(ViewProjection, HMM_FrustumFromM4_ZO(ViewProjection), 1);
+    }
+
+    // Planes are normalized, with the near plane at the right distance
+    {
+        HMM_Frustum Frustum = HMM_FrustumFromM4_ZO(HMM_Perspective_RH_ZO(HMM_AngleDeg(90.0f), 1.0f, 2.0f, 50.0f));
+        for (int Plane = 0; Plane < 6; ++Plane)
+        {
+            EXPECT_NEAR(HMM_LenV3(Frustum.Planes[Plane].XYZ), 1.0f, 1e-6f);
+        }
+        EXPECT_NEAR(Frustum.Near.Z, -1.0f, 1e-6f);
+        EXPECT_NEAR(Frustum.Near.W, -2.0f, 1e-5f);
+        EXPECT_NEAR(Frustum.Far.Z, 1.0f, 1e-6f);
+        EXPECT_NEAR(Frustum.Far.W, 50.0f, 1e-3f);
+    }
+}
+
+TEST(Frustum, Sphere)
+{
+    HMM_Frustum Frustum = HMM_FrustumFromM4_NO(HMM_Perspective_RH_NO(HMM_AngleDeg(90.0f), 1.0f, 1.0f, 100.0f));
+
+    EXPECT_TRUE(HMM_FrustumTestSphere(Frustum, HMM_V3(0.0f, 0.0f, -10.0f), 1.0f));
+    EXPECT_FALSE(HMM_FrustumTestSphere(Frustum, HMM_V3(0.0f, 0.0f, 10.0f), 1.0f));
+    EXPECT_FALSE(HMM_FrustumTestSphere(Frustum, HMM_V3(0.0f, 0.0f, -0.25f), 0.5f));
+    EXPECT_TRUE(HMM_FrustumTestSphere(Frustum, HMM_V3(0.0f, 0.0f, -0.25f), 1.0f));
+    EXPECT_FALSE(HMM_FrustumTestSphere(Frustum, HMM_V3(-12.0f, 0.0f, -10.0f), 1.0f));
+    EXPECT_TRUE(HMM_FrustumTestSphere(Frustum, HMM_V3(-12.0f, 0.0f, -10.0f), 2.0f));
+}
+
+TEST(Frustum, AABB)
+{
+    HMM_Frustum Frustum = HMM_FrustumFromM4_NO(HMM_Perspective_RH_NO(HMM_AngleDeg(90.0f), 1.0f, 1.0f, 100.0f));
+
+    EXPECT_TRUE(HMM_FrustumTestAABB(Frustum, HMM_V3(-1.0f, -1.0f, -11.0f), HMM_V3(1.0f, 1.0f, -9.0f)));
+    EXPECT_FALSE(HMM_FrustumTestAABB(Frustum, HMM_V3(-1.0f, -1.0f, 9.0f), HMM_V3(1.0f, 1.0f, 11.0f)));
+    EXPECT_FALSE(HMM_FrustumTestAABB(Frustum, HMM_V3(-14.0f, -1.0f, -11.0f), HMM_V3(-12.0f, 1.0f, -9.0f)));
+    EXPECT_TRUE(HMM_FrustumTestAABB(Frustum, HMM_V3(-14.0f, -1.0f, -11.0f), HMM_V3(-9.0f, 1.0f, -9.0f)));
+    // Straddling the far plane
+    EXPECT_TRUE(HMM_FrustumTestAABB(Frustum, HMM_V3(-1.0f, -1.0f, -150.0f), HMM_V3(1.0f, 1.0f, -50.0f)));
+}
+
+TEST(Frustum, Batch)
+{
+    HMM_Mat4 ViewProjection = HMM_MulM4(HMM_Perspective_RH_ZO(HMM_AngleDeg(70.0f), 1.5f, 0.5f, 40.0f),
+                                        HMM_LookAt_RH(HMM_V3(0.0f, 2.0f, 5.0f), HMM_V3(0.0f, 0.0f, 0.0f), HMM_V3(0.0f, 1.0f, 0.0f)));
+    HMM_Frustum Frustum = HMM_FrustumFromM4_ZO(ViewProjection);
+
+    enum { Count = 37 };
+    unsigned int State = 99;
+    HMM_Vec3 Centers[Count], Mins[Count], Maxs[Count];
+    float Radii[Count];
+    for (int i = 0; i < Count; ++i)
+    {
+        Centers[i] = HMM_V3(HMMTest_Random(&State, -30.0f, 30.0f), HMMTest_Random(&State, -30.0f, 30.0f), HMMTest_Random(&State, -30.0f, 30.0f));
+        Radii[i] = HMMTest_Random(&State, 0.1f, 5.0f);
+        HMM_Vec3 Extent = HMM_V3(HMMTest_Random(&State, 0.1f, 5.0f), HMMTest_Random(&State, 0.1f, 5.0f), HMMTest_Random(&State, 0.1f, 5.0f));
+        Mins[i] = HMM_SubV3(Centers[i], Extent);
+        Maxs[i] = HMM_AddV3(Centers[i], Extent);
+    }
+
+    enum { Blocks = (Count + HMM_SOA_WIDTH - 1) / HMM_SOA_WIDTH };
+    HMM_Vec3SoA CentersSoA[Blocks], MinsSoA[Blocks], MaxsSoA[Blocks];
+    HMM_FloatSoA RadiiSoA[Blocks];
+    HMM_V3ArrayToSoA(Centers, CentersSoA, Count);
+    HMM_V3ArrayToSoA(Mins, MinsSoA, Count);
+    HMM_V3ArrayToSoA(Maxs, MaxsSoA, Count);
+    for (int i = 0; i < Blocks * HMM_SOA_WIDTH; ++i)
+    {
+        RadiiSoA[i / HMM_SOA_WIDTH].Elements[i % HMM_SOA_WIDTH] = i < Count ? Radii[i] : 0.0f;
+    }
+
+    unsigned char SphereVisible[(Count + 7) / 8], BoxVisible[(Count + 7) / 8];
+    HMM_FrustumTestSphereSoA(Frustum, CentersSoA, RadiiSoA, SphereVisible, Count);
+    HMM_FrustumTestAABBSoA(Frustum, MinsSoA, MaxsSoA, BoxVisible, Count);
+
+    int Visible = 0;
+    for (int i = 0; i < Count; ++i)
+    {
+        HMM_Bool Sphere = (SphereVisible[i / 8] >> (i % 8)) & 1;
+        HMM_Bool Box = (BoxVisible[i / 8] >> (i % 8)) & 1;
+        EXPECT_TRUE(Sphere == HMM_FrustumTestSphere(Frustum, Centers[i], Radii[i]));
+        EXPECT_TRUE(Box == HMM_FrustumTestAABB(Frustum, Mins[i], Maxs[i]));
+        Visible += Sphere;
+    }
+    EXPECT_GT((float)Visible, 0.0f);
+    EXPECT_LT((float)Visible, (float)Count);
+
+    // Bits past Count are cleared
+    EXPECT_TRUE((SphereVisible[Count / 8] >> (Count % 8)) == 0);
+    EXPECT_TRUE((BoxVisible[Count / 8] >> (Count % 8)) == 0);
+}
@@ -0,0 +1,116 @@
+#include "../HandmadeTest.h"
+
+/*
+ * 0        5
+ * |- 1     '- 6
+ * |  |- 2
+ * |  '- 3
+ * '- 4
+ */
+static const int HierarchyTestParents[7] = { -1, 0, 1, 1, 0, -1, 5 };
+
+TEST(Hierarchy, SubtreeEnd)
+{
+    EXPECT_TRUE(HMM_HierarchySubtreeEnd(HierarchyTestParents, 0, 7) == 5);
+    EXPECT_TRUE(HMM_HierarchySubtreeEnd(HierarchyTestParents, 1, 7) == 4);
+    EXPECT_TRUE(HMM_HierarchySubtreeEnd(HierarchyTestParents, 2, 7) == 3);
+    EXPECT_TRUE(HMM_HierarchySubtreeEnd(HierarchyTestParents, 4, 7) == 5);
+    EXPECT_TRUE(HMM_HierarchySubtreeEnd(HierarchyTestParents, 5, 7) == 7);
+    EXPECT_TRUE(HMM_HierarchySubtreeEnd(HierarchyTestParents, 6, 7) == 7);
+}
+
+TEST(Hierarchy, UpdateM4)
+{
+    HMM_Mat4 local[7], world[7], expected[7];
+    for (int i = 0; i < 7; ++i)
+    {
+        local[i] = HMMTest_AffineM4(i);
+    }
+    expected[0] = local[0];
+    expected[1] = HMM_MulM4(local[0], local[1]);
+    expected[2] = HMM_MulM4(expected[1], local[2]);
+    expected[3] = HMM_MulM4(expected[1], local[3]);
+    expected[4] = HMM_MulM4(local[0], local[4]);
+    expected[5] = local[5];
+    expected[6] = HMM_MulM4(local[5], local[6]);
+
+    HMM_UpdateHierarchyM4(HierarchyTestParents, local, NULL, world, 0, 7);
+    for (int i = 0; i < 7; ++i)
+    {
+        EXPECT_M4_NEAR(world[i], expected[i], 1e-5f);
+    }
+
+    // Independent subtrees, updated separately
+    {
+        HMM_Mat4 split[7];
+        HMM_UpdateHierarchyM4(HierarchyTestParents, local, NULL, split, 5, 2);
+        HMM_UpdateHierarchyM4(HierarchyTestParents, local, NULL, split, 0, 5);
+        EXPECT_TRUE(memcmp(split, world, sizeof(world)) == 0);
+    }
+
+    // Only node 1 changed, so only its subtree is recomputed
+    {
+        unsigned char dirty[7] = { 0, 1, 0, 0, 0, 0, 0 };
+        local[1] = HMM_M4D(1.0f);
+        world[4] = HMM_M4D(0.0f);
+        HMM_UpdateHierarchyM4(HierarchyTestParents, local, dirty, world, 0, 7);
+
+        EXPECT_M4_NEAR(world[1], local[0], 1e-5f);
+        EXPECT_M4_NEAR(world[2], HMM_MulM4(local[0], local[2]), 1e-5f);
+        EXPECT_M4_NEAR(world[3], HMM_MulM4(local[0], local[3]), 1e-5f);
+        EXPECT_M4_EQ(world[4], HMM_M4D(0.0f));
+        EXPECT_M4_EQ(world[6], expected[6]);
+
+        const unsigned char expectedDirty[7] = { 0, 1, 1, 1, 0, 0, 0 };
+        EXPECT_TRUE(memcmp(dirty, expectedDirty, sizeof(dirty)) == 0);
+    }
+
+    // A dirty node inside the subtree of a clean one is still found
+    {
+        unsigned char dirty[7] = { 0, 0, 0, 1, 0, 0, 1 };
+        HMM_Mat4 before2 = world[2];
+        local[3] = HMM_M4D(2.0f);
+        local[6] = HMM_M4D(1.0f);
+        world[1] = HMM_M4D(0.0f);
+        HMM_UpdateHierarchyM4(HierarchyTestParents, local, dirty, world, 0, 7);
+
+        EXPECT_M4_EQ(world[1], HMM_M4D(0.0f));
+        EXPECT_M4_EQ(world[2], before2);
+        EXPECT_M4_EQ(world[3], HMM_MulM4(HMM_M4D(0.0f), local[3]));
+        EXPECT_M4_NEAR(world[6], local[5], 1e-6f);
+
+        const unsigned char expectedDirty[7] = { 0, 0, 0, 1, 0, 0, 1 };
+        EXPECT_TRUE(memcmp(dirty, expectedDirty, sizeof(dirty)) == 0);
+    }
+}
+
+TEST(Hierarchy, UpdateA34)
+{
+    HMM_Affine3x4 local[7], world[7];
+    HMM_Mat4 localM4[7], worldM4[7];
+    for (int i = 0; i < 7; ++i)
+    {
+        localM4[i] = HMMTest_AffineM4(i);
+        local[i] = HMM_M4ToA34(localM4[i]);
+    }
+    HMM_UpdateHierarchyM4(HierarchyTestParents, localM4, NULL, worldM4, 0, 7);
+
+    HMM_UpdateHierarchyA34(HierarchyTestParents, local, NULL, world, 0, 7);
+    for (int i = 0; i < 7; ++i)
+    {
+        EXPECT_M4_NEAR(HMM_A34ToM4(world[i]), worldM4[i], 1e-5f);
+    }
+
+    {
+        unsigned char dirty[7] = { 0, 0, 0, 0, 0, 1, 0 };
+        local[5] = HMM_A34D(1.0f);
+        HMM_UpdateHierarchyA34(HierarchyTestParents, local, dirty, world, 0, 7);
+
+        EXPECT_M4_EQ(HMM_A34ToM4(world[5]), HMM_M4D(1.0f));
+        EXPECT_M4_NEAR(HMM_A34ToM4(world[6]), localM4[6], 1e-6f);
+        EXPECT_M4_NEAR(HMM_A34ToM4(world[3]), worldM4[3], 1e-5f);
+
+        const unsigned char expectedDirty[7] = { 0, 0, 0, 0, 0, 1, 1 };
+        EXPECT_TRUE(memcmp(dirty, expectedDirty, sizeof(dirty)) == 0);
+    }
+}
@@ -357,3 +357,88 @@ TEST(InvMatrix, InvTranslate)
     HMM_Mat4 Result = HMM_MulM4(Matrix, Inverse);
     EXPECT_M4_EQ(Result, Expect);
 }
+
+static HMM_Mat3 MatrixOpsTestM3(int i)
+{
+    HMM_Mat3 Result;
+    for (int Column = 0; Column < 3; ++Column)
+    {
+        for (int Row = 0; Row < 3; ++Row)
+        {
+            Result.Elements[Column][Row] = 0.25f * (float)((i * 7 + Column * 3 + Row * 5) % 11) - 1.0f + (Column == Row ? 2.0f : 0.0f);
+        }
+    }
+    return Result;
+}
+
+TEST(MatrixOps, Mat3MatchesScalar)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        HMM_Mat3 a = MatrixOpsTestM3(i);
+        HMM_Mat3 b = MatrixOpsTestM3(i + 3);
+        HMM_Vec3 v = HMM_V3(0.5f * i - 1.0f, 2.0f, -0.25f * i);
+
+        // Plain scalar references, computed in the same order as the scalar paths
+        HMM_Vec3 expectedV;
+        HMM_Mat3 expectedMul, expectedTranspose;
+        for (int Row = 0; Row < 3; ++Row)
+        {
+            expectedV.Elements[Row] = v.Elements[0] * a.Elements[0][Row] + v.Elements[1] * a.Elements[1][Row] + v.Elements[2] * a.Elements[2][Row];
+            for (int Column = 0; Column < 3; ++Column)
+            {
+                expectedMul.Elements[Column][Row] = b.Elements[Column][0] * a.Elements[0][Row] + b.Elements[Column][1] * a.Elements[1][Row] + b.Elements[Column][2] * a.Elements[2][Row];
+                expectedTranspose.Elements[Column][Row] = a.Elements[Row][Column];
+            }
+        }
+
+        HMM_Vec3 resultV = HMM_MulM3V3(a, v);
+        HMM_Mat3 resultMul = HMM_MulM3(a, b);
+        HMM_Mat3 resultTranspose = HMM_TransposeM3(a);
+        for (int Row = 0; Row < 3; ++Row)
+        {
+            EXPECT_NEAR(resultV.Elements[Row], expectedV.Elements[Row], 1e-6f);
+            for (int Column = 0; Column < 3; ++Column)
+            {
+                EXPECT_NEAR(resultMul.Elements[Column][Row], expectedMul.Elements[Column][Row], 1e-6f);
+                EXPECT_FLOAT_EQ(resultTranspose.Elements[Column][Row], expectedTranspose.Elements[Column][Row]);
+            }
+        }
+
+        float det = a.Elements[0][0] * (a.Elements[1][1] * a.Elements[2][2] - a.Elements[2][1] * a.Elements[1][2])
+                  - a.Elements[1][0] * (a.Elements[0][1] * a.Elements[2][2] - a.Elements[2][1] * a.Elements[0][2])
+                  + a.Elements[2][0] * (a.Elements[0][1] * a.Elements[1][2] - a.Elements[1][1] * a.Elements[0][2]);
+        EXPECT_NEAR(HMM_DeterminantM3(a), det, 1e-5f);
+
+        HMM_Mat3 identity = HMM_MulM3(a, HMM_InvGeneralM3(a));
+        for (int Column = 0; Column < 3; ++Column)
+        {
+            for (int Row = 0; Row < 3; ++Row)
+            {
+                EXPECT_NEAR(identity.Elements[Column][Row], Column == Row ? 1.0f : 0.0f, 1e-5f);
+            }
+        }
+    }
+}
+
+TEST(MatrixOps, Mat3MulArray)
+{
+    HMM_Mat3 m = MatrixOpsTestM3(2);
+    HMM_Vec3 vectors[7], outs[7];
+    for (int i = 0; i < 7; ++i)
+    {
+        vectors[i] = HMM_V3(1.0f * i, -0.5f * i, 2.0f);
+    }
+    HMM_MulM3V3Array(m, vectors, outs, 7);
+    for (int i = 0; i < 7; ++i)
+    {
+        HMM_Vec3 expected = HMM_MulM3V3(m, vectors[i]);
+        EXPECT_FLOAT_EQ(outs[i].X, expected.X);
+        EXPECT_FLOAT_EQ(outs[i].Y, expected.Y);
+        EXPECT_FLOAT_EQ(outs[i].Z, expected.Z);
+    }
+
+    // In place
+    HMM_MulM3V3Array(m, vectors, vectors, 7);
+    EXPECT_TRUE(memcmp(vectors, outs, sizeof(outs)) == 0);
+}
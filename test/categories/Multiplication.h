@@ -786,6 +786,60 @@ TEST(Multiplication, Mat4Vec4)
 #endif
 }
 
+TEST(Multiplication, Mat4Vec4Array)
+{
+    HMM_Mat4 m4 = HMM_M4();
+    for (int Column = 0; Column < 4; ++Column)
+    {
+        for (int Row = 0; Row < 4; ++Row)
+        {
+            m4.Elements[Column][Row] = 0.25f * (float)(Column * 4 + Row) - 1.3f;
+        }
+    }
+
+    HMM_Vec4 vectors[11];
+    for (int i = 0; i < 11; ++i)
+    {
+        vectors[i] = HMM_V4(0.1f * i, 1.0f - 0.3f * i, 2.5f + i, (i % 2) ? 1.0f : 0.0f);
+    }
+
+    // Packed arrays must match HMM_MulM4V4 bit for bit, including the remainder. (Runtime-dispatched
+    // AVX2 and AVX-512 kernels use FMA, so pin the baseline tier; see the Dispatch tests for those.)
+    HMM_SIMDTier tier = HMM_GetSIMDTier();
+    HMM_SetSIMDTier(HMM_SIMD_TIER_SSE);
+    {
+        HMM_Vec4 result[11];
+        HMM_MulM4V4Array(m4, vectors, 0, result, 0, 11);
+        for (int i = 0; i < 11; ++i)
+        {
+            HMM_Vec4 expected = HMM_MulM4V4(m4, vectors[i]);
+            EXPECT_TRUE(memcmp(&result[i], &expected, sizeof(HMM_Vec4)) == 0);
+        }
+    }
+
+    // Strided, unaligned vectors
+    {
+        struct { float Pad; float Position[4]; } vertices[7];
+        for (int i = 0; i < 7; ++i)
+        {
+            vertices[i].Pad = -1.0f;
+            vertices[i].Position[0] = vectors[i].X;
+            vertices[i].Position[1] = vectors[i].Y;
+            vertices[i].Position[2] = vectors[i].Z;
+            vertices[i].Position[3] = vectors[i].W;
+        }
+
+        HMM_MulM4V4Array(m4, (HMM_Vec4 *)vertices[0].Position, sizeof(vertices[0]), (HMM_Vec4 *)vertices[0].Position, sizeof(vertices[0]), 7);
+        for (int i = 0; i < 7; ++i)
+        {
+            HMM_Vec4 expected = HMM_MulM4V4(m4, vectors[i]);
+            EXPECT_TRUE(memcmp(vertices[i].Position, expected.Elements, sizeof(HMM_Vec4)) == 0);
+            EXPECT_FLOAT_EQ(vertices[i].Pad, -1.0f);
+        }
+    }
+    HMM_SetSIMDTier(tier);
+}
+
 TEST(Multiplication, QuaternionQuaternion)
 {
     HMM_Quat q1 = HMM_Q(1.0f, 2.0f, 3.0f, 4.0f);
@@ -822,6 +876,46 @@ TEST(Multiplication, QuaternionQuaternion)
 #endif
 }
 
+TEST(Multiplication, QuaternionQuaternionArray)
+{
+    HMM_Quat left[7];
+    HMM_Quat right[7];
+    for (int i = 0; i < 7; ++i)
+    {
+        left[i] = HMM_Q(1.0f + i, 2.0f - 0.5f * i, 3.0f, 0.25f * i - 4.0f);
+        right[i] = HMM_Q(-0.75f * i, 6.0f, 7.0f - i, 8.0f + 0.125f * i);
+    }
+
+    // Must match HMM_MulQ bit for bit, including the remainder.
+    HMM_SIMDTier tier = HMM_GetSIMDTier();
+    HMM_SetSIMDTier(HMM_SIMD_TIER_SSE);
+    {
+        HMM_Quat result[7];
+        HMM_MulQArray(left, right, result, 7);
+        for (int i = 0; i < 7; ++i)
+        {
+            HMM_Quat expected = HMM_MulQ(left[i], right[i]);
+            EXPECT_TRUE(memcmp(&result[i], &expected, sizeof(HMM_Quat)) == 0);
+        }
+    }
+
+    // In place
+    {
+        HMM_Quat result[7];
+        for (int i = 0; i < 7; ++i)
+        {
+            result[i] = left[i];
+        }
+        HMM_MulQArray(result, right, result, 7);
+        for (int i = 0; i < 7; ++i)
+        {
+            HMM_Quat expected = HMM_MulQ(left[i], right[i]);
+            EXPECT_TRUE(memcmp(&result[i], &expected, sizeof(HMM_Quat)) == 0);
+        }
+    }
+    HMM_SetSIMDTier(tier);
+}
+
 TEST(Multiplication, QuaternionScalar)
 {
     HMM_Quat q = HMM_Q(1.0f, 2.0f, 3.0f, 4.0f);
@@ -49,20 +49,27 @@ TEST(Projection, Orthographic)
 
 TEST(Projection, Perspective)
 {
+#ifdef HANDMADE_MATH_FAST_TRIG
+    // The fast approximations can be off by an ulp even for angles like 45 degrees.
+    const float perspectiveError = 0.000001f;
+#else
+    const float perspectiveError = FLT_EPSILON;
+#endif
+
     // Right-handed
     {
         // Z from -1 to 1 (GL convention)
         {
             HMM_Mat4 projection = HMM_Perspective_RH_NO(HMM_AngleDeg(90.0f), 2.0f, 1.0f, 15.0f);
             HMM_Vec4 original = HMM_V4(5.0f, 5.0f, -1.0f, 1.0f);
-            EXPECT_V4_EQ(HMM_MulM4V4(projection, original), HMM_V4(2.5f, 5.0f, -1.0f, 1.0f));
+            EXPECT_V4_NEAR(HMM_MulM4V4(projection, original), HMM_V4(2.5f, 5.0f, -1.0f, 1.0f), perspectiveError);
         }
 
         // Z from 0 to 1 (DX convention)
         {
             HMM_Mat4 projection = HMM_Perspective_RH_ZO(HMM_AngleDeg(90.0f), 2.0f, 1.0f, 15.0f);
             HMM_Vec4 original = HMM_V4(5.0f, 5.0f, -1.0f, 1.0f);
-            EXPECT_V4_EQ(HMM_MulM4V4(projection, original), HMM_V4(2.5f, 5.0f, 0.0f, 1.0f));
+            EXPECT_V4_NEAR(HMM_MulM4V4(projection, original), HMM_V4(2.5f, 5.0f, 0.0f, 1.0f), perspectiveError);
         }
     }
 
@@ -72,14 +79,14 @@ TEST(Projection, Perspective)
         {
             HMM_Mat4 projection = HMM_Perspective_LH_NO(HMM_AngleDeg(90.0f), 2.0f, 1.0f, 15.0f);
             HMM_Vec4 original = HMM_V4(5.0f, 5.0f, 1.0f, 1.0f);
-            EXPECT_V4_EQ(HMM_MulM4V4(projection, original), HMM_V4(2.5f, 5.0f, -1.0f, 1.0f));
+            EXPECT_V4_NEAR(HMM_MulM4V4(projection, original), HMM_V4(2.5f, 5.0f, -1.0f, 1.0f), perspectiveError);
         }
 
         // Z from 0 to 1 (DX convention)
         {
             HMM_Mat4 projection = HMM_Perspective_LH_ZO(HMM_AngleDeg(90.0f), 2.0f, 1.0f, 15.0f);
             HMM_Vec4 original = HMM_V4(5.0f, 5.0f, 1.0f, 1.0f);
-            EXPECT_V4_EQ(HMM_MulM4V4(projection, original), HMM_V4(2.5f, 5.0f, 0.0f, 1.0f));
+            EXPECT_V4_NEAR(HMM_MulM4V4(projection, original), HMM_V4(2.5f, 5.0f, 0.0f, 1.0f), perspectiveError);
         }
     }
 }
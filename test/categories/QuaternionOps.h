@@ -50,6 +50,41 @@ TEST(QuaternionOps, Normalize)
         EXPECT_NEAR(result.W, 0.7302967433f, 0.001f);
     }
 #endif
+    {
+        HMM_Quat result = HMM_NormFastQ(q);
+        EXPECT_NEAR(result.X, 0.1825741858f, 3e-7f);
+        EXPECT_NEAR(result.Y, 0.3651483717f, 3e-7f);
+        EXPECT_NEAR(result.Z, 0.5477225575f, 3e-7f);
+        EXPECT_NEAR(result.W, 0.7302967433f, 3e-7f);
+    }
+}
+
+TEST(QuaternionOps, NormalizeArray)
+{
+    HMM_Quat quats[7];
+    for (int i = 0; i < 7; ++i)
+    {
+        quats[i] = HMM_Q(1.0f + i, 2.0f - 0.5f * i, 3.0f, 0.25f * i - 4.0f);
+    }
+
+    HMM_SIMDTier tier = HMM_GetSIMDTier();
+    HMM_SetSIMDTier(HMM_SIMD_TIER_SSE);
+    HMM_Quat result[7];
+    HMM_NormQArray(quats, result, 7);
+    for (int i = 0; i < 7; ++i)
+    {
+        HMM_Quat expected = HMM_NormQ(quats[i]);
+#if defined(HANDMADE_MATH__USE_AVX512) && defined(HANDMADE_MATH_FAST_RSQRT)
+        // The AVX-512 estimate is more accurate than the SSE one
+        EXPECT_V4_NEAR(result[i], expected, 3e-7f);
+#else
+        EXPECT_TRUE(memcmp(&result[i], &expected, sizeof(HMM_Quat)) == 0);
+#endif
+    }
+
+    HMM_NormQArray(quats, quats, 7);
+    EXPECT_TRUE(memcmp(quats, result, sizeof(quats)) == 0);
+    HMM_SetSIMDTier(tier);
 }
 
 TEST(QuaternionOps, NLerp)
@@ -106,6 +141,51 @@ TEST(QuaternionOps, SLerp)
     }
 }
 
+TEST(QuaternionOps, LerpArray)
+{
+    // Includes pairs on opposite hemispheres and nearly equal pairs, which take the linear path in HMM_SLerp
+    HMM_Quat left[19], right[19], result[19];
+    float times[19];
+    for (int i = 0; i < 19; ++i)
+    {
+        left[i] = HMM_NormQ(HMM_Q(1.0f + i, 2.0f - 0.5f * i, 3.0f, 0.25f * i - 4.0f));
+        right[i] = HMM_NormQ(HMM_Q(0.5f * i - 3.0f, 1.0f, 2.0f + i, 1.5f));
+        times[i] = i / 18.0f;
+    }
+    right[3] = HMM_NormQ(HMM_Q(-left[3].X, -left[3].Y, -left[3].Z, -left[3].W + 0.01f));
+    right[9] = HMM_NormQ(HMM_Q(left[9].X, left[9].Y, left[9].Z + 0.01f, left[9].W));
+
+    HMM_NLerpArray(left, times, right, result, 19);
+    for (int i = 0; i < 19; ++i)
+    {
+        HMM_Quat expected = HMM_NLerp(left[i], times[i], right[i]);
+        EXPECT_TRUE(memcmp(&result[i], &expected, sizeof(HMM_Quat)) == 0);
+    }
+
+    HMM_NLerpArrayF(left, 0.3f, right, result, 19);
+    for (int i = 0; i < 19; ++i)
+    {
+        HMM_Quat expected = HMM_NLerp(left[i], 0.3f, right[i]);
+        EXPECT_TRUE(memcmp(&result[i], &expected, sizeof(HMM_Quat)) == 0);
+    }
+
+    HMM_SLerpArray(left, times, right, result, 19);
+    for (int i = 0; i < 19; ++i)
+    {
+        EXPECT_V4_NEAR(result[i], HMM_SLerp(left[i], times[i], right[i]), 1e-6f);
+    }
+
+    HMM_SLerpArrayF(left, 0.3f, right, result, 19);
+    for (int i = 0; i < 19; ++i)
+    {
+        EXPECT_V4_NEAR(result[i], HMM_SLerp(left[i], 0.3f, right[i]), 1e-6f);
+    }
+
+    // In place
+    HMM_SLerpArrayF(left, 0.3f, right, left, 19);
+    EXPECT_TRUE(memcmp(left, result, sizeof(left)) == 0);
+}
+
 TEST(QuaternionOps, QuatToMat4)
 {
     const float abs_error = 0.001f;
@@ -135,6 +215,28 @@ TEST(QuaternionOps, QuatToMat4)
     EXPECT_NEAR(result.Elements[3][3], 1.0f, abs_error);
 }
 
+TEST(QuaternionOps, UnitQuatToMat4)
+{
+    HMM_Quat quats[7];
+    HMM_Mat4 outs[7];
+    for (int i = 0; i < 7; ++i)
+    {
+        quats[i] = HMM_QFromAxisAngle_RH(HMM_NormV3(HMM_V3(1.0f, -0.5f * i, 0.25f * i - 1.0f)), 0.9f * i - 2.5f);
+    }
+
+    for (int i = 0; i < 7; ++i)
+    {
+        EXPECT_M4_NEAR(HMM_QToM4Unit(quats[i]), HMM_QToM4(quats[i]), 1e-6f);
+    }
+
+    HMM_QToM4UnitArray(quats, outs, 7);
+    for (int i = 0; i < 7; ++i)
+    {
+        HMM_Mat4 expected = HMM_QToM4Unit(quats[i]);
+        EXPECT_TRUE(memcmp(&outs[i], &expected, sizeof(expected)) == 0);
+    }
+}
+
 TEST(QuaternionOps, Mat4ToQuat)
 {
     const float abs_error = 0.0001f;
@@ -0,0 +1,176 @@
+#include "../HandmadeTest.h"
+#include "../hmm_random.h"
+
+static HMM_Vec3 RayTestRandomV3(unsigned int *State, float Min, float Max)
+{
+    return HMM_V3(HMMTest_Random(State, Min, Max), HMMTest_Random(State, Min, Max), HMMTest_Random(State, Min, Max));
+}
+
+TEST(Ray, Triangle)
+{
+    HMM_Vec3 v0 = HMM_V3(0.0f, 0.0f, 0.0f);
+    HMM_Vec3 v1 = HMM_V3(2.0f, 0.0f, 0.0f);
+    HMM_Vec3 v2 = HMM_V3(0.0f, 2.0f, 0.0f);
+    HMM_Ray ray = { HMM_V3(0.5f, 0.25f, 3.0f), HMM_V3(0.0f, 0.0f, -2.0f) };
+    float t, u, v;
+
+    EXPECT_TRUE(HMM_RayTriangle(ray, 10.0f, v0, v1, v2, &t, &u, &v));
+    EXPECT_FLOAT_EQ(t, 1.5f);
+    EXPECT_FLOAT_EQ(u, 0.25f);
+    EXPECT_FLOAT_EQ(v, 0.125f);
+
+    // Both sides count
+    ray.Origin.Z = -3.0f;
+    ray.Direction.Z = 2.0f;
+    EXPECT_TRUE(HMM_RayTriangle(ray, 10.0f, v0, v1, v2, &t, &u, &v));
+    EXPECT_FLOAT_EQ(t, 1.5f);
+
+    // Too short, pointing away, outside, parallel
+    EXPECT_FALSE(HMM_RayTriangle(ray, 1.0f, v0, v1, v2, &t, &u, &v));
+    ray.Direction.Z = -2.0f;
+    EXPECT_FALSE(HMM_RayTriangle(ray, 10.0f, v0, v1, v2, &t, &u, &v));
+    ray.Origin = HMM_V3(1.5f, 1.5f, 3.0f);
+    EXPECT_FALSE(HMM_RayTriangle(ray, 10.0f, v0, v1, v2, &t, &u, &v));
+    ray.Origin = HMM_V3(0.5f, 0.25f, 3.0f);
+    ray.Direction = HMM_V3(1.0f, 0.0f, 0.0f);
+    EXPECT_FALSE(HMM_RayTriangle(ray, 10.0f, v0, v1, v2, &t, &u, &v));
+}
+
+TEST(Ray, AABB)
+{
+    HMM_AABB box = { { HMM_V3(-1.0f, -1.0f, -1.0f), HMM_V3(1.0f, 2.0f, 1.0f) } };
+    HMM_Ray ray = { HMM_V3(-5.0f, 0.0f, 0.0f), HMM_V3(2.0f, 0.0f, 0.0f) };
+    float t;
+
+    // Axis-aligned directions divide by zero, which the slab test handles
+    EXPECT_TRUE(HMM_RayAABB(ray, 10.0f, box, &t));
+    EXPECT_FLOAT_EQ(t, 2.0f);
+    EXPECT_FALSE(HMM_RayAABB(ray, 1.5f, box, &t));
+
+    // Starting inside
+    ray.Origin = HMM_V3(0.0f, 1.0f, 0.0f);
+    EXPECT_TRUE(HMM_RayAABB(ray, 10.0f, box, &t));
+    EXPECT_FLOAT_EQ(t, 0.0f);
+
+    // Behind, and past a corner
+    ray.Origin = HMM_V3(5.0f, 0.0f, 0.0f);
+    EXPECT_FALSE(HMM_RayAABB(ray, 10.0f, box, &t));
+    ray.Origin = HMM_V3(-3.0f, 0.0f, 0.0f);
+    ray.Direction = HMM_V3(1.0f, 1.0f, 0.0f);
+    EXPECT_TRUE(HMM_RayAABB(ray, 10.0f, box, &t));
+    EXPECT_FLOAT_EQ(t, 2.0f);
+    ray.Direction = HMM_V3(1.0f, 1.5f, 0.0f);
+    EXPECT_FALSE(HMM_RayAABB(ray, 10.0f, box, &t));
+}
+
+TEST(Ray, TrianglePacket)
+{
+    enum { Count = 21 };
+    unsigned int State = 5;
+    HMM_Vec3 vertices[3 * Count];
+    for (int i = 0; i < Count; ++i)
+    {
+        HMM_Vec3 center = RayTestRandomV3(&State, -2.0f, 2.0f);
+        for (int Vertex = 0; Vertex < 3; ++Vertex)
+        {
+            vertices[3 * i + Vertex] = HMM_AddV3(center, RayTestRandomV3(&State, -2.0f, 2.0f));
+        }
+    }
+
+    HMM_TriangleSoA triangles[(Count + HMM_SOA_WIDTH - 1) / HMM_SOA_WIDTH];
+    HMM_TrianglesToSoA(vertices, triangles, Count);
+
+    int hits = 0;
+    for (int r = 0; r < 16; ++r)
+    {
+        HMM_Ray ray;
+        ray.Origin = RayTestRandomV3(&State, -6.0f, 6.0f);
+        ray.Direction = HMM_SubV3(RayTestRandomV3(&State, -1.0f, 1.0f), ray.Origin);
+        for (int Block = 0; Block * HMM_SOA_WIDTH < Count; ++Block)
+        {
+            HMM_FloatSoA t, u, v;
+            int mask = HMM_RayTriangleSoA(ray, 2.0f, &triangles[Block], &t, &u, &v);
+            for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+            {
+                int i = Block * HMM_SOA_WIDTH + Lane;
+                float expectedT = 0.0f, expectedU = 0.0f, expectedV = 0.0f;
+                HMM_Bool expected = i < Count && HMM_RayTriangle(ray, 2.0f, vertices[3 * i], vertices[3 * i + 1], vertices[3 * i + 2],
+                                                                 &expectedT, &expectedU, &expectedV);
+                EXPECT_TRUE(((mask >> Lane) & 1) == expected);
+                if (expected)
+                {
+                    EXPECT_FLOAT_EQ(t.Elements[Lane], expectedT);
+                    EXPECT_FLOAT_EQ(u.Elements[Lane], expectedU);
+                    EXPECT_FLOAT_EQ(v.Elements[Lane], expectedV);
+                    ++hits;
+                }
+            }
+        }
+    }
+    EXPECT_GT((float)hits, 5.0f);
+}
+
+TEST(Ray, AABBPacket)
+{
+    enum { Count = 21 };
+    unsigned int State = 9;
+    HMM_Ray rays[Count];
+    for (int i = 0; i < Count; ++i)
+    {
+        rays[i].Origin = RayTestRandomV3(&State, -6.0f, 6.0f);
+        rays[i].Direction = HMM_SubV3(RayTestRandomV3(&State, -2.0f, 2.0f), rays[i].Origin);
+    }
+
+    HMM_RaySoA packets[(Count + HMM_SOA_WIDTH - 1) / HMM_SOA_WIDTH];
+    HMM_RaysToSoA(rays, 0.9f, packets, Count);
+
+    HMM_AABB box = { { HMM_V3(-1.0f, -0.5f, -1.5f), HMM_V3(1.0f, 1.0f, 0.5f) } };
+    int hits = 0;
+    for (int Block = 0; Block * HMM_SOA_WIDTH < Count; ++Block)
+    {
+        HMM_FloatSoA t;
+        int mask = HMM_RayAABBSoA(&packets[Block], box, &t);
+        EXPECT_TRUE(mask == HMM_RayAABBSoA(&packets[Block], box, NULL));
+        for (int Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+        {
+            int i = Block * HMM_SOA_WIDTH + Lane;
+            float expectedT = 0.0f;
+            HMM_Bool expected = i < Count && HMM_RayAABB(rays[i], 0.9f, box, &expectedT);
+            EXPECT_TRUE(((mask >> Lane) & 1) == expected);
+            if (expected)
+            {
+                EXPECT_FLOAT_EQ(t.Elements[Lane], expectedT);
+                ++hits;
+            }
+        }
+    }
+    EXPECT_GT((float)hits, 2.0f);
+    EXPECT_LT((float)hits, (float)Count);
+
+    {
+        // Grazing rays whose origins lie on a face, with a zero direction component across it
+        HMM_AABB unit = { { HMM_V3(0.0f, 0.0f, 0.0f), HMM_V3(1.0f, 1.0f, 1.0f) } };
+        HMM_Ray grazing[3] = {
+            { HMM_V3(-1.0f, 0.0f, 0.5f), HMM_V3(1.0f, 0.0f, 0.0f) },
+            { HMM_V3(0.5f, 1.0f, -2.0f), HMM_V3(0.0f, 0.0f, 1.0f) },
+            { HMM_V3(0.0f, 3.0f, 0.0f), HMM_V3(0.0f, -1.0f, 0.0f) },
+        };
+        HMM_RaySoA packet;
+        HMM_RaysToSoA(grazing, 10.0f, &packet, 3);
+
+        HMM_FloatSoA t;
+        int mask = HMM_RayAABBSoA(&packet, unit, &t);
+        for (int Lane = 0; Lane < 3; ++Lane)
+        {
+            float expectedT = 0.0f;
+            HMM_Bool expected = HMM_RayAABB(grazing[Lane], 10.0f, unit, &expectedT);
+            EXPECT_TRUE(((mask >> Lane) & 1) == expected);
+            if (expected)
+            {
+                EXPECT_FLOAT_EQ(t.Elements[Lane], expectedT);
+            }
+        }
+        EXPECT_TRUE((mask & 1) == 1);
+        EXPECT_FLOAT_EQ(t.Elements[0], 1.0f);
+    }
+}
@@ -28,6 +28,46 @@ TEST(ScalarMath, Trigonometry)
     // checking that things work by default.
 }
 
+TEST(ScalarMath, SinCos)
+{
+    const float Angles[] = { 0.0f, 0.5f, HMM_PI32 / 2, 2.0f, HMM_PI32, -1.0f, -3 * HMM_PI32 / 4, 10.0f };
+    int i;
+
+    for (i = 0; i < (int)(sizeof(Angles) / sizeof(Angles[0])); ++i)
+    {
+        HMM_Vec2 SinCos = HMM_SinCosF(Angles[i]);
+        EXPECT_FLOAT_EQ(SinCos.X, HMM_SinF(Angles[i]));
+        EXPECT_FLOAT_EQ(SinCos.Y, HMM_CosF(Angles[i]));
+    }
+}
+
+#ifdef HANDMADE_MATH_FAST_TRIG
+TEST(ScalarMath, FastTrig)
+{
+    // Compare against the runtime library over a few periods, plus some large angles.
+    int i;
+    for (i = -5000; i <= 5000; ++i)
+    {
+        float Angle = (float)i * 0.0025f;
+        EXPECT_NEAR(HMM_SinF(Angle), sinf(Angle), 2e-7f);
+        EXPECT_NEAR(HMM_CosF(Angle), cosf(Angle), 2e-7f);
+
+        Angle = (float)i * 1.6384f;
+        EXPECT_NEAR(HMM_SinF(Angle), sinf(Angle), 2e-7f);
+        EXPECT_NEAR(HMM_CosF(Angle), cosf(Angle), 2e-7f);
+
+        Angle = (float)i * 0.0003f;
+        EXPECT_NEAR(HMM_TanF(Angle), tanf(Angle), 1e-6f * HMM_MAX(1.0f, HMM_ABS(tanf(Angle))));
+
+        Angle = (float)i * 0.0002f;
+        EXPECT_NEAR(HMM_ACosF(Angle), acosf(Angle), 4e-7f);
+    }
+
+    EXPECT_FLOAT_EQ(HMM_ACosF(1.0f), 0.0f);
+    EXPECT_FLOAT_EQ(HMM_ACosF(-1.0f), HMM_PI32);
+}
+#endif
+
 TEST(ScalarMath, SquareRoot)
 {
     EXPECT_FLOAT_EQ(HMM_SqrtF(16.0f), 4.0f);
@@ -36,6 +76,12 @@ TEST(ScalarMath, SquareRoot)
 TEST(ScalarMath, RSquareRootF)
 {
     EXPECT_NEAR(HMM_InvSqrtF(10.0f), 0.31616211f, 0.0001f);
+
+    // Relative error below 3e-7 over a range of magnitudes
+    for (float x = 1e-6f; x < 1e6f; x *= 1.37f)
+    {
+        EXPECT_NEAR(HMM_InvSqrtFastF(x) * sqrtf(x), 1.0f, 3e-7f);
+    }
 }
 
 TEST(ScalarMath, Lerp)
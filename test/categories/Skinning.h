@@ -0,0 +1,65 @@
+#include "../HandmadeTest.h"
+
+#define SKINNING_TEST_VERTICES 300
+
+// The HMM_MulM4F and HMM_AddM4 blend that the skinning functions replace
+static HMM_Mat4 SkinningTestBlend(const HMM_Mat4 *palette, const unsigned short *bones, HMM_Vec4 weights)
+{
+    HMM_Mat4 result = HMM_MulM4F(palette[bones[0]], weights.X);
+    result = HMM_AddM4(result, HMM_MulM4F(palette[bones[1]], weights.Y));
+    result = HMM_AddM4(result, HMM_MulM4F(palette[bones[2]], weights.Z));
+    return HMM_AddM4(result, HMM_MulM4F(palette[bones[3]], weights.W));
+}
+
+TEST(Skinning, LinearBlend)
+{
+    static HMM_Mat4 palette[5];
+    static unsigned short bones[4 * SKINNING_TEST_VERTICES];
+    static HMM_Vec4 weights[SKINNING_TEST_VERTICES];
+    static HMM_Vec3 positions[SKINNING_TEST_VERTICES], normals[SKINNING_TEST_VERTICES];
+    static HMM_Vec3 outPositions[SKINNING_TEST_VERTICES], outNormals[SKINNING_TEST_VERTICES];
+    static HMM_Vec4 streamPositions[SKINNING_TEST_VERTICES], streamNormals[SKINNING_TEST_VERTICES];
+
+    for (int i = 0; i < 5; ++i)
+    {
+        palette[i] = HMMTest_AffineM4(i);
+    }
+    for (int i = 0; i < SKINNING_TEST_VERTICES; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            bones[4 * i + j] = (unsigned short)((i + 2 * j) % 5);
+        }
+        // The last influence is unused for every third vertex
+        float unused = (i % 3 == 0) ? 0.0f : 0.1f;
+        weights[i] = HMM_V4(0.5f, 0.3f - 0.1f * (i % 2), 0.2f + 0.1f * (i % 2) - unused, unused);
+        positions[i] = HMM_V3(0.1f * i - 15.0f, 2.0f, 0.05f * i);
+        normals[i] = HMM_NormV3(HMM_V3(1.0f, 0.01f * i, -0.5f));
+    }
+
+    HMM_SkinV3Array(palette, bones, weights, positions, normals, outPositions, outNormals, SKINNING_TEST_VERTICES);
+    HMM_SkinV4ArrayStream(palette, bones, weights, positions, normals, streamPositions, streamNormals, SKINNING_TEST_VERTICES);
+
+    for (int i = 0; i < SKINNING_TEST_VERTICES; ++i)
+    {
+        HMM_Mat4 skin = SkinningTestBlend(palette, &bones[4 * i], weights[i]);
+        HMM_Vec4 position = HMM_MulM4V4(skin, HMM_V4V(positions[i], 1.0f));
+        HMM_Vec4 normal = HMM_MulM4V4(skin, HMM_V4V(normals[i], 0.0f));
+
+        EXPECT_NEAR(outPositions[i].X, position.X, 1e-4f);
+        EXPECT_NEAR(outPositions[i].Y, position.Y, 1e-4f);
+        EXPECT_NEAR(outPositions[i].Z, position.Z, 1e-4f);
+        EXPECT_NEAR(outNormals[i].X, normal.X, 1e-5f);
+        EXPECT_NEAR(outNormals[i].Y, normal.Y, 1e-5f);
+        EXPECT_NEAR(outNormals[i].Z, normal.Z, 1e-5f);
+
+        EXPECT_TRUE(memcmp(&streamPositions[i], &outPositions[i], sizeof(HMM_Vec3)) == 0);
+        EXPECT_TRUE(memcmp(&streamNormals[i], &outNormals[i], sizeof(HMM_Vec3)) == 0);
+        EXPECT_NEAR(streamPositions[i].W, 1.0f, 1e-6f);
+        EXPECT_NEAR(streamNormals[i].W, 0.0f, 1e-6f);
+    }
+
+    // Positions only, in place
+    HMM_SkinV3Array(palette, bones, weights, positions, 0, positions, 0, SKINNING_TEST_VERTICES);
+    EXPECT_TRUE(memcmp(positions, outPositions, sizeof(positions)) == 0);
+}
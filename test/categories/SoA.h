@@ -0,0 +1,287 @@
+#include "../HandmadeTest.h"
+
+static HMM_Vec3 SoATestVec3(int i)
+{
+    return HMM_V3(0.5f * i - 2.0f, 1.0f + 0.25f * i, 3.0f - 0.75f * i);
+}
+
+static HMM_Vec4 SoATestVec4(int i)
+{
+    return HMM_V4(0.5f * i - 2.0f, 1.0f + 0.25f * i, 3.0f - 0.75f * i, 0.125f * i + 0.5f);
+}
+
+TEST(SoA, Conversion)
+{
+    HMM_Vec3 v3[19];
+    HMM_Vec4 v4[19];
+    for (int i = 0; i < 19; ++i)
+    {
+        v3[i] = SoATestVec3(i);
+        v4[i] = SoATestVec4(i);
+    }
+
+    HMM_Vec3SoA soa3[3];
+    HMM_Vec4SoA soa4[3];
+    HMM_V3ArrayToSoA(v3, soa3, 19);
+    HMM_V4ArrayToSoA(v4, soa4, 19);
+
+    for (int i = 0; i < 19; ++i)
+    {
+        const HMM_Vec3SoA *block3 = &soa3[i / HMM_SOA_WIDTH];
+        const HMM_Vec4SoA *block4 = &soa4[i / HMM_SOA_WIDTH];
+        int lane = i % HMM_SOA_WIDTH;
+
+        EXPECT_FLOAT_EQ(block3->X.Elements[lane], v3[i].X);
+        EXPECT_FLOAT_EQ(block3->Y.Elements[lane], v3[i].Y);
+        EXPECT_FLOAT_EQ(block3->Z.Elements[lane], v3[i].Z);
+
+        EXPECT_FLOAT_EQ(block4->X.Elements[lane], v4[i].X);
+        EXPECT_FLOAT_EQ(block4->Y.Elements[lane], v4[i].Y);
+        EXPECT_FLOAT_EQ(block4->Z.Elements[lane], v4[i].Z);
+        EXPECT_FLOAT_EQ(block4->W.Elements[lane], v4[i].W);
+    }
+
+    // Unused lanes are zeroed
+    for (int lane = 19 % HMM_SOA_WIDTH; lane < HMM_SOA_WIDTH; ++lane)
+    {
+        EXPECT_FLOAT_EQ(soa3[2].X.Elements[lane], 0.0f);
+        EXPECT_FLOAT_EQ(soa3[2].Z.Elements[lane], 0.0f);
+        EXPECT_FLOAT_EQ(soa4[2].W.Elements[lane], 0.0f);
+    }
+
+    HMM_Vec3 back3[20];
+    HMM_Vec4 back4[20];
+    back3[19] = HMM_V3(-7.0f, -7.0f, -7.0f);
+    back4[19] = HMM_V4(-7.0f, -7.0f, -7.0f, -7.0f);
+    HMM_SoAToV3Array(soa3, back3, 19);
+    HMM_SoAToV4Array(soa4, back4, 19);
+
+    for (int i = 0; i < 19; ++i)
+    {
+        EXPECT_TRUE(HMM_EqV3(back3[i], v3[i]));
+        EXPECT_TRUE(HMM_EqV4(back4[i], v4[i]));
+    }
+
+    // Nothing is written past Count
+    EXPECT_FLOAT_EQ(back3[19].X, -7.0f);
+    EXPECT_FLOAT_EQ(back4[19].W, -7.0f);
+}
+
+TEST(SoA, Broadcast)
+{
+    HMM_FloatSoA f = HMM_SoAF(2.5f);
+    HMM_Vec3SoA v3 = HMM_V3SoA(HMM_V3(1.0f, 2.0f, 3.0f));
+    HMM_Vec4SoA v4 = HMM_V4SoA(HMM_V4(1.0f, 2.0f, 3.0f, 4.0f));
+
+    for (int lane = 0; lane < HMM_SOA_WIDTH; ++lane)
+    {
+        EXPECT_FLOAT_EQ(f.Elements[lane], 2.5f);
+        EXPECT_FLOAT_EQ(v3.X.Elements[lane], 1.0f);
+        EXPECT_FLOAT_EQ(v3.Y.Elements[lane], 2.0f);
+        EXPECT_FLOAT_EQ(v3.Z.Elements[lane], 3.0f);
+        EXPECT_FLOAT_EQ(v4.X.Elements[lane], 1.0f);
+        EXPECT_FLOAT_EQ(v4.W.Elements[lane], 4.0f);
+    }
+}
+
+TEST(SoA, Arithmetic)
+{
+    HMM_Vec3 a3[HMM_SOA_WIDTH], b3[HMM_SOA_WIDTH];
+    HMM_Vec4 a4[HMM_SOA_WIDTH], b4[HMM_SOA_WIDTH];
+    for (int i = 0; i < HMM_SOA_WIDTH; ++i)
+    {
+        a3[i] = SoATestVec3(i);
+        b3[i] = SoATestVec3(i + 5);
+        a4[i] = SoATestVec4(i);
+        b4[i] = SoATestVec4(i + 5);
+    }
+
+    HMM_Vec3SoA A3, B3;
+    HMM_Vec4SoA A4, B4;
+    HMM_V3ArrayToSoA(a3, &A3, HMM_SOA_WIDTH);
+    HMM_V3ArrayToSoA(b3, &B3, HMM_SOA_WIDTH);
+    HMM_V4ArrayToSoA(a4, &A4, HMM_SOA_WIDTH);
+    HMM_V4ArrayToSoA(b4, &B4, HMM_SOA_WIDTH);
+
+    {
+        HMM_Vec3SoA add = HMM_AddV3SoA(A3, B3);
+        HMM_Vec3SoA sub = HMM_SubV3SoA(A3, B3);
+        HMM_Vec3SoA mul = HMM_MulV3SoA(A3, B3);
+        HMM_Vec3SoA mulf = HMM_MulV3SoAF(A3, 3.0f);
+        for (int i = 0; i < HMM_SOA_WIDTH; ++i)
+        {
+            EXPECT_FLOAT_EQ(add.X.Elements[i], HMM_AddV3(a3[i], b3[i]).X);
+            EXPECT_FLOAT_EQ(add.Z.Elements[i], HMM_AddV3(a3[i], b3[i]).Z);
+            EXPECT_FLOAT_EQ(sub.Y.Elements[i], HMM_SubV3(a3[i], b3[i]).Y);
+            EXPECT_FLOAT_EQ(mul.Z.Elements[i], HMM_MulV3(a3[i], b3[i]).Z);
+            EXPECT_FLOAT_EQ(mulf.X.Elements[i], HMM_MulV3F(a3[i], 3.0f).X);
+        }
+    }
+    {
+        HMM_Vec4SoA add = HMM_AddV4SoA(A4, B4);
+        HMM_Vec4SoA sub = HMM_SubV4SoA(A4, B4);
+        HMM_Vec4SoA mul = HMM_MulV4SoA(A4, B4);
+        HMM_Vec4SoA mulf = HMM_MulV4SoAF(A4, 3.0f);
+        for (int i = 0; i < HMM_SOA_WIDTH; ++i)
+        {
+            EXPECT_FLOAT_EQ(add.W.Elements[i], HMM_AddV4(a4[i], b4[i]).W);
+            EXPECT_FLOAT_EQ(sub.X.Elements[i], HMM_SubV4(a4[i], b4[i]).X);
+            EXPECT_FLOAT_EQ(mul.Y.Elements[i], HMM_MulV4(a4[i], b4[i]).Y);
+            EXPECT_FLOAT_EQ(mulf.W.Elements[i], HMM_MulV4F(a4[i], 3.0f).W);
+        }
+    }
+#if HANDMADE_MATH__USE_C11_GENERICS || defined(__cplusplus)
+    {
+        HMM_Vec3SoA add3 = HMM_Add(A3, B3);
+        HMM_Vec3SoA sub3 = HMM_Sub(A3, B3);
+        HMM_Vec3SoA mul3 = HMM_Mul(A3, B3);
+        HMM_Vec3SoA mulf3 = HMM_Mul(A3, 3.0f);
+        HMM_Vec4SoA add4 = HMM_Add(A4, B4);
+        HMM_Vec4SoA sub4 = HMM_Sub(A4, B4);
+        HMM_Vec4SoA mul4 = HMM_Mul(A4, B4);
+        HMM_Vec4SoA mulf4 = HMM_Mul(A4, 3.0f);
+        EXPECT_FLOAT_EQ(add3.X.Elements[1], HMM_AddV3(a3[1], b3[1]).X);
+        EXPECT_FLOAT_EQ(sub3.Y.Elements[2], HMM_SubV3(a3[2], b3[2]).Y);
+        EXPECT_FLOAT_EQ(mul3.Z.Elements[3], HMM_MulV3(a3[3], b3[3]).Z);
+        EXPECT_FLOAT_EQ(mulf3.X.Elements[4], HMM_MulV3F(a3[4], 3.0f).X);
+        EXPECT_FLOAT_EQ(add4.W.Elements[5], HMM_AddV4(a4[5], b4[5]).W);
+        EXPECT_FLOAT_EQ(sub4.X.Elements[6], HMM_SubV4(a4[6], b4[6]).X);
+        EXPECT_FLOAT_EQ(mul4.Y.Elements[7], HMM_MulV4(a4[7], b4[7]).Y);
+        EXPECT_FLOAT_EQ(mulf4.Z.Elements[0], HMM_MulV4F(a4[0], 3.0f).Z);
+    }
+#endif
+#ifdef __cplusplus
+    {
+        HMM_Vec3SoA add3 = A3 + B3;
+        HMM_Vec3SoA sub3 = A3 - B3;
+        HMM_Vec3SoA mul3 = A3 * B3;
+        HMM_Vec3SoA mulf3 = A3 * 3.0f;
+        HMM_Vec3SoA mulfl3 = 3.0f * A3;
+        HMM_Vec4SoA add4 = A4 + B4;
+        HMM_Vec4SoA sub4 = A4 - B4;
+        HMM_Vec4SoA mul4 = A4 * B4;
+        HMM_Vec4SoA mulf4 = A4 * 3.0f;
+        HMM_Vec4SoA mulfl4 = 3.0f * A4;
+        EXPECT_FLOAT_EQ(add3[0][1], HMM_AddV3(a3[1], b3[1]).X);
+        EXPECT_FLOAT_EQ(sub3[1][2], HMM_SubV3(a3[2], b3[2]).Y);
+        EXPECT_FLOAT_EQ(mul3[2][3], HMM_MulV3(a3[3], b3[3]).Z);
+        EXPECT_FLOAT_EQ(mulf3[0][4], HMM_MulV3F(a3[4], 3.0f).X);
+        EXPECT_FLOAT_EQ(mulfl3[1][4], HMM_MulV3F(a3[4], 3.0f).Y);
+        EXPECT_FLOAT_EQ(add4[3][5], HMM_AddV4(a4[5], b4[5]).W);
+        EXPECT_FLOAT_EQ(sub4[0][6], HMM_SubV4(a4[6], b4[6]).X);
+        EXPECT_FLOAT_EQ(mul4[1][7], HMM_MulV4(a4[7], b4[7]).Y);
+        EXPECT_FLOAT_EQ(mulf4[2][0], HMM_MulV4F(a4[0], 3.0f).Z);
+        EXPECT_FLOAT_EQ(mulfl4[3][0], HMM_MulV4F(a4[0], 3.0f).W);
+    }
+#endif
+}
+
+TEST(SoA, VectorOps)
+{
+    HMM_Vec3 a3[HMM_SOA_WIDTH], b3[HMM_SOA_WIDTH];
+    HMM_Vec4 a4[HMM_SOA_WIDTH], b4[HMM_SOA_WIDTH];
+    for (int i = 0; i < HMM_SOA_WIDTH; ++i)
+    {
+        a3[i] = SoATestVec3(i);
+        b3[i] = SoATestVec3(2 * i + 1);
+        a4[i] = SoATestVec4(i);
+        b4[i] = SoATestVec4(2 * i + 1);
+    }
+
+    HMM_Vec3SoA A3, B3;
+    HMM_Vec4SoA A4, B4;
+    HMM_V3ArrayToSoA(a3, &A3, HMM_SOA_WIDTH);
+    HMM_V3ArrayToSoA(b3, &B3, HMM_SOA_WIDTH);
+    HMM_V4ArrayToSoA(a4, &A4, HMM_SOA_WIDTH);
+    HMM_V4ArrayToSoA(b4, &B4, HMM_SOA_WIDTH);
+
+    {
+        HMM_FloatSoA dot3 = HMM_DotV3SoA(A3, B3);
+        HMM_FloatSoA dot4 = HMM_DotV4SoA(A4, B4);
+        HMM_FloatSoA len3 = HMM_LenV3SoA(A3);
+        HMM_FloatSoA len4 = HMM_LenV4SoA(A4);
+        HMM_Vec3SoA cross = HMM_CrossSoA(A3, B3);
+        HMM_Vec3SoA norm3 = HMM_NormV3SoA(A3);
+        HMM_Vec4SoA norm4 = HMM_NormV4SoA(A4);
+        HMM_Vec3SoA lerp3 = HMM_LerpV3SoA(A3, 0.3f, B3);
+        HMM_Vec4SoA lerp4 = HMM_LerpV4SoA(A4, 0.3f, B4);
+
+        for (int i = 0; i < HMM_SOA_WIDTH; ++i)
+        {
+            HMM_Vec3 expectedCross = HMM_Cross(a3[i], b3[i]);
+            HMM_Vec3 expectedNorm3 = HMM_NormV3(a3[i]);
+            HMM_Vec4 expectedNorm4 = HMM_NormV4(a4[i]);
+            HMM_Vec3 expectedLerp3 = HMM_LerpV3(a3[i], 0.3f, b3[i]);
+            HMM_Vec4 expectedLerp4 = HMM_LerpV4(a4[i], 0.3f, b4[i]);
+
+            EXPECT_FLOAT_EQ(dot3.Elements[i], HMM_DotV3(a3[i], b3[i]));
+            EXPECT_FLOAT_EQ(len3.Elements[i], HMM_LenV3(a3[i]));
+            EXPECT_FLOAT_EQ(cross.X.Elements[i], expectedCross.X);
+            EXPECT_FLOAT_EQ(cross.Y.Elements[i], expectedCross.Y);
+            EXPECT_FLOAT_EQ(cross.Z.Elements[i], expectedCross.Z);
+            EXPECT_FLOAT_EQ(norm3.X.Elements[i], expectedNorm3.X);
+            EXPECT_FLOAT_EQ(norm3.Y.Elements[i], expectedNorm3.Y);
+            EXPECT_FLOAT_EQ(norm3.Z.Elements[i], expectedNorm3.Z);
+            EXPECT_FLOAT_EQ(lerp3.X.Elements[i], expectedLerp3.X);
+            EXPECT_FLOAT_EQ(lerp3.Z.Elements[i], expectedLerp3.Z);
+
+            EXPECT_NEAR(dot4.Elements[i], HMM_DotV4(a4[i], b4[i]), 0.0001f);
+            EXPECT_NEAR(len4.Elements[i], HMM_LenV4(a4[i]), 0.0001f);
+            EXPECT_NEAR(norm4.X.Elements[i], expectedNorm4.X, 0.0001f);
+            EXPECT_NEAR(norm4.W.Elements[i], expectedNorm4.W, 0.0001f);
+            EXPECT_FLOAT_EQ(lerp4.Y.Elements[i], expectedLerp4.Y);
+            EXPECT_FLOAT_EQ(lerp4.W.Elements[i], expectedLerp4.W);
+        }
+    }
+#if HANDMADE_MATH__USE_C11_GENERICS || defined(__cplusplus)
+    {
+        HMM_FloatSoA dot3 = HMM_Dot(A3, B3);
+        HMM_FloatSoA dot4 = HMM_Dot(A4, B4);
+        HMM_FloatSoA len3 = HMM_Len(A3);
+        HMM_FloatSoA len4 = HMM_Len(A4);
+        HMM_Vec3SoA norm3 = HMM_Norm(A3);
+        HMM_Vec4SoA norm4 = HMM_Norm(A4);
+        HMM_Vec3SoA lerp3 = HMM_Lerp(A3, 0.3f, B3);
+        HMM_Vec4SoA lerp4 = HMM_Lerp(A4, 0.3f, B4);
+
+        EXPECT_FLOAT_EQ(dot3.Elements[3], HMM_DotV3(a3[3], b3[3]));
+        EXPECT_NEAR(dot4.Elements[3], HMM_DotV4(a4[3], b4[3]), 0.0001f);
+        EXPECT_FLOAT_EQ(len3.Elements[4], HMM_LenV3(a3[4]));
+        EXPECT_NEAR(len4.Elements[4], HMM_LenV4(a4[4]), 0.0001f);
+        EXPECT_FLOAT_EQ(norm3.Y.Elements[5], HMM_NormV3(a3[5]).Y);
+        EXPECT_NEAR(norm4.Z.Elements[5], HMM_NormV4(a4[5]).Z, 0.0001f);
+        EXPECT_FLOAT_EQ(lerp3.X.Elements[6], HMM_LerpV3(a3[6], 0.3f, b3[6]).X);
+        EXPECT_FLOAT_EQ(lerp4.W.Elements[6], HMM_LerpV4(a4[6], 0.3f, b4[6]).W);
+    }
+#endif
+}
+
+TEST(SoA, MathFunctions)
+{
+    HMM_FloatSoA angles, args, squares;
+    for (int i = 0; i < HMM_SOA_WIDTH; ++i)
+    {
+        angles.Elements[i] = 1.7f * i - 6.0f;
+        args.Elements[i] = 0.25f * i - 0.9f;
+        squares.Elements[i] = 0.5f * i + 0.25f;
+    }
+
+    HMM_FloatSoA sin, cos;
+    HMM_SinCosSoA(angles, &sin, &cos);
+    HMM_FloatSoA sinOnly = HMM_SinSoA(angles);
+    HMM_FloatSoA cosOnly = HMM_CosSoA(angles);
+    HMM_FloatSoA acos = HMM_ACosSoA(args);
+    HMM_FloatSoA sqrt = HMM_SqrtSoA(squares);
+    HMM_FloatSoA rsqrt = HMM_RSqrtSoA(squares);
+
+    for (int i = 0; i < HMM_SOA_WIDTH; ++i)
+    {
+        EXPECT_NEAR(sin.Elements[i], sinf(angles.Elements[i]), 2e-7f);
+        EXPECT_NEAR(cos.Elements[i], cosf(angles.Elements[i]), 2e-7f);
+        EXPECT_NEAR(sinOnly.Elements[i], sinf(angles.Elements[i]), 2e-7f);
+        EXPECT_NEAR(cosOnly.Elements[i], cosf(angles.Elements[i]), 2e-7f);
+        EXPECT_NEAR(acos.Elements[i], acosf(args.Elements[i]), 4e-7f);
+        EXPECT_FLOAT_EQ(sqrt.Elements[i], HMM_SqrtF(squares.Elements[i]));
+        EXPECT_FLOAT_EQ(rsqrt.Elements[i], HMM_InvSqrtF(squares.Elements[i]));
+    }
+}
@@ -0,0 +1,101 @@
+#include "../HandmadeTest.h"
+
+static HMM_TRS TRSTestTransform(int i, float Scale)
+{
+    HMM_Quat rotation = HMM_QFromAxisAngle_RH(HMM_NormV3(HMM_V3(1.0f, -0.5f * i, 2.0f)), 0.6f * i + 0.3f);
+    HMM_Vec3 scale = (Scale > 0.0f) ? HMM_V3(Scale, Scale, Scale) : HMM_V3(1.0f + 0.25f * i, 0.5f, 2.0f);
+    return HMM_TRSFrom(HMM_V3(1.0f * i, -2.0f, 0.5f), rotation, scale);
+}
+
+static HMM_Mat4 TRSTestMatrix(HMM_TRS t)
+{
+    return HMM_MulM4(HMM_Translate(t.Translation.XYZ), HMM_MulM4(HMM_QToM4(t.Rotation), HMM_Scale(t.Scale.XYZ)));
+}
+
+TEST(TRS, ToM4)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        HMM_TRS t = TRSTestTransform(i, 0.0f);
+        HMM_Mat4 result = HMM_TRSToM4(t);
+        EXPECT_M4_NEAR(result, TRSTestMatrix(t), 1e-5f);
+        EXPECT_M4_NEAR(HMM_TRSToInvM4(t), HMM_InvGeneralM4(result), 1e-5f);
+        EXPECT_M4_NEAR(HMM_MulM4(HMM_TRSToInvM4(t), result), HMM_M4D(1.0f), 1e-5f);
+    }
+
+    HMM_TRS transforms[5];
+    HMM_Mat4 outs[5];
+    for (int i = 0; i < 5; ++i)
+    {
+        transforms[i] = TRSTestTransform(i, 0.0f);
+    }
+    HMM_TRSToM4Array(transforms, outs, 5);
+    for (int i = 0; i < 5; ++i)
+    {
+        HMM_Mat4 expected = HMM_TRSToM4(transforms[i]);
+        EXPECT_TRUE(memcmp(&outs[i], &expected, sizeof(expected)) == 0);
+    }
+}
+
+TEST(TRS, Multiplication)
+{
+    HMM_TRS a = TRSTestTransform(1, 2.0f);
+    HMM_TRS b = TRSTestTransform(3, 0.0f);
+    HMM_Mat4 expected = HMM_MulM4(HMM_TRSToM4(a), HMM_TRSToM4(b));
+
+    {
+        HMM_TRS result = HMM_MulTRS(a, b);
+        EXPECT_M4_NEAR(HMM_TRSToM4(result), expected, 1e-5f);
+    }
+#if HANDMADE_MATH__USE_C11_GENERICS || defined(__cplusplus)
+    {
+        HMM_TRS result = HMM_Mul(a, b);
+        EXPECT_M4_NEAR(HMM_TRSToM4(result), expected, 1e-5f);
+    }
+#endif
+#ifdef __cplusplus
+    {
+        HMM_TRS result = a * b;
+        EXPECT_M4_NEAR(HMM_TRSToM4(result), expected, 1e-5f);
+    }
+#endif
+}
+
+TEST(TRS, Inverse)
+{
+    HMM_TRS t = TRSTestTransform(2, 0.5f);
+    HMM_TRS inverse = HMM_InvTRS(t);
+    EXPECT_M4_NEAR(HMM_TRSToM4(inverse), HMM_TRSToInvM4(t), 1e-5f);
+    EXPECT_M4_NEAR(HMM_TRSToM4(HMM_MulTRS(inverse, t)), HMM_M4D(1.0f), 1e-5f);
+    EXPECT_M4_NEAR(HMM_TRSToM4(HMM_MulTRS(t, inverse)), HMM_M4D(1.0f), 1e-5f);
+}
+
+TEST(TRS, Interpolation)
+{
+    HMM_TRS a = TRSTestTransform(1, 0.0f);
+    HMM_TRS b = TRSTestTransform(2, 0.0f);
+
+    EXPECT_M4_NEAR(HMM_TRSToM4(HMM_LerpTRS(a, 0.0f, b)), HMM_TRSToM4(a), 1e-5f);
+    EXPECT_M4_NEAR(HMM_TRSToM4(HMM_LerpTRS(a, 1.0f, b)), HMM_TRSToM4(b), 1e-5f);
+
+    HMM_TRS half = HMM_LerpTRS(a, 0.5f, b);
+    EXPECT_V4_NEAR(HMM_V4V(half.Translation.XYZ, 0.0f), HMM_V4V(HMM_LerpV3(a.Translation.XYZ, 0.5f, b.Translation.XYZ), 0.0f), 1e-6f);
+    EXPECT_V4_NEAR(HMM_V4V(half.Scale.XYZ, 0.0f), HMM_V4V(HMM_LerpV3(a.Scale.XYZ, 0.5f, b.Scale.XYZ), 0.0f), 1e-6f);
+    EXPECT_NEAR(half.Rotation.X, HMM_NLerp(a.Rotation, 0.5f, b.Rotation).X, 1e-6f);
+    EXPECT_NEAR(half.Rotation.W, HMM_NLerp(a.Rotation, 0.5f, b.Rotation).W, 1e-6f);
+
+    // -Q is the same rotation, and the interpolation still takes the short way
+    HMM_TRS flipped = b;
+    flipped.Rotation = HMM_MulQF(b.Rotation, -1.0f);
+    EXPECT_M4_NEAR(HMM_TRSToM4(HMM_LerpTRS(a, 0.5f, flipped)), HMM_TRSToM4(half), 1e-5f);
+
+    HMM_TRS transforms[3] = { a, flipped, b };
+    {
+        float weights[2] = { 0.5f, 0.5f };
+        EXPECT_M4_NEAR(HMM_TRSToM4(HMM_BlendTRS(transforms, weights, 2)), HMM_TRSToM4(half), 1e-5f);
+    }
+    {
+        float weights[3] = { 1.0f, 0.0f, 0.0f };
+        EXPECT_M4_NEAR(HMM_TRSToM4(HMM_BlendTRS(transforms, weights, 3)), HMM_TRSToM4(a), 1e-5f);
+    }
+}
@@ -0,0 +1,70 @@
+#include "../HandmadeTest.h"
+
+#define EXPECT_V3A_EQ(_actual, _expected) \
+    EXPECT_FLOAT_EQ((_actual).X, (_expected).X); \
+    EXPECT_FLOAT_EQ((_actual).Y, (_expected).Y); \
+    EXPECT_FLOAT_EQ((_actual).Z, (_expected).Z);
+
+TEST(Vec3A, Conversion)
+{
+    HMM_Vec3A a = HMM_V3A(1.0f, 2.0f, 3.0f);
+    EXPECT_FLOAT_EQ(a.X, 1.0f);
+    EXPECT_FLOAT_EQ(a.Y, 2.0f);
+    EXPECT_FLOAT_EQ(a.Z, 3.0f);
+    EXPECT_FLOAT_EQ(a.Elements[2], 3.0f);
+    EXPECT_TRUE(sizeof(HMM_Vec3A) == 16);
+#ifdef __cplusplus
+    EXPECT_FLOAT_EQ(a[1], 2.0f);
+#endif
+
+    HMM_Vec3 v = HMM_V3AToV3(HMM_V3ToV3A(HMM_V3(4.0f, 5.0f, 6.0f)));
+    EXPECT_V3A_EQ(v, HMM_V3(4.0f, 5.0f, 6.0f));
+
+    HMM_Vec3A fromV4 = HMM_V4ToV3A(HMM_V4(7.0f, 8.0f, 9.0f, 10.0f));
+    EXPECT_V3A_EQ(fromV4, HMM_V3(7.0f, 8.0f, 9.0f));
+    EXPECT_V4_EQ(HMM_V3AToV4(fromV4, -1.0f), HMM_V4(7.0f, 8.0f, 9.0f, -1.0f));
+}
+
+TEST(Vec3A, Arithmetic)
+{
+    HMM_Vec3 l = HMM_V3(1.5f, -2.0f, 3.25f);
+    HMM_Vec3 r = HMM_V3(-0.5f, 4.0f, 2.0f);
+    /* The padding lanes hold values that would show up if they leaked into a result */
+    HMM_Vec3A la = HMM_V4ToV3A(HMM_V4V(l, 1000.0f));
+    HMM_Vec3A ra = HMM_V4ToV3A(HMM_V4V(r, -1000.0f));
+
+    EXPECT_V3A_EQ(HMM_AddV3A(la, ra), HMM_AddV3(l, r));
+    EXPECT_V3A_EQ(HMM_SubV3A(la, ra), HMM_SubV3(l, r));
+    EXPECT_V3A_EQ(HMM_MulV3A(la, ra), HMM_MulV3(l, r));
+    EXPECT_V3A_EQ(HMM_MulV3AF(la, 3.0f), HMM_MulV3F(l, 3.0f));
+    EXPECT_V3A_EQ(HMM_DivV3A(la, ra), HMM_DivV3(l, r));
+    EXPECT_V3A_EQ(HMM_DivV3AF(la, 4.0f), HMM_DivV3F(l, 4.0f));
+    EXPECT_FLOAT_EQ(HMM_DotV3A(la, ra), HMM_DotV3(l, r));
+    EXPECT_V3A_EQ(HMM_CrossV3A(la, ra), HMM_Cross(l, r));
+    EXPECT_FLOAT_EQ(HMM_LenSqrV3A(la), HMM_LenSqrV3(l));
+    EXPECT_FLOAT_EQ(HMM_LenV3A(la), HMM_LenV3(l));
+    EXPECT_V3A_EQ(HMM_NormV3A(la), HMM_NormV3(l));
+
+#if HANDMADE_MATH__USE_C11_GENERICS || defined(__cplusplus)
+    EXPECT_V3A_EQ(HMM_Add(la, ra), HMM_AddV3(l, r));
+    EXPECT_V3A_EQ(HMM_Sub(la, ra), HMM_SubV3(l, r));
+    EXPECT_V3A_EQ(HMM_Mul(la, ra), HMM_MulV3(l, r));
+    EXPECT_V3A_EQ(HMM_Mul(la, 3.0f), HMM_MulV3F(l, 3.0f));
+    EXPECT_V3A_EQ(HMM_Div(la, ra), HMM_DivV3(l, r));
+    EXPECT_V3A_EQ(HMM_Div(la, 4.0f), HMM_DivV3F(l, 4.0f));
+    EXPECT_FLOAT_EQ(HMM_Dot(la, ra), HMM_DotV3(l, r));
+    EXPECT_FLOAT_EQ(HMM_LenSqr(la), HMM_LenSqrV3(l));
+    EXPECT_FLOAT_EQ(HMM_Len(la), HMM_LenV3(l));
+    EXPECT_V3A_EQ(HMM_Norm(la), HMM_NormV3(l));
+#endif
+#ifdef __cplusplus
+    EXPECT_V3A_EQ(la + ra, HMM_AddV3(l, r));
+    EXPECT_V3A_EQ(la - ra, HMM_SubV3(l, r));
+    EXPECT_V3A_EQ(la * ra, HMM_MulV3(l, r));
+    EXPECT_V3A_EQ(la * 3.0f, HMM_MulV3F(l, 3.0f));
+    EXPECT_V3A_EQ(3.0f * la, HMM_MulV3F(l, 3.0f));
+    EXPECT_V3A_EQ(la / ra, HMM_DivV3(l, r));
+    EXPECT_V3A_EQ(la / 4.0f, HMM_DivV3F(l, 4.0f));
+    EXPECT_V3A_EQ(-la, HMM_V3(-l.X, -l.Y, -l.Z));
+#endif
+}
@@ -87,6 +87,25 @@ TEST(VectorOps, Normalize)
 #endif
 }
 
+TEST(VectorOps, NormalizeFast)
+{
+    HMM_Vec3 v3 = HMM_V3(1.0f, -2.0f, 3.0f);
+    HMM_Vec4 v4 = HMM_V4(1.0f, -2.0f, 3.0f, -1.0f);
+
+    {
+        HMM_Vec3 result = HMM_NormFastV3(v3);
+        HMM_Vec3 expected = HMM_NormV3(v3);
+        EXPECT_NEAR(result.X, expected.X, 3e-7f);
+        EXPECT_NEAR(result.Y, expected.Y, 3e-7f);
+        EXPECT_NEAR(result.Z, expected.Z, 3e-7f);
+    }
+    {
+        HMM_Vec4 result = HMM_NormFastV4(v4);
+        EXPECT_V4_NEAR(result, HMM_NormV4(v4), 3e-7f);
+        EXPECT_NEAR(HMM_LenV4(result), 1.0f, 3e-7f);
+    }
+}
+
 TEST(VectorOps, NormalizeZero)
 {
     HMM_Vec2 v2 = HMM_V2(0.0f, 0.0f);
@@ -242,6 +261,53 @@ TEST(VectorOps, LerpV4)
 #endif
 }
 
+TEST(VectorOps, TrigV4)
+{
+    // Always the fast approximations, so compare against the runtime library with a tolerance.
+    for (int i = -200; i < 200; ++i)
+    {
+        HMM_Vec4 angles = HMM_V4(i * 0.05f, i * 0.05f + 0.0125f, i * 0.05f + 0.025f, i * 0.05f + 0.0375f);
+        HMM_Vec4 args = HMM_V4(i * 0.005f, i * 0.005f + 0.00125f, i * 0.005f + 0.0025f, i * 0.005f + 0.00375f);
+        HMM_Vec4 sin, cos;
+        HMM_SinCosV4(angles, &sin, &cos);
+        HMM_Vec4 sinOnly = HMM_SinV4(angles);
+        HMM_Vec4 cosOnly = HMM_CosV4(angles);
+        HMM_Vec4 acos = HMM_ACosV4(args);
+
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            EXPECT_NEAR(sin.Elements[lane], sinf(angles.Elements[lane]), 2e-7f);
+            EXPECT_NEAR(cos.Elements[lane], cosf(angles.Elements[lane]), 2e-7f);
+            EXPECT_NEAR(sinOnly.Elements[lane], sinf(angles.Elements[lane]), 2e-7f);
+            EXPECT_NEAR(cosOnly.Elements[lane], cosf(angles.Elements[lane]), 2e-7f);
+            EXPECT_NEAR(acos.Elements[lane], acosf(args.Elements[lane]), 4e-7f);
+        }
+    }
+
+    HMM_Vec4 acos = HMM_ACosV4(HMM_V4(-1.0f, 1.0f, 0.0f, 0.5f));
+    EXPECT_FLOAT_EQ(acos.X, HMM_PI32);
+    EXPECT_FLOAT_EQ(acos.Y, 0.0f);
+    EXPECT_FLOAT_EQ(acos.Z, HMM_PI32 / 2.0f);
+    EXPECT_NEAR(acos.W, HMM_PI32 / 3.0f, 2e-7f);
+}
+
+TEST(VectorOps, SqrtV4)
+{
+    HMM_Vec4 v = HMM_V4(16.0f, 2.0f, 0.25f, 10.0f);
+
+    HMM_Vec4 sqrt = HMM_SqrtV4(v);
+    EXPECT_FLOAT_EQ(sqrt.X, 4.0f);
+    EXPECT_FLOAT_EQ(sqrt.Y, HMM_SqrtF(2.0f));
+    EXPECT_FLOAT_EQ(sqrt.Z, 0.5f);
+    EXPECT_FLOAT_EQ(sqrt.W, HMM_SqrtF(10.0f));
+
+    HMM_Vec4 rsqrt = HMM_RSqrtV4(v);
+    EXPECT_FLOAT_EQ(rsqrt.X, 0.25f);
+    EXPECT_FLOAT_EQ(rsqrt.Y, HMM_InvSqrtF(2.0f));
+    EXPECT_FLOAT_EQ(rsqrt.Z, 2.0f);
+    EXPECT_FLOAT_EQ(rsqrt.W, HMM_InvSqrtF(10.0f));
+}
+
 /*
  * MatrixOps tests
  */
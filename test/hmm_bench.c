@@ -0,0 +1,254 @@
+/*
+ * Micro-benchmark runner for HandmadeMath.
+ *
+ * Every case in hmm_bench_cases.c is timed twice, once built with SIMD and once
+ * with HANDMADE_MATH_NO_SIMD. Each case is calibrated so that one repetition
+ * takes about --target-us microseconds, warmed up for --warmup repetitions, and
+ * then timed for --reps repetitions. The median and p99 (nearest rank) of the
+ * per-repetition ns/op are reported.
+ *
+ * Usage: hmm_bench [--reps N] [--warmup N] [--target-us N] [--filter TEXT]
+ *                  [--csv FILE] [--json FILE]
+ */
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+# define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <time.h>
+#endif
+
+#include "hmm_bench.h"
+
+#if !defined(__GNUC__) && !defined(__clang__)
+void HMMBench_Escape(void *Pointer)
+{
+    static void *volatile Sink;
+    Sink = Pointer;
+}
+#endif
+
+typedef struct BenchResult
+{
+    double MedianNs;
+    double P99Ns;
+    double MinNs;
+    int Operations;
+} BenchResult;
+
+static double NowNs(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER Counter, Frequency;
+    QueryPerformanceCounter(&Counter);
+    QueryPerformanceFrequency(&Frequency);
+    return (double)Counter.QuadPart * 1e9 / (double)Frequency.QuadPart;
+#else
+    struct timespec Time;
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+    return (double)Time.tv_sec * 1e9 + (double)Time.tv_nsec;
+#endif
+}
+
+static int CompareDoubles(const void *A, const void *B)
+{
+    double Left = *(const double *)A;
+    double Right = *(const double *)B;
+    return (Left > Right) - (Left < Right);
+}
+
+static BenchResult RunCase(const HMMBenchCase *Case, int Reps, int Warmup, double TargetNs)
+{
+    BenchResult Result;
+    double *Samples = (double *)malloc(sizeof(double) * Reps);
+    int Operations = HMM_BENCH_DATA_SIZE;
+    int Rep;
+
+    /* Calibrate: double the operations per repetition until one takes long enough to time reliably. */
+    for (;;)
+    {
+        double Start = NowNs();
+        Case->Run(Operations);
+        if (NowNs() - Start >= TargetNs || Operations >= (1 << 28))
+        {
+            break;
+        }
+        Operations *= 2;
+    }
+
+    for (Rep = 0; Rep < Warmup; ++Rep)
+    {
+        Case->Run(Operations);
+    }
+
+    for (Rep = 0; Rep < Reps; ++Rep)
+    {
+        double Start = NowNs();
+        Case->Run(Operations);
+        Samples[Rep] = (NowNs() - Start) / (double)Operations;
+    }
+
+    qsort(Samples, Reps, sizeof(double), CompareDoubles);
+    Result.MinNs = Samples[0];
+    Result.MedianNs = (Reps % 2) ? Samples[Reps / 2] : 0.5 * (Samples[Reps / 2 - 1] + Samples[Reps / 2]);
+    Result.P99Ns = Samples[(99 * Reps + 99) / 100 - 1];
+    Result.Operations = Operations;
+
+    free(Samples);
+    return Result;
+}
+
+static const HMMBenchCase *FindCase(const HMMBenchCase *Cases, int Count, const char *Name)
+{
+    int i;
+    for (i = 0; i < Count; ++i)
+    {
+        if (strcmp(Cases[i].Name, Name) == 0)
+        {
+            return &Cases[i];
+        }
+    }
+    return NULL;
+}
+
+static void Usage(const char *Program)
+{
+    fprintf(stderr, "Usage: %s [--reps N] [--warmup N] [--target-us N] [--filter TEXT] [--csv FILE] [--json FILE]\n", Program);
+}
+
+int main(int argc, char **argv)
+{
+    int Reps = 51;
+    int Warmup = 5;
+    double TargetNs = 200000.0;
+    const char *Filter = NULL;
+    const char *CSVPath = NULL;
+    const char *JSONPath = NULL;
+    FILE *CSV = NULL;
+    FILE *JSON = NULL;
+    int FirstJSONResult = 1;
+    int i;
+
+    for (i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc)
+        {
+            Reps = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc)
+        {
+            Warmup = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--target-us") == 0 && i + 1 < argc)
+        {
+            TargetNs = atof(argv[++i]) * 1000.0;
+        }
+        else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+        {
+            Filter = argv[++i];
+        }
+        else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc)
+        {
+            CSVPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+        {
+            JSONPath = argv[++i];
+        }
+        else
+        {
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (Reps < 1)
+    {
+        Reps = 1;
+    }
+
+    if (CSVPath && !(CSV = fopen(CSVPath, "w")))
+    {
+        fprintf(stderr, "Could not open %s\n", CSVPath);
+        return 1;
+    }
+    if (JSONPath && !(JSON = fopen(JSONPath, "w")))
+    {
+        fprintf(stderr, "Could not open %s\n", JSONPath);
+        return 1;
+    }
+
+    HMMBench_InitSIMD(12345);
+    HMMBench_InitScalar(12345);
+
+    printf("SIMD build: %s, %d reps, %d warmup reps, ~%.0f us per rep\n\n", HMMBench_TierSIMD(), Reps, Warmup, TargetNs / 1000.0);
+    printf("%-24s %12s %12s %12s %12s %9s\n", "Function (ns/op)", "SIMD median", "SIMD p99", "Scalar median", "Scalar p99", "Speedup");
+
+    if (CSV)
+    {
+        fprintf(CSV, "name,variant,median_ns,p99_ns,min_ns,reps,ops_per_rep\n");
+    }
+    if (JSON)
+    {
+        fprintf(JSON, "{\n  \"simd_tier\": \"%s\",\n  \"reps\": %d,\n  \"warmup\": %d,\n  \"results\": [", HMMBench_TierSIMD(), Reps, Warmup);
+    }
+
+    for (i = 0; i < HMMBench_CaseCountSIMD; ++i)
+    {
+        const HMMBenchCase *SIMDCase = &HMMBench_CasesSIMD[i];
+        const HMMBenchCase *ScalarCase = FindCase(HMMBench_CasesScalar, HMMBench_CaseCountScalar, SIMDCase->Name);
+        BenchResult Results[2];
+        const char *Variants[2] = { "simd", "scalar" };
+        int Variant;
+
+        if (Filter && !strstr(SIMDCase->Name, Filter))
+        {
+            continue;
+        }
+
+        Results[0] = RunCase(SIMDCase, Reps, Warmup, TargetNs);
+        Results[1] = RunCase(ScalarCase, Reps, Warmup, TargetNs);
+
+        printf("%-24s %12.3f %12.3f %12.3f %12.3f %8.2fx\n", SIMDCase->Name,
+            Results[0].MedianNs, Results[0].P99Ns, Results[1].MedianNs, Results[1].P99Ns,
+            Results[1].MedianNs / Results[0].MedianNs);
+        fflush(stdout);
+
+        for (Variant = 0; Variant < 2; ++Variant)
+        {
+            if (CSV)
+            {
+                fprintf(CSV, "%s,%s,%.4f,%.4f,%.4f,%d,%d\n", SIMDCase->Name, Variants[Variant],
+                    Results[Variant].MedianNs, Results[Variant].P99Ns, Results[Variant].MinNs, Reps, Results[Variant].Operations);
+            }
+            if (JSON)
+            {
+                fprintf(JSON, "%s\n    {\"name\": \"%s\", \"variant\": \"%s\", \"median_ns\": %.4f, \"p99_ns\": %.4f, \"min_ns\": %.4f, \"ops_per_rep\": %d}",
+                    FirstJSONResult ? "" : ",", SIMDCase->Name, Variants[Variant],
+                    Results[Variant].MedianNs, Results[Variant].P99Ns, Results[Variant].MinNs, Results[Variant].Operations);
+                FirstJSONResult = 0;
+            }
+        }
+    }
+
+    if (CSV)
+    {
+        fclose(CSV);
+        printf("\nWrote %s\n", CSVPath);
+    }
+    if (JSON)
+    {
+        fprintf(JSON, "\n  ]\n}\n");
+        fclose(JSON);
+        printf("Wrote %s\n", JSONPath);
+    }
+
+    return 0;
+}
@@ -0,0 +1,45 @@
+#ifndef HMM_BENCH_H
+#define HMM_BENCH_H
+
+/*
+ * Shared between the benchmark runner (hmm_bench.c) and the benchmark cases
+ * (hmm_bench_cases.c), which are compiled twice: once normally and once with
+ * HANDMADE_MATH_NO_SIMD.
+ */
+
+// Number of inputs each case cycles through. Every run does a multiple of this many operations.
+#define HMM_BENCH_DATA_SIZE 256
+
+typedef struct HMMBenchCase
+{
+    const char *Name;
+    void (*Run)(int Operations);
+} HMMBenchCase;
+
+// Keeps the compiler from optimizing away the computation of whatever Pointer points to.
+#if defined(__GNUC__) || defined(__clang__)
+# define HMM_BENCH_ESCAPE(Pointer) __asm__ __volatile__("" : : "g"(Pointer) : "memory")
+#else
+extern void HMMBench_Escape(void *Pointer);
+# define HMM_BENCH_ESCAPE(Pointer) HMMBench_Escape(Pointer)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const HMMBenchCase HMMBench_CasesSIMD[];
+extern const int HMMBench_CaseCountSIMD;
+void HMMBench_InitSIMD(unsigned int Seed);
+const char *HMMBench_TierSIMD(void);
+
+extern const HMMBenchCase HMMBench_CasesScalar[];
+extern const int HMMBench_CaseCountScalar;
+void HMMBench_InitScalar(unsigned int Seed);
+const char *HMMBench_TierScalar(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,380 @@
+/*
+ * Benchmark cases. This file is compiled twice, once normally and once with
+ * HANDMADE_MATH_NO_SIMD, so every case is measured with and without SIMD.
+ */
+
+#include "hmm_bench.h"
+#include "hmm_random.h"
+
+/* Provides the runtime dispatch kernels if BENCH_FLAGS enables HANDMADE_MATH_RUNTIME_DISPATCH */
+#ifndef HANDMADE_MATH_NO_SIMD
+# define HANDMADE_MATH_IMPLEMENTATION
+#endif
+#include "../HandmadeMath.h"
+
+#ifdef HANDMADE_MATH_NO_SIMD
+# define HMM_BENCH_VARIANT(Name) Name##Scalar
+#else
+# define HMM_BENCH_VARIANT(Name) Name##SIMD
+#endif
+
+#define N HMM_BENCH_DATA_SIZE
+
+/* Inputs are filled in at runtime so the compiler can't constant-fold them. One extra element lets cases read [i + 1]. */
+static float Floats[N + 1];
+static HMM_Vec4 Vec4s[N + 1];
+static HMM_Mat3 Mat3s[N + 1];
+static HMM_Mat4 Mat4s[N + 1];
+static HMM_Affine3x4 Affines[N + 1];
+static HMM_Quat Quats[N + 1];
+static HMM_Vec3SoA Vec3SoAs[N + 1];
+static HMM_Vec3 Vec3s[N];
+static unsigned short Bones[4 * N];
+static HMM_Vec4 Weights[N];
+static HMM_DualQuat DualQuats[64];
+static HMM_Frustum Frustum;
+static HMM_FloatSoA RadiiSoA[N];
+static HMM_Vec3SoA BoxMaxsSoA[N];
+static HMM_AABB Boxes[N];
+static HMM_Sphere Spheres[N];
+static HMM_Ray Ray;
+static HMM_RaySoA RaySoAs[N];
+static HMM_TriangleSoA TriangleSoAs[N];
+static HMM_DMat4 DMat4s[N + 1];
+static HMM_DQuat DQuats[N + 1];
+static HMM_DVec3 DVec3s[N];
+static int Parents[N];
+static unsigned char HierarchyDirty[N];
+static HMM_TRS TRSs[N + 1];
+static int KeyOffsets[N + 1];
+static float KeyTimes[8 * N];
+static HMM_Vec3 KeyVec3s[8 * N];
+static HMM_Quat KeyQuats[8 * N];
+static int Cursors[N];
+static HMM_PackedQuat32 PackedQuat32s[N];
+static HMM_PackedQuat48 PackedQuat48s[N];
+static HMM_HalfVec3 HalfVec3s[N];
+static HMM_FixedVec3 FixedVec3s[N];
+static HMM_OctVec3 OctVec3s[N];
+static HMM_Vec3 FixedMin, FixedMax;
+static HMM_DVec3 Camera;
+
+static float FloatOut[N];
+static HMM_Vec2 Vec2Out[N];
+static HMM_Vec4 Vec4Out[N];
+static HMM_Mat3 Mat3Out[N];
+static HMM_Mat4 Mat4Out[N];
+static HMM_Affine3x4 AffineOut[N];
+static HMM_Quat QuatOut[N];
+static HMM_FloatSoA FloatSoAOut[N];
+static HMM_Vec3SoA Vec3SoAOut[N];
+static HMM_Vec3 Vec3Out[N];
+static HMM_Vec3 NormalOut[N];
+static HMM_Vec4 Vec4NormalOut[N];
+static unsigned char VisibleOut[N / 8 + 1];
+static HMM_AABB BoxOut[N];
+static HMM_Sphere SphereOut[N];
+static int MaskOut[N];
+static HMM_DVec4 DVec4Out[N];
+static HMM_DMat4 DMat4Out[N];
+static HMM_DQuat DQuatOut[N];
+static HMM_TRS TRSOut[N];
+
+/* Single-value functions: Out[i] = Expression for every input. */
+#define HMM_BENCH_ELEMENT_CASES(X) \
+    X(HMM_SqrtF, FloatOut, HMM_SqrtF(Floats[i])) \
+    X(HMM_InvSqrtF, FloatOut, HMM_InvSqrtF(Floats[i])) \
+    X(HMM_InvSqrtFastF, FloatOut, HMM_InvSqrtFastF(Floats[i])) \
+    X(HMM_SinF, FloatOut, HMM_SinF(Floats[i])) \
+    X(HMM_CosF, FloatOut, HMM_CosF(Floats[i])) \
+    X(HMM_SinCosF, Vec2Out, HMM_SinCosF(Floats[i])) \
+    X(HMM_TanF, FloatOut, HMM_TanF(Floats[i] * 0.3f)) \
+    X(HMM_ACosF, FloatOut, HMM_ACosF((Floats[i] - 2.25f) * 0.5f)) \
+    X(HMM_SinV4, Vec4Out, HMM_SinV4(Vec4s[i])) \
+    X(HMM_ACosV4, Vec4Out, HMM_ACosV4(HMM_MulV4F(Vec4s[i], 0.09f))) \
+    X(HMM_SqrtV4, Vec4Out, HMM_SqrtV4(HMM_MulV4(Vec4s[i], Vec4s[i]))) \
+    X(HMM_RSqrtV4, Vec4Out, HMM_RSqrtV4(HMM_MulV4(Vec4s[i], Vec4s[i]))) \
+    X(HMM_AddV4, Vec4Out, HMM_AddV4(Vec4s[i], Vec4s[i + 1])) \
+    X(HMM_SubV4, Vec4Out, HMM_SubV4(Vec4s[i], Vec4s[i + 1])) \
+    X(HMM_MulV4, Vec4Out, HMM_MulV4(Vec4s[i], Vec4s[i + 1])) \
+    X(HMM_MulV4F, Vec4Out, HMM_MulV4F(Vec4s[i], Floats[i])) \
+    X(HMM_DivV4, Vec4Out, HMM_DivV4(Vec4s[i], Vec4s[i + 1])) \
+    X(HMM_DivV4F, Vec4Out, HMM_DivV4F(Vec4s[i], Floats[i])) \
+    X(HMM_DotV4, FloatOut, HMM_DotV4(Vec4s[i], Vec4s[i + 1])) \
+    X(HMM_NormV4, Vec4Out, HMM_NormV4(Vec4s[i])) \
+    X(HMM_NormV3, Vec3Out, HMM_NormV3(Vec3s[i])) \
+    X(HMM_Cross, Vec3Out, HMM_Cross(Vec3s[i], Vec4s[i + 1].XYZ)) \
+    X(HMM_CrossV3A, Vec4Out, HMM_V3AToV4(HMM_CrossV3A(HMM_V4ToV3A(Vec4s[i]), HMM_V4ToV3A(Vec4s[i + 1])), 0.0f)) \
+    X(HMM_NormV3A, Vec4Out, HMM_V3AToV4(HMM_NormV3A(HMM_V4ToV3A(Vec4s[i])), 0.0f)) \
+    X(HMM_NormFastV3, Vec3Out, HMM_NormFastV3(Vec3s[i])) \
+    X(HMM_NormFastV4, Vec4Out, HMM_NormFastV4(Vec4s[i])) \
+    X(HMM_LinearCombineV4M4, Vec4Out, HMM_LinearCombineV4M4(Vec4s[i], Mat4s[i])) \
+    X(HMM_MulM4V4, Vec4Out, HMM_MulM4V4(Mat4s[i], Vec4s[i])) \
+    X(HMM_TransposeM4, Mat4Out, HMM_TransposeM4(Mat4s[i])) \
+    X(HMM_AddM4, Mat4Out, HMM_AddM4(Mat4s[i], Mat4s[i + 1])) \
+    X(HMM_SubM4, Mat4Out, HMM_SubM4(Mat4s[i], Mat4s[i + 1])) \
+    X(HMM_MulM4, Mat4Out, HMM_MulM4(Mat4s[i], Mat4s[i + 1])) \
+    X(HMM_MulM4F, Mat4Out, HMM_MulM4F(Mat4s[i], Floats[i])) \
+    X(HMM_DivM4F, Mat4Out, HMM_DivM4F(Mat4s[i], Floats[i])) \
+    X(HMM_InvGeneralM4, Mat4Out, HMM_InvGeneralM4(Mat4s[i])) \
+    X(HMM_TransformAABB, BoxOut, HMM_TransformAABB(Mat4s[i], Boxes[i])) \
+    X(HMM_MulM3V3, Vec3Out, HMM_MulM3V3(Mat3s[i], Vec3s[i])) \
+    X(HMM_MulM3, Mat3Out, HMM_MulM3(Mat3s[i], Mat3s[i + 1])) \
+    X(HMM_TransposeM3, Mat3Out, HMM_TransposeM3(Mat3s[i])) \
+    X(HMM_InvGeneralM3, Mat3Out, HMM_InvGeneralM3(Mat3s[i])) \
+    X(HMM_MulA34, AffineOut, HMM_MulA34(Affines[i], Affines[i + 1])) \
+    X(HMM_InvA34, AffineOut, HMM_InvA34(Affines[i])) \
+    X(HMM_InvRigidA34, AffineOut, HMM_InvRigidA34(Affines[i])) \
+    X(HMM_TransformPointA34, Vec3Out, HMM_TransformPointA34(Affines[i], Vec3s[i])) \
+    X(HMM_AddQ, QuatOut, HMM_AddQ(Quats[i], Quats[i + 1])) \
+    X(HMM_SubQ, QuatOut, HMM_SubQ(Quats[i], Quats[i + 1])) \
+    X(HMM_MulQ, QuatOut, HMM_MulQ(Quats[i], Quats[i + 1])) \
+    X(HMM_MulQF, QuatOut, HMM_MulQF(Quats[i], Floats[i])) \
+    X(HMM_DivQF, QuatOut, HMM_DivQF(Quats[i], Floats[i])) \
+    X(HMM_DotQ, FloatOut, HMM_DotQ(Quats[i], Quats[i + 1])) \
+    X(HMM_NormQ, QuatOut, HMM_NormQ(Quats[i])) \
+    X(HMM_NormFastQ, QuatOut, HMM_NormFastQ(Quats[i])) \
+    X(HMM_InvQ, QuatOut, HMM_InvQ(Quats[i])) \
+    X(HMM_NLerp, QuatOut, HMM_NLerp(Quats[i], Floats[i] * 0.1f, Quats[i + 1])) \
+    X(HMM_SLerp, QuatOut, HMM_SLerp(Quats[i], Floats[i] * 0.1f, Quats[i + 1])) \
+    X(HMM_QToM4, Mat4Out, HMM_QToM4(Quats[i])) \
+    X(HMM_QToM4Unit, Mat4Out, HMM_QToM4Unit(Quats[i])) \
+    X(HMM_RotateV3Q, Vec3Out, HMM_RotateV3Q(Vec3s[i], Quats[i])) \
+    X(HMM_Rotate_RH, Mat4Out, HMM_Rotate_RH(Floats[i], Vec4s[i].XYZ)) \
+    X(HMM_LookAt_RH, Mat4Out, HMM_LookAt_RH(Vec3s[i], Vec4s[i + 1].XYZ, HMM_V3(0.0f, 1.0f, 0.0f))) \
+    X(HMM_Perspective_RH_NO, Mat4Out, HMM_Perspective_RH_NO(Floats[i] * 0.5f, 1.5f, 0.1f, 100.0f)) \
+    X(HMM_SinSoA, FloatSoAOut, HMM_SinSoA(Vec3SoAs[i].Components[0])) \
+    X(HMM_SqrtSoA, FloatSoAOut, HMM_SqrtSoA(Vec3SoAs[i].Components[2])) \
+    X(HMM_AddV3SoA, Vec3SoAOut, HMM_AddV3SoA(Vec3SoAs[i], Vec3SoAs[i + 1])) \
+    X(HMM_CrossSoA, Vec3SoAOut, HMM_CrossSoA(Vec3SoAs[i], Vec3SoAs[i + 1])) \
+    X(HMM_NormV3SoA, Vec3SoAOut, HMM_NormV3SoA(Vec3SoAs[i])) \
+    X(HMM_RayTriangleSoA, MaskOut, HMM_RayTriangleSoA(Ray, 100.0f, &TriangleSoAs[i], &Vec3SoAOut[i].Components[0], &Vec3SoAOut[i].Components[1], &Vec3SoAOut[i].Components[2])) \
+    X(HMM_RayAABBSoA, MaskOut, HMM_RayAABBSoA(&RaySoAs[i], Boxes[i], &FloatSoAOut[i])) \
+    X(HMM_MulDM4V4, DVec4Out, HMM_MulDM4V4(DMat4s[i], DMat4s[i + 1].Columns[3])) \
+    X(HMM_TransposeDM4, DMat4Out, HMM_TransposeDM4(DMat4s[i])) \
+    X(HMM_MulDM4, DMat4Out, HMM_MulDM4(DMat4s[i], DMat4s[i + 1])) \
+    X(HMM_InvGeneralDM4, DMat4Out, HMM_InvGeneralDM4(DMat4s[i])) \
+    X(HMM_M4ToDM4, DMat4Out, HMM_M4ToDM4(Mat4s[i])) \
+    X(HMM_DM4ToM4, Mat4Out, HMM_DM4ToM4(DMat4s[i])) \
+    X(HMM_MulDQuat, DQuatOut, HMM_MulDQuat(DQuats[i], DQuats[i + 1])) \
+    X(HMM_SLerpDQuat, DQuatOut, HMM_SLerpDQuat(DQuats[i], Floats[i] * 0.1f, DQuats[i + 1])) \
+    X(HMM_DQuatToDM4, DMat4Out, HMM_DQuatToDM4(DQuats[i])) \
+    X(HMM_TRSToM4, Mat4Out, HMM_TRSToM4(TRSs[i])) \
+    X(HMM_TRSToInvM4, Mat4Out, HMM_TRSToInvM4(TRSs[i])) \
+    X(HMM_MulTRS, TRSOut, HMM_MulTRS(TRSs[i], TRSs[i + 1])) \
+    X(HMM_LerpTRS, TRSOut, HMM_LerpTRS(TRSs[i], Floats[i] * 0.1f, TRSs[i + 1]))
+
+#define HMM_BENCH_DEFINE_ELEMENT_CASE(Name, Out, Expression) \
+    static void Bench_##Name(int Operations) \
+    { \
+        int Done, i; \
+        for (Done = 0; Done < Operations; Done += N) \
+        { \
+            for (i = 0; i < N; ++i) \
+            { \
+                Out[i] = (Expression); \
+            } \
+            HMM_BENCH_ESCAPE(Out); \
+        } \
+    }
+
+HMM_BENCH_ELEMENT_CASES(HMM_BENCH_DEFINE_ELEMENT_CASE)
+
+/* Batch functions: one call over all N inputs counts as N operations. */
+#define HMM_BENCH_BATCH_CASES(X) \
+    X(HMM_MulM4V4Array, Vec4Out, HMM_MulM4V4Array(Mat4s[0], Vec4s, 0, Vec4Out, 0, N)) \
+    X(HMM_MulQArray, QuatOut, HMM_MulQArray(Quats, Quats + 1, QuatOut, N)) \
+    X(HMM_NormQArray, QuatOut, HMM_NormQArray(Quats, QuatOut, N)) \
+    X(HMM_MulM3V3Array, Vec3Out, HMM_MulM3V3Array(Mat3s[0], Vec3s, Vec3Out, N)) \
+    X(HMM_MulA34Array, AffineOut, HMM_MulA34Array(Affines, Affines + 1, AffineOut, N)) \
+    X(HMM_TransformPointA34Array, Vec3Out, HMM_TransformPointA34Array(Affines[0], Vec3s, Vec3Out, N)) \
+    X(HMM_NLerpArray, QuatOut, HMM_NLerpArray(Quats, Floats, Quats + 1, QuatOut, N)) \
+    X(HMM_SLerpArray, QuatOut, HMM_SLerpArray(Quats, Floats, Quats + 1, QuatOut, N)) \
+    X(HMM_SkinV3Array, Vec3Out, HMM_SkinV3Array(Mat4s, Bones, Weights, Vec3s, Vec3s, Vec3Out, NormalOut, N)) \
+    X(HMM_SkinV4ArrayStream, Vec4Out, HMM_SkinV4ArrayStream(Mat4s, Bones, Weights, Vec3s, Vec3s, Vec4Out, Vec4NormalOut, N)) \
+    X(HMM_SkinDQV3Array, Vec3Out, HMM_SkinDQV3Array(DualQuats, Bones, Weights, Vec3s, Vec3s, Vec3Out, NormalOut, N)) \
+    X(HMM_FrustumTestSphereSoA, VisibleOut, HMM_FrustumTestSphereSoA(Frustum, Vec3SoAs, RadiiSoA, VisibleOut, N)) \
+    X(HMM_FrustumTestAABBSoA, VisibleOut, HMM_FrustumTestAABBSoA(Frustum, Vec3SoAs, BoxMaxsSoA, VisibleOut, N)) \
+    X(HMM_TransformAABBArray, BoxOut, HMM_TransformAABBArray(Mat4s[0], Boxes, BoxOut, N)) \
+    X(HMM_TransformSphereArray, SphereOut, HMM_TransformSphereArray(Mat4s[0], Spheres, SphereOut, N)) \
+    X(HMM_MergeAABBArray, BoxOut, BoxOut[0] = HMM_MergeAABBArray(Boxes, N)) \
+    X(HMM_AABBOverlapArray, VisibleOut, HMM_AABBOverlapArray(Boxes[0], Boxes, VisibleOut, N)) \
+    X(HMM_V3ArrayToSoA, Vec3SoAOut, HMM_V3ArrayToSoA(Vec3s, Vec3SoAOut, N)) \
+    X(HMM_SoAToV3Array, Vec3Out, HMM_SoAToV3Array(Vec3SoAs, Vec3Out, N)) \
+    X(HMM_CameraRelativeV3Array, Vec3Out, HMM_CameraRelativeV3Array(DVec3s, Camera, Vec3Out, N)) \
+    X(HMM_CameraRelativeModelViewArray, Mat4Out, HMM_CameraRelativeModelViewArray(Mat4s[N], Camera, DVec3s, Mat4s, Mat4Out, N)) \
+    X(HMM_UpdateHierarchyA34, AffineOut, HMM_UpdateHierarchyA34(Parents, Affines, 0, AffineOut, 0, N)) \
+    X(HMM_UpdateHierarchyM4, Mat4Out, HMM_UpdateHierarchyM4(Parents, Mat4s, 0, Mat4Out, 0, N)) \
+    X(HMM_UpdateHierarchyDirty, AffineOut, HMM_UpdateHierarchyA34(Parents, Affines, HierarchyDirty, AffineOut, 0, N)) \
+    X(HMM_TRSToM4Array, Mat4Out, HMM_TRSToM4Array(TRSs, Mat4Out, N)) \
+    X(HMM_QToM4UnitArray, Mat4Out, HMM_QToM4UnitArray(Quats, Mat4Out, N)) \
+    X(HMM_SampleV3Tracks, Vec3Out, HMM_SampleV3Tracks(KeyOffsets, KeyTimes, KeyVec3s, N, 1.7f, Cursors, Vec3Out)) \
+    X(HMM_SampleQTracks, QuatOut, HMM_SampleQTracks(KeyOffsets, KeyTimes, KeyQuats, N, 1.7f, Cursors, QuatOut)) \
+    X(HMM_UnpackQ32Array, QuatOut, HMM_UnpackQ32Array(PackedQuat32s, QuatOut, N)) \
+    X(HMM_UnpackQ48Array, QuatOut, HMM_UnpackQ48Array(PackedQuat48s, QuatOut, N)) \
+    X(HMM_UnpackHalfV3Array, Vec3Out, HMM_UnpackHalfV3Array(HalfVec3s, Vec3Out, N)) \
+    X(HMM_UnpackFixedV3Array, Vec3Out, HMM_UnpackFixedV3Array(FixedVec3s, FixedMin, FixedMax, Vec3Out, N)) \
+    X(HMM_UnpackOctV3Array, Vec3Out, HMM_UnpackOctV3Array(OctVec3s, Vec3Out, N))
+
+#define HMM_BENCH_DEFINE_BATCH_CASE(Name, Out, Call) \
+    static void Bench_##Name(int Operations) \
+    { \
+        int Done; \
+        for (Done = 0; Done < Operations; Done += N) \
+        { \
+            Call; \
+            HMM_BENCH_ESCAPE(Out); \
+        } \
+    }
+
+HMM_BENCH_BATCH_CASES(HMM_BENCH_DEFINE_BATCH_CASE)
+
+#define HMM_BENCH_CASE_ENTRY(Name, Out, Expression) { #Name, Bench_##Name },
+
+const HMMBenchCase HMM_BENCH_VARIANT(HMMBench_Cases)[] = {
+    HMM_BENCH_ELEMENT_CASES(HMM_BENCH_CASE_ENTRY)
+    HMM_BENCH_BATCH_CASES(HMM_BENCH_CASE_ENTRY)
+};
+
+const int HMM_BENCH_VARIANT(HMMBench_CaseCount) = sizeof(HMM_BENCH_VARIANT(HMMBench_Cases)) / sizeof(HMM_BENCH_VARIANT(HMMBench_Cases)[0]);
+
+static unsigned int RandomState;
+
+static float RandomFloat(float Min, float Max)
+{
+    return HMMTest_Random(&RandomState, Min, Max);
+}
+
+void HMM_BENCH_VARIANT(HMMBench_Init)(unsigned int Seed)
+{
+    int i, Column, Row, Lane;
+    RandomState = Seed;
+
+    for (i = 0; i < N + 1; ++i)
+    {
+        Floats[i] = RandomFloat(0.5f, 4.0f);
+        Vec4s[i] = HMM_V4(RandomFloat(-10.0f, 10.0f), RandomFloat(-10.0f, 10.0f), RandomFloat(-10.0f, 10.0f), RandomFloat(0.5f, 2.0f));
+        Quats[i] = HMM_NormQ(HMM_Q(RandomFloat(-1.0f, 1.0f), RandomFloat(-1.0f, 1.0f), RandomFloat(-1.0f, 1.0f), RandomFloat(0.5f, 1.0f)));
+
+        /* Diagonally dominant, so always invertible */
+        for (Column = 0; Column < 4; ++Column)
+        {
+            for (Row = 0; Row < 4; ++Row)
+            {
+                Mat4s[i].Elements[Column][Row] = (Column == Row) ? RandomFloat(4.0f, 8.0f) : RandomFloat(-1.0f, 1.0f);
+                if (Column < 3 && Row < 3)
+                {
+                    Mat3s[i].Elements[Column][Row] = Mat4s[i].Elements[Column][Row];
+                }
+            }
+        }
+        Affines[i] = HMM_M4ToA34(Mat4s[i]);
+        DMat4s[i] = HMM_M4ToDM4(Mat4s[i]);
+        DQuats[i] = HMM_QToDQuat(Quats[i]);
+        TRSs[i] = HMM_TRSFrom(Vec4s[i].XYZ, Quats[i], HMM_V3(Floats[i], Vec4s[i].W, 1.0f));
+
+        for (Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+        {
+            Vec3SoAs[i].X.Elements[Lane] = RandomFloat(-10.0f, 10.0f);
+            Vec3SoAs[i].Y.Elements[Lane] = RandomFloat(-10.0f, 10.0f);
+            Vec3SoAs[i].Z.Elements[Lane] = RandomFloat(0.5f, 10.0f);
+            if (i < N)
+            {
+                RadiiSoA[i].Elements[Lane] = RandomFloat(0.1f, 2.0f);
+                BoxMaxsSoA[i].X.Elements[Lane] = Vec3SoAs[i].X.Elements[Lane] + RandomFloat(0.1f, 2.0f);
+                BoxMaxsSoA[i].Y.Elements[Lane] = Vec3SoAs[i].Y.Elements[Lane] + RandomFloat(0.1f, 2.0f);
+                BoxMaxsSoA[i].Z.Elements[Lane] = Vec3SoAs[i].Z.Elements[Lane] + RandomFloat(0.1f, 2.0f);
+            }
+        }
+    }
+
+    for (i = 0; i < N; ++i)
+    {
+        Vec3s[i] = Vec4s[i].XYZ;
+        /* Sixteen trees in depth-first order, each node a child of the node before it or one of that
+           node's nearest ancestors. One node in 32 is dirty. */
+        Parents[i] = (i % 16 == 0) ? -1 : i - 1;
+        for (Row = (int)RandomFloat(0.0f, 3.0f); Row > 0 && Parents[i] >= 0 && Parents[Parents[i]] >= 0; --Row)
+        {
+            Parents[i] = Parents[Parents[i]];
+        }
+        HierarchyDirty[i] = (i % 32 == 7);
+        DVec3s[i] = HMM_AddDV3(HMM_DV3(6.4e9, -3.1e8, 1.7e7), HMM_V3ToDV3(Vec3s[i]));
+
+        /* Palette of 64 bones */
+        for (Lane = 0; Lane < 4; ++Lane)
+        {
+            Bones[4 * i + Lane] = (unsigned short)RandomFloat(0.0f, 64.0f);
+        }
+        Weights[i] = HMM_V4(0.4f, 0.3f, 0.2f, 0.1f);
+
+        Boxes[i].Min = HMM_SubV3(Vec3s[i], HMM_V3(RandomFloat(0.1f, 4.0f), RandomFloat(0.1f, 4.0f), RandomFloat(0.1f, 4.0f)));
+        Boxes[i].Max = HMM_AddV3(Vec3s[i], HMM_V3(RandomFloat(0.1f, 4.0f), RandomFloat(0.1f, 4.0f), RandomFloat(0.1f, 4.0f)));
+        Spheres[i].Center = Vec3s[i];
+        Spheres[i].Radius = RandomFloat(0.1f, 4.0f);
+
+        for (Lane = 0; Lane < HMM_SOA_WIDTH; ++Lane)
+        {
+            for (Column = 0; Column < 3; ++Column)
+            {
+                TriangleSoAs[i].Vertex0.Components[Column].Elements[Lane] = RandomFloat(-2.0f, 2.0f);
+                TriangleSoAs[i].Edge1.Components[Column].Elements[Lane] = RandomFloat(-2.0f, 2.0f);
+                TriangleSoAs[i].Edge2.Components[Column].Elements[Lane] = RandomFloat(-2.0f, 2.0f);
+                RaySoAs[i].Origin.Components[Column].Elements[Lane] = RandomFloat(-20.0f, 20.0f);
+                RaySoAs[i].InvDirection.Components[Column].Elements[Lane] = 1.0f / RandomFloat(0.1f, 1.0f);
+            }
+            RaySoAs[i].MaxT.Elements[Lane] = 100.0f;
+        }
+    }
+
+    /* One track per input, each with eight keys a quarter of a second apart */
+    for (i = 0; i < N; ++i)
+    {
+        KeyOffsets[i] = 8 * i;
+        for (Lane = 0; Lane < 8; ++Lane)
+        {
+            KeyTimes[8 * i + Lane] = 0.25f * Lane;
+            KeyVec3s[8 * i + Lane] = Vec4s[(i + Lane) % N].XYZ;
+            KeyQuats[8 * i + Lane] = Quats[(i + Lane) % N];
+        }
+    }
+    KeyOffsets[N] = 8 * N;
+
+    FixedMin = HMM_V3(-20.0f, -20.0f, -20.0f);
+    FixedMax = HMM_V3(20.0f, 20.0f, 20.0f);
+    for (i = 0; i < N; ++i)
+    {
+        PackedQuat32s[i] = HMM_PackQ32(Quats[i]);
+        PackedQuat48s[i] = HMM_PackQ48(Quats[i]);
+        HalfVec3s[i] = HMM_PackHalfV3(Vec3s[i]);
+        FixedVec3s[i] = HMM_PackFixedV3(Vec3s[i], FixedMin, FixedMax);
+        OctVec3s[i] = HMM_PackOctV3(HMM_NormV3(Vec3s[i]));
+    }
+
+    Camera = HMM_DV3(6.4e9 + 0.5, -3.1e8 - 0.5, 1.7e7 + 2.0);
+
+    Ray.Origin = HMM_V3(0.0f, 0.0f, -5.0f);
+    Ray.Direction = HMM_V3(0.1f, 0.05f, 1.0f);
+
+    /* Sees roughly half of the SoA points */
+    Frustum = HMM_FrustumFromM4_ZO(HMM_MulM4(HMM_Perspective_RH_ZO(HMM_AngleDeg(60.0f), 1.0f, 0.1f, 100.0f),
+                                             HMM_LookAt_RH(HMM_V3(0.0f, 0.0f, -5.0f), HMM_V3(0.0f, 0.0f, 5.0f), HMM_V3(0.0f, 1.0f, 0.0f))));
+
+    for (i = 0; i < 64; ++i)
+    {
+        DualQuats[i] = HMM_DQFromQV3(Quats[i], Vec3s[i]);
+    }
+}
+
+const char *HMM_BENCH_VARIANT(HMMBench_Tier)(void)
+{
+    switch (HMM_GetSIMDTier())
+    {
+        case HMM_SIMD_TIER_NEON: return "NEON";
+        case HMM_SIMD_TIER_SSE: return "SSE";
+        case HMM_SIMD_TIER_AVX: return "AVX";
+        case HMM_SIMD_TIER_AVX2: return "AVX2";
+        case HMM_SIMD_TIER_AVX512: return "AVX-512";
+        default: return "none";
+    }
+}
@@ -0,0 +1,16 @@
+#ifndef HMM_RANDOM_H
+#define HMM_RANDOM_H
+
+/*
+ * The linear congruential generator the tests and benchmarks draw their
+ * inputs from. It is seeded by the caller, so every run sees the same values.
+ */
+
+// Uniform in [Min, Max)
+static inline float HMMTest_Random(unsigned int *State, float Min, float Max)
+{
+    *State = *State * 1664525u + 1013904223u;
+    return Min + (Max - Min) * (float)(*State >> 8) * (1.0f / 16777216.0f);
+}
+
+#endif
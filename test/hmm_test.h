@@ -9,7 +9,13 @@
 #include "categories/ScalarMath.h"
 #include "categories/Initialization.h"
 #include "categories/VectorOps.h"
+#include "categories/Vec3A.h"
 #include "categories/MatrixOps.h"
+#include "categories/Affine.h"
+#include "categories/Hierarchy.h"
+#include "categories/Frustum.h"
+#include "categories/BoundingVolume.h"
+#include "categories/Ray.h"
 #include "categories/QuaternionOps.h"
 #include "categories/Addition.h"
 #include "categories/Subtraction.h"
@@ -19,3 +25,12 @@
 #include "categories/Projection.h"
 #include "categories/Transformation.h"
 #include "categories/SSE.h"
+#include "categories/SoA.h"
+#include "categories/Skinning.h"
+#include "categories/DualQuaternion.h"
+#include "categories/TRS.h"
+#include "categories/Animation.h"
+#include "categories/Compression.h"
+#include "categories/Double.h"
+#include "categories/CameraRelative.h"
+#include "categories/Dispatch.h"